@@ -33,6 +33,7 @@ struct ezFileStats;
 class ezAssetProcessorLog;
 class ezFileSystemWatcher;
 class ezAssetTableWriter;
+class ezAssetTransformCache;
 struct ezFileChangedEvent;
 class ezFileSystemModel;
 
@@ -236,6 +237,9 @@ public:
   /// \brief Writes the asset lookup table for the given platform, or the currently active platform if nullptr is passed.
   ezResult WriteAssetTables(const ezPlatformProfile* pAssetProfile = nullptr, bool bForce = false);
 
+  /// \brief The cache from which transform outputs are restored before an asset is transformed. Configured through the '-TransformCache' and '-SharedTransformCache' command line options.
+  ezAssetTransformCache& GetTransformCache() { return *m_pTransformCache; }
+
   ///@}
   /// \name Asset Access
   ///@{
@@ -452,6 +456,7 @@ private:
   // Immutable data after StartInitialize
   ezApplicationFileSystemConfig m_FileSystemConfig;
   ezUniquePtr<ezAssetTableWriter> m_pAssetTableWriter;
+  ezUniquePtr<ezAssetTransformCache> m_pTransformCache;
   ezSet<ezString> m_ValidAssetExtensions;
 
   // Update task
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <EditorFramework/EditorFrameworkDLL.h>
+
+#include <Foundation/Containers/DynamicArray.h>
+#include <Foundation/Strings/String.h>
+#include <Foundation/Threading/AtomicInteger.h>
+#include <Foundation/Types/UniquePtr.h>
+
+struct ezAssetInfo;
+class ezPlatformProfile;
+
+/// \brief Storage interface for the ezAssetTransformCache.
+///
+/// Keys are relative file paths that are unique for the content of the file. A backend therefore never needs to
+/// invalidate entries, once an entry exists it stays valid forever.
+class EZ_EDITORFRAMEWORK_DLL ezAssetTransformCacheBackend
+{
+public:
+  virtual ~ezAssetTransformCacheBackend() = default;
+
+  /// \brief Used for logging only.
+  virtual ezStringView GetName() const = 0;
+
+  virtual bool Contains(ezStringView sKey) const = 0;
+
+  /// \brief Copies the cached file into sAbsTargetFile. Fails if the cache doesn't contain the key.
+  virtual ezResult Fetch(ezStringView sKey, ezStringView sAbsTargetFile) const = 0;
+
+  /// \brief Adds a copy of sAbsSourceFile to the cache. Must be safe to call from multiple processes at the same time.
+  virtual ezResult Store(ezStringView sKey, ezStringView sAbsSourceFile) = 0;
+};
+
+/// \brief Stores cache entries as individual files below a root directory. Works for local and shared (network) folders.
+class EZ_EDITORFRAMEWORK_DLL ezAssetTransformCacheDirectoryBackend : public ezAssetTransformCacheBackend
+{
+public:
+  ezAssetTransformCacheDirectoryBackend(ezStringView sRootDirectory);
+
+  ezStringView GetRootDirectory() const { return m_sRootDirectory; }
+
+  virtual ezStringView GetName() const override { return m_sRootDirectory; }
+  virtual bool Contains(ezStringView sKey) const override;
+  virtual ezResult Fetch(ezStringView sKey, ezStringView sAbsTargetFile) const override;
+  virtual ezResult Store(ezStringView sKey, ezStringView sAbsSourceFile) override;
+
+private:
+  ezString m_sRootDirectory;
+};
+
+/// \brief Content addressed cache for asset transform outputs.
+///
+/// Entries are keyed by the asset hash (which already covers the content of the asset document, all its transform dependencies and the
+/// asset profile settings), the asset type version and, for profile specific assets, the platform profile name.
+/// Before an asset is transformed, the curator tries to restore all of its outputs from the cache, after a successful transform the
+/// outputs are pushed into the cache.
+///
+/// The cache consists of an optional local directory and an optional shared backend. Hits in the shared backend are copied into the local
+/// directory, new outputs are stored in both.
+class EZ_EDITORFRAMEWORK_DLL ezAssetTransformCache
+{
+public:
+  ezAssetTransformCache();
+  ~ezAssetTransformCache();
+
+  struct Statistics
+  {
+    ezUInt32 m_uiLocalHits = 0;
+    ezUInt32 m_uiSharedHits = 0;
+    ezUInt32 m_uiMisses = 0;
+    ezUInt32 m_uiStored = 0;
+  };
+
+  /// \brief Sets up the local directory and the shared directory from the '-TransformCache' and '-SharedTransformCache' command line options.
+  void ConfigureFromCommandLine();
+
+  /// \brief Sets the local cache directory. An empty string disables the local cache.
+  void SetLocalDirectory(ezStringView sDirectory);
+  ezStringView GetLocalDirectory() const;
+
+  /// \brief Uses a directory that is shared between multiple machines (e.g. a network folder) as the shared backend. An empty string disables it.
+  void SetSharedDirectory(ezStringView sDirectory);
+
+  /// \brief Returns the directory passed to SetSharedDirectory(), empty if no shared directory or a custom backend is used.
+  ezStringView GetSharedDirectory() const { return m_sSharedDirectory; }
+
+  /// \brief Sets a custom backend that is shared between multiple machines, e.g. a web service.
+  void SetSharedBackend(ezUniquePtr<ezAssetTransformCacheBackend>&& pBackend);
+
+  bool IsEnabled() const { return m_pLocal != nullptr || m_pShared != nullptr; }
+
+  /// \brief Copies all outputs of the asset from the cache into the asset cache folder of its data directory.
+  ///
+  /// Only succeeds if every required file was found. The thumbnail is only required for asset types that create it during the transform.
+  /// Restored outputs whose asset header doesn't match uiAssetHash are deleted again and count as a miss.
+  ezResult RestoreOutputs(ezAssetInfo* pAssetInfo, const ezPlatformProfile* pAssetProfile, ezUInt64 uiAssetHash, ezUInt64 uiThumbHash);
+
+  /// \brief Pushes all outputs of the asset into the cache. Must only be called when the outputs are up to date with the given hashes.
+  void StoreOutputs(ezAssetInfo* pAssetInfo, const ezPlatformProfile* pAssetProfile, ezUInt64 uiAssetHash, ezUInt64 uiThumbHash);
+
+  Statistics GetStatistics() const;
+  void LogStatistics() const;
+
+private:
+  struct CacheFile
+  {
+    ezString m_sKey;
+    ezString m_sAbsPath;
+    ezString m_sOutputTag;
+    bool m_bRequired = true;
+    bool m_bIsThumbnail = false;
+  };
+
+  void GatherFiles(ezAssetInfo* pAssetInfo, const ezPlatformProfile* pAssetProfile, ezUInt64 uiAssetHash, ezUInt64 uiThumbHash, ezDynamicArray<CacheFile>& out_files) const;
+  bool IsValidOutput(const CacheFile& file, ezAssetInfo* pAssetInfo, ezUInt64 uiAssetHash) const;
+
+  /// \brief Restores the file from the local or the shared backend. Entries that don't match the asset hash are ignored.
+  ezResult FetchFile(const CacheFile& file, ezAssetInfo* pAssetInfo, ezUInt64 uiAssetHash, bool& out_bFromShared) const;
+
+  ezUniquePtr<ezAssetTransformCacheDirectoryBackend> m_pLocal;
+  ezUniquePtr<ezAssetTransformCacheBackend> m_pShared;
+  ezString m_sSharedDirectory;
+
+  ezAtomicInteger32 m_iLocalHits;
+  ezAtomicInteger32 m_iSharedHits;
+  ezAtomicInteger32 m_iMisses;
+  ezAtomicInteger32 m_iStored;
+};
@@ -4,6 +4,7 @@
 #include <EditorFramework/Assets/AssetDocument.h>
 #include <EditorFramework/Assets/AssetProcessor.h>
 #include <EditorFramework/Assets/AssetTableWriter.h>
+#include <EditorFramework/Assets/AssetTransformCache.h>
 #include <EditorFramework/EditorApp/EditorApp.moc.h>
 #include <Foundation/Configuration/SubSystem.h>
 #include <Foundation/IO/FileSystem/DeferredFileWriter.h>
@@ -98,6 +99,7 @@ void ezSubAsset::GetSubAssetIdentifier(ezStringBuilder& out_sPath) const
 ezAssetCurator::ezAssetCurator()
   : m_SingletonRegistrar(this)
 {
+  m_pTransformCache = EZ_DEFAULT_NEW(ezAssetTransformCache);
 }
 
 ezAssetCurator::~ezAssetCurator()
@@ -135,6 +137,7 @@ void ezAssetCurator::StartInitialize(const ezApplicationFileSystemConfig& cfg)
   ezFileSystemModel::GetSingleton()->Initialize(m_FileSystemConfig, std::move(referencedFiles), std::move(referencedFolders));
 
   m_pAssetTableWriter = EZ_DEFAULT_NEW(ezAssetTableWriter, m_FileSystemConfig);
+  m_pTransformCache->ConfigureFromCommandLine();
 
   ezSharedPtr<ezDelegateTask<void>> pInitTask = EZ_DEFAULT_NEW(ezDelegateTask<void>, "AssetCuratorUpdateCache", ezTaskNesting::Never, [this]()
     {
@@ -1519,6 +1522,24 @@ ezTransformStatus ezAssetCurator::ProcessAsset(ezAssetInfo* pAssetInfo, const ez
     return ezTransformStatus(ezFmt("Missing dependency for asset '{0}', can't transform.", pAssetInfo->m_Path.GetAbsolutePath()));
   }
 
+  const bool bNeedsTransform = state == ezAssetInfo::TransformState::NeedsTransform || (state == ezAssetInfo::TransformState::NeedsThumbnail && assetFlags.IsSet(ezAssetDocumentFlags::AutoThumbnailOnTransform));
+
+  // Restoring the outputs from the transform cache saves us from opening the document at all.
+  if (bNeedsTransform && !transformFlags.IsSet(ezTransformFlags::ForceTransform) && m_pTransformCache->IsEnabled())
+  {
+    if (m_pTransformCache->RestoreOutputs(pAssetInfo, pAssetProfile, uiHash, uiThumbHash).Succeeded())
+    {
+      NotifyOfAssetChange(pAssetInfo->m_Info->m_DocumentID);
+
+      NeedsReloadResources(pAssetInfo->m_Info->m_DocumentID);
+
+      // If only the thumbnail is still missing, the code below creates it like after a regular transform.
+      state = IsAssetUpToDate(pAssetInfo->m_Info->m_DocumentID, pAssetProfile, pTypeDesc, uiHash, uiThumbHash, uiPackageHash);
+      if (state == ezAssetInfo::TransformState::UpToDate)
+        return ezStatus(EZ_SUCCESS);
+    }
+  }
+
   // does the document already exist and is open ?
   bool bWasOpen = false;
   ezDocument* pDoc = pTypeDesc->m_pManager->GetDocumentByPath(pAssetInfo->m_Path);
@@ -1533,12 +1554,14 @@ ezTransformStatus ezAssetCurator::ProcessAsset(ezAssetInfo* pAssetInfo, const ez
   EZ_SCOPE_EXIT(if (!pDoc->HasWindowBeenRequested() && !bWasOpen) pDoc->GetDocumentManager()->CloseDocument(pDoc););
 
   ezTransformStatus ret;
+  bool bTransformed = false;
   ezAssetDocument* pAsset = static_cast<ezAssetDocument*>(pDoc);
   if (state == ezAssetInfo::TransformState::NeedsTransform || (state == ezAssetInfo::TransformState::NeedsThumbnail && assetFlags.IsSet(ezAssetDocumentFlags::AutoThumbnailOnTransform)) || (transformFlags.IsSet(ezTransformFlags::TriggeredManually) && state == ezAssetInfo::TransformState::NeedsImport))
   {
     ret = pAsset->TransformAsset(transformFlags, pAssetProfile);
     if (ret.Succeeded())
     {
+      bTransformed = true;
       m_pAssetTableWriter->NeedsReloadResource(pAsset->GetGuid());
 
       for (auto& subAssetUuid : pAssetInfo->m_SubAssets)
@@ -1573,6 +1596,16 @@ ezTransformStatus ezAssetCurator::ProcessAsset(ezAssetInfo* pAssetInfo, const ez
     }
   }
 
+  if (bTransformed && ret.Succeeded() && m_pTransformCache->IsEnabled())
+  {
+    // The transform may have modified the document, so only cache the outputs if they match the current state.
+    const ezAssetInfo::TransformState stateAfter = IsAssetUpToDate(pAssetInfo->m_Info->m_DocumentID, pAssetProfile, pTypeDesc, uiHash, uiThumbHash, uiPackageHash);
+    if (stateAfter == ezAssetInfo::TransformState::UpToDate || stateAfter == ezAssetInfo::TransformState::NeedsThumbnail)
+    {
+      m_pTransformCache->StoreOutputs(pAssetInfo, pAssetProfile, uiHash, uiThumbHash);
+    }
+  }
+
   return ret;
 }
 
@@ -3,6 +3,7 @@
 #include <EditorFramework/Assets/AssetCurator.h>
 #include <EditorFramework/Assets/AssetProcessor.h>
 #include <EditorFramework/Assets/AssetProcessorMessages.h>
+#include <EditorFramework/Assets/AssetTransformCache.h>
 #include <EditorFramework/Preferences/EditorPreferences.h>
 #include <Foundation/Configuration/SubSystem.h>
 #include <GameEngine/GameApplication/GameApplication.h>
@@ -252,6 +253,23 @@ ezResult ezProcessTask::StartProcess()
     args << sAbsoluteData.GetData();
   }
 
+  {
+    // background processors have to use the same transform cache as the editor
+    const ezAssetTransformCache& cache = ezAssetCurator::GetSingleton()->GetTransformCache();
+
+    if (!cache.GetLocalDirectory().IsEmpty())
+    {
+      args << "-TransformCache";
+      args << cache.GetLocalDirectory().GetData(tmp);
+    }
+
+    if (!cache.GetSharedDirectory().IsEmpty())
+    {
+      args << "-SharedTransformCache";
+      args << cache.GetSharedDirectory().GetData(tmp);
+    }
+  }
+
 #if EZ_ENABLED(EZ_PLATFORM_WINDOWS)
   const char* EditorProcessorExecutable = "ezEditorProcessor.exe";
 #else
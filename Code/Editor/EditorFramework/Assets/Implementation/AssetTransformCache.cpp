@@ -0,0 +1,351 @@
+#include <EditorFramework/EditorFrameworkPCH.h>
+
+#include <EditorFramework/Assets/AssetCurator.h>
+#include <EditorFramework/Assets/AssetTransformCache.h>
+#include <Foundation/IO/OSFile.h>
+#include <Foundation/Utilities/CommandLineOptions.h>
+#include <GuiFoundation/UIServices/ImageCache.moc.h>
+
+// Change this to invalidate all existing cache entries, e.g. when the way the keys are computed changes.
+#define EZ_TRANSFORM_CACHE_VERSION 1
+
+ezCommandLineOptionPath opt_TransformCache("_Editor", "-TransformCache", "Local directory in which asset transform outputs are cached by their content hash.\nAssets whose outputs are found in the cache are not transformed again.", "");
+ezCommandLineOptionPath opt_SharedTransformCache("_Editor", "-SharedTransformCache", "Directory that is shared between multiple machines (e.g. a network folder) in which asset transform outputs are cached by their content hash.\nHits are copied into the local transform cache, if one is set.", "");
+
+ezAssetTransformCacheDirectoryBackend::ezAssetTransformCacheDirectoryBackend(ezStringView sRootDirectory)
+{
+  ezStringBuilder sRoot = sRootDirectory;
+  sRoot.MakeCleanPath();
+  m_sRootDirectory = sRoot;
+}
+
+bool ezAssetTransformCacheDirectoryBackend::Contains(ezStringView sKey) const
+{
+  ezStringBuilder sPath = m_sRootDirectory;
+  sPath.AppendPath(sKey);
+  return ezOSFile::ExistsFile(sPath);
+}
+
+ezResult ezAssetTransformCacheDirectoryBackend::Fetch(ezStringView sKey, ezStringView sAbsTargetFile) const
+{
+  ezStringBuilder sPath = m_sRootDirectory;
+  sPath.AppendPath(sKey);
+
+  if (!ezOSFile::ExistsFile(sPath))
+    return EZ_FAILURE;
+
+  if (ezOSFile::CopyFile(sPath, sAbsTargetFile).Failed())
+  {
+    // don't leave a partially written output behind
+    ezOSFile::DeleteFile(sAbsTargetFile).IgnoreResult();
+    return EZ_FAILURE;
+  }
+
+  return EZ_SUCCESS;
+}
+
+ezResult ezAssetTransformCacheDirectoryBackend::Store(ezStringView sKey, ezStringView sAbsSourceFile)
+{
+  ezStringBuilder sPath = m_sRootDirectory;
+  sPath.AppendPath(sKey);
+
+  // entries never change, so if another process already stored it, we are done
+  if (ezOSFile::ExistsFile(sPath))
+    return EZ_SUCCESS;
+
+  // copy into a uniquely named file first and then move it into place, so that other processes never see partial files
+  ezStringBuilder sTemp, sGuid;
+  sTemp.SetFormat("{}.{}.tmp", sPath, ezConversionUtils::ToString(ezUuid::MakeUuid(), sGuid));
+
+  if (ezOSFile::CopyFile(sAbsSourceFile, sTemp).Failed())
+  {
+    ezOSFile::DeleteFile(sTemp).IgnoreResult();
+    return EZ_FAILURE;
+  }
+
+  if (ezOSFile::MoveFileOrDirectory(sTemp, sPath).Failed())
+  {
+    ezOSFile::DeleteFile(sTemp).IgnoreResult();
+    return ezOSFile::ExistsFile(sPath) ? EZ_SUCCESS : EZ_FAILURE;
+  }
+
+  return EZ_SUCCESS;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+ezAssetTransformCache::ezAssetTransformCache() = default;
+ezAssetTransformCache::~ezAssetTransformCache() = default;
+
+void ezAssetTransformCache::ConfigureFromCommandLine()
+{
+  SetLocalDirectory(opt_TransformCache.GetOptionValue(ezCommandLineOption::LogMode::FirstTimeIfSpecified));
+
+  SetSharedDirectory(opt_SharedTransformCache.GetOptionValue(ezCommandLineOption::LogMode::FirstTimeIfSpecified));
+}
+
+void ezAssetTransformCache::SetLocalDirectory(ezStringView sDirectory)
+{
+  if (sDirectory.IsEmpty())
+  {
+    m_pLocal.Clear();
+    return;
+  }
+
+  m_pLocal = EZ_DEFAULT_NEW(ezAssetTransformCacheDirectoryBackend, sDirectory);
+}
+
+ezStringView ezAssetTransformCache::GetLocalDirectory() const
+{
+  return m_pLocal ? m_pLocal->GetRootDirectory() : ezStringView();
+}
+
+void ezAssetTransformCache::SetSharedDirectory(ezStringView sDirectory)
+{
+  if (sDirectory.IsEmpty())
+  {
+    SetSharedBackend(nullptr);
+    return;
+  }
+
+  m_pShared = EZ_DEFAULT_NEW(ezAssetTransformCacheDirectoryBackend, sDirectory);
+  m_sSharedDirectory = m_pShared->GetName();
+}
+
+void ezAssetTransformCache::SetSharedBackend(ezUniquePtr<ezAssetTransformCacheBackend>&& pBackend)
+{
+  m_pShared = std::move(pBackend);
+  m_sSharedDirectory.Clear();
+}
+
+void ezAssetTransformCache::GatherFiles(ezAssetInfo* pAssetInfo, const ezPlatformProfile* pAssetProfile, ezUInt64 uiAssetHash, ezUInt64 uiThumbHash, ezDynamicArray<CacheFile>& out_files) const
+{
+  const ezAssetDocumentTypeDescriptor* pTypeDesc = pAssetInfo->m_pDocumentTypeDescriptor;
+  ezAssetDocumentManager* pManager = pAssetInfo->GetManager();
+  const ezPlatformProfile* pProfile = ezAssetDocumentManager::DetermineFinalTargetProfile(pAssetProfile);
+  const ezString& sDocumentPath = pAssetInfo->m_Path.GetAbsolutePath();
+  const ezUInt32 uiTypeVersion = pTypeDesc->m_pDocumentType->GetTypeVersion();
+
+  auto MakeKey = [&](ezUInt64 uiHash, bool bProfileSpecific, ezStringView sFileName, ezStringBuilder& out_sKey)
+  {
+    ezUInt64 uiKey = ezHashingUtils::xxHash64String(pTypeDesc->m_sDocumentTypeName, EZ_TRANSFORM_CACHE_VERSION);
+    uiKey = ezHashingUtils::xxHash64(&uiHash, sizeof(uiHash), uiKey);
+    uiKey = ezHashingUtils::xxHash64(&uiTypeVersion, sizeof(uiTypeVersion), uiKey);
+
+    if (bProfileSpecific)
+    {
+      uiKey = ezHashingUtils::xxHash64String(pProfile->GetConfigName(), uiKey);
+    }
+
+    ezStringBuilder sHex;
+    sHex.SetFormat("{}", ezArgU(uiKey, 16, true, 16));
+
+    // spread the entries over multiple folders, to keep the number of files per folder low
+    out_sKey.SetFormat("{}/{}/{}", sHex.GetView().GetSubString(0, 2), sHex, sFileName);
+  };
+
+  ezStringBuilder sKey, sFileName, sValidTag;
+
+  auto AddOutput = [&](ezStringView sOutputTag)
+  {
+    CacheFile& file = out_files.ExpandAndGetRef();
+    file.m_sAbsPath = pManager->GetAbsoluteOutputFileName(pTypeDesc, sDocumentPath, sOutputTag, pProfile);
+    file.m_sOutputTag = sOutputTag;
+
+    if (sOutputTag.IsEmpty())
+    {
+      sFileName = "Output";
+    }
+    else
+    {
+      ezPathUtils::MakeValidFilename(sOutputTag, '_', sValidTag);
+      sFileName.Set("Output-", sValidTag);
+    }
+
+    sFileName.ChangeFileExtension(file.m_sAbsPath.GetFileExtension());
+    MakeKey(uiAssetHash, pManager->GeneratesProfileSpecificAssets(), sFileName, sKey);
+    file.m_sKey = sKey;
+  };
+
+  AddOutput("");
+  for (auto it = pAssetInfo->m_Info->m_Outputs.GetIterator(); it.IsValid(); ++it)
+  {
+    AddOutput(it.Key());
+  }
+
+  const auto assetFlags = pTypeDesc->m_AssetDocumentFlags;
+  if (assetFlags.IsAnySet(ezAssetDocumentFlags::SupportsThumbnail | ezAssetDocumentFlags::AutoThumbnailOnTransform))
+  {
+    // the thumbnail doesn't depend on the profile, but on the references of the asset, which are covered by the thumbnail hash
+    CacheFile& file = out_files.ExpandAndGetRef();
+    file.m_sAbsPath = pManager->GenerateResourceThumbnailPath(sDocumentPath);
+    file.m_bRequired = assetFlags.IsSet(ezAssetDocumentFlags::AutoThumbnailOnTransform);
+    file.m_bIsThumbnail = true;
+
+    MakeKey(uiThumbHash, false, "Thumbnail.jpg", sKey);
+    file.m_sKey = sKey;
+  }
+}
+
+bool ezAssetTransformCache::IsValidOutput(const CacheFile& file, ezAssetInfo* pAssetInfo, ezUInt64 uiAssetHash) const
+{
+  // thumbnails have no asset header, they are only keyed by the thumbnail hash
+  if (file.m_bIsThumbnail)
+    return true;
+
+  // the same check that the curator uses to decide whether an output is up to date
+  return pAssetInfo->GetManager()->IsOutputUpToDate(pAssetInfo->m_Path.GetAbsolutePath(), file.m_sOutputTag, uiAssetHash, pAssetInfo->m_pDocumentTypeDescriptor);
+}
+
+ezResult ezAssetTransformCache::FetchFile(const CacheFile& file, ezAssetInfo* pAssetInfo, ezUInt64 uiAssetHash, bool& out_bFromShared) const
+{
+  bool bWritten = false;
+
+  if (m_pLocal && m_pLocal->Fetch(file.m_sKey, file.m_sAbsPath).Succeeded())
+  {
+    if (IsValidOutput(file, pAssetInfo, uiAssetHash))
+      return EZ_SUCCESS;
+
+    bWritten = true;
+    ezLog::Warning("Ignoring '{}' in the transform cache '{}', it doesn't match the asset hash", file.m_sKey, m_pLocal->GetName());
+  }
+
+  if (m_pShared && m_pShared->Fetch(file.m_sKey, file.m_sAbsPath).Succeeded())
+  {
+    // validate before copying it locally, so that a bad shared entry doesn't spread
+    if (IsValidOutput(file, pAssetInfo, uiAssetHash))
+    {
+      out_bFromShared = true;
+
+      if (m_pLocal && m_pLocal->Store(file.m_sKey, file.m_sAbsPath).Failed())
+      {
+        ezLog::Warning("Failed to copy '{}' into the local transform cache", file.m_sKey);
+      }
+
+      return EZ_SUCCESS;
+    }
+
+    bWritten = true;
+    ezLog::Warning("Ignoring '{}' in the transform cache '{}', it doesn't match the asset hash", file.m_sKey, m_pShared->GetName());
+  }
+
+  if (bWritten)
+  {
+    // don't leave an invalid output behind, the asset gets transformed instead
+    ezOSFile::DeleteFile(file.m_sAbsPath).IgnoreResult();
+  }
+
+  return EZ_FAILURE;
+}
+
+ezResult ezAssetTransformCache::RestoreOutputs(ezAssetInfo* pAssetInfo, const ezPlatformProfile* pAssetProfile, ezUInt64 uiAssetHash, ezUInt64 uiThumbHash)
+{
+  if (!IsEnabled() || uiAssetHash == 0)
+    return EZ_FAILURE;
+
+  ezHybridArray<CacheFile, 4> files;
+  GatherFiles(pAssetInfo, pAssetProfile, uiAssetHash, uiThumbHash, files);
+
+  // check all required files first, so that a partial entry doesn't overwrite any outputs
+  for (const CacheFile& file : files)
+  {
+    if (file.m_bRequired && !(m_pLocal && m_pLocal->Contains(file.m_sKey)) && !(m_pShared && m_pShared->Contains(file.m_sKey)))
+    {
+      m_iMisses.Increment();
+      return EZ_FAILURE;
+    }
+  }
+
+  bool bFromShared = false;
+  for (const CacheFile& file : files)
+  {
+    if (FetchFile(file, pAssetInfo, uiAssetHash, bFromShared).Failed())
+    {
+      if (file.m_bRequired)
+      {
+        m_iMisses.Increment();
+        return EZ_FAILURE;
+      }
+
+      continue;
+    }
+
+    ezAssetCurator::GetSingleton()->NotifyOfFileChange(file.m_sAbsPath);
+
+    if (file.m_bIsThumbnail)
+    {
+      ezQtImageCache::GetSingleton()->InvalidateCache(file.m_sAbsPath);
+    }
+  }
+
+  if (bFromShared)
+    m_iSharedHits.Increment();
+  else
+    m_iLocalHits.Increment();
+
+  return EZ_SUCCESS;
+}
+
+void ezAssetTransformCache::StoreOutputs(ezAssetInfo* pAssetInfo, const ezPlatformProfile* pAssetProfile, ezUInt64 uiAssetHash, ezUInt64 uiThumbHash)
+{
+  if (!IsEnabled() || uiAssetHash == 0)
+    return;
+
+  ezHybridArray<CacheFile, 4> files;
+  GatherFiles(pAssetInfo, pAssetProfile, uiAssetHash, uiThumbHash, files);
+
+  const ezAssetDocumentTypeDescriptor* pTypeDesc = pAssetInfo->m_pDocumentTypeDescriptor;
+
+  bool bStored = false;
+  for (const CacheFile& file : files)
+  {
+    // thumbnails may be disabled or created separately, only cache them when they match the current state
+    if (file.m_bIsThumbnail && !pAssetInfo->GetManager()->IsThumbnailUpToDate(pAssetInfo->m_Path.GetAbsolutePath(), "", uiThumbHash, pTypeDesc->m_pDocumentType->GetTypeVersion()))
+      continue;
+
+    // the backends are independent, a failure in one doesn't keep the file out of the other
+    if (m_pLocal && !m_pLocal->Contains(file.m_sKey))
+    {
+      if (m_pLocal->Store(file.m_sKey, file.m_sAbsPath).Succeeded())
+        bStored = true;
+      else
+        ezLog::Warning("Failed to store '{}' in the local transform cache '{}'", file.m_sAbsPath, m_pLocal->GetName());
+    }
+
+    if (m_pShared && !m_pShared->Contains(file.m_sKey))
+    {
+      if (m_pShared->Store(file.m_sKey, file.m_sAbsPath).Succeeded())
+        bStored = true;
+      else
+        ezLog::Warning("Failed to store '{}' in the shared transform cache '{}'", file.m_sAbsPath, m_pShared->GetName());
+    }
+  }
+
+  if (bStored)
+  {
+    m_iStored.Increment();
+  }
+}
+
+ezAssetTransformCache::Statistics ezAssetTransformCache::GetStatistics() const
+{
+  Statistics stats;
+  stats.m_uiLocalHits = static_cast<ezUInt32>(m_iLocalHits);
+  stats.m_uiSharedHits = static_cast<ezUInt32>(m_iSharedHits);
+  stats.m_uiMisses = static_cast<ezUInt32>(m_iMisses);
+  stats.m_uiStored = static_cast<ezUInt32>(m_iStored);
+  return stats;
+}
+
+void ezAssetTransformCache::LogStatistics() const
+{
+  if (!IsEnabled())
+    return;
+
+  const Statistics stats = GetStatistics();
+  const ezUInt32 uiHits = stats.m_uiLocalHits + stats.m_uiSharedHits;
+  const ezUInt32 uiLookups = uiHits + stats.m_uiMisses;
+  const double fHitRate = uiLookups > 0 ? 100.0 * uiHits / uiLookups : 0.0;
+
+  ezLog::Info("Transform cache: {} of {} assets restored ({}%), {} local hits, {} shared hits, {} assets stored", uiHits, uiLookups, ezArgF(fHitRate, 1), stats.m_uiLocalHits, stats.m_uiSharedHits, stats.m_uiStored);
+}
@@ -6,6 +6,7 @@
 #include <EditorEngineProcessFramework/EngineProcess/EngineProcessCommunicationChannel.h>
 #include <EditorFramework/Assets/AssetCurator.h>
 #include <EditorFramework/Assets/AssetProcessorMessages.h>
+#include <EditorFramework/Assets/AssetTransformCache.h>
 #include <EditorFramework/CodeGen/CppProject.h>
 #include <EditorFramework/CodeGen/CppSettings.h>
 #include <EditorFramework/EditorApp/EditorApp.moc.h>
@@ -247,6 +248,8 @@ public:
               SetReturnCode(1);
             }
 
+            ezAssetCurator::GetSingleton()->GetTransformCache().LogStatistics();
+
             if (opt_SaveProfilingData.GetOptionValue(ezCommandLineOption::LogMode::Always))
             {
               ezActionContext context;
@@ -306,6 +309,8 @@ public:
 
         const ezInt32 iReturnCode = ezQtEditorApp::GetSingleton()->RunEditor();
         SetReturnCode(iReturnCode);
+
+        ezAssetCurator::GetSingleton()->GetTransformCache().LogStatistics();
       }
       else
       {
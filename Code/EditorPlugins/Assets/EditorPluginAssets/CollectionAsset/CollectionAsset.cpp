@@ -2,6 +2,7 @@
 
 #include <EditorFramework/Assets/AssetCurator.h>
 #include <EditorFramework/Assets/AssetDocumentInfo.h>
+#include <Core/Collection/CollectionUtils.h>
 #include <EditorPluginAssets/CollectionAsset/CollectionAsset.h>
 
 // clang-format off
@@ -26,7 +27,7 @@ EZ_BEGIN_DYNAMIC_REFLECTED_TYPE(ezCollectionAssetData, 1, ezRTTIDefaultAllocator
 }
 EZ_END_DYNAMIC_REFLECTED_TYPE;
 
-EZ_BEGIN_DYNAMIC_REFLECTED_TYPE(ezCollectionAssetDocument, 1, ezRTTINoAllocator)
+EZ_BEGIN_DYNAMIC_REFLECTED_TYPE(ezCollectionAssetDocument, 2, ezRTTINoAllocator)
 EZ_END_DYNAMIC_REFLECTED_TYPE;
 // clang-format on
 
@@ -35,7 +36,9 @@ ezCollectionAssetDocument::ezCollectionAssetDocument(ezStringView sDocumentPath)
 {
 }
 
-static bool InsertEntry(ezStringView sID, ezStringView sLookupName, ezMap<ezString, ezCollectionEntry>& inout_found)
+using ezCollectionDependencyMap = ezMap<ezString, ezHybridArray<ezString, 4>>;
+
+static bool InsertEntry(ezStringView sID, ezStringView sLookupName, ezMap<ezString, ezCollectionEntry>& inout_found, ezCollectionDependencyMap& inout_dependencies)
 {
   auto it = inout_found.Find(sID);
 
@@ -73,8 +76,11 @@ static bool InsertEntry(ezStringView sID, ezStringView sLookupName, ezMap<ezStri
 
     for (const ezString& doc : pDocInfo->m_PackageDependencies)
     {
-      // ignore return value, we are only interested in top-level information
-      InsertEntry(doc, {}, inout_found);
+      // non-asset dependencies are skipped silently, we are only interested in top-level errors
+      if (InsertEntry(doc, {}, inout_found, inout_dependencies))
+      {
+        inout_dependencies[sID].PushBack(doc);
+      }
     }
   }
 
@@ -86,13 +92,14 @@ ezTransformStatus ezCollectionAssetDocument::InternalTransformAsset(ezStreamWrit
   const ezCollectionAssetData* pProp = GetProperties();
 
   ezMap<ezString, ezCollectionEntry> entries;
+  ezCollectionDependencyMap dependencies;
 
   for (const auto& e : pProp->m_Entries)
   {
     if (e.m_sRedirectionAsset.IsEmpty())
       continue;
 
-    if (!InsertEntry(e.m_sRedirectionAsset, e.m_sLookupName, entries))
+    if (!InsertEntry(e.m_sRedirectionAsset, e.m_sLookupName, entries, dependencies))
     {
       // this should be treated as an error for top-level references, since they are manually added (in contrast to the transitive dependencies)
       return ezStatus(ezFmt("Asset in Collection is unknown: '{0}'", e.m_sRedirectionAsset));
@@ -100,12 +107,27 @@ ezTransformStatus ezCollectionAssetDocument::InternalTransformAsset(ezStreamWrit
   }
 
   ezCollectionResourceDescriptor desc;
+  ezMap<ezString, ezUInt32> entryIndices;
 
   for (auto it : entries)
   {
+    entryIndices[it.Key()] = desc.m_Resources.GetCount();
     desc.m_Resources.PushBack(it.Value());
   }
 
+  // store the package dependencies as a graph, so that the runtime can load resources before the resources that reference them
+  for (auto it : dependencies)
+  {
+    ezCollectionEntry& entry = desc.m_Resources[entryIndices[it.Key()]];
+
+    for (const ezString& sDependency : it.Value())
+    {
+      entry.m_Dependencies.PushBack(entryIndices[sDependency]);
+    }
+  }
+
+  ezCollectionUtils::SortByDependencies(desc);
+
   desc.Save(stream);
 
   return ezStatus(EZ_SUCCESS);
@@ -48,6 +48,11 @@ ezTransformStatus ezMeshAssetDocument::InternalTransformAsset(ezStreamWriter& st
   else
   {
     CreateMeshFromGeom(pProp, desc);
+
+    if (pProp->m_bBuildClusters)
+    {
+      desc.BuildClusters();
+    }
   }
 
   // if there is no material set for a slot, use the "Pattern" material as a fallback
@@ -60,6 +65,13 @@ ezTransformStatus ezMeshAssetDocument::InternalTransformAsset(ezStreamWriter& st
     }
   }
 
+  if (pProp->m_bCompressMesh)
+  {
+    desc.OptimizeVertexOrder();
+    desc.m_bEncodeMeshBuffer = true;
+    desc.m_uiPositionQuantizationBits = pProp->m_uiPositionQuantizationBits;
+  }
+
   range.BeginNextStep("Writing Result");
   desc.Save(stream);
 
@@ -258,6 +270,8 @@ ezTransformStatus ezMeshAssetDocument::CreateMeshFromFile(ezMeshAssetProperties*
     opt.m_bAggressiveSimplification = pProp->m_bAggressiveSimplification;
   }
 
+  opt.m_bBuildClusters = pProp->m_bBuildClusters;
+
   if (pImporter->Import(opt).Failed())
     return ezStatus("Model importer was unable to read this asset.");
 
@@ -5,7 +5,7 @@
 #include <GuiFoundation/PropertyGrid/PropertyMetaState.h>
 
 // clang-format off
-EZ_BEGIN_DYNAMIC_REFLECTED_TYPE(ezMeshAssetProperties, 5, ezRTTIDefaultAllocator<ezMeshAssetProperties>)
+EZ_BEGIN_DYNAMIC_REFLECTED_TYPE(ezMeshAssetProperties, 7, ezRTTIDefaultAllocator<ezMeshAssetProperties>)
 {
   EZ_BEGIN_PROPERTIES
   {
@@ -36,6 +36,9 @@ EZ_BEGIN_DYNAMIC_REFLECTED_TYPE(ezMeshAssetProperties, 5, ezRTTIDefaultAllocator
     EZ_MEMBER_PROPERTY("MeshSimplification", m_uiMeshSimplification)->AddAttributes(new ezDefaultValueAttribute(50), new ezClampValueAttribute(1, 100)),
     EZ_MEMBER_PROPERTY("MaxSimplificationError", m_uiMaxSimplificationError)->AddAttributes(new ezDefaultValueAttribute(5), new ezClampValueAttribute(1, 100)),
     EZ_MEMBER_PROPERTY("AggressiveSimplification", m_bAggressiveSimplification),
+    EZ_MEMBER_PROPERTY("BuildClusters", m_bBuildClusters),
+    EZ_MEMBER_PROPERTY("CompressMesh", m_bCompressMesh),
+    EZ_MEMBER_PROPERTY("PositionQuantizationBits", m_uiPositionQuantizationBits)->AddAttributes(new ezDefaultValueAttribute(0), new ezClampValueAttribute(0, 23)),
   }
   EZ_END_PROPERTIES;
 }
@@ -68,6 +71,7 @@ void ezMeshAssetProperties::PropertyMetaStateEventHandler(ezPropertyMetaStateEve
   {
     const ezInt64 primType = e.m_pObject->GetTypeAccessor().GetValue("PrimitiveType").ConvertTo<ezInt64>();
     const bool bSimplify = e.m_pObject->GetTypeAccessor().GetValue("SimplifyMesh").ConvertTo<bool>();
+    const bool bCompress = e.m_pObject->GetTypeAccessor().GetValue("CompressMesh").ConvertTo<bool>();
 
     auto& props = *e.m_pPropertyStates;
 
@@ -91,6 +95,7 @@ void ezMeshAssetProperties::PropertyMetaStateEventHandler(ezPropertyMetaStateEve
     props["MeshSimplification"].m_Visibility = bSimplify ? ezPropertyUiState::Default : ezPropertyUiState::Invisible;
     props["MaxSimplificationError"].m_Visibility = bSimplify ? ezPropertyUiState::Default : ezPropertyUiState::Invisible;
     props["AggressiveSimplification"].m_Visibility = bSimplify ? ezPropertyUiState::Default : ezPropertyUiState::Invisible;
+    props["PositionQuantizationBits"].m_Visibility = bCompress ? ezPropertyUiState::Default : ezPropertyUiState::Invisible;
 
     const ezInt64 importTransform = e.m_pObject->GetTypeAccessor().GetValue("ImportTransform").ConvertTo<ezInt64>();
     const bool bCustomTransform = importTransform == 127;
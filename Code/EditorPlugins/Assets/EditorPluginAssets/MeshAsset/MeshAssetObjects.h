@@ -79,4 +79,8 @@ public:
   bool m_bAggressiveSimplification = false;
   ezUInt8 m_uiMeshSimplification = 50;
   ezUInt8 m_uiMaxSimplificationError = 5;
+
+  bool m_bBuildClusters = false;
+  bool m_bCompressMesh = false;
+  ezUInt8 m_uiPositionQuantizationBits = 0;
 };
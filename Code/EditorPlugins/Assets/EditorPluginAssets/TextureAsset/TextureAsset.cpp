@@ -208,6 +208,19 @@ ezStatus ezTextureAssetDocument::RunTexConv(const char* szTargetFile, const ezAs
   arguments << "-compression";
   arguments << ToCompressionMode(pProp->m_CompressionMode);
 
+  if (pAssetConfig->m_bFastEncoding)
+  {
+    arguments << "-encoding";
+    arguments << "Fast";
+  }
+
+  if (pAssetConfig->m_fRdoLambda > 0.0f)
+  {
+    arguments << "-rdoLambda";
+    temp.SetFormat("{0}", ezArgF(pAssetConfig->m_fRdoLambda, 2));
+    arguments << temp.GetData();
+  }
+
   arguments << "-usage";
   arguments << ToUsageMode(pProp->m_TextureUsage);
 
@@ -13,6 +13,8 @@ EZ_BEGIN_DYNAMIC_REFLECTED_TYPE(ezTextureAssetProfileConfig, 1, ezRTTIDefaultAll
   EZ_BEGIN_PROPERTIES
   {
     EZ_MEMBER_PROPERTY("MaxResolution", m_uiMaxResolution)->AddAttributes(new ezDefaultValueAttribute(16 * 1024)),
+    EZ_MEMBER_PROPERTY("FastEncoding", m_bFastEncoding),
+    EZ_MEMBER_PROPERTY("RdoLambda", m_fRdoLambda)->AddAttributes(new ezClampValueAttribute(0.0f, 10.0f)),
   }
   EZ_END_PROPERTIES;
 }
@@ -65,7 +67,18 @@ ezTextureAssetDocumentManager::~ezTextureAssetDocumentManager()
 
 ezUInt64 ezTextureAssetDocumentManager::ComputeAssetProfileHashImpl(const ezPlatformProfile* pAssetProfile) const
 {
-  return pAssetProfile->GetTypeConfig<ezTextureAssetProfileConfig>()->m_uiMaxResolution;
+  const ezTextureAssetProfileConfig* pConfig = pAssetProfile->GetTypeConfig<ezTextureAssetProfileConfig>();
+
+  ezUInt64 uiHash = pConfig->m_uiMaxResolution;
+
+  // the encoder settings only affect the hash when they are changed, so existing assets stay up to date
+  if (pConfig->m_bFastEncoding || pConfig->m_fRdoLambda > 0.0f)
+  {
+    uiHash = ezHashingUtils::xxHash64(&pConfig->m_fRdoLambda, sizeof(float), uiHash);
+    uiHash = ezHashingUtils::xxHash64(&pConfig->m_bFastEncoding, sizeof(bool), uiHash);
+  }
+
+  return uiHash;
 }
 
 void ezTextureAssetDocumentManager::OnDocumentManagerEvent(const ezDocumentManager::Event& e)
@@ -10,6 +10,8 @@ class EZ_EDITORPLUGINASSETS_DLL ezTextureAssetProfileConfig : public ezProfileCo
 
 public:
   ezUInt16 m_uiMaxResolution = 1024 * 16;
+  bool m_bFastEncoding = false;
+  float m_fRdoLambda = 0.0f;
 };
 
 class ezTextureAssetDocumentManager : public ezAssetDocumentManager
@@ -1034,6 +1034,19 @@ ezStatus ezSubstancePackageAssetDocument::RunTexConv(const char* szInputFile, co
   arguments << "-compression";
   arguments << s_szTexConvCompressionMapping[graphOutput.m_CompressionMode];
 
+  if (pAssetConfig->m_bFastEncoding)
+  {
+    arguments << "-encoding";
+    arguments << "Fast";
+  }
+
+  if (pAssetConfig->m_fRdoLambda > 0.0f)
+  {
+    arguments << "-rdoLambda";
+    temp.SetFormat("{0}", ezArgF(pAssetConfig->m_fRdoLambda, 2));
+    arguments << temp.GetData();
+  }
+
   arguments << "-mipmaps";
   arguments << s_szTexConvMipMapMapping[graphOutput.m_MipmapMode];
 
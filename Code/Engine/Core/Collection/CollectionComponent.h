@@ -36,6 +36,9 @@ public:
   void SetCollection(const ezCollectionResourceHandle& hPrefab);                                     // [ property ]
   EZ_ALWAYS_INLINE const ezCollectionResourceHandle& GetCollection() const { return m_hCollection; } // [ property ]
 
+  void SetRegisterNames(bool bRegisterNames);                // [ property ]
+  bool GetRegisterNames() const { return m_bRegisterNames; } // [ property ]
+
 protected:
   /// \brief Triggers the preload on the referenced ezCollectionResource
   void InitiatePreload();
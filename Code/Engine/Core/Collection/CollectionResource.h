@@ -2,6 +2,7 @@
 
 #include <Core/CoreDLL.h>
 #include <Core/ResourceManager/Resource.h>
+#include <Foundation/Containers/SmallArray.h>
 
 /// \brief Represents one resource to load / preload through an ezCollectionResource
 struct EZ_CORE_DLL ezCollectionEntry
@@ -10,6 +11,7 @@ struct EZ_CORE_DLL ezCollectionEntry
   ezString m_sResourceID;             ///< The ID / path to the resource to load.
   ezHashedString m_sAssetTypeName;
   ezUInt64 m_uiFileSize = 0;
+  ezSmallArray<ezUInt32, 2> m_Dependencies; ///< Indices of other entries in the same collection, that this resource references. Those are always stored before this entry.
 };
 
 /// \brief Describes a full ezCollectionResource, ie. lists all the resources that the collection contains
@@ -21,6 +23,24 @@ struct EZ_CORE_DLL ezCollectionResourceDescriptor
   void Load(ezStreamReader& inout_stream);
 };
 
+/// \brief Limits how much an ezCollectionResource puts into the preload queue at once. See ezCollectionResource::UpdatePreloading().
+struct EZ_CORE_DLL ezCollectionPreloadSettings
+{
+  ezUInt64 m_uiMaxBytesInFlight = 0;     ///< No more resources are queued while the queued, but not yet loaded resources add up to this many bytes. Zero means unlimited.
+  ezUInt32 m_uiMaxResourcesInFlight = 0; ///< No more resources are queued while this many resources are queued, but not yet loaded. Zero means unlimited.
+};
+
+/// \brief Detailed preloading state of a single ezCollectionResource. See ezCollectionResource::GetLoadingProgress().
+struct EZ_CORE_DLL ezCollectionLoadingProgress
+{
+  ezUInt32 m_uiNumResources = 0; ///< Number of entries in the collection.
+  ezUInt32 m_uiNumQueued = 0;    ///< Number of entries that have been put into the preload queue so far.
+  ezUInt32 m_uiNumLoaded = 0;    ///< Number of queued entries that have finished loading (or failed to load).
+  ezUInt64 m_uiTotalBytes = 0;
+  ezUInt64 m_uiLoadedBytes = 0;
+  ezUInt64 m_uiBytesInFlight = 0; ///< Size of the resources that are queued, but not yet loaded.
+};
+
 using ezCollectionResourceHandle = ezTypedResourceHandle<class ezCollectionResource>;
 
 /// \brief An ezCollectionResource is used to tell the engine about resources that it should preload in the background
@@ -71,8 +91,22 @@ public:
   /// This has to be called manually. It will return false if no more resources can be queued for preloading. This can be used
   /// as a workflow where PreloadResources and IsLoadingFinished are called repeadedly in tandem, so only a smaller fraction
   /// of resources gets queued and waited for, to allow simple resource load-balancing.
+  ///
+  /// Resources are queued in the order in which they are stored in the collection, which puts dependencies before the resources that use them.
   bool PreloadResources(ezUInt32 uiNumResourcesToPreload = ezMath::MaxValue<ezUInt32>());
 
+  /// \brief Streaming alternative to PreloadResources(), that has to be called repeatedly (usually once per frame).
+  ///
+  /// A resource is only queued once all of its dependencies have finished loading, so resources arrive in dependency order,
+  /// instead of competing with the resources that they reference. Additionally queuing pauses while the limits in \a settings are reached,
+  /// so that a large collection doesn't flood the preload queue and starve other loads. At least one resource is always allowed in flight.
+  ///
+  /// Returns false once all resources have been queued, just like PreloadResources().
+  bool UpdatePreloading(const ezCollectionPreloadSettings& settings);
+
+  /// \brief Reports how many of the collection's resources are queued, loaded and in flight.
+  void GetLoadingProgress(ezCollectionLoadingProgress& out_progress) const;
+
   /// \brief Returns true if all resources added for preloading via PreloadResources have finished loading.
   /// if `out_progress` is defined:
   ///     * Assigns a value between 0.0 and 1.0 representing how many of the collection's resources are in a loaded state at the moment.
@@ -93,8 +127,18 @@ private:
   virtual ezResourceLoadDesc UpdateContent(ezStreamReader* Stream) override;
   virtual void UpdateMemoryUsage(MemoryUsage& out_NewMemoryUsage) override;
 
+  void PreloadEntry(ezUInt32 uiEntry);
+  void ComputeLoadingProgress(ezCollectionLoadingProgress& out_progress) const;
+  bool IsEntryFinished(ezUInt32 uiEntry) const;
+
   mutable ezMutex m_PreloadMutex;
   bool m_bRegistered = false;
   ezCollectionResourceDescriptor m_Collection;
   ezDynamicArray<ezTypelessResourceHandle> m_PreloadedResources;
+
+  /// The first m_uiNumFinishedEntries entries of m_PreloadedResources have finished loading, so that ComputeLoadingProgress() doesn't
+  /// have to ask the resource manager about them every frame. Maintained by UpdatePreloading().
+  ezUInt32 m_uiNumFinishedEntries = 0;
+  ezUInt64 m_uiFinishedEntriesBytes = 0;
+  ezUInt64 m_uiTotalBytes = 0;
 };
@@ -15,6 +15,8 @@ namespace ezCollectionUtils
 
   /// \brief Merges all collections from the input array into the target result collection. Resource entries will be de-duplicated by resource ID
   /// string.
+  ///
+  /// Dependencies between the entries are preserved and the result is sorted with SortByDependencies().
   EZ_CORE_DLL void MergeCollections(ezCollectionResourceDescriptor& ref_result, ezArrayPtr<const ezCollectionResourceDescriptor*> inputCollections);
 
   /// \brief Special case of ezCollectionUtils::MergeCollections which outputs unique entries from input collection into the result collection
@@ -29,4 +31,10 @@ namespace ezCollectionUtils
   /// for the file size check within the scope of the function, it will not modify the resource Id.
   EZ_CORE_DLL void AddResourceHandle(ezCollectionResourceDescriptor& ref_collection, ezTypelessResourceHandle hHandle, ezStringView sAssetTypeName, ezStringView sAbsFolderpath);
 
+  /// \brief Reorders the entries, such that every entry comes after all the entries that it depends on (see ezCollectionEntry::m_Dependencies).
+  ///
+  /// Entries are grouped by their depth in the dependency graph, within a group the previous order is kept, so the result is deterministic.
+  /// Dependencies that form a cycle can't be ordered, the offending references are removed from the entries that come first.
+  EZ_CORE_DLL void SortByDependencies(ezCollectionResourceDescriptor& ref_collection);
+
 }; // namespace ezCollectionUtils
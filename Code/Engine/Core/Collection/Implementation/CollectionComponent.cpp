@@ -10,7 +10,7 @@ EZ_BEGIN_COMPONENT_TYPE(ezCollectionComponent, 2, ezComponentMode::Static)
   EZ_BEGIN_PROPERTIES
   {
     EZ_RESOURCE_ACCESSOR_PROPERTY("Collection", GetCollection, SetCollection)->AddAttributes(new ezAssetBrowserAttribute("CompatibleAsset_AssetCollection", ezDependencyFlags::Package)),
-    EZ_MEMBER_PROPERTY("RegisterNames", m_bRegisterNames),
+    EZ_ACCESSOR_PROPERTY("RegisterNames", GetRegisterNames, SetRegisterNames),
   }
   EZ_END_PROPERTIES;
   EZ_BEGIN_ATTRIBUTES
@@ -22,7 +22,11 @@ EZ_BEGIN_COMPONENT_TYPE(ezCollectionComponent, 2, ezComponentMode::Static)
 EZ_END_DYNAMIC_REFLECTED_TYPE;
 // clang-format on
 
-ezCollectionComponent::ezCollectionComponent() = default;
+ezCollectionComponent::ezCollectionComponent()
+{
+  EnableStateVersionTracking();
+}
+
 ezCollectionComponent::~ezCollectionComponent() = default;
 
 void ezCollectionComponent::SerializeComponent(ezWorldWriter& inout_stream) const
@@ -51,6 +55,7 @@ void ezCollectionComponent::DeserializeComponent(ezWorldReader& inout_stream)
 void ezCollectionComponent::SetCollection(const ezCollectionResourceHandle& hCollection)
 {
   m_hCollection = hCollection;
+  MarkStateChanged();
 
   if (IsActiveAndSimulating())
   {
@@ -58,6 +63,12 @@ void ezCollectionComponent::SetCollection(const ezCollectionResourceHandle& hCol
   }
 }
 
+void ezCollectionComponent::SetRegisterNames(bool bRegisterNames)
+{
+  m_bRegisterNames = bRegisterNames;
+  MarkStateChanged();
+}
+
 void ezCollectionComponent::OnSimulationStarted()
 {
   InitiatePreload();
@@ -9,6 +9,20 @@ EZ_END_DYNAMIC_REFLECTED_TYPE;
 
 EZ_RESOURCE_IMPLEMENT_COMMON_CODE(ezCollectionResource);
 
+namespace
+{
+  ezUInt64 ComputeTotalBytes(const ezCollectionResourceDescriptor& collection)
+  {
+    ezUInt64 uiTotalBytes = 0;
+    for (const ezCollectionEntry& entry : collection.m_Resources)
+    {
+      uiTotalBytes += entry.m_uiFileSize;
+    }
+
+    return uiTotalBytes;
+  }
+} // namespace
+
 ezCollectionResource::ezCollectionResource()
   : ezResource(DoUpdate::OnAnyThread, 1)
 {
@@ -36,35 +50,153 @@ bool ezCollectionResource::PreloadResources(ezUInt32 uiNumResourcesToPreload)
   const ezUInt32 remainingResources = m_Collection.m_Resources.GetCount() - m_PreloadedResources.GetCount();
   const ezUInt32 end = ezMath::Min(remainingResources, uiNumResourcesToPreload) + m_PreloadedResources.GetCount();
   for (ezUInt32 i = m_PreloadedResources.GetCount(); i < end; ++i)
+  {
+    PreloadEntry(i);
+  }
+
+  return m_PreloadedResources.GetCount() < m_Collection.m_Resources.GetCount();
+}
+
+bool ezCollectionResource::UpdatePreloading(const ezCollectionPreloadSettings& settings)
+{
+  EZ_LOCK(m_PreloadMutex);
+  EZ_PROFILE_SCOPE("Stream Resources to Preload");
+
+  const ezUInt32 uiNumResources = m_Collection.m_Resources.GetCount();
+
+  if (m_PreloadedResources.GetCount() == uiNumResources)
+    return false;
+
+  m_PreloadedResources.Reserve(uiNumResources);
+
+  // the collection holds on to the handles, so once an entry has finished loading it stays that way
+  while (m_uiNumFinishedEntries < m_PreloadedResources.GetCount() && IsEntryFinished(m_uiNumFinishedEntries))
+  {
+    m_uiFinishedEntriesBytes += m_Collection.m_Resources[m_uiNumFinishedEntries].m_uiFileSize;
+    ++m_uiNumFinishedEntries;
+  }
+
+  ezCollectionLoadingProgress progress;
+  ComputeLoadingProgress(progress);
+
+  ezUInt32 uiResourcesInFlight = progress.m_uiNumQueued - progress.m_uiNumLoaded;
+  ezUInt64 uiBytesInFlight = progress.m_uiBytesInFlight;
+
+  // entries are sorted by their dependencies, so queuing strictly in order never waits for something that hasn't been queued yet
+  for (ezUInt32 i = m_PreloadedResources.GetCount(); i < uiNumResources; ++i)
   {
     const ezCollectionEntry& e = m_Collection.m_Resources[i];
-    ezTypelessResourceHandle hTypeless;
 
-    if (!e.m_sAssetTypeName.IsEmpty())
+    bool bDependenciesLoaded = true;
+    for (ezUInt32 uiDependency : e.m_Dependencies)
     {
-      if (const ezRTTI* pRtti = ezResourceManager::FindResourceForAssetType(e.m_sAssetTypeName))
-      {
-        hTypeless = ezResourceManager::LoadResourceByType(pRtti, e.m_sResourceID);
-      }
-      else
+      // forward references can't be satisfied by this scheme, they only exist in collections that weren't sorted
+      if (uiDependency >= m_uiNumFinishedEntries && uiDependency < i && !IsEntryFinished(uiDependency))
       {
-        ezLog::Warning("There was no valid RTTI available for assets with type name '{}'. Could not pre-load resource '{}'. Did you forget to register the resource type with the ezResourceManager?", e.m_sAssetTypeName, ezArgSensitive(e.m_sResourceID, "ResourceID"));
+        bDependenciesLoaded = false;
+        break;
       }
     }
-    else
+
+    if (!bDependenciesLoaded)
+      break;
+
+    if (uiResourcesInFlight > 0)
     {
-      ezLog::Error("Asset '{}' had an empty asset type name. Cannot pre-load it.", ezArgSensitive(e.m_sResourceID, "ResourceID"));
+      if (settings.m_uiMaxResourcesInFlight > 0 && uiResourcesInFlight >= settings.m_uiMaxResourcesInFlight)
+        break;
+
+      if (settings.m_uiMaxBytesInFlight > 0 && uiBytesInFlight + e.m_uiFileSize > settings.m_uiMaxBytesInFlight)
+        break;
     }
 
-    m_PreloadedResources.PushBack(hTypeless);
+    PreloadEntry(i);
 
-    if (hTypeless.IsValid())
+    if (m_PreloadedResources.PeekBack().IsValid())
     {
-      ezResourceManager::PreloadResource(hTypeless);
+      ++uiResourcesInFlight;
+      uiBytesInFlight += e.m_uiFileSize;
     }
   }
 
-  return m_PreloadedResources.GetCount() < m_Collection.m_Resources.GetCount();
+  return m_PreloadedResources.GetCount() < uiNumResources;
+}
+
+void ezCollectionResource::GetLoadingProgress(ezCollectionLoadingProgress& out_progress) const
+{
+  EZ_LOCK(m_PreloadMutex);
+  ComputeLoadingProgress(out_progress);
+}
+
+void ezCollectionResource::PreloadEntry(ezUInt32 uiEntry)
+{
+  EZ_ASSERT_DEBUG(uiEntry == m_PreloadedResources.GetCount(), "Collection entries have to be queued in order");
+
+  const ezCollectionEntry& e = m_Collection.m_Resources[uiEntry];
+  ezTypelessResourceHandle hTypeless;
+
+  if (!e.m_sAssetTypeName.IsEmpty())
+  {
+    if (const ezRTTI* pRtti = ezResourceManager::FindResourceForAssetType(e.m_sAssetTypeName))
+    {
+      hTypeless = ezResourceManager::LoadResourceByType(pRtti, e.m_sResourceID);
+    }
+    else
+    {
+      ezLog::Warning("There was no valid RTTI available for assets with type name '{}'. Could not pre-load resource '{}'. Did you forget to register the resource type with the ezResourceManager?", e.m_sAssetTypeName, ezArgSensitive(e.m_sResourceID, "ResourceID"));
+    }
+  }
+  else
+  {
+    ezLog::Error("Asset '{}' had an empty asset type name. Cannot pre-load it.", ezArgSensitive(e.m_sResourceID, "ResourceID"));
+  }
+
+  m_PreloadedResources.PushBack(hTypeless);
+
+  if (hTypeless.IsValid())
+  {
+    ezResourceManager::PreloadResource(hTypeless);
+  }
+}
+
+bool ezCollectionResource::IsEntryFinished(ezUInt32 uiEntry) const
+{
+  if (uiEntry >= m_PreloadedResources.GetCount())
+    return false;
+
+  const ezTypelessResourceHandle& hResource = m_PreloadedResources[uiEntry];
+
+  // resources that couldn't be queued will never finish, they must not block the rest of the collection
+  if (!hResource.IsValid())
+    return true;
+
+  const ezResourceState state = ezResourceManager::GetLoadingState(hResource);
+  return state == ezResourceState::Loaded || state == ezResourceState::LoadedResourceMissing;
+}
+
+void ezCollectionResource::ComputeLoadingProgress(ezCollectionLoadingProgress& out_progress) const
+{
+  out_progress = {};
+  out_progress.m_uiNumResources = m_Collection.m_Resources.GetCount();
+  out_progress.m_uiNumQueued = m_PreloadedResources.GetCount();
+  out_progress.m_uiNumLoaded = m_uiNumFinishedEntries;
+  out_progress.m_uiTotalBytes = m_uiTotalBytes;
+  out_progress.m_uiLoadedBytes = m_uiFinishedEntriesBytes;
+
+  for (ezUInt32 i = m_uiNumFinishedEntries; i < m_PreloadedResources.GetCount(); ++i)
+  {
+    const ezUInt64 uiFileSize = m_Collection.m_Resources[i].m_uiFileSize;
+
+    if (IsEntryFinished(i))
+    {
+      ++out_progress.m_uiNumLoaded;
+      out_progress.m_uiLoadedBytes += uiFileSize;
+    }
+    else
+    {
+      out_progress.m_uiBytesInFlight += uiFileSize;
+    }
+  }
 }
 
 bool ezCollectionResource::IsLoadingFinished(float* out_pProgress) const
@@ -138,6 +270,7 @@ const ezCollectionResourceDescriptor& ezCollectionResource::GetDescriptor() cons
 EZ_RESOURCE_IMPLEMENT_CREATEABLE(ezCollectionResource, ezCollectionResourceDescriptor)
 {
   m_Collection = descriptor;
+  m_uiTotalBytes = ComputeTotalBytes(m_Collection);
 
   ezResourceLoadDesc res;
   res.m_uiQualityLevelsDiscardable = 0;
@@ -165,6 +298,9 @@ ezResourceLoadDesc ezCollectionResource::UnloadData(Unload WhatToUnload)
     // EZ_LOCK(m_preloadMutex);
     m_PreloadedResources.Clear();
     m_Collection.m_Resources.Clear();
+    m_uiNumFinishedEntries = 0;
+    m_uiFinishedEntriesBytes = 0;
+    m_uiTotalBytes = 0;
 
     m_PreloadedResources.Compact();
     m_Collection.m_Resources.Compact();
@@ -196,6 +332,7 @@ ezResourceLoadDesc ezCollectionResource::UpdateContent(ezStreamReader* Stream)
   AssetHash.Read(*Stream).IgnoreResult();
 
   m_Collection.Load(*Stream);
+  m_uiTotalBytes = ComputeTotalBytes(m_Collection);
 
   res.m_State = ezResourceState::Loaded;
   return res;
@@ -248,7 +385,7 @@ void ezCollectionResource::UnregisterNames()
 
 void ezCollectionResourceDescriptor::Save(ezStreamWriter& inout_stream) const
 {
-  const ezUInt8 uiVersion = 3;
+  const ezUInt8 uiVersion = 4;
   const ezUInt8 uiIdentifier = 0xC0;
   const ezUInt32 uiNumResources = m_Resources.GetCount();
 
@@ -262,6 +399,7 @@ void ezCollectionResourceDescriptor::Save(ezStreamWriter& inout_stream) const
     inout_stream << m_Resources[i].m_sOptionalNiceLookupName;
     inout_stream << m_Resources[i].m_sResourceID;
     inout_stream << m_Resources[i].m_uiFileSize;
+    inout_stream.WriteArray(m_Resources[i].m_Dependencies).AssertSuccess();
   }
 }
 
@@ -286,7 +424,7 @@ void ezCollectionResourceDescriptor::Load(ezStreamReader& inout_stream)
   }
 
   EZ_ASSERT_DEV(uiIdentifier == 0xC0, "File does not contain a valid ezCollectionResourceDescriptor");
-  EZ_ASSERT_DEV(uiVersion > 0 && uiVersion <= 3, "Invalid file version {0}", uiVersion);
+  EZ_ASSERT_DEV(uiVersion > 0 && uiVersion <= 4, "Invalid file version {0}", uiVersion);
 
   m_Resources.SetCount(uiNumResources);
 
@@ -299,6 +437,10 @@ void ezCollectionResourceDescriptor::Load(ezStreamReader& inout_stream)
     {
       inout_stream >> m_Resources[i].m_uiFileSize;
     }
+    if (uiVersion >= 4)
+    {
+      inout_stream.ReadArray(m_Resources[i].m_Dependencies).AssertSuccess();
+    }
   }
 }
 
@@ -53,19 +53,50 @@ void ezCollectionUtils::AddFiles(ezCollectionResourceDescriptor& ref_collection,
 
 EZ_CORE_DLL void ezCollectionUtils::MergeCollections(ezCollectionResourceDescriptor& ref_result, ezArrayPtr<const ezCollectionResourceDescriptor*> inputCollections)
 {
-  ezMap<ezString, const ezCollectionEntry*> firstEntryOfID;
+  ezMap<ezString, ezUInt32> firstEntryOfID;
+
+  ezDynamicArray<ezUInt32> inputToResult;
 
   for (const ezCollectionResourceDescriptor* inputDesc : inputCollections)
   {
+    const ezUInt32 uiFirstNewEntry = ref_result.m_Resources.GetCount();
+    inputToResult.Clear();
+
     for (const ezCollectionEntry& inputEntry : inputDesc->m_Resources)
     {
-      if (!firstEntryOfID.Contains(inputEntry.m_sResourceID))
+      bool bExisted = false;
+      auto it = firstEntryOfID.FindOrAdd(inputEntry.m_sResourceID, &bExisted);
+
+      if (!bExisted)
       {
-        firstEntryOfID.Insert(inputEntry.m_sResourceID, &inputEntry);
+        it.Value() = ref_result.m_Resources.GetCount();
         ref_result.m_Resources.PushBack(inputEntry);
       }
+
+      inputToResult.PushBack(it.Value());
+    }
+
+    // dependency indices are relative to the input collection
+    for (ezUInt32 i = uiFirstNewEntry; i < ref_result.m_Resources.GetCount(); ++i)
+    {
+      auto& dependencies = ref_result.m_Resources[i].m_Dependencies;
+
+      for (ezUInt32 j = 0; j < dependencies.GetCount();)
+      {
+        if (dependencies[j] >= inputToResult.GetCount())
+        {
+          ezLog::Warning("Collection entry '{}' references the invalid dependency index {}, the dependency is ignored.", ref_result.m_Resources[i].m_sResourceID, dependencies[j]);
+          dependencies.RemoveAtAndSwap(j);
+          continue;
+        }
+
+        dependencies[j] = inputToResult[dependencies[j]];
+        ++j;
+      }
     }
   }
+
+  SortByDependencies(ref_result);
 }
 
 
@@ -105,3 +136,84 @@ void ezCollectionUtils::AddResourceHandle(ezCollectionResourceDescriptor& ref_co
     }
   }
 }
+
+namespace
+{
+  constexpr ezUInt32 s_uiDependencyLevelInProgress = ezInvalidIndex - 1;
+
+  ezUInt32 ComputeDependencyLevel(ezCollectionResourceDescriptor& ref_collection, ezUInt32 uiEntry, ezDynamicArray<ezUInt32>& inout_levels)
+  {
+    if (inout_levels[uiEntry] != ezInvalidIndex)
+      return inout_levels[uiEntry];
+
+    inout_levels[uiEntry] = s_uiDependencyLevelInProgress;
+
+    ezUInt32 uiLevel = 0;
+    auto& dependencies = ref_collection.m_Resources[uiEntry].m_Dependencies;
+
+    for (ezUInt32 i = 0; i < dependencies.GetCount();)
+    {
+      const ezUInt32 uiDependency = dependencies[i];
+
+      if (uiDependency >= inout_levels.GetCount() || uiDependency == uiEntry || inout_levels[uiDependency] == s_uiDependencyLevelInProgress)
+      {
+        // invalid index or a cycle
+        dependencies.RemoveAtAndSwap(i);
+        continue;
+      }
+
+      uiLevel = ezMath::Max(uiLevel, ComputeDependencyLevel(ref_collection, uiDependency, inout_levels) + 1);
+      ++i;
+    }
+
+    inout_levels[uiEntry] = uiLevel;
+    return uiLevel;
+  }
+} // namespace
+
+void ezCollectionUtils::SortByDependencies(ezCollectionResourceDescriptor& ref_collection)
+{
+  const ezUInt32 uiNumEntries = ref_collection.m_Resources.GetCount();
+
+  ezDynamicArray<ezUInt32> levels;
+  levels.SetCount(uiNumEntries, ezInvalidIndex);
+
+  for (ezUInt32 i = 0; i < uiNumEntries; ++i)
+  {
+    ComputeDependencyLevel(ref_collection, i, levels);
+  }
+
+  ezDynamicArray<ezUInt32> order;
+  order.SetCountUninitialized(uiNumEntries);
+  for (ezUInt32 i = 0; i < uiNumEntries; ++i)
+  {
+    order[i] = i;
+  }
+
+  order.Sort([&](ezUInt32 a, ezUInt32 b)
+    { return levels[a] != levels[b] ? levels[a] < levels[b] : a < b; });
+
+  ezDynamicArray<ezUInt32> oldToNew;
+  oldToNew.SetCountUninitialized(uiNumEntries);
+
+  ezDynamicArray<ezCollectionEntry> sorted;
+  sorted.Reserve(uiNumEntries);
+
+  for (ezUInt32 i = 0; i < uiNumEntries; ++i)
+  {
+    oldToNew[order[i]] = i;
+    sorted.PushBack(std::move(ref_collection.m_Resources[order[i]]));
+  }
+
+  for (ezCollectionEntry& entry : sorted)
+  {
+    for (ezUInt32& uiDependency : entry.m_Dependencies)
+    {
+      uiDependency = oldToNew[uiDependency];
+    }
+
+    entry.m_Dependencies.Sort();
+  }
+
+  ref_collection.m_Resources = std::move(sorted);
+}
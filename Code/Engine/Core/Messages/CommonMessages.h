@@ -18,6 +18,14 @@ struct EZ_CORE_DLL ezMsgInterruptPlaying : public ezMessage
   EZ_DECLARE_MESSAGE_TYPE(ezMsgInterruptPlaying, ezMessage);
 };
 
+/// \brief Sent to active components after their state was deserialized in place, e.g. by ezWorldSnapshot.
+///
+/// DeserializeComponent() writes the members directly, so components that cache data derived from their properties should rebuild it here.
+struct EZ_CORE_DLL ezMsgComponentStateRestored : public ezMessage
+{
+  EZ_DECLARE_MESSAGE_TYPE(ezMsgComponentStateRestored, ezMessage);
+};
+
 /// \brief Basic message to set some generic parameter to a float value.
 struct EZ_CORE_DLL ezMsgSetFloatParameter : public ezMessage
 {
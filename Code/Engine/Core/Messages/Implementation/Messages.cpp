@@ -67,6 +67,19 @@ EZ_END_DYNAMIC_REFLECTED_TYPE;
 
 //////////////////////////////////////////////////////////////////////////
 
+EZ_IMPLEMENT_MESSAGE_TYPE(ezMsgComponentStateRestored);
+EZ_BEGIN_DYNAMIC_REFLECTED_TYPE(ezMsgComponentStateRestored, 1, ezRTTIDefaultAllocator<ezMsgComponentStateRestored>)
+{
+  EZ_BEGIN_ATTRIBUTES
+  {
+    new ezExcludeFromScript()
+  }
+  EZ_END_ATTRIBUTES;
+}
+EZ_END_DYNAMIC_REFLECTED_TYPE;
+
+//////////////////////////////////////////////////////////////////////////
+
 EZ_IMPLEMENT_MESSAGE_TYPE(ezMsgParentChanged);
 EZ_BEGIN_DYNAMIC_REFLECTED_TYPE(ezMsgParentChanged, 1, ezRTTIDefaultAllocator<ezMsgParentChanged>)
 {
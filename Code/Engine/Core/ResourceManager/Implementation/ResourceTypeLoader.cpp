@@ -8,10 +8,39 @@
 #include <Foundation/IO/OSFile.h>
 #include <Foundation/Profiling/Profiling.h>
 
+namespace
+{
+  /// Reads the absolute path that is prepended to the stream and then continues with the file content, which is read in place.
+  class PathAndContentStreamReader : public ezStreamReader
+  {
+  public:
+    virtual ezUInt64 ReadBytes(void* pReadBuffer, ezUInt64 uiBytesToRead) override
+    {
+      const ezUInt64 uiReadFromPath = m_PathReader.ReadBytes(pReadBuffer, uiBytesToRead);
+      void* pRemainingBuffer = pReadBuffer != nullptr ? ezMemoryUtils::AddByteOffset(pReadBuffer, static_cast<std::ptrdiff_t>(uiReadFromPath)) : nullptr;
+
+      return uiReadFromPath + m_ContentReader.ReadBytes(pRemainingBuffer, uiBytesToRead - uiReadFromPath);
+    }
+
+    virtual ezUInt64 SkipBytes(ezUInt64 uiBytesToSkip) override
+    {
+      const ezUInt64 uiSkippedInPath = m_PathReader.SkipBytes(uiBytesToSkip);
+      return uiSkippedInPath + m_ContentReader.SkipBytes(uiBytesToSkip - uiSkippedInPath);
+    }
+
+    ezRawMemoryStreamReader m_PathReader;
+    ezRawMemoryStreamReader m_ContentReader;
+  };
+} // namespace
+
 struct FileResourceLoadData
 {
   ezBlob m_Storage;
   ezRawMemoryStreamReader m_Reader;
+
+  // Used when the data directory provides the file content in memory. The file stays open until the resource is updated, which keeps that memory alive.
+  ezFileReader m_File;
+  PathAndContentStreamReader m_InPlaceReader;
 };
 
 ezResourceLoadData ezResourceLoaderFromFile::OpenDataStream(const ezResource* pResource)
@@ -20,9 +49,14 @@ ezResourceLoadData ezResourceLoaderFromFile::OpenDataStream(const ezResource* pR
 
   ezResourceLoadData res;
 
-  ezFileReader File;
+  FileResourceLoadData* pData = EZ_DEFAULT_NEW(FileResourceLoadData);
+
+  ezFileReader& File = pData->m_File;
   if (File.Open(pResource->GetResourceID()).Failed())
+  {
+    EZ_DEFAULT_DELETE(pData);
     return res;
+  }
 
   res.m_sResourceDescription = File.GetFilePathRelative().GetData();
 
@@ -35,11 +69,13 @@ ezResourceLoadData ezResourceLoaderFromFile::OpenDataStream(const ezResource* pR
 
 #endif
 
-  FileResourceLoadData* pData = EZ_DEFAULT_NEW(FileResourceLoadData);
-
+  const ezArrayPtr<const ezUInt8> memoryView = File.GetMemoryView();
   const ezUInt64 uiFileSize = File.GetFileSize();
 
-  const ezUInt64 uiBlobCapacity = uiFileSize + File.GetFilePathAbsolute().GetElementCount() + 8; // +8 for the string overhead
+  // if the file content is already in memory (e.g. in a memory mapped archive), only the path needs to be stored
+  const ezUInt64 uiContentCapacity = memoryView.IsEmpty() ? uiFileSize : 0;
+
+  const ezUInt64 uiBlobCapacity = uiContentCapacity + File.GetFilePathAbsolute().GetElementCount() + 8; // +8 for the string overhead
   pData->m_Storage.SetCountUninitialized(uiBlobCapacity);
 
   ezUInt8* pBlobPtr = pData->m_Storage.GetBlobPtr<ezUInt8>().GetPtr();
@@ -51,10 +87,21 @@ ezResourceLoadData ezResourceLoaderFromFile::OpenDataStream(const ezResource* pR
 
   const ezUInt64 uiOffset = w.GetNumWrittenBytes();
 
-  File.ReadBytes(pBlobPtr + uiOffset, uiFileSize);
+  if (!memoryView.IsEmpty())
+  {
+    pData->m_InPlaceReader.m_PathReader.Reset(pBlobPtr, uiOffset);
+    pData->m_InPlaceReader.m_ContentReader.Reset(memoryView.GetPtr(), memoryView.GetCount());
+    res.m_pDataStream = &pData->m_InPlaceReader;
+  }
+  else
+  {
+    File.ReadBytes(pBlobPtr + uiOffset, uiFileSize);
+    File.Close();
+
+    pData->m_Reader.Reset(pBlobPtr, uiOffset + uiFileSize);
+    res.m_pDataStream = &pData->m_Reader;
+  }
 
-  pData->m_Reader.Reset(pBlobPtr, w.GetNumWrittenBytes() + uiFileSize);
-  res.m_pDataStream = &pData->m_Reader;
   res.m_pCustomLoaderData = pData;
 
   return res;
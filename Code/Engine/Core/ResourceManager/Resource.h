@@ -187,6 +187,11 @@ protected:
   /// All resources loaded from file are automatically flagged as reloadable.
   void SetIsReloadable(bool bIsReloadable) { m_Flags.AddOrRemove(ezResourceFlags::IsReloadable, bIsReloadable); }
 
+  /// \brief Allows a resource to announce that it could load more data than it currently has, e.g. because the desired quality changed.
+  ///
+  /// This only updates the bookkeeping, call ezResourceManager::PreloadResource() afterwards to actually queue the resource for loading.
+  void SetNumQualityLevelsLoadable(ezUInt8 uiNumLevels) { m_uiQualityLevelsLoadable = uiNumLevels; }
+
   /// \brief Used internally by the code injection macros
   void SetHasLoadingFallback(bool bHasLoadingFallback) { m_Flags.AddOrRemove(ezResourceFlags::ResourceHasFallback, bHasLoadingFallback); }
 
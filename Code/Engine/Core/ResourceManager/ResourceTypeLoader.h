@@ -59,6 +59,8 @@ public:
 ///
 /// The loader will interpret the ezResource 'resource ID' as a path, read that full file into a memory stream.
 /// The file modification data is stored as well.
+/// If the data directory already holds the file in memory (e.g. uncompressed entries in an ezArchive), the stream reads from that memory
+/// directly instead of copying it, and the file stays open until CloseDataStream() is called.
 /// Resources that use this loader can update their data as if they were reading the file directly.
 class EZ_CORE_DLL ezResourceLoaderFromFile : public ezResourceTypeLoader
 {
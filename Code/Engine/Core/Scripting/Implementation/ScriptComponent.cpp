@@ -270,7 +270,7 @@ void ezScriptComponent::InstantiateScript(bool bActivate)
   }
 
   m_pScriptType = pScriptType;
-  m_pMessageDispatchType = pScriptType;
+  SetMessageDispatchType(pScriptType);
 
   m_pInstance = pScript->Instantiate(*this, GetWorld());
   if (m_pInstance != nullptr)
@@ -316,7 +316,7 @@ void ezScriptComponent::ClearInstance(bool bDeactivate)
   m_pInstance = nullptr;
   m_pScriptType = nullptr;
 
-  m_pMessageDispatchType = GetDynamicRTTI();
+  SetMessageDispatchType(GetDynamicRTTI());
 }
 
 void ezScriptComponent::AddUpdateFunctionToSchedule()
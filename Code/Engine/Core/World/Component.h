@@ -135,6 +135,19 @@ public:
   /// \brief Checks whether the ezObjectFlags::CreatedByPrefab flag is set on this component.
   bool WasCreatedByPrefab() const { return m_ComponentFlags.IsSet(ezObjectFlags::CreatedByPrefab); }
 
+  /// \brief Increments the state version. Call this whenever data changes that SerializeComponent() writes.
+  ///
+  /// The active flag, the user flags and in-place deserialization through ezWorldReader mark the state as changed automatically.
+  void MarkStateChanged() { ++m_uiStateVersion; }
+
+  /// \brief Returns a counter that changes with every call to MarkStateChanged().
+  ///
+  /// Only reliable if HasStateVersionTracking() returns true, otherwise the component may change its state without updating the version.
+  ezUInt32 GetStateVersion() const { return m_uiStateVersion; }
+
+  /// \brief Returns whether the component type calls MarkStateChanged() for all of its state changes. See EnableStateVersionTracking().
+  bool HasStateVersionTracking() const { return m_ComponentFlags.IsSet(ezObjectFlags::StateVersionTracking); }
+
 
   /// \brief Deletes this component. Note that the component will be invalidated first and the actual deletion is postponed.
   void DeleteComponent();
@@ -209,6 +222,11 @@ protected:
   /// \brief By default disabled. Enable to have OnUnhandledMessage() called for every unhandled message.
   void EnableUnhandledMessageHandler(bool enable);
 
+  /// \brief Declares that this component calls MarkStateChanged() whenever its serialized state changes. Usually called in the constructor.
+  ///
+  /// This allows systems like ezWorldSnapshot to skip unchanged components without serializing them.
+  void EnableStateVersionTracking() { m_ComponentFlags.Add(ezObjectFlags::StateVersionTracking); }
+
   /// \brief When EnableUnhandledMessageHandler() was activated, this is called for all messages for which there is no dedicated message handler.
   ///
   /// \return Should return true if the given message was handled, false otherwise.
@@ -220,7 +238,11 @@ protected:
   virtual bool OnUnhandledMessage(ezMessage& msg, bool bWasPostedMsg) const;
 
 protected:
-  /// Messages will be dispatched to this type. Default is what GetDynamicRTTI() returns, can be redirected if necessary.
+  /// \brief Redirects message dispatch to the given type. Use this instead of writing m_pMessageDispatchType directly,
+  /// so that the world doesn't drop queued messages that only the redirected type can handle.
+  void SetMessageDispatchType(const ezRTTI* pType);
+
+  /// Messages will be dispatched to this type. Default is what GetDynamicRTTI() returns, can be redirected through SetMessageDispatchType().
   const ezRTTI* m_pMessageDispatchType = nullptr;
 
   bool IsInitialized() const;
@@ -231,6 +253,8 @@ private:
   // updates the component's active state depending on the owner object's active state
   void UpdateActiveState(bool bOwnerActive);
 
+  void NotifyCustomMessageHandling();
+
   ezGameObject* Reflection_GetOwner() const;
   ezWorld* Reflection_GetWorld() const;
   void Reflection_Update(ezTime deltaTime);
@@ -241,6 +265,7 @@ private:
   ezComponentId m_InternalId;
   ezBitflags<ezObjectFlags> m_ComponentFlags = ezObjectFlags::ActiveFlag;
   ezUInt32 m_uiUniqueID = ezInvalidIndex;
+  ezUInt32 m_uiStateVersion = 0;
 
   ezComponentManagerBase* m_pManager = nullptr;
   ezGameObject* m_pOwner = nullptr;
@@ -11,6 +11,8 @@
 #include <Core/World/Declarations.h>
 #include <Core/World/WorldModule.h>
 
+#include <tuple>
+
 /// \brief Base class for all component managers. Do not derive directly from this class, but derive from ezComponentManager instead.
 ///
 /// Every component type has its corresponding manager type. The manager stores the components in memory blocks to minimize overhead
@@ -154,6 +156,74 @@ private:
 
 //////////////////////////////////////////////////////////////////////////
 
+/// \brief Component manager that stores hot per-component data in parallel arrays (structure of arrays) next to the components.
+///
+/// Each type in HotFields gets its own array with one entry per component. The components themselves use compact block storage
+/// and the hot field arrays are kept in the same order, so component index i in the storage always corresponds to entry i in every
+/// hot field array.
+///
+/// Update functions can use ForEachBatch() to process the components in contiguous batches, where every batch provides matching
+/// slices of all hot field arrays. That allows tight (and vectorizable) loops that never touch the component objects themselves.
+/// Note that batches also contain inactive components. If that matters, store an activation flag as a hot field as well,
+/// e.g. by writing it in OnActivated() and OnDeactivated() of the component.
+template <typename T, typename... HotFields>
+class ezComponentManagerSoA : public ezComponentManager<T, ezBlockStorageType::Compact>
+{
+public:
+  using ComponentType = T;
+  using SUPER = ezComponentManager<T, ezBlockStorageType::Compact>;
+
+  template <ezUInt32 FieldIndex>
+  using HotFieldType = std::tuple_element_t<FieldIndex, std::tuple<HotFields...>>;
+
+  /// \brief A contiguous range of components together with the corresponding slices of the hot field arrays.
+  struct Batch
+  {
+    /// \brief Returns the number of components in this batch.
+    ezUInt32 GetCount() const { return m_Components.GetCount(); }
+
+    /// \brief Returns the slice of the hot field array with the given index.
+    template <ezUInt32 FieldIndex>
+    ezArrayPtr<HotFieldType<FieldIndex>> GetHotFields() const
+    {
+      return std::get<FieldIndex>(m_HotFields);
+    }
+
+    /// \brief The index of the first component of this batch in the component storage.
+    ezUInt32 m_uiFirstIndex = 0;
+    ezArrayPtr<ComponentType> m_Components;
+    std::tuple<ezArrayPtr<HotFields>...> m_HotFields;
+  };
+
+  ezComponentManagerSoA(ezWorld* pWorld);
+
+  /// \brief Returns the hot field with the given index of the given component.
+  ///
+  /// This needs to look up the index of the component, prefer ForEachBatch() when processing many components.
+  template <ezUInt32 FieldIndex>
+  HotFieldType<FieldIndex>& GetHotField(const ComponentType* pComponent);
+
+  /// \brief Returns the hot field with the given index of the given component.
+  template <ezUInt32 FieldIndex>
+  const HotFieldType<FieldIndex>& GetHotField(const ComponentType* pComponent) const;
+
+  /// \brief Returns the whole hot field array with the given index, in the same order as the component storage.
+  template <ezUInt32 FieldIndex>
+  ezArrayPtr<HotFieldType<FieldIndex>> GetHotFieldArray();
+
+  /// \brief Splits the component range of the given update context into contiguous batches and calls func(const Batch&) for each one.
+  template <typename Func>
+  void ForEachBatch(const ezWorldModule::UpdateContext& context, Func func);
+
+protected:
+  virtual ezComponent* CreateComponentStorage() override;
+  virtual void DeleteComponentStorage(ezComponent* pComponent, ezComponent*& out_pMovedComponent) override;
+
+  std::tuple<ezDynamicArray<HotFields>...> m_HotFieldArrays;
+};
+
+//////////////////////////////////////////////////////////////////////////
+
 #define EZ_ADD_COMPONENT_FUNCTIONALITY(componentType, baseType, managerType)                                            \
 public:                                                                                                                 \
   using ComponentManagerType = managerType;                                                                             \
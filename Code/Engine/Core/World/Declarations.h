@@ -218,6 +218,7 @@ struct ezObjectFlags
 
     CreatedByPrefab = EZ_BIT(13),                     ///< Such flagged objects and components are ignored during scene export (see ezWorldWriter) and will be removed when a prefab needs to be re-instantiated.
     HideShapeIcon = EZ_BIT(14),                       ///< Hide the shape icon of the object in the editor.
+    StateVersionTracking = EZ_BIT(15),                ///< The component calls MarkStateChanged() whenever the state written by SerializeComponent() changes.
 
     UserFlag0 = EZ_BIT(24),
     UserFlag1 = EZ_BIT(25),
@@ -249,8 +250,9 @@ struct ezObjectFlags
 
     StorageType CreatedByPrefab : 1;                     //< 13
     StorageType HideShapeIcon : 1;                       //< 14
+    StorageType StateVersionTracking : 1;                //< 15
 
-    StorageType Padding : 9;                             // 15 - 23
+    StorageType Padding : 8;                             // 16 - 23
 
     StorageType UserFlag0 : 1;                           //< 24
     StorageType UserFlag1 : 1;                           //< 25
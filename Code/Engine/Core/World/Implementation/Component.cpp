@@ -37,6 +37,7 @@ void ezComponent::SetActiveFlag(bool bEnabled)
   if (m_ComponentFlags.IsSet(ezObjectFlags::ActiveFlag) != bEnabled)
   {
     m_ComponentFlags.AddOrRemove(ezObjectFlags::ActiveFlag, bEnabled);
+    MarkStateChanged();
 
     UpdateActiveState(GetOwner() == nullptr ? true : GetOwner()->IsActive());
   }
@@ -80,6 +81,12 @@ void ezComponent::EnsureInitialized()
 
     Initialize();
 
+    if (m_ComponentFlags.IsSet(ezObjectFlags::UnhandledMessageHandler))
+    {
+      // may have been enabled before the component was added to a manager
+      NotifyCustomMessageHandling();
+    }
+
     m_ComponentFlags.Remove(ezObjectFlags::Initializing);
     m_ComponentFlags.Add(ezObjectFlags::Initialized);
   }
@@ -121,7 +128,13 @@ void ezComponent::SetUserFlag(ezUInt8 uiFlagIndex, bool bSet)
 {
   EZ_ASSERT_DEBUG(uiFlagIndex < 8, "Flag index {0} is out of the valid range [0 - 7]", uiFlagIndex);
 
-  m_ComponentFlags.AddOrRemove(static_cast<ezObjectFlags::Enum>(ezObjectFlags::UserFlag0 << uiFlagIndex), bSet);
+  const ezObjectFlags::Enum flag = static_cast<ezObjectFlags::Enum>(ezObjectFlags::UserFlag0 << uiFlagIndex);
+
+  if (m_ComponentFlags.IsSet(flag) != bSet)
+  {
+    m_ComponentFlags.AddOrRemove(flag, bSet);
+    MarkStateChanged();
+  }
 }
 
 bool ezComponent::GetUserFlag(ezUInt8 uiFlagIndex) const
@@ -154,6 +167,30 @@ void ezComponent::OnSimulationStarted() {}
 void ezComponent::EnableUnhandledMessageHandler(bool enable)
 {
   m_ComponentFlags.AddOrRemove(ezObjectFlags::UnhandledMessageHandler, enable);
+
+  if (enable)
+  {
+    NotifyCustomMessageHandling();
+  }
+}
+
+void ezComponent::SetMessageDispatchType(const ezRTTI* pType)
+{
+  m_pMessageDispatchType = pType;
+
+  if (pType != GetDynamicRTTI())
+  {
+    NotifyCustomMessageHandling();
+  }
+}
+
+void ezComponent::NotifyCustomMessageHandling()
+{
+  // the world can't filter queued messages by this component's type anymore
+  if (m_pManager != nullptr)
+  {
+    GetWorld()->SetComponentTypeHasCustomMessageHandling(m_InternalId.m_TypeId);
+  }
 }
 
 bool ezComponent::OnUnhandledMessage(ezMessage& msg, bool bWasPostedMsg)
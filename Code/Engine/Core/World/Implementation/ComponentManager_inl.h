@@ -212,3 +212,81 @@ void ezComponentManagerSimple<ComponentType, UpdateType, StorageType, UpdatePhas
     out_sName = sName;
   }
 }
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename T, typename... HotFields>
+ezComponentManagerSoA<T, HotFields...>::ezComponentManagerSoA(ezWorld* pWorld)
+  : ezComponentManager<T, ezBlockStorageType::Compact>(pWorld)
+  , m_HotFieldArrays(ezDynamicArray<HotFields>(this->GetAllocator())...)
+{
+}
+
+template <typename T, typename... HotFields>
+template <ezUInt32 FieldIndex>
+EZ_FORCE_INLINE auto ezComponentManagerSoA<T, HotFields...>::GetHotField(const ComponentType* pComponent) -> HotFieldType<FieldIndex>&
+{
+  return std::get<FieldIndex>(m_HotFieldArrays)[this->m_ComponentStorage.GetIndex(pComponent)];
+}
+
+template <typename T, typename... HotFields>
+template <ezUInt32 FieldIndex>
+EZ_FORCE_INLINE auto ezComponentManagerSoA<T, HotFields...>::GetHotField(const ComponentType* pComponent) const -> const HotFieldType<FieldIndex>&
+{
+  return std::get<FieldIndex>(m_HotFieldArrays)[this->m_ComponentStorage.GetIndex(pComponent)];
+}
+
+template <typename T, typename... HotFields>
+template <ezUInt32 FieldIndex>
+EZ_ALWAYS_INLINE auto ezComponentManagerSoA<T, HotFields...>::GetHotFieldArray() -> ezArrayPtr<HotFieldType<FieldIndex>>
+{
+  return std::get<FieldIndex>(m_HotFieldArrays).GetArrayPtr();
+}
+
+template <typename T, typename... HotFields>
+template <typename Func>
+void ezComponentManagerSoA<T, HotFields...>::ForEachBatch(const ezWorldModule::UpdateContext& context, Func func)
+{
+  const ezUInt32 uiCount = this->m_ComponentStorage.GetCount();
+  const ezUInt32 uiEndIndex = ezMath::Min(ezMath::Max(context.m_uiFirstComponentIndex + context.m_uiComponentCount, context.m_uiComponentCount), uiCount);
+
+  Batch batch;
+  batch.m_uiFirstIndex = context.m_uiFirstComponentIndex;
+
+  while (batch.m_uiFirstIndex < uiEndIndex)
+  {
+    // a batch never crosses a block boundary of the component storage
+    batch.m_Components = this->m_ComponentStorage.GetContiguousRange(batch.m_uiFirstIndex, uiEndIndex - batch.m_uiFirstIndex);
+    batch.m_HotFields = std::apply([&](auto&... arrays)
+      { return std::make_tuple(arrays.GetArrayPtr().GetSubArray(batch.m_uiFirstIndex, batch.m_Components.GetCount())...); },
+      m_HotFieldArrays);
+
+    func(static_cast<const Batch&>(batch));
+
+    batch.m_uiFirstIndex += batch.m_Components.GetCount();
+  }
+}
+
+template <typename T, typename... HotFields>
+ezComponent* ezComponentManagerSoA<T, HotFields...>::CreateComponentStorage()
+{
+  // compact storage always appends at the end, so the new hot field entries line up with the new component
+  std::apply([](auto&... arrays)
+    { ((arrays.ExpandAndGetRef() = {}), ...); },
+    m_HotFieldArrays);
+
+  return SUPER::CreateComponentStorage();
+}
+
+template <typename T, typename... HotFields>
+void ezComponentManagerSoA<T, HotFields...>::DeleteComponentStorage(ezComponent* pComponent, ezComponent*& out_pMovedComponent)
+{
+  const ezUInt32 uiIndex = this->m_ComponentStorage.GetIndex(static_cast<T*>(pComponent));
+
+  SUPER::DeleteComponentStorage(pComponent, out_pMovedComponent);
+
+  // compact storage moves the last component into the gap, mirror that in the hot field arrays
+  std::apply([uiIndex](auto&... arrays)
+    { (arrays.RemoveAtAndSwap(uiIndex), ...); },
+    m_HotFieldArrays);
+}
@@ -599,6 +599,7 @@ ezWorldModule* ezWorld::GetOrCreateModule(const ezRTTI* pRtti)
     pModule->Initialize();
 
     m_Data.m_Modules[uiTypeId] = pModule;
+    m_Data.m_MessageHandlerCache.Clear();
 
     if (m_Data.m_bSimulateWorld)
     {
@@ -854,10 +855,16 @@ ezStringView ezWorld::GetObjectGlobalKey(const ezGameObject* pObject) const
 
 void ezWorld::ProcessQueuedMessage(const ezInternal::WorldData::MessageQueue::Entry& entry)
 {
+  if (!MayHandleMessage(*entry.m_pMessage))
+    return;
+
   if (entry.m_MetaData.m_uiReceiverIsComponent)
   {
     ezComponentHandle hComponent(ezComponentId(entry.m_MetaData.m_uiReceiverObjectOrComponent));
 
+    if (!ComponentTypeMayHandleMessage(hComponent.GetInternalID().m_TypeId, *entry.m_pMessage))
+      return;
+
     ezComponent* pReceiverComponent = nullptr;
     if (TryGetComponent(hComponent, pReceiverComponent))
     {
@@ -901,6 +908,39 @@ void ezWorld::ProcessQueuedMessage(const ezInternal::WorldData::MessageQueue::En
   }
 }
 
+void ezWorld::ProcessQueuedComponentMessages(const ezInternal::WorldData::MessageQueue& queue, ezUInt32 uiFirstEntry, ezUInt32 uiNumEntries)
+{
+  // all entries are messages of the same type sent to components of the same type,
+  // so whether they can be handled at all only needs to be checked once for the whole batch
+  const ezMessage& firstMsg = *queue[uiFirstEntry].m_pMessage;
+  const ezWorldModuleTypeId componentTypeId = ezComponentId(queue[uiFirstEntry].m_MetaData.m_uiReceiverObjectOrComponent).m_TypeId;
+
+  if (!ComponentTypeMayHandleMessage(componentTypeId, firstMsg))
+    return;
+
+  for (ezUInt32 i = uiFirstEntry; i < uiFirstEntry + uiNumEntries; ++i)
+  {
+    const ezInternal::WorldData::MessageQueue::Entry& entry = queue[i];
+
+    ezComponentHandle hComponent(ezComponentId(entry.m_MetaData.m_uiReceiverObjectOrComponent));
+
+    ezComponent* pReceiverComponent = nullptr;
+    if (TryGetComponent(hComponent, pReceiverComponent))
+    {
+      pReceiverComponent->SendMessageInternal(*entry.m_pMessage, true);
+    }
+    else
+    {
+#if EZ_ENABLED(EZ_COMPILE_FOR_DEBUG)
+      if (entry.m_pMessage->GetDebugMessageRouting())
+      {
+        ezLog::Warning("ezWorld::ProcessQueuedMessage: Receiver ezComponent for message of type '{0}' does not exist anymore.", entry.m_pMessage->GetId());
+      }
+#endif
+    }
+  }
+}
+
 void ezWorld::ProcessQueuedMessages(ezObjectMsgQueueType::Enum queueType)
 {
   EZ_PROFILE_SCOPE("Process Queued Messages");
@@ -943,9 +983,42 @@ void ezWorld::ProcessQueuedMessages(ezObjectMsgQueueType::Enum queueType)
     queue.Sort(MessageComparer());
 
     m_Data.m_ProcessingMessageQueue = queueType;
-    for (ezUInt32 i = 0; i < queue.GetCount(); ++i)
+    for (ezUInt32 i = 0; i < queue.GetCount();)
     {
-      ProcessQueuedMessage(queue[i]);
+      const auto& entry = queue[i];
+
+      if (!MayHandleMessage(*entry.m_pMessage))
+      {
+        ++i;
+        continue;
+      }
+
+      if (!entry.m_MetaData.m_uiReceiverIsComponent)
+      {
+        ProcessQueuedMessage(entry);
+        ++i;
+        continue;
+      }
+
+      // The sort order puts messages of the same type to the same component type next to each other,
+      // since the component type id is stored in the upper bits of the receiver id. Deliver them as one batch.
+      const ezMessageId msgId = entry.m_pMessage->GetId();
+      const ezTime due = entry.m_MetaData.m_Due;
+      const ezWorldModuleTypeId componentTypeId = ezComponentId(entry.m_MetaData.m_uiReceiverObjectOrComponent).m_TypeId;
+
+      ezUInt32 uiEnd = i + 1;
+      while (uiEnd < queue.GetCount())
+      {
+        const auto& nextEntry = queue[uiEnd];
+        if (!nextEntry.m_MetaData.m_uiReceiverIsComponent || nextEntry.m_pMessage->GetId() != msgId || nextEntry.m_MetaData.m_Due != due ||
+            ezComponentId(nextEntry.m_MetaData.m_uiReceiverObjectOrComponent).m_TypeId != componentTypeId)
+          break;
+
+        ++uiEnd;
+      }
+
+      ProcessQueuedComponentMessages(queue, i, uiEnd - i);
+      i = uiEnd;
 
       // no need to deallocate these messages, they are allocated through a frame allocator
     }
@@ -978,6 +1051,71 @@ void ezWorld::ProcessQueuedMessages(ezObjectMsgQueueType::Enum queueType)
   }
 }
 
+bool ezWorld::MayHandleMessage(const ezMessage& msg)
+{
+#if EZ_ENABLED(EZ_COMPILE_FOR_DEBUG)
+  // take the regular path so that the routing warnings are written
+  if (msg.GetDebugMessageRouting())
+    return true;
+#endif
+
+  using CacheState = ezInternal::WorldData::MessageHandlerCacheState;
+
+  const ezMessageId msgId = msg.GetId();
+  if (msgId >= m_Data.m_MessageHandlerCache.GetCount())
+  {
+    m_Data.m_MessageHandlerCache.SetCount(msgId + 1, CacheState::Unknown);
+  }
+
+  ezUInt8& uiState = m_Data.m_MessageHandlerCache[msgId];
+  if (uiState == CacheState::Unknown)
+  {
+    bool bMayHandle = ezGetStaticRTTI<ezGameObject>()->CanHandleMessage(msgId);
+
+    for (ezUInt32 uiTypeId = 0; uiTypeId < m_Data.m_Modules.GetCount() && !bMayHandle; ++uiTypeId)
+    {
+      if (m_Data.m_Modules[uiTypeId] != nullptr)
+      {
+        bMayHandle = ComponentTypeMayHandleMessage(static_cast<ezWorldModuleTypeId>(uiTypeId), msg);
+      }
+    }
+
+    uiState = bMayHandle ? CacheState::MayHandle : CacheState::NoHandler;
+  }
+
+  return uiState == CacheState::MayHandle;
+}
+
+bool ezWorld::ComponentTypeMayHandleMessage(ezWorldModuleTypeId componentTypeId, const ezMessage& msg) const
+{
+#if EZ_ENABLED(EZ_COMPILE_FOR_DEBUG)
+  if (msg.GetDebugMessageRouting())
+    return true;
+#endif
+
+  const auto& customTypes = m_Data.m_ComponentTypesWithCustomMessageHandling;
+  if (componentTypeId < customTypes.GetCount() && customTypes.IsBitSet(componentTypeId))
+    return true;
+
+  const ezRTTI* pRtti = ezWorldModuleFactory::GetInstance()->GetRtti(componentTypeId);
+  return pRtti == nullptr || pRtti->CanHandleMessage(msg.GetId());
+}
+
+void ezWorld::SetComponentTypeHasCustomMessageHandling(ezWorldModuleTypeId componentTypeId)
+{
+  auto& customTypes = m_Data.m_ComponentTypesWithCustomMessageHandling;
+  if (componentTypeId >= customTypes.GetCount())
+  {
+    customTypes.SetCount(componentTypeId + 1);
+  }
+
+  if (!customTypes.IsBitSet(componentTypeId))
+  {
+    customTypes.SetBit(componentTypeId);
+    m_Data.m_MessageHandlerCache.Clear();
+  }
+}
+
 // static
 template <typename World, typename GameObject, typename Component>
 void ezWorld::FindEventMsgHandlers(World& world, const ezMessage& msg, GameObject pSearchObject, ezDynamicArray<Component>& out_components)
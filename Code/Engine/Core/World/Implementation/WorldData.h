@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Foundation/Communication/MessageQueue.h>
+#include <Foundation/Containers/Bitfield.h>
 #include <Foundation/Containers/HashTable.h>
 #include <Foundation/Math/Random.h>
 #include <Foundation/Memory/FrameAllocator.h>
@@ -237,6 +238,22 @@ namespace ezInternal
     mutable MessageQueue m_TimedMessageQueues[ezObjectMsgQueueType::COUNT];
     ezObjectMsgQueueType::Enum m_ProcessingMessageQueue = ezObjectMsgQueueType::COUNT;
 
+    // per message id: whether any module in this world may handle it, see ezWorld::MayHandleMessage
+    struct MessageHandlerCacheState
+    {
+      enum Enum : ezUInt8
+      {
+        Unknown,
+        NoHandler,
+        MayHandle
+      };
+    };
+    ezDynamicArray<ezUInt8, ezLocalAllocatorWrapper> m_MessageHandlerCache;
+
+    // per component type id: at least one instance handles messages that are not known to the type's reflection,
+    // e.g. through an unhandled message handler or a redirected message dispatch type
+    ezDynamicBitfield m_ComponentTypesWithCustomMessageHandling;
+
     ezThreadID m_WriteThreadID;
     ezInt32 m_iWriteCounter = 0;
     mutable ezAtomicInteger32 m_iReadCounter;
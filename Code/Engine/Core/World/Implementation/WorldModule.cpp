@@ -89,6 +89,16 @@ ezWorldModuleTypeId ezWorldModuleFactory::GetTypeId(const ezRTTI* pRtti)
   return uiTypeId;
 }
 
+const ezRTTI* ezWorldModuleFactory::GetRtti(ezWorldModuleTypeId typeId) const
+{
+  if (typeId < m_CreatorFuncs.GetCount())
+  {
+    return m_CreatorFuncs[typeId].m_pRtti;
+  }
+
+  return nullptr;
+}
+
 ezWorldModule* ezWorldModuleFactory::CreateWorldModule(ezWorldModuleTypeId typeId, ezWorld* pWorld)
 {
   if (typeId < m_CreatorFuncs.GetCount())
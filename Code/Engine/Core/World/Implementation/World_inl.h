@@ -165,6 +165,7 @@ ManagerType* ezWorld::GetOrCreateComponentManager()
 
     m_Data.m_Modules[uiTypeId] = pModule;
     m_Data.m_ModulesToStartSimulation.PushBack(pModule);
+    m_Data.m_MessageHandlerCache.Clear();
   }
 
   return pModule;
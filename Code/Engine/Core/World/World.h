@@ -421,8 +421,18 @@ private:
 
   void PostMessage(const ezGameObjectHandle& receiverObject, const ezMessage& msg, ezObjectMsgQueueType::Enum queueType, ezTime delay, bool bRecursive) const;
   void ProcessQueuedMessage(const ezInternal::WorldData::MessageQueue::Entry& entry);
+  void ProcessQueuedComponentMessages(const ezInternal::WorldData::MessageQueue& queue, ezUInt32 uiFirstEntry, ezUInt32 uiNumEntries);
   void ProcessQueuedMessages(ezObjectMsgQueueType::Enum queueType);
 
+  /// \brief Returns false if neither ezGameObject nor any component type in this world can handle the given message, so it can be dropped right away.
+  bool MayHandleMessage(const ezMessage& msg);
+
+  /// \brief Returns false if components of the given type will never handle the given message.
+  bool ComponentTypeMayHandleMessage(ezWorldModuleTypeId componentTypeId, const ezMessage& msg) const;
+
+  /// \brief Called when a component starts to handle messages that are not known to its type's reflection, see ezComponent::EnableUnhandledMessageHandler().
+  void SetComponentTypeHasCustomMessageHandling(ezWorldModuleTypeId componentTypeId);
+
   template <typename World, typename GameObject, typename Component>
   static void FindEventMsgHandlers(World& world, const ezMessage& msg, GameObject pSearchObject, ezDynamicArray<Component>& out_components);
 
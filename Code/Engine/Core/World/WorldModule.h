@@ -130,6 +130,9 @@ public:
   /// \brief Returns the module type id to the given rtti module/component type.
   ezWorldModuleTypeId GetTypeId(const ezRTTI* pRtti);
 
+  /// \brief Returns the rtti module/component type that was registered for the given type id.
+  const ezRTTI* GetRtti(ezWorldModuleTypeId typeId) const;
+
   /// \brief Creates a new instance of the world module with the given type id and world.
   ezWorldModule* CreateWorldModule(ezUInt16 uiTypeId, ezWorld* pWorld);
 
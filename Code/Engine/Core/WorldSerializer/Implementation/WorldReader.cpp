@@ -1,13 +1,17 @@
 #include <Core/CorePCH.h>
 
+#include <Core/Messages/CommonMessages.h>
 #include <Core/WorldSerializer/WorldReader.h>
+#include <Core/WorldSerializer/WorldWriter.h>
 #include <Foundation/IO/StringDeduplicationContext.h>
+#include <Foundation/Threading/TaskSystem.h>
 #include <Foundation/Types/ScopeExit.h>
 #include <Foundation/Utilities/Progress.h>
 
 ezWorldReader::FindComponentTypeCallback ezWorldReader::s_FindComponentTypeCallback;
 
 thread_local ezWorldReader::InstantiationContextBase* tl_pReaderContext = nullptr;
+thread_local ezStreamReader* tl_pReaderStream = nullptr;
 
 ezWorldReader::ezWorldReader() = default;
 ezWorldReader::~ezWorldReader() = default;
@@ -19,7 +23,7 @@ ezResult ezWorldReader::ReadWorldDescription(ezStreamReader& inout_stream, bool
   m_uiVersion = 0;
   inout_stream >> m_uiVersion;
 
-  if (m_uiVersion < 8 || m_uiVersion > 10)
+  if (m_uiVersion < 8 || m_uiVersion > ezWorldWriter::s_uiCurrentVersion)
   {
     ezLog::Error("Invalid world version (got {}).", m_uiVersion);
     return EZ_FAILURE;
@@ -88,6 +92,11 @@ ezUniquePtr<ezWorldReader::InstantiationContextBase> ezWorldReader::InstantiateW
   return Instantiate(ref_world, false, ezTransform(), options);
 }
 
+ezUniquePtr<ezWorldReader::InstantiationContextBase> ezWorldReader::InstantiateWorld(ezWorld& ref_world, const ezPrefabInstantiationOptions& options)
+{
+  return Instantiate(ref_world, false, ezTransform(), options);
+}
+
 ezUniquePtr<ezWorldReader::InstantiationContextBase> ezWorldReader::InstantiatePrefab(ezWorld& ref_world, const ezTransform& rootTransform, const ezPrefabInstantiationOptions& options)
 {
   return Instantiate(ref_world, true, rootTransform, options);
@@ -95,9 +104,7 @@ ezUniquePtr<ezWorldReader::InstantiationContextBase> ezWorldReader::InstantiateP
 
 ezStreamReader& ezWorldReader::GetStream() const
 {
-  ezWorldReader::InstantiationContext* pContext = ((ezWorldReader::InstantiationContext*)tl_pReaderContext);
-
-  return pContext->m_CurrentReader;
+  return *tl_pReaderStream;
 }
 
 ezGameObjectHandle ezWorldReader::ReadGameObjectHandle()
@@ -105,7 +112,7 @@ ezGameObjectHandle ezWorldReader::ReadGameObjectHandle()
   ezWorldReader::InstantiationContext* pContext = ((ezWorldReader::InstantiationContext*)tl_pReaderContext);
 
   ezUInt32 idx = 0;
-  pContext->m_CurrentReader >> idx;
+  *tl_pReaderStream >> idx;
 
   return pContext->m_IndexToGameObjectHandle[idx];
 }
@@ -117,8 +124,8 @@ void ezWorldReader::ReadComponentHandle(ezComponentHandle& out_hComponent)
   ezUInt16 uiTypeIndex = 0;
   ezUInt32 uiIndex = 0;
 
-  pContext->m_CurrentReader >> uiTypeIndex;
-  pContext->m_CurrentReader >> uiIndex;
+  *tl_pReaderStream >> uiTypeIndex;
+  *tl_pReaderStream >> uiIndex;
 
   out_hComponent.Invalidate();
 
@@ -227,6 +234,119 @@ void ezWorldReader::ReadGameObjectDesc(GameObjectToCreate& godesc)
   }
 }
 
+void ezWorldReader::BeginRestoreInPlace(ezWorld& ref_world, ezArrayPtr<const ezGameObjectHandle> objects, ezArrayPtr<const ezRTTI* const> componentTypes, ezArrayPtr<const ezDynamicArray<ezComponentHandle>> components)
+{
+  EZ_ASSERT_DEV(m_pRestoreContext == nullptr, "EndRestoreInPlace() has not been called");
+
+  ClearAndCompact();
+
+  // the state is always written with the current version of ezWorldWriter and the current component type versions
+  m_uiVersion = ezWorldWriter::s_uiCurrentVersion;
+
+  m_ComponentTypes.SetCount(componentTypes.GetCount());
+  for (ezUInt32 i = 0; i < componentTypes.GetCount(); ++i)
+  {
+    m_ComponentTypes[i].m_pRtti = componentTypes[i];
+    m_ComponentTypes[i].m_uiNumComponents = components[i].GetCount() - 1;
+
+    m_ComponentTypeVersions[componentTypes[i]] = componentTypes[i]->GetTypeVersion();
+  }
+
+  m_pRestoreContext = EZ_DEFAULT_NEW(InstantiationContext, *this, &ref_world, false, ezTransform(), ezPrefabInstantiationOptions());
+  m_pRestoreContext->m_IndexToGameObjectHandle = objects;
+
+  for (ezUInt32 i = 0; i < components.GetCount(); ++i)
+  {
+    m_pRestoreContext->m_ComponentTypeStates[i].m_ComponentIndexToHandle = components[i];
+  }
+}
+
+void ezWorldReader::EndRestoreInPlace()
+{
+  m_pRestoreContext = nullptr;
+
+  ClearAndCompact();
+}
+
+void ezWorldReader::RestoreGameObjectState(ezStreamReader& inout_stream, ezGameObject* pObject)
+{
+  GameObjectToCreate godesc;
+
+  m_pReadStream = &inout_stream;
+  ReadGameObjectDesc(godesc);
+  m_pReadStream = nullptr;
+
+  const ezGameObjectDesc& desc = godesc.m_Desc;
+  const auto& indexToHandle = m_pRestoreContext->m_IndexToGameObjectHandle;
+
+  const ezGameObjectHandle hParent = godesc.m_uiParentHandleIdx < indexToHandle.GetCount() ? indexToHandle[godesc.m_uiParentHandleIdx] : ezGameObjectHandle();
+  const ezGameObjectHandle hCurrentParent = pObject->GetParent() != nullptr ? pObject->GetParent()->GetHandle() : ezGameObjectHandle();
+
+  if (hParent != hCurrentParent)
+  {
+    const ezGameObjectHandle hObject = pObject->GetHandle();
+
+    // the local transform is restored below anyway
+    pObject->SetParent(hParent, ezTransformPreservation::PreserveLocal);
+
+    // changing the parent can move the object in memory
+    EZ_VERIFY(m_pRestoreContext->m_pWorld->TryGetObject(hObject, pObject), "Object must still exist");
+  }
+
+  pObject->SetName(desc.m_sName);
+  pObject->SetGlobalKey(godesc.m_sGlobalKey);
+  pObject->SetLocalPosition(desc.m_LocalPosition);
+  pObject->SetLocalRotation(desc.m_LocalRotation);
+  pObject->SetLocalScaling(desc.m_LocalScaling);
+  pObject->SetLocalUniformScaling(desc.m_LocalUniformScaling);
+  pObject->SetActiveFlag(desc.m_bActiveFlag);
+  pObject->SetTags(desc.m_Tags);
+  pObject->SetTeamID(desc.m_uiTeamID);
+  pObject->SetStableRandomSeed(desc.m_uiStableRandomSeed);
+
+  if (desc.m_bDynamic && !pObject->IsDynamic())
+  {
+    pObject->MakeDynamic();
+  }
+  else if (!desc.m_bDynamic && pObject->IsDynamic())
+  {
+    pObject->MakeStatic();
+  }
+}
+
+void ezWorldReader::RestoreComponentState(ezStreamReader& inout_stream, ezComponent* pComponent)
+{
+  bool bActive = true;
+  inout_stream >> bActive;
+
+  ezUInt8 userFlags = 0;
+  inout_stream >> userFlags;
+
+  pComponent->SetActiveFlag(bActive);
+
+  for (ezUInt8 i = 0; i < 8; ++i)
+  {
+    pComponent->SetUserFlag(i, (userFlags & EZ_BIT(i)) != 0);
+  }
+
+  tl_pReaderContext = m_pRestoreContext.Borrow();
+  tl_pReaderStream = &inout_stream;
+
+  EZ_SCOPE_EXIT(tl_pReaderContext = nullptr; tl_pReaderStream = nullptr;);
+
+  pComponent->DeserializeComponent(*this);
+  pComponent->MarkStateChanged();
+
+  // the component is already running, let it rebuild whatever it derived from its previous state
+  if (pComponent->IsActiveAndInitialized())
+  {
+    ezMsgComponentStateRestored msg;
+    pComponent->SendMessage(msg);
+
+    pComponent->GetOwner()->UpdateLocalBounds();
+  }
+}
+
 void ezWorldReader::ReadComponentTypeInfo(ezUInt32 uiComponentTypeIdx)
 {
   ezStreamReader& s = *m_pReadStream;
@@ -445,11 +565,9 @@ ezWorldReader::InstantiationContext::StepResult ezWorldReader::InstantiationCont
     {
       m_WorldReader.m_pStringDedupReadContext->SetActive(true);
       tl_pReaderContext = this;
+      tl_pReaderStream = &m_CurrentReader;
 
-      // ezStreamReader* pPrevReader = m_WorldReader.m_pStream;
-      // m_WorldReader.m_pStream = &m_CurrentReader;
-
-      EZ_SCOPE_EXIT(/*m_WorldReader.m_pStream = pPrevReader; */ m_WorldReader.m_pStringDedupReadContext->SetActive(false); tl_pReaderContext = nullptr;);
+      EZ_SCOPE_EXIT(m_WorldReader.m_pStringDedupReadContext->SetActive(false); tl_pReaderContext = nullptr; tl_pReaderStream = nullptr;);
 
       if (!CreateComponents(endTime))
         return StepResult::Continue;
@@ -464,16 +582,22 @@ ezWorldReader::InstantiationContext::StepResult ezWorldReader::InstantiationCont
   {
     if (m_WorldReader.m_ComponentDataStream.GetStorageSize64() > 0)
     {
-      m_WorldReader.m_pStringDedupReadContext->SetActive(true);
-      tl_pReaderContext = this;
-
-      // ezStreamReader* pPrevReader = m_WorldReader.m_pStream;
-      // m_WorldReader.m_pStream = &m_CurrentReader;
+      if (m_Options.m_bDeserializeComponentsInParallel)
+      {
+        if (!DeserializeComponentsParallel(endTime))
+          return StepResult::Continue;
+      }
+      else
+      {
+        m_WorldReader.m_pStringDedupReadContext->SetActive(true);
+        tl_pReaderContext = this;
+        tl_pReaderStream = &m_CurrentReader;
 
-      EZ_SCOPE_EXIT(/*m_WorldReader.m_pStream = pPrevReader;*/ m_WorldReader.m_pStringDedupReadContext->SetActive(false); tl_pReaderContext = nullptr;);
+        EZ_SCOPE_EXIT(m_WorldReader.m_pStringDedupReadContext->SetActive(false); tl_pReaderContext = nullptr; tl_pReaderStream = nullptr;);
 
-      if (!DeserializeComponents(endTime))
-        return StepResult::Continue;
+        if (!DeserializeComponents(endTime))
+          return StepResult::Continue;
+      }
     }
 
     m_CurrentReader.SetStorage(nullptr);
@@ -729,6 +853,141 @@ bool ezWorldReader::InstantiationContext::DeserializeComponents(ezTime endTime)
   return true;
 }
 
+bool ezWorldReader::InstantiationContext::DeserializeComponentsParallel(ezTime endTime)
+{
+  EZ_PROFILE_SCOPE("ezWorldReader::DeserializeComponentsParallel");
+
+  const ezUInt32 uiNumComponentTypes = m_WorldReader.m_ComponentTypes.GetCount();
+
+  if (!m_bParallelDeserializationStarted)
+  {
+    // The data of each component type is stored in one contiguous block, so every type can be read independently.
+    // The managers are looked up here, because accessing them through the world isn't allowed from other threads.
+    ezUInt64 uiDataOffset = 0;
+
+    for (ezUInt32 uiType = 0; uiType < uiNumComponentTypes; ++uiType)
+    {
+      const auto& compTypeInfo = m_WorldReader.m_ComponentTypes[uiType];
+      if (compTypeInfo.m_pRtti == nullptr)
+        continue;
+
+      auto& compTypeState = m_ComponentTypeStates[uiType];
+      compTypeState.m_uiDataReadOffset = uiDataOffset;
+      compTypeState.m_uiDataReadPosition = uiDataOffset;
+      compTypeState.m_uiNextComponentIndex = 0;
+      compTypeState.m_pManager = m_pWorld->GetManagerForComponentType(compTypeInfo.m_pRtti);
+
+      uiDataOffset += compTypeInfo.m_uiComponentDataSize;
+    }
+
+    m_bParallelDeserializationStarted = true;
+  }
+
+  ezHybridArray<ezUInt32, 64> pendingTypes;
+  for (ezUInt32 uiType = 0; uiType < uiNumComponentTypes; ++uiType)
+  {
+    const auto& compTypeState = m_ComponentTypeStates[uiType];
+    if (m_WorldReader.m_ComponentTypes[uiType].m_pRtti != nullptr && compTypeState.m_uiNextComponentIndex < compTypeState.m_ComponentIndexToHandle.GetCount())
+    {
+      pendingTypes.PushBack(uiType);
+    }
+  }
+
+  if (!pendingTypes.IsEmpty())
+  {
+    // The calling thread holds the world write lock and participates in the work, so the world can't be modified while the tasks run.
+    ezParallelForParams params;
+    params.m_uiBinSize = 1;
+    params.m_uiMaxTasksPerThread = 4;
+    params.m_NestingMode = ezTaskNesting::Maybe;
+
+    ezTaskSystem::ParallelForIndexed(
+      0, pendingTypes.GetCount(), [&](ezUInt32 uiStartIndex, ezUInt32 uiEndIndex)
+      {
+        for (ezUInt32 i = uiStartIndex; i < uiEndIndex; ++i)
+        {
+          DeserializeComponentsOfType(pendingTypes[i], endTime);
+        }
+      },
+      "ezWorldReader::DeserializeComponents", ezTaskNesting::Maybe, params);
+
+    ezUInt64 uiNumProcessed = 0;
+    bool bFinished = true;
+
+    for (ezUInt32 uiType : pendingTypes)
+    {
+      const auto& compTypeState = m_ComponentTypeStates[uiType];
+      bFinished &= compTypeState.m_uiNextComponentIndex >= compTypeState.m_ComponentIndexToHandle.GetCount();
+    }
+
+    if (!bFinished)
+    {
+      for (const auto& compTypeState : m_ComponentTypeStates)
+      {
+        uiNumProcessed += compTypeState.m_uiNextComponentIndex;
+      }
+
+      SetSubProgressCompletion((double)uiNumProcessed / m_WorldReader.m_uiTotalNumComponents);
+      return false;
+    }
+  }
+
+  m_uiCurrentIndex = 0;
+  m_uiCurrentComponentTypeIndex = 0;
+  m_uiCurrentNumComponentsProcessed = 0;
+  m_bParallelDeserializationStarted = false;
+
+  return true;
+}
+
+void ezWorldReader::InstantiationContext::DeserializeComponentsOfType(ezUInt32 uiComponentTypeIndex, ezTime endTime)
+{
+  const auto& compTypeInfo = m_WorldReader.m_ComponentTypes[uiComponentTypeIndex];
+  auto& compTypeState = m_ComponentTypeStates[uiComponentTypeIndex];
+
+  ezMemoryStreamReader reader(&m_WorldReader.m_ComponentDataStream);
+  reader.SetReadPosition(compTypeState.m_uiDataReadPosition);
+
+  m_WorldReader.m_pStringDedupReadContext->SetActive(true);
+  tl_pReaderContext = this;
+  tl_pReaderStream = &reader;
+
+  EZ_SCOPE_EXIT(m_WorldReader.m_pStringDedupReadContext->SetActive(false); tl_pReaderContext = nullptr; tl_pReaderStream = nullptr;);
+
+  // the first index is always the invalid handle
+  if (compTypeState.m_uiNextComponentIndex == 0)
+  {
+    compTypeState.m_uiNextComponentIndex = 1;
+  }
+
+  const ezUInt32 uiNumComponents = compTypeState.m_ComponentIndexToHandle.GetCount();
+
+  while (compTypeState.m_uiNextComponentIndex < uiNumComponents)
+  {
+    ezComponent* pComponent = nullptr;
+    if (compTypeState.m_pManager != nullptr && compTypeState.m_pManager->TryGetComponent(compTypeState.m_ComponentIndexToHandle[compTypeState.m_uiNextComponentIndex++], pComponent))
+    {
+      pComponent->DeserializeComponent(m_WorldReader);
+
+      // exit here to ensure that we at least did some work
+      if (ezTime::Now() >= endTime)
+        break;
+    }
+  }
+
+  compTypeState.m_uiDataReadPosition = reader.GetReadPosition();
+
+  if (compTypeState.m_uiNextComponentIndex >= uiNumComponents)
+  {
+    const ezUInt64 uiBytesRead = compTypeState.m_uiDataReadPosition - compTypeState.m_uiDataReadOffset;
+
+    if (uiBytesRead != compTypeInfo.m_uiComponentDataSize)
+    {
+      EZ_REPORT_FAILURE("Component type '{}' (version {}) deserialized {} of the stored {} bytes.\nCheck that the serialization and deserialization functions assume the same data layout.", compTypeInfo.m_pRtti->GetTypeName(), compTypeInfo.m_pRtti->GetTypeVersion(), uiBytesRead, compTypeInfo.m_uiComponentDataSize);
+    }
+  }
+}
+
 bool ezWorldReader::InstantiationContext::AddComponentsToBatch(ezTime endTime)
 {
   EZ_PROFILE_SCOPE("ezWorldReader::AddComponentsToBatch");
@@ -0,0 +1,526 @@
+#include <Core/CorePCH.h>
+
+#include <Core/WorldSerializer/WorldSnapshot.h>
+#include <Foundation/Algorithm/HashingUtils.h>
+#include <Foundation/Types/ScopeExit.h>
+
+ezWorldSnapshot::ezWorldSnapshot() = default;
+ezWorldSnapshot::~ezWorldSnapshot() = default;
+
+void ezWorldSnapshot::Capture(ezWorld& ref_world, const ezTagSet* pExclude)
+{
+  Clear();
+
+  const ezWorld& world = ref_world;
+  EZ_LOCK(world.GetReadMarker());
+
+  m_pWorld = &ref_world;
+  m_uiWorldObjectCount = world.GetObjectCount();
+
+  {
+    ezMemoryStreamWriter writer(&m_BaseImage);
+    m_Writer.WriteWorld(writer, ref_world, pExclude);
+  }
+
+  // remember the objects and components in the order in which the base image refers to them
+  {
+    m_Objects.Reserve(1 + m_Writer.m_AllRootObjects.GetCount() + m_Writer.m_AllChildObjects.GetCount());
+    m_Objects.PushBack(ezGameObjectHandle());
+
+    for (const ezGameObject* pObject : m_Writer.m_AllRootObjects)
+    {
+      m_Objects.PushBack(pObject->GetHandle());
+    }
+
+    for (const ezGameObject* pObject : m_Writer.m_AllChildObjects)
+    {
+      m_Objects.PushBack(pObject->GetHandle());
+    }
+
+    m_ComponentTypes.SetCount(m_Writer.m_AllComponents.GetCount());
+    m_Components.SetCount(m_Writer.m_AllComponents.GetCount());
+
+    for (auto it = m_Writer.m_AllComponents.GetIterator(); it.IsValid(); ++it)
+    {
+      const ezUInt16 uiTypeIndex = it.Value().m_uiSerializedTypeIndex;
+      m_ComponentTypes[uiTypeIndex] = it.Key();
+
+      auto& handles = m_Components[uiTypeIndex];
+      handles.Reserve(1 + it.Value().m_Components.GetCount());
+      handles.PushBack(ezComponentHandle());
+
+      for (const ezComponent* pComponent : it.Value().m_Components)
+      {
+        handles.PushBack(pComponent->GetHandle());
+      }
+
+      // the pointers become invalid as soon as the world changes, only the handle to index mapping is used from now on
+      it.Value().m_Components.Clear();
+    }
+
+    m_Writer.m_AllRootObjects.Clear();
+    m_Writer.m_AllChildObjects.Clear();
+  }
+
+  // store the state of every object and component separately, so that it can be compared and restored individually
+  {
+    m_ObjectRecords.SetCount(m_Objects.GetCount());
+    m_ObjectComponentCounts.SetCount(m_Objects.GetCount());
+    m_ObjectCache.SetCount(m_Objects.GetCount());
+
+    for (ezUInt32 i = 1; i < m_Objects.GetCount(); ++i)
+    {
+      const ezGameObject* pObject = nullptr;
+      EZ_VERIFY(world.TryGetObject(m_Objects[i], pObject), "Written object must exist");
+
+      m_ObjectComponentCounts[i] = pObject->GetComponents().GetCount();
+      m_ObjectRecords[i] = StoreScratchData(SerializeObject(pObject), m_RecordData);
+
+      m_ObjectCache[i].m_State.Read(pObject);
+      m_ObjectCache[i].m_uiHash = m_ObjectRecords[i].m_uiHash;
+    }
+
+    m_ComponentRecords.SetCount(m_Components.GetCount());
+    m_ComponentCache.SetCount(m_Components.GetCount());
+
+    for (ezUInt32 uiTypeIndex = 0; uiTypeIndex < m_Components.GetCount(); ++uiTypeIndex)
+    {
+      const auto& handles = m_Components[uiTypeIndex];
+      auto& records = m_ComponentRecords[uiTypeIndex];
+      auto& cache = m_ComponentCache[uiTypeIndex];
+      records.SetCount(handles.GetCount());
+      cache.SetCount(handles.GetCount());
+
+      for (ezUInt32 i = 1; i < handles.GetCount(); ++i)
+      {
+        const ezComponent* pComponent = nullptr;
+        EZ_VERIFY(world.TryGetComponent(handles[i], pComponent), "Written component must exist");
+
+        records[i] = StoreScratchData(SerializeComponent(pComponent), m_RecordData);
+
+        cache[i].m_uiStateVersion = pComponent->GetStateVersion();
+        cache[i].m_uiHash = records[i].m_uiHash;
+      }
+    }
+
+    m_uiBaseImageHash = ezHashingUtils::xxHash64(m_RecordData.GetData(), m_RecordData.GetCount());
+  }
+}
+
+void ezWorldSnapshot::Clear()
+{
+  m_pWorld = nullptr;
+  m_uiWorldObjectCount = 0;
+  m_uiBaseImageHash = 0;
+
+  m_Writer.Clear();
+  m_BaseImage.Clear();
+
+  m_Objects.Clear();
+  m_ObjectComponentCounts.Clear();
+  m_ComponentTypes.Clear();
+  m_Components.Clear();
+
+  m_ObjectRecords.Clear();
+  m_ComponentRecords.Clear();
+  m_RecordData.Clear();
+
+  m_ObjectCache.Clear();
+  m_ComponentCache.Clear();
+
+  m_uiNumChangesInLastDelta = 0;
+  m_uiNumSerializedInLastDelta = 0;
+  m_uiNumRestoredInLastApply = 0;
+}
+
+ezResult ezWorldSnapshot::WriteDelta(ezStreamWriter& inout_stream)
+{
+  EZ_ASSERT_DEV(IsValid(), "No base image has been captured.");
+
+  const ezWorld& world = *m_pWorld;
+  EZ_LOCK(world.GetReadMarker());
+
+  EZ_SUCCEED_OR_RETURN(CheckStructure());
+
+  // collect the changes first, nothing is written if anything fails
+  ezUInt32 uiNumSerialized = 0;
+  ezUInt32 uiNumChangedObjects = 0;
+  ezDefaultMemoryStreamStorage objectStorage;
+
+  {
+    ezMemoryStreamWriter writer(&objectStorage);
+
+    for (ezUInt32 i = 1; i < m_Objects.GetCount(); ++i)
+    {
+      const ezGameObject* pObject = nullptr;
+      EZ_VERIFY(world.TryGetObject(m_Objects[i], pObject), "Structure has been checked, the object must exist");
+
+      bool bSerialized = false;
+      const ezUInt64 uiHash = GetCurrentObjectHash(i, pObject, bSerialized);
+      uiNumSerialized += bSerialized ? 1 : 0;
+
+      if (uiHash == m_ObjectRecords[i].m_uiHash)
+        continue;
+
+      // still differs from the base image, but didn't change since the last delta
+      if (!bSerialized)
+        SerializeObject(pObject);
+
+      writer << i;
+      writer << m_Scratch.GetStorageSize32();
+      EZ_SUCCEED_OR_RETURN(writer.WriteBytes(m_Scratch.GetData(), m_Scratch.GetStorageSize32()));
+
+      ++uiNumChangedObjects;
+    }
+  }
+
+  ezUInt32 uiNumChangedComponents = 0;
+  ezDefaultMemoryStreamStorage componentStorage;
+
+  {
+    ezMemoryStreamWriter writer(&componentStorage);
+
+    for (ezUInt32 uiTypeIndex = 0; uiTypeIndex < m_Components.GetCount(); ++uiTypeIndex)
+    {
+      const auto& handles = m_Components[uiTypeIndex];
+      const auto& records = m_ComponentRecords[uiTypeIndex];
+
+      for (ezUInt32 i = 1; i < handles.GetCount(); ++i)
+      {
+        const ezComponent* pComponent = nullptr;
+        EZ_VERIFY(world.TryGetComponent(handles[i], pComponent), "Structure has been checked, the component must exist");
+
+        bool bSerialized = false;
+        const ezUInt64 uiHash = GetCurrentComponentHash(uiTypeIndex, i, pComponent, bSerialized);
+        uiNumSerialized += bSerialized ? 1 : 0;
+
+        if (uiHash == records[i].m_uiHash)
+          continue;
+
+        if (!bSerialized)
+          SerializeComponent(pComponent);
+
+        writer << static_cast<ezUInt16>(uiTypeIndex);
+        writer << i;
+        writer << m_Scratch.GetStorageSize32();
+        EZ_SUCCEED_OR_RETURN(writer.WriteBytes(m_Scratch.GetData(), m_Scratch.GetStorageSize32()));
+
+        ++uiNumChangedComponents;
+      }
+    }
+  }
+
+  const ezUInt8 uiVersion = 1;
+  inout_stream << uiVersion;
+  inout_stream << m_uiBaseImageHash;
+
+  inout_stream << uiNumChangedObjects;
+  EZ_SUCCEED_OR_RETURN(objectStorage.CopyToStream(inout_stream));
+
+  inout_stream << uiNumChangedComponents;
+  EZ_SUCCEED_OR_RETURN(componentStorage.CopyToStream(inout_stream));
+
+  m_uiNumChangesInLastDelta = uiNumChangedObjects + uiNumChangedComponents;
+  m_uiNumSerializedInLastDelta = uiNumSerialized;
+  return EZ_SUCCESS;
+}
+
+ezResult ezWorldSnapshot::ApplyDelta(ezStreamReader& inout_stream)
+{
+  EZ_ASSERT_DEV(IsValid(), "No base image has been captured.");
+
+  ezUInt8 uiVersion = 0;
+  inout_stream >> uiVersion;
+
+  if (uiVersion != 1)
+  {
+    ezLog::Error("Invalid world snapshot delta version (got {}).", uiVersion);
+    return EZ_FAILURE;
+  }
+
+  ezUInt64 uiBaseImageHash = 0;
+  inout_stream >> uiBaseImageHash;
+
+  if (uiBaseImageHash != m_uiBaseImageHash)
+  {
+    ezLog::Error("World snapshot delta was written for a different base image.");
+    return EZ_FAILURE;
+  }
+
+  ezDynamicArray<ezUInt8> deltaData;
+
+  auto ReadRecord = [&](Record& out_record) -> ezResult
+  {
+    ezUInt32 uiDataSize = 0;
+    inout_stream >> uiDataSize;
+
+    out_record.m_uiDataOffset = deltaData.GetCount();
+    out_record.m_uiDataSize = uiDataSize;
+
+    deltaData.SetCountUninitialized(out_record.m_uiDataOffset + uiDataSize);
+    ezUInt8* pData = deltaData.GetData() + out_record.m_uiDataOffset;
+
+    if (inout_stream.ReadBytes(pData, uiDataSize) != uiDataSize)
+      return EZ_FAILURE;
+
+    out_record.m_uiHash = ezHashingUtils::xxHash64(pData, uiDataSize);
+    return EZ_SUCCESS;
+  };
+
+  ezDynamicArray<Record> deltaObjects;
+  deltaObjects.SetCount(m_Objects.GetCount());
+
+  ezUInt32 uiNumChangedObjects = 0;
+  inout_stream >> uiNumChangedObjects;
+
+  for (ezUInt32 i = 0; i < uiNumChangedObjects; ++i)
+  {
+    ezUInt32 uiObjectIndex = 0;
+    inout_stream >> uiObjectIndex;
+
+    if (uiObjectIndex == 0 || uiObjectIndex >= m_Objects.GetCount() || ReadRecord(deltaObjects[uiObjectIndex]).Failed())
+    {
+      ezLog::Error("World snapshot delta is corrupted.");
+      return EZ_FAILURE;
+    }
+  }
+
+  ezDynamicArray<ezDynamicArray<Record>> deltaComponents;
+  deltaComponents.SetCount(m_Components.GetCount());
+
+  ezUInt32 uiNumChangedComponents = 0;
+  inout_stream >> uiNumChangedComponents;
+
+  for (ezUInt32 i = 0; i < uiNumChangedComponents; ++i)
+  {
+    ezUInt16 uiTypeIndex = 0;
+    inout_stream >> uiTypeIndex;
+
+    ezUInt32 uiComponentIndex = 0;
+    inout_stream >> uiComponentIndex;
+
+    if (uiTypeIndex >= m_Components.GetCount() || uiComponentIndex == 0 || uiComponentIndex >= m_Components[uiTypeIndex].GetCount())
+    {
+      ezLog::Error("World snapshot delta is corrupted.");
+      return EZ_FAILURE;
+    }
+
+    auto& records = deltaComponents[uiTypeIndex];
+    records.SetCount(m_Components[uiTypeIndex].GetCount());
+
+    if (ReadRecord(records[uiComponentIndex]).Failed())
+    {
+      ezLog::Error("World snapshot delta is corrupted.");
+      return EZ_FAILURE;
+    }
+  }
+
+  EZ_LOCK(m_pWorld->GetWriteMarker());
+
+  return RestoreState(deltaObjects, deltaComponents, deltaData);
+}
+
+ezResult ezWorldSnapshot::RestoreBase()
+{
+  EZ_ASSERT_DEV(IsValid(), "No base image has been captured.");
+
+  EZ_LOCK(m_pWorld->GetWriteMarker());
+
+  return RestoreState({}, {}, {});
+}
+
+ezResult ezWorldSnapshot::CheckStructure() const
+{
+  const ezWorld& world = *m_pWorld;
+
+  // new objects can only be detected through the count, new components change the component count of their owner
+  if (world.GetObjectCount() != m_uiWorldObjectCount)
+    return EZ_FAILURE;
+
+  for (ezUInt32 i = 1; i < m_Objects.GetCount(); ++i)
+  {
+    const ezGameObject* pObject = nullptr;
+    if (!world.TryGetObject(m_Objects[i], pObject) || pObject->GetComponents().GetCount() != m_ObjectComponentCounts[i])
+      return EZ_FAILURE;
+  }
+
+  for (const auto& handles : m_Components)
+  {
+    for (ezUInt32 i = 1; i < handles.GetCount(); ++i)
+    {
+      const ezComponent* pComponent = nullptr;
+      if (!world.TryGetComponent(handles[i], pComponent))
+        return EZ_FAILURE;
+    }
+  }
+
+  return EZ_SUCCESS;
+}
+
+ezUInt64 ezWorldSnapshot::SerializeObject(const ezGameObject* pObject)
+{
+  m_Scratch.Clear();
+
+  ezMemoryStreamWriter writer(&m_Scratch);
+  m_Writer.WriteGameObjectState(writer, pObject);
+
+  return ezHashingUtils::xxHash64(m_Scratch.GetData(), m_Scratch.GetStorageSize32());
+}
+
+ezUInt64 ezWorldSnapshot::SerializeComponent(const ezComponent* pComponent)
+{
+  m_Scratch.Clear();
+
+  ezMemoryStreamWriter writer(&m_Scratch);
+  m_Writer.WriteComponentState(writer, pComponent);
+
+  return ezHashingUtils::xxHash64(m_Scratch.GetData(), m_Scratch.GetStorageSize32());
+}
+
+void ezWorldSnapshot::ObjectState::Read(const ezGameObject* pObject)
+{
+  m_hParent = pObject->GetParent() != nullptr ? pObject->GetParent()->GetHandle() : ezGameObjectHandle();
+  m_sName = pObject->GetNameHashed();
+  m_sGlobalKey = pObject->GetGlobalKey();
+  m_vLocalPosition = pObject->GetLocalPosition();
+  m_qLocalRotation = pObject->GetLocalRotation();
+  m_vLocalScaling = pObject->GetLocalScaling();
+  m_fLocalUniformScaling = pObject->GetLocalUniformScaling();
+  m_Tags = pObject->GetTags();
+  m_uiStableRandomSeed = pObject->GetStableRandomSeed();
+  m_uiTeamID = pObject->GetTeamID();
+  m_bActiveFlag = pObject->GetActiveFlag();
+  m_bDynamic = pObject->IsDynamic();
+}
+
+bool ezWorldSnapshot::ObjectState::Matches(const ezGameObject* pObject) const
+{
+  const ezGameObjectHandle hParent = pObject->GetParent() != nullptr ? pObject->GetParent()->GetHandle() : ezGameObjectHandle();
+
+  // the transform changes most often, check it first
+  return m_vLocalPosition == pObject->GetLocalPosition() && m_qLocalRotation == pObject->GetLocalRotation() && m_vLocalScaling == pObject->GetLocalScaling() &&
+         m_fLocalUniformScaling == pObject->GetLocalUniformScaling() && m_bActiveFlag == pObject->GetActiveFlag() && m_bDynamic == pObject->IsDynamic() &&
+         m_hParent == hParent && m_uiTeamID == pObject->GetTeamID() && m_uiStableRandomSeed == pObject->GetStableRandomSeed() &&
+         m_sName == pObject->GetNameHashed() && m_sGlobalKey == pObject->GetGlobalKey() && m_Tags == pObject->GetTags();
+}
+
+ezUInt64 ezWorldSnapshot::GetCurrentObjectHash(ezUInt32 uiIndex, const ezGameObject* pObject, bool& out_bSerialized)
+{
+  ObjectCache& cache = m_ObjectCache[uiIndex];
+
+  out_bSerialized = !cache.m_State.Matches(pObject);
+
+  if (out_bSerialized)
+  {
+    cache.m_State.Read(pObject);
+    cache.m_uiHash = SerializeObject(pObject);
+  }
+
+  return cache.m_uiHash;
+}
+
+ezUInt64 ezWorldSnapshot::GetCurrentComponentHash(ezUInt32 uiTypeIndex, ezUInt32 uiIndex, const ezComponent* pComponent, bool& out_bSerialized)
+{
+  ComponentCache& cache = m_ComponentCache[uiTypeIndex][uiIndex];
+
+  // without version tracking the component may have changed at any time
+  out_bSerialized = !pComponent->HasStateVersionTracking() || cache.m_uiStateVersion != pComponent->GetStateVersion();
+
+  if (out_bSerialized)
+  {
+    cache.m_uiStateVersion = pComponent->GetStateVersion();
+    cache.m_uiHash = SerializeComponent(pComponent);
+  }
+
+  return cache.m_uiHash;
+}
+
+ezWorldSnapshot::Record ezWorldSnapshot::StoreScratchData(ezUInt64 uiHash, ezDynamicArray<ezUInt8>& ref_data) const
+{
+  EZ_ASSERT_ALWAYS(ref_data.GetCount() + static_cast<ezUInt64>(m_Scratch.GetStorageSize32()) <= ezMath::MaxValue<ezUInt32>(), "World snapshots are limited to 4GB.");
+
+  Record record;
+  record.m_uiHash = uiHash;
+  record.m_uiDataOffset = ref_data.GetCount();
+  record.m_uiDataSize = m_Scratch.GetStorageSize32();
+
+  ref_data.PushBackRange(ezArrayPtr<const ezUInt8>(m_Scratch.GetData(), record.m_uiDataSize));
+
+  return record;
+}
+
+ezResult ezWorldSnapshot::RestoreState(ezArrayPtr<const Record> deltaObjects, ezArrayPtr<const ezDynamicArray<Record>> deltaComponents, ezArrayPtr<const ezUInt8> deltaData)
+{
+  if (CheckStructure().Failed())
+  {
+    ezLog::Error("Objects or components were created or deleted since the world snapshot was captured.");
+    return EZ_FAILURE;
+  }
+
+  m_uiNumRestoredInLastApply = 0;
+
+  m_Reader.BeginRestoreInPlace(*m_pWorld, m_Objects, m_ComponentTypes, m_Components);
+  EZ_SCOPE_EXIT(m_Reader.EndRestoreInPlace());
+
+  // objects first, components may depend on the state of their owner
+  for (ezUInt32 i = 1; i < m_Objects.GetCount(); ++i)
+  {
+    const bool bFromDelta = i < deltaObjects.GetCount() && deltaObjects[i].IsValid();
+    const Record& target = bFromDelta ? deltaObjects[i] : m_ObjectRecords[i];
+    const ezUInt8* pData = bFromDelta ? deltaData.GetPtr() : m_RecordData.GetData();
+
+    ezGameObject* pObject = nullptr;
+    EZ_VERIFY(m_pWorld->TryGetObject(m_Objects[i], pObject), "Structure has been checked, the object must exist");
+
+    bool bSerialized = false;
+    if (GetCurrentObjectHash(i, pObject, bSerialized) == target.m_uiHash)
+      continue;
+
+    ezRawMemoryStreamReader reader(pData + target.m_uiDataOffset, target.m_uiDataSize);
+    m_Reader.RestoreGameObjectState(reader, pObject);
+
+    // changing the parent can move the object in memory
+    EZ_VERIFY(m_pWorld->TryGetObject(m_Objects[i], pObject), "Object must still exist");
+    m_ObjectCache[i].m_State.Read(pObject);
+    m_ObjectCache[i].m_uiHash = target.m_uiHash;
+
+    ++m_uiNumRestoredInLastApply;
+  }
+
+  for (ezUInt32 uiTypeIndex = 0; uiTypeIndex < m_Components.GetCount(); ++uiTypeIndex)
+  {
+    const auto& handles = m_Components[uiTypeIndex];
+    const auto& records = m_ComponentRecords[uiTypeIndex];
+    const ezArrayPtr<const Record> deltaRecords = uiTypeIndex < deltaComponents.GetCount() ? deltaComponents[uiTypeIndex].GetArrayPtr() : ezArrayPtr<const Record>();
+
+    for (ezUInt32 i = 1; i < handles.GetCount(); ++i)
+    {
+      const bool bFromDelta = i < deltaRecords.GetCount() && deltaRecords[i].IsValid();
+      const Record& target = bFromDelta ? deltaRecords[i] : records[i];
+      const ezUInt8* pData = bFromDelta ? deltaData.GetPtr() : m_RecordData.GetData();
+
+      ezComponent* pComponent = nullptr;
+      EZ_VERIFY(m_pWorld->TryGetComponent(handles[i], pComponent), "Structure has been checked, the component must exist");
+
+      bool bSerialized = false;
+      if (GetCurrentComponentHash(uiTypeIndex, i, pComponent, bSerialized) == target.m_uiHash)
+        continue;
+
+      ezRawMemoryStreamReader reader(pData + target.m_uiDataOffset, target.m_uiDataSize);
+      m_Reader.RestoreComponentState(reader, pComponent);
+
+      // restoring increments the state version, the new version corresponds to the target state
+      m_ComponentCache[uiTypeIndex][i].m_uiStateVersion = pComponent->GetStateVersion();
+      m_ComponentCache[uiTypeIndex][i].m_uiHash = target.m_uiHash;
+
+      if (reader.GetReadPosition() != target.m_uiDataSize)
+      {
+        ezLog::Error("Component type '{}' deserialized {} of the stored {} bytes. Check that the serialization and deserialization functions assume the same data layout.", m_ComponentTypes[uiTypeIndex]->GetTypeName(), reader.GetReadPosition(), target.m_uiDataSize);
+      }
+
+      ++m_uiNumRestoredInLastApply;
+    }
+  }
+
+  return EZ_SUCCESS;
+}
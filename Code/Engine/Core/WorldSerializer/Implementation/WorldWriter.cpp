@@ -66,8 +66,7 @@ void ezWorldWriter::WriteObjects(ezStreamWriter& inout_stream, ezArrayPtr<const
 
 ezResult ezWorldWriter::WriteToStream()
 {
-  const ezUInt8 uiVersion = 10;
-  *m_pStream << uiVersion;
+  *m_pStream << s_uiCurrentVersion;
 
   // version 8: use string dedup instead of handle writer
   ezStringDeduplicationWriteContext stringDedupWriteContext(*m_pStream);
@@ -293,6 +292,40 @@ void ezWorldWriter::WriteGameObject(const ezGameObject* pObject)
   s << pObject->GetStableRandomSeed();
 }
 
+void ezWorldWriter::WriteGameObjectState(ezStreamWriter& inout_stream, const ezGameObject* pObject)
+{
+  ezStreamWriter* pPrevStream = m_pStream;
+  m_pStream = &inout_stream;
+
+  WriteGameObject(pObject);
+
+  m_pStream = pPrevStream;
+}
+
+void ezWorldWriter::WriteComponentState(ezStreamWriter& inout_stream, const ezComponent* pComponent)
+{
+  ezStreamWriter* pPrevStream = m_pStream;
+  m_pStream = &inout_stream;
+
+  // same data as written by WriteComponentCreationData and WriteComponentSerializationData, minus the owner and index
+  {
+    ezStreamWriter& s = *m_pStream;
+    s << pComponent->GetActiveFlag();
+
+    ezUInt8 userFlags = 0;
+    for (ezUInt8 i = 0; i < 8; ++i)
+    {
+      userFlags |= pComponent->GetUserFlag(i) ? EZ_BIT(i) : 0;
+    }
+
+    s << userFlags;
+  }
+
+  pComponent->SerializeComponent(*this);
+
+  m_pStream = pPrevStream;
+}
+
 void ezWorldWriter::WriteComponentTypeInfo(const ezRTTI* pRtti)
 {
   ezStreamWriter& s = *m_pStream;
@@ -37,6 +37,14 @@ struct ezPrefabInstantiationOptions
   ezTime m_MaxStepTime = ezTime::MakeZero();
 
   ezProgress* m_pProgress = nullptr;
+
+  /// \brief If set, the components of different types are deserialized in parallel on worker threads.
+  ///
+  /// Object and component creation, as well as initialization, still happen on the thread that calls Step().
+  /// That thread also holds the world write lock while the workers run, so the world can't change in the meantime.
+  /// This is only safe, if all involved component types restrict their DeserializeComponent() functions to reading the stream
+  /// and setting up their own state, e.g. they must not access other objects or components through the world.
+  bool m_bDeserializeComponentsInParallel = false;
 };
 
 /// \brief Reads a world description from a stream. Allows to instantiate that world multiple times
@@ -100,6 +108,11 @@ public:
   /// has to be valid as long as the instantiation is in progress.
   ezUniquePtr<InstantiationContextBase> InstantiateWorld(ezWorld& ref_world, const ezUInt16* pOverrideTeamID = nullptr, ezTime maxStepTime = ezTime::MakeZero(), ezProgress* pProgress = nullptr);
 
+  /// \brief Same as above, but takes all settings from \a options, e.g. to enable parallel component deserialization.
+  ///
+  /// Note that the overload above uses RandomSeedMode::FixedFromSerialization, set this in the options to get the same behavior.
+  ezUniquePtr<InstantiationContextBase> InstantiateWorld(ezWorld& ref_world, const ezPrefabInstantiationOptions& options);
+
   /// \brief Creates one instance of the world that was previously read by ReadWorldDescription().
   ///
   /// \param rootTransform is an additional transform that is applied to all root objects.
@@ -159,6 +172,8 @@ public:
   static ezTime GetMaxStepTime(InstantiationContextBase* pContext);
 
 private:
+  friend class ezWorldSnapshot;
+
   struct GameObjectToCreate
   {
     ezGameObjectDesc m_Desc;
@@ -172,6 +187,12 @@ private:
 
   ezUniquePtr<InstantiationContextBase> Instantiate(ezWorld& world, bool bUseTransform, const ezTransform& rootTransform, const ezPrefabInstantiationOptions& options);
 
+  // used by ezWorldSnapshot to restore the state of individual objects and components without recreating them
+  void BeginRestoreInPlace(ezWorld& ref_world, ezArrayPtr<const ezGameObjectHandle> objects, ezArrayPtr<const ezRTTI* const> componentTypes, ezArrayPtr<const ezDynamicArray<ezComponentHandle>> components);
+  void EndRestoreInPlace();
+  void RestoreGameObjectState(ezStreamReader& inout_stream, ezGameObject* pObject);
+  void RestoreComponentState(ezStreamReader& inout_stream, ezComponent* pComponent);
+
   ezStreamReader* m_pReadStream = nullptr;
   ezUInt8 m_uiVersion = 0;
 
@@ -207,6 +228,8 @@ private:
 
     bool CreateComponents(ezTime endTime);
     bool DeserializeComponents(ezTime endTime);
+    bool DeserializeComponentsParallel(ezTime endTime);
+    void DeserializeComponentsOfType(ezUInt32 uiComponentTypeIndex, ezTime endTime);
     bool AddComponentsToBatch(ezTime endTime);
 
     void SetMaxStepTime(ezTime stepTime);
@@ -230,6 +253,11 @@ private:
     {
       ezUInt64 m_uiDataReadOffset = 0;
       ezDynamicArray<ezComponentHandle> m_ComponentIndexToHandle;
+
+      // only used for parallel deserialization, where every component type keeps track of its own progress
+      ezComponentManagerBase* m_pManager = nullptr;
+      ezUInt64 m_uiDataReadPosition = 0;
+      ezUInt32 m_uiNextComponentIndex = 0;
     };
 
     ezDynamicArray<ezGameObjectHandle> m_IndexToGameObjectHandle;
@@ -258,9 +286,13 @@ private:
     ezUInt32 m_uiCurrentIndex = 0; // object or component
     ezUInt32 m_uiCurrentComponentTypeIndex = 0;
     ezUInt64 m_uiCurrentNumComponentsProcessed = 0;
+    bool m_bParallelDeserializationStarted = false; // set once the per type read positions have been set up
     ezMemoryStreamReader m_CurrentReader;
 
     ezUniquePtr<ezProgressRange> m_pOverallProgressRange;
     ezUniquePtr<ezProgressRange> m_pSubProgressRange;
   };
+
+  // only set between BeginRestoreInPlace() and EndRestoreInPlace(), provides the handle lookup tables
+  ezUniquePtr<InstantiationContext> m_pRestoreContext;
 };
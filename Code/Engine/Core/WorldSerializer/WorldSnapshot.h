@@ -0,0 +1,158 @@
+#pragma once
+
+#include <Core/WorldSerializer/WorldReader.h>
+#include <Core/WorldSerializer/WorldWriter.h>
+#include <Foundation/IO/MemoryStream.h>
+
+/// \brief Captures the state of a world once and afterwards only records the objects and components whose state differs from it.
+///
+/// Capture() writes the whole world through ezWorldWriter into a base image, which has the same format as a regular level.
+/// The base image can be instantiated with ezWorldReader, e.g. to clone the world. Additionally the serialized state
+/// and a hash of every written object and component is kept.
+///
+/// WriteDelta() only writes the objects and components whose state differs from the base image. The snapshot remembers the last
+/// known state of everything, and only serializes what changed since then:
+/// - Components that enable ezComponent::EnableStateVersionTracking() are skipped as long as their state version is unchanged.
+///   Other component types can't report their modifications, those are serialized and compared through a hash every time.
+/// - Game objects are compared field by field with their last known state, which is much cheaper than serializing them.
+/// Saves, autosaves and replays thus cost time and space proportional to the amount of change instead of the size of the world.
+///
+/// ApplyDelta() restores such a state in place through ezWorldReader, without recreating any objects or components.
+/// Everything that is not part of the delta is reset to the base image, so any delta can be applied at any time, e.g. to
+/// roll back to an earlier point in time. Objects and components that already have the desired state are not touched.
+/// Note that the components are deserialized while they are initialized and active, their DeserializeComponent() functions need to support that.
+/// Active components receive ezMsgComponentStateRestored afterwards, to update data that they derive from their state.
+///
+/// Deltas only cover state changes. If objects or components were created or deleted after the capture, WriteDelta() and ApplyDelta()
+/// fail and a new base image has to be captured.
+class EZ_CORE_DLL ezWorldSnapshot
+{
+  EZ_DISALLOW_COPY_AND_ASSIGN(ezWorldSnapshot);
+
+public:
+  ezWorldSnapshot();
+  ~ezWorldSnapshot();
+
+  /// \brief Writes the base image of \a world and remembers the state of all written objects and components.
+  ///
+  /// All game objects with tags that overlap with \a pExclude will be ignored.
+  /// The world must stay alive as long as this snapshot is used.
+  void Capture(ezWorld& ref_world, const ezTagSet* pExclude = nullptr);
+
+  /// \brief Discards the base image and all recorded state.
+  void Clear();
+
+  /// \brief Returns whether a base image was captured.
+  bool IsValid() const { return m_pWorld != nullptr; }
+
+  /// \brief Returns the base image in the regular ezWorldWriter format.
+  const ezDefaultMemoryStreamStorage& GetBaseImage() const { return m_BaseImage; }
+
+  /// \brief Writes the state of all objects and components that differ from the base image to \a inout_stream.
+  ///
+  /// Nothing is written, if objects or components were created or deleted since the base image was captured.
+  ezResult WriteDelta(ezStreamWriter& inout_stream);
+
+  /// \brief Restores the state that was written by WriteDelta() in place. Everything that is not part of the delta is reset to the base image.
+  ezResult ApplyDelta(ezStreamReader& inout_stream);
+
+  /// \brief Resets all captured objects and components to the state of the base image.
+  ezResult RestoreBase();
+
+  /// \brief Returns how many objects and components were written by the last call to WriteDelta().
+  ezUInt32 GetNumChangesInLastDelta() const { return m_uiNumChangesInLastDelta; }
+
+  /// \brief Returns how many objects and components had to be serialized by the last call to WriteDelta() to find out whether they changed.
+  ezUInt32 GetNumSerializedInLastDelta() const { return m_uiNumSerializedInLastDelta; }
+
+  /// \brief Returns how many objects and components were restored by the last call to ApplyDelta() or RestoreBase().
+  ezUInt32 GetNumRestoredInLastApply() const { return m_uiNumRestoredInLastApply; }
+
+private:
+  struct Record
+  {
+    ezUInt64 m_uiHash = 0;
+    ezUInt32 m_uiDataOffset = 0;
+    ezUInt32 m_uiDataSize = ezInvalidIndex;
+
+    bool IsValid() const { return m_uiDataSize != ezInvalidIndex; }
+  };
+
+  /// The members of an object that ezWorldWriter serializes, to detect changes without serializing the object.
+  struct ObjectState
+  {
+    void Read(const ezGameObject* pObject);
+    bool Matches(const ezGameObject* pObject) const;
+
+    ezGameObjectHandle m_hParent;
+    ezHashedString m_sName;
+    ezString m_sGlobalKey;
+    ezVec3 m_vLocalPosition;
+    ezQuat m_qLocalRotation;
+    ezVec3 m_vLocalScaling;
+    float m_fLocalUniformScaling = 1.0f;
+    ezTagSet m_Tags;
+    ezUInt32 m_uiStableRandomSeed = 0;
+    ezUInt16 m_uiTeamID = 0;
+    bool m_bActiveFlag = true;
+    bool m_bDynamic = false;
+  };
+
+  /// The last known state of an object and the hash of its serialized data.
+  struct ObjectCache
+  {
+    ObjectState m_State;
+    ezUInt64 m_uiHash = 0;
+  };
+
+  /// The state version of a component when it was serialized last and the hash of that data.
+  struct ComponentCache
+  {
+    EZ_DECLARE_POD_TYPE();
+
+    ezUInt32 m_uiStateVersion;
+    ezUInt64 m_uiHash;
+  };
+
+  ezResult CheckStructure() const;
+  ezUInt64 SerializeObject(const ezGameObject* pObject);
+  ezUInt64 SerializeComponent(const ezComponent* pComponent);
+
+  /// \brief Returns the hash of the current state. Only serializes into m_Scratch, if the state changed since it was last seen, which is reported through out_bSerialized.
+  ezUInt64 GetCurrentObjectHash(ezUInt32 uiIndex, const ezGameObject* pObject, bool& out_bSerialized);
+  ezUInt64 GetCurrentComponentHash(ezUInt32 uiTypeIndex, ezUInt32 uiIndex, const ezComponent* pComponent, bool& out_bSerialized);
+
+  Record StoreScratchData(ezUInt64 uiHash, ezDynamicArray<ezUInt8>& ref_data) const;
+  ezResult RestoreState(ezArrayPtr<const Record> deltaObjects, ezArrayPtr<const ezDynamicArray<Record>> deltaComponents, ezArrayPtr<const ezUInt8> deltaData);
+
+  ezWorld* m_pWorld = nullptr;
+  ezUInt32 m_uiWorldObjectCount = 0;
+  ezUInt64 m_uiBaseImageHash = 0;
+
+  // keeps the mapping from handles to the indices used in the base image
+  ezWorldWriter m_Writer;
+  ezWorldReader m_Reader;
+
+  ezDefaultMemoryStreamStorage m_BaseImage;
+
+  // in the order of the base image, index 0 is the invalid handle
+  ezDynamicArray<ezGameObjectHandle> m_Objects;
+  ezDynamicArray<ezUInt32> m_ObjectComponentCounts;
+  ezDynamicArray<const ezRTTI*> m_ComponentTypes;
+  ezDynamicArray<ezDynamicArray<ezComponentHandle>> m_Components;
+
+  // the state of every object and component in the base image
+  ezDynamicArray<Record> m_ObjectRecords;
+  ezDynamicArray<ezDynamicArray<Record>> m_ComponentRecords;
+  ezDynamicArray<ezUInt8> m_RecordData;
+
+  // the state of every object and component when it was looked at last, in the same order
+  ezDynamicArray<ObjectCache> m_ObjectCache;
+  ezDynamicArray<ezDynamicArray<ComponentCache>> m_ComponentCache;
+
+  ezContiguousMemoryStreamStorage m_Scratch;
+
+  ezUInt32 m_uiNumChangesInLastDelta = 0;
+  ezUInt32 m_uiNumSerializedInLastDelta = 0;
+  ezUInt32 m_uiNumRestoredInLastApply = 0;
+};
@@ -12,6 +12,9 @@
 class EZ_CORE_DLL ezWorldWriter
 {
 public:
+  /// \brief The version of the stream format that WriteWorld() and WriteObjects() produce. ezWorldReader accepts this and older versions.
+  static constexpr ezUInt8 s_uiCurrentVersion = 10;
+
   /// \brief Writes all content in \a world to \a stream.
   ///
   /// All game objects with tags that overlap with \a pExclude will be ignored.
@@ -46,6 +49,8 @@ public:
   const ezDeque<const ezGameObject*>& GetAllWrittenChildObjects() const { return m_AllChildObjects; }
 
 private:
+  friend class ezWorldSnapshot;
+
   void Clear();
   ezResult WriteToStream();
   void AssignGameObjectIndices();
@@ -60,6 +65,10 @@ private:
   void WriteComponentCreationData(const ezDeque<const ezComponent*>& components);
   void WriteComponentSerializationData(const ezDeque<const ezComponent*>& components);
 
+  // used by ezWorldSnapshot to write the state of individual objects and components, using the indices of the last written world
+  void WriteGameObjectState(ezStreamWriter& inout_stream, const ezGameObject* pObject);
+  void WriteComponentState(ezStreamWriter& inout_stream, const ezComponent* pComponent);
+
   ezStreamWriter* m_pStream = nullptr;
   const ezTagSet* m_pExclude = nullptr;
 
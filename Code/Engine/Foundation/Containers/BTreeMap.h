@@ -0,0 +1,433 @@
+#pragma once
+
+#include <Foundation/Algorithm/Comparer.h>
+#include <Foundation/Containers/DynamicArray.h>
+
+template <typename KeyType, typename ValueType, typename Comparer>
+class ezBTreeMapBase;
+
+/// \brief Base class for all iterators.
+template <typename KeyType, typename ValueType, typename Comparer, bool REVERSE>
+struct ezBTreeMapBaseConstIteratorBase
+{
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = ezBTreeMapBaseConstIteratorBase<KeyType, ValueType, Comparer, false>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = ezBTreeMapBaseConstIteratorBase<KeyType, ValueType, Comparer, false>*;
+  using reference = ezBTreeMapBaseConstIteratorBase<KeyType, ValueType, Comparer, false>&;
+
+  EZ_DECLARE_POD_TYPE();
+
+  /// \brief Constructs an invalid iterator.
+  EZ_ALWAYS_INLINE ezBTreeMapBaseConstIteratorBase() = default; // [tested]
+
+  /// \brief Checks whether this iterator points to a valid element.
+  EZ_ALWAYS_INLINE bool IsValid() const { return (m_pNode != nullptr); } // [tested]
+
+  /// \brief Checks whether the two iterators point to the same element.
+  EZ_ALWAYS_INLINE bool operator==(const ezBTreeMapBaseConstIteratorBase& it2) const { return (m_pNode == it2.m_pNode && m_uiIndex == it2.m_uiIndex); }
+  EZ_ADD_DEFAULT_OPERATOR_NOTEQUAL(const ezBTreeMapBaseConstIteratorBase&);
+
+  /// \brief Returns the 'key' of the element that this iterator points to.
+  EZ_FORCE_INLINE const KeyType& Key() const
+  {
+    EZ_ASSERT_DEBUG(IsValid(), "Cannot access the 'key' of an invalid iterator.");
+    return m_pNode->Keys()[m_uiIndex];
+  } // [tested]
+
+  /// \brief Returns the 'value' of the element that this iterator points to.
+  EZ_FORCE_INLINE const ValueType& Value() const
+  {
+    EZ_ASSERT_DEBUG(IsValid(), "Cannot access the 'value' of an invalid iterator.");
+    return m_pNode->Value(m_uiIndex);
+  } // [tested]
+
+  /// \brief Returns '*this' to enable foreach
+  EZ_ALWAYS_INLINE ezBTreeMapBaseConstIteratorBase& operator*() { return *this; } // [tested]
+
+  /// \brief Advances the iterator to the next element in the map. The iterator will not be valid anymore, if the end is reached.
+  void Next(); // [tested]
+
+  /// \brief Advances the iterator to the previous element in the map. The iterator will not be valid anymore, if the end is reached.
+  void Prev(); // [tested]
+
+  /// \brief Shorthand for 'Next'
+  EZ_ALWAYS_INLINE void operator++() { Next(); } // [tested]
+
+  /// \brief Shorthand for 'Prev'
+  EZ_ALWAYS_INLINE void operator--() { Prev(); } // [tested]
+
+protected:
+  void Forward();
+  void Backward();
+
+  friend class ezBTreeMapBase<KeyType, ValueType, Comparer>;
+
+  EZ_ALWAYS_INLINE ezBTreeMapBaseConstIteratorBase(typename ezBTreeMapBase<KeyType, ValueType, Comparer>::Node* pNode, ezUInt32 uiIndex)
+    : m_pNode(pNode)
+    , m_uiIndex(uiIndex)
+  {
+  }
+
+  typename ezBTreeMapBase<KeyType, ValueType, Comparer>::Node* m_pNode = nullptr;
+  ezUInt32 m_uiIndex = 0;
+};
+
+/// \brief Forward Iterator to iterate over all elements in sorted order.
+template <typename KeyType, typename ValueType, typename Comparer, bool REVERSE>
+struct ezBTreeMapBaseIteratorBase : public ezBTreeMapBaseConstIteratorBase<KeyType, ValueType, Comparer, REVERSE>
+{
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = ezBTreeMapBaseIteratorBase<KeyType, ValueType, Comparer, REVERSE>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = ezBTreeMapBaseIteratorBase<KeyType, ValueType, Comparer, REVERSE>*;
+  using reference = ezBTreeMapBaseIteratorBase<KeyType, ValueType, Comparer, REVERSE>&;
+
+  EZ_DECLARE_POD_TYPE();
+
+  /// \brief Constructs an invalid iterator.
+  EZ_ALWAYS_INLINE ezBTreeMapBaseIteratorBase() = default;
+
+  /// \brief Returns the 'value' of the element that this iterator points to.
+  EZ_FORCE_INLINE ValueType& Value() const
+  {
+    EZ_ASSERT_DEBUG(this->IsValid(), "Cannot access the 'value' of an invalid iterator.");
+    return this->m_pNode->Value(this->m_uiIndex);
+  } // [tested]
+
+  /// \brief Returns '*this' to enable foreach
+  EZ_ALWAYS_INLINE ezBTreeMapBaseIteratorBase& operator*() { return *this; } // [tested]
+
+private:
+  friend class ezBTreeMapBase<KeyType, ValueType, Comparer>;
+
+  EZ_ALWAYS_INLINE ezBTreeMapBaseIteratorBase(typename ezBTreeMapBase<KeyType, ValueType, Comparer>::Node* pNode, ezUInt32 uiIndex)
+    : ezBTreeMapBaseConstIteratorBase<KeyType, ValueType, Comparer, REVERSE>(pNode, uiIndex)
+  {
+  }
+};
+
+/// \brief An associative container with the same interface as ezMap, but implemented as a B-tree.
+///
+/// ezMap allocates one node per key/value pair, so every step of a lookup and of an iteration is a dependent load from a
+/// different place in memory. A B-tree stores many sorted keys per node instead. The nodes are sized to span a few cache lines
+/// (see MaxKeysPerNode), and keys and values are stored in separate arrays, such that a lookup only touches the keys of the
+/// O(log n) nodes on its path and iteration walks through contiguous memory.
+///
+/// Performance characteristics:
+/// - Lookup, insertion, erasure, bounds checking: O(log n), with a much shallower tree than ezMap
+/// - Memory usage: one allocation per node instead of per element, no per-element pointers
+/// - Iteration: O(n) in sorted key order
+/// - BuildFromSorted() creates a tightly packed tree from sorted data in O(n)
+///
+/// In contrast to ezMap, elements are moved around in memory when other elements are inserted or removed.
+/// Therefore, all iterators, references and pointers to keys and values are invalidated by every Insert(), FindOrAdd() and Remove().
+///
+/// Use when:
+/// - You need sorted iteration or range queries and the map is read much more often than it is modified
+/// - The map is large, or lookups are performance critical
+///
+/// Stick to ezMap when:
+/// - Stable element addresses are required
+/// - Keys or values are expensive to move
+template <typename KeyType, typename ValueType, typename Comparer>
+class ezBTreeMapBase
+{
+public:
+  using ConstIterator = ezBTreeMapBaseConstIteratorBase<KeyType, ValueType, Comparer, false>;
+  using ConstReverseIterator = ezBTreeMapBaseConstIteratorBase<KeyType, ValueType, Comparer, true>;
+
+  using Iterator = ezBTreeMapBaseIteratorBase<KeyType, ValueType, Comparer, false>;
+  using ReverseIterator = ezBTreeMapBaseIteratorBase<KeyType, ValueType, Comparer, true>;
+
+private:
+  friend ConstIterator;
+  friend ConstReverseIterator;
+  friend Iterator;
+  friend ReverseIterator;
+
+  /// \brief Value types without any state (used by ezBTreeSet) don't need any storage in the nodes.
+  static constexpr bool EmptyValues = std::is_empty_v<ValueType> && std::is_trivial_v<ValueType>;
+
+  static constexpr ezUInt32 EntrySize = sizeof(KeyType) + (EmptyValues ? 0 : sizeof(ValueType));
+
+public:
+  /// \brief How many key/value pairs a node can hold. The keys and values of a node take up about four cache lines (256 bytes).
+  static constexpr ezUInt32 MaxKeysPerNode = (256 / EntrySize) < 6 ? 6 : ((256 / EntrySize) > 64 ? 64 : (256 / EntrySize));
+
+private:
+  static constexpr ezUInt32 MinKeysPerNode = MaxKeysPerNode / 2;
+
+  struct InnerNode;
+
+  /// \brief A leaf node, also the base of all inner nodes.
+  struct Node
+  {
+    InnerNode* m_pParent = nullptr;
+    ezUInt16 m_uiPosInParent = 0;
+    ezUInt16 m_uiCount = 0;
+    bool m_bLeaf = true;
+
+    alignas(KeyType) ezUInt8 m_KeyStorage[sizeof(KeyType) * MaxKeysPerNode];
+    alignas(ValueType) ezUInt8 m_ValueStorage[sizeof(ValueType) * (EmptyValues ? 1 : MaxKeysPerNode)];
+
+    EZ_ALWAYS_INLINE KeyType* Keys() { return reinterpret_cast<KeyType*>(m_KeyStorage); }
+    EZ_ALWAYS_INLINE ValueType* Values() { return reinterpret_cast<ValueType*>(m_ValueStorage); }
+    EZ_ALWAYS_INLINE ValueType& Value(ezUInt32 uiIndex) { return Values()[EmptyValues ? 0 : uiIndex]; }
+  };
+
+  /// \brief An inner node additionally stores m_uiCount + 1 children.
+  struct InnerNode : public Node
+  {
+    Node* m_pChildren[MaxKeysPerNode + 1];
+  };
+
+protected:
+  /// \brief Initializes the map to be empty.
+  ezBTreeMapBase(const Comparer& comparer, ezAllocator* pAllocator); // [tested]
+
+  /// \brief Copies all key/value pairs from the given map into this one.
+  ezBTreeMapBase(const ezBTreeMapBase<KeyType, ValueType, Comparer>& cc, ezAllocator* pAllocator); // [tested]
+
+  /// \brief Destroys all elements from the map.
+  ~ezBTreeMapBase(); // [tested]
+
+  /// \brief Copies all key/value pairs from the given map into this one.
+  void operator=(const ezBTreeMapBase<KeyType, ValueType, Comparer>& rhs); // [tested]
+
+public:
+  /// \brief Returns whether there are no elements in the map. O(1) operation.
+  bool IsEmpty() const; // [tested]
+
+  /// \brief Returns the number of elements currently stored in the map. O(1) operation.
+  ezUInt32 GetCount() const; // [tested]
+
+  /// \brief Destroys all elements in the map and resets its size to zero.
+  void Clear(); // [tested]
+
+  /// \brief Returns an Iterator to the very first element.
+  Iterator GetIterator(); // [tested]
+
+  /// \brief Returns a ReverseIterator to the very last element.
+  ReverseIterator GetReverseIterator(); // [tested]
+
+  /// \brief Returns a constant Iterator to the very first element.
+  ConstIterator GetIterator() const; // [tested]
+
+  /// \brief Returns a constant ReverseIterator to the very last element.
+  ConstReverseIterator GetReverseIterator() const; // [tested]
+
+  /// \brief Inserts the key/value pair into the tree and returns an Iterator to it. O(log n) operation.
+  template <typename CompatibleKeyType, typename CompatibleValueType>
+  Iterator Insert(CompatibleKeyType&& key, CompatibleValueType&& value); // [tested]
+
+  /// \brief Erases the key/value pair with the given key, if it exists. O(log n) operation.
+  template <typename CompatibleKeyType>
+  bool Remove(const CompatibleKeyType& key); // [tested]
+
+  /// \brief Erases the key/value pair at the given Iterator. O(log n) operation. Returns an iterator to the element after the given
+  /// iterator.
+  Iterator Remove(const Iterator& pos); // [tested]
+
+  /// \brief Searches for the given key and returns an iterator to it. If it did not exist yet, it is default-created. \a bExisted is set to
+  /// true, if the key was found, false if it needed to be created.
+  template <typename CompatibleKeyType>
+  Iterator FindOrAdd(CompatibleKeyType&& key, bool* out_pExisted = nullptr); // [tested]
+
+  /// \brief Allows read/write access to the value stored under the given key. If there is no such key, a new element is
+  /// default-constructed.
+  template <typename CompatibleKeyType>
+  ValueType& operator[](const CompatibleKeyType& key); // [tested]
+
+  /// \brief Returns whether an entry with the given key was found and if found writes out the corresponding value to out_value.
+  template <typename CompatibleKeyType>
+  bool TryGetValue(const CompatibleKeyType& key, ValueType& out_value) const; // [tested]
+
+  /// \brief Returns whether an entry with the given key was found and if found writes out the pointer to the corresponding value to out_pValue.
+  template <typename CompatibleKeyType>
+  bool TryGetValue(const CompatibleKeyType& key, const ValueType*& out_pValue) const; // [tested]
+
+  /// \brief Returns whether an entry with the given key was found and if found writes out the pointer to the corresponding value to out_pValue.
+  template <typename CompatibleKeyType>
+  bool TryGetValue(const CompatibleKeyType& key, ValueType*& out_pValue) const; // [tested]
+
+  /// \brief Returns a pointer to the value of the entry with the given key if found, otherwise returns nullptr.
+  template <typename CompatibleKeyType>
+  const ValueType* GetValue(const CompatibleKeyType& key) const; // [tested]
+
+  /// \brief Returns a pointer to the value of the entry with the given key if found, otherwise returns nullptr.
+  template <typename CompatibleKeyType>
+  ValueType* GetValue(const CompatibleKeyType& key); // [tested]
+
+  /// \brief Either returns the value of the entry with the given key, if found, or the provided default value.
+  template <typename CompatibleKeyType>
+  const ValueType& GetValueOrDefault(const CompatibleKeyType& key, const ValueType& defaultValue) const; // [tested]
+
+  /// \brief Searches for key, returns an Iterator to it or an invalid iterator, if no such key is found. O(log n) operation.
+  template <typename CompatibleKeyType>
+  Iterator Find(const CompatibleKeyType& key); // [tested]
+
+  /// \brief Returns an Iterator to the element with a key equal or larger than the given key. Returns an invalid iterator, if there is no
+  /// such element.
+  template <typename CompatibleKeyType>
+  Iterator LowerBound(const CompatibleKeyType& key); // [tested]
+
+  /// \brief Returns an Iterator to the element with a key that is LARGER than the given key. Returns an invalid iterator, if there is no
+  /// such element.
+  template <typename CompatibleKeyType>
+  Iterator UpperBound(const CompatibleKeyType& key); // [tested]
+
+  /// \brief Searches for key, returns an Iterator to it or an invalid iterator, if no such key is found. O(log n) operation.
+  template <typename CompatibleKeyType>
+  ConstIterator Find(const CompatibleKeyType& key) const; // [tested]
+
+  /// \brief Checks whether the given key is in the container.
+  template <typename CompatibleKeyType>
+  bool Contains(const CompatibleKeyType& key) const; // [tested]
+
+  /// \brief Returns an Iterator to the element with a key equal or larger than the given key. Returns an invalid iterator, if there is no
+  /// such element.
+  template <typename CompatibleKeyType>
+  ConstIterator LowerBound(const CompatibleKeyType& key) const; // [tested]
+
+  /// \brief Returns an Iterator to the element with a key that is LARGER than the given key. Returns an invalid iterator, if there is no
+  /// such element.
+  template <typename CompatibleKeyType>
+  ConstIterator UpperBound(const CompatibleKeyType& key) const; // [tested]
+
+  /// \brief Replaces the content of the map with the given key/value pairs. O(n) operation.
+  ///
+  /// The keys must be sorted and unique. The tree is built bottom-up with completely filled nodes, which is much faster than inserting
+  /// the elements one by one and results in the smallest possible tree for read-mostly data.
+  void BuildFromSorted(ezArrayPtr<const KeyType> keys, ezArrayPtr<const ValueType> values); // [tested]
+
+  /// \brief Returns the allocator that is used by this instance.
+  ezAllocator* GetAllocator() const { return m_pAllocator; }
+
+  /// \brief Comparison operator
+  bool operator==(const ezBTreeMapBase<KeyType, ValueType, Comparer>& rhs) const; // [tested]
+  EZ_ADD_DEFAULT_OPERATOR_NOTEQUAL(const ezBTreeMapBase<KeyType, ValueType, Comparer>&);
+
+  /// \brief Returns the amount of bytes that are currently allocated on the heap.
+  ezUInt64 GetHeapMemoryUsage() const { return m_uiNumLeafNodes * sizeof(Node) + m_uiNumInnerNodes * sizeof(InnerNode); } // [tested]
+
+  /// \brief Swaps this map with the other one.
+  void Swap(ezBTreeMapBase<KeyType, ValueType, Comparer>& other); // [tested]
+
+protected:
+  /// \brief Implementation of BuildFromSorted(). If \a pValues is nullptr, all values are default constructed.
+  void BuildFromSortedInternal(ezArrayPtr<const KeyType> keys, const ValueType* pValues);
+
+private:
+  template <typename CompatibleKeyType>
+  ezUInt32 LowerBoundInNode(Node* pNode, const CompatibleKeyType& key) const;
+  template <typename CompatibleKeyType>
+  ezUInt32 UpperBoundInNode(Node* pNode, const CompatibleKeyType& key) const;
+
+  template <typename CompatibleKeyType>
+  Node* Internal_Find(const CompatibleKeyType& key, ezUInt32& out_uiIndex) const;
+  template <typename CompatibleKeyType>
+  Node* Internal_LowerBound(const CompatibleKeyType& key, ezUInt32& out_uiIndex) const;
+  template <typename CompatibleKeyType>
+  Node* Internal_UpperBound(const CompatibleKeyType& key, ezUInt32& out_uiIndex) const;
+
+  static InnerNode* AsInner(Node* pNode) { return static_cast<InnerNode*>(pNode); }
+  static void SetChild(InnerNode* pParent, ezUInt32 uiPos, Node* pChild);
+
+  Node* AcquireLeaf();
+  InnerNode* AcquireInnerNode();
+  void ReleaseNode(Node* pNode);
+
+  /// \brief Destroys all elements in the given subtree and frees its nodes.
+  void DestroySubtree(Node* pNode);
+  Node* CloneSubtree(Node* pSource, InnerNode* pParent, ezUInt32 uiPosInParent);
+
+  /// \brief Moves \a uiCount keys and values from one node into uninitialized slots of another node.
+  static void MoveEntries(Node* pDst, ezUInt32 uiDstIndex, Node* pSrc, ezUInt32 uiSrcIndex, ezUInt32 uiCount);
+  /// \brief Moves entries within a node, the slots that are moved into are uninitialized, the ones that are left become uninitialized.
+  static void ShiftEntries(Node* pNode, ezUInt32 uiDstIndex, ezUInt32 uiSrcIndex, ezUInt32 uiCount);
+  template <typename T>
+  static void RelocateWithinNode(T* pArray, ezUInt32 uiDstIndex, ezUInt32 uiSrcIndex, ezUInt32 uiCount);
+  static void ShiftChildren(InnerNode* pNode, ezUInt32 uiDstIndex, ezUInt32 uiSrcIndex, ezUInt32 uiCount);
+
+  /// \brief Splits a full node in two halves and moves the median up into its parent. Splits the parent first, if necessary.
+  void SplitNode(Node* pNode);
+
+  /// \brief Removes the element at the given position and restores the B-tree invariants.
+  /// The removed key is moved into \a out_pRemovedKey, if given, which must point to uninitialized memory.
+  void RemoveAt(Node* pNode, ezUInt32 uiIndex, KeyType* out_pRemovedKey);
+
+  /// \brief Fixes up nodes with too few elements after a removal, by borrowing from or merging with a sibling.
+  void Rebalance(Node* pNode);
+  void RotateLeft(InnerNode* pParent, ezUInt32 uiSeparator);
+  void RotateRight(InnerNode* pParent, ezUInt32 uiSeparator);
+  void Merge(InnerNode* pParent, ezUInt32 uiSeparator);
+
+  Node* GetLeftMost(ezUInt32& out_uiIndex) const;
+  Node* GetRightMost(ezUInt32& out_uiIndex) const;
+
+  Node* m_pRoot = nullptr;
+  ezUInt32 m_uiCount = 0;
+  ezUInt32 m_uiNumLeafNodes = 0;
+  ezUInt32 m_uiNumInnerNodes = 0;
+  ezAllocator* m_pAllocator = nullptr;
+  Comparer m_Comparer;
+};
+
+
+/// \brief \see ezBTreeMapBase
+template <typename KeyType, typename ValueType, typename Comparer = ezCompareHelper<KeyType>, typename AllocatorWrapper = ezDefaultAllocatorWrapper>
+class ezBTreeMap : public ezBTreeMapBase<KeyType, ValueType, Comparer>
+{
+public:
+  ezBTreeMap();
+  explicit ezBTreeMap(ezAllocator* pAllocator);
+  ezBTreeMap(const Comparer& comparer, ezAllocator* pAllocator);
+
+  ezBTreeMap(const ezBTreeMap<KeyType, ValueType, Comparer, AllocatorWrapper>& other);
+  ezBTreeMap(const ezBTreeMapBase<KeyType, ValueType, Comparer>& other);
+
+  void operator=(const ezBTreeMap<KeyType, ValueType, Comparer, AllocatorWrapper>& rhs);
+  void operator=(const ezBTreeMapBase<KeyType, ValueType, Comparer>& rhs);
+};
+
+template <typename KeyType, typename ValueType, typename Comparer>
+typename ezBTreeMapBase<KeyType, ValueType, Comparer>::Iterator begin(ezBTreeMapBase<KeyType, ValueType, Comparer>& ref_container)
+{
+  return ref_container.GetIterator();
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+typename ezBTreeMapBase<KeyType, ValueType, Comparer>::ConstIterator begin(const ezBTreeMapBase<KeyType, ValueType, Comparer>& container)
+{
+  return container.GetIterator();
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+typename ezBTreeMapBase<KeyType, ValueType, Comparer>::ConstIterator cbegin(const ezBTreeMapBase<KeyType, ValueType, Comparer>& container)
+{
+  return container.GetIterator();
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+typename ezBTreeMapBase<KeyType, ValueType, Comparer>::Iterator end(ezBTreeMapBase<KeyType, ValueType, Comparer>& ref_container)
+{
+  EZ_IGNORE_UNUSED(ref_container);
+  return typename ezBTreeMapBase<KeyType, ValueType, Comparer>::Iterator();
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+typename ezBTreeMapBase<KeyType, ValueType, Comparer>::ConstIterator end(const ezBTreeMapBase<KeyType, ValueType, Comparer>& container)
+{
+  EZ_IGNORE_UNUSED(container);
+  return typename ezBTreeMapBase<KeyType, ValueType, Comparer>::ConstIterator();
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+typename ezBTreeMapBase<KeyType, ValueType, Comparer>::ConstIterator cend(const ezBTreeMapBase<KeyType, ValueType, Comparer>& container)
+{
+  EZ_IGNORE_UNUSED(container);
+  return typename ezBTreeMapBase<KeyType, ValueType, Comparer>::ConstIterator();
+}
+
+#include <Foundation/Containers/Implementation/BTreeMap_inl.h>
@@ -0,0 +1,236 @@
+#pragma once
+
+#include <Foundation/Containers/BTreeMap.h>
+
+/// \brief A set container with the same interface as ezSet, but implemented as a B-tree.
+///
+/// This is an ezBTreeMapBase without values, see there for the performance characteristics.
+/// Just like with ezBTreeMap, all iterators are invalidated by every Insert() and Remove().
+///
+/// Use when:
+/// - You need sorted iteration over unique elements and the set is large or lookups are performance critical
+/// - The set is built once from sorted data (see BuildFromSorted()) and queried often
+///
+/// Stick to ezSet when:
+/// - Stable element addresses are required
+template <typename KeyType, typename Comparer>
+class ezBTreeSetBase
+{
+private:
+  /// \brief The tree stores no values, this type takes up no space in the nodes.
+  struct EmptyValue
+  {
+  };
+
+  class Tree : public ezBTreeMapBase<KeyType, EmptyValue, Comparer>
+  {
+  public:
+    Tree(const Comparer& comparer, ezAllocator* pAllocator)
+      : ezBTreeMapBase<KeyType, EmptyValue, Comparer>(comparer, pAllocator)
+    {
+    }
+
+    Tree(const Tree& cc, ezAllocator* pAllocator)
+      : ezBTreeMapBase<KeyType, EmptyValue, Comparer>(cc, pAllocator)
+    {
+    }
+
+    void operator=(const Tree& rhs) { ezBTreeMapBase<KeyType, EmptyValue, Comparer>::operator=(rhs); }
+
+    using ezBTreeMapBase<KeyType, EmptyValue, Comparer>::BuildFromSortedInternal;
+  };
+
+  using TreeIterator = typename Tree::Iterator;
+  using TreeReverseIterator = typename Tree::ReverseIterator;
+
+public:
+  /// \brief Base class for all iterators.
+  template <bool REVERSE>
+  struct IteratorBase
+  {
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = IteratorBase<REVERSE>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = IteratorBase<REVERSE>*;
+    using reference = IteratorBase<REVERSE>&;
+
+    EZ_DECLARE_POD_TYPE();
+
+    /// \brief Constructs an invalid iterator.
+    EZ_ALWAYS_INLINE IteratorBase() = default; // [tested]
+
+    /// \brief Checks whether this iterator points to a valid element.
+    EZ_ALWAYS_INLINE bool IsValid() const { return m_It.IsValid(); } // [tested]
+
+    /// \brief Checks whether the two iterators point to the same element.
+    EZ_ALWAYS_INLINE bool operator==(const typename ezBTreeSetBase<KeyType, Comparer>::IteratorBase<REVERSE>& it2) const { return (m_It == it2.m_It); }
+    EZ_ADD_DEFAULT_OPERATOR_NOTEQUAL(const typename ezBTreeSetBase<KeyType, Comparer>::IteratorBase<REVERSE>&);
+
+    /// \brief Returns the 'key' of the element that this iterator points to.
+    EZ_ALWAYS_INLINE const KeyType& Key() const { return m_It.Key(); } // [tested]
+
+    /// \brief Returns the 'key' of the element that this iterator points to.
+    EZ_ALWAYS_INLINE const KeyType& operator*() const { return Key(); }
+
+    /// \brief Advances the iterator to the next element in the set. The iterator will not be valid anymore, if the end is reached.
+    EZ_ALWAYS_INLINE void Next() { m_It.Next(); } // [tested]
+
+    /// \brief Advances the iterator to the previous element in the set. The iterator will not be valid anymore, if the end is reached.
+    EZ_ALWAYS_INLINE void Prev() { m_It.Prev(); } // [tested]
+
+    /// \brief Shorthand for 'Next'
+    EZ_ALWAYS_INLINE void operator++() { Next(); } // [tested]
+
+    /// \brief Shorthand for 'Prev'
+    EZ_ALWAYS_INLINE void operator--() { Prev(); } // [tested]
+
+  private:
+    friend class ezBTreeSetBase<KeyType, Comparer>;
+
+    using TreeIteratorType = std::conditional_t<REVERSE, TreeReverseIterator, TreeIterator>;
+
+    EZ_ALWAYS_INLINE explicit IteratorBase(const TreeIteratorType& it)
+      : m_It(it)
+    {
+    }
+
+    TreeIteratorType m_It;
+  };
+
+  using Iterator = IteratorBase<false>;
+  using ReverseIterator = IteratorBase<true>;
+
+protected:
+  /// \brief Initializes the set to be empty.
+  ezBTreeSetBase(const Comparer& comparer, ezAllocator* pAllocator); // [tested]
+
+  /// \brief Copies all keys from the given set into this one.
+  ezBTreeSetBase(const ezBTreeSetBase<KeyType, Comparer>& cc, ezAllocator* pAllocator); // [tested]
+
+  /// \brief Copies all keys from the given set into this one.
+  void operator=(const ezBTreeSetBase<KeyType, Comparer>& rhs); // [tested]
+
+public:
+  /// \brief Returns whether there are no elements in the set. O(1) operation.
+  bool IsEmpty() const { return m_Elements.IsEmpty(); } // [tested]
+
+  /// \brief Returns the number of elements currently stored in the set. O(1) operation.
+  ezUInt32 GetCount() const { return m_Elements.GetCount(); } // [tested]
+
+  /// \brief Destroys all elements in the set and resets its size to zero.
+  void Clear() { m_Elements.Clear(); } // [tested]
+
+  /// \brief Returns a constant Iterator to the very first element.
+  Iterator GetIterator() const; // [tested]
+
+  /// \brief Returns a constant ReverseIterator to the very last element.
+  ReverseIterator GetReverseIterator() const; // [tested]
+
+  /// \brief Inserts the key into the tree and returns an Iterator to it. O(log n) operation.
+  template <typename CompatibleKeyType>
+  Iterator Insert(CompatibleKeyType&& key); // [tested]
+
+  /// \brief Erases the element with the given key, if it exists. O(log n) operation.
+  template <typename CompatibleKeyType>
+  bool Remove(const CompatibleKeyType& key); // [tested]
+
+  /// \brief Erases the element at the given Iterator. O(log n) operation. Returns an iterator to the element after the given iterator.
+  Iterator Remove(const Iterator& pos); // [tested]
+
+  /// \brief Searches for key, returns an Iterator to it or an invalid iterator, if no such key is found. O(log n) operation.
+  template <typename CompatibleKeyType>
+  Iterator Find(const CompatibleKeyType& key) const; // [tested]
+
+  /// \brief Checks whether the given key is in the container.
+  template <typename CompatibleKeyType>
+  bool Contains(const CompatibleKeyType& key) const; // [tested]
+
+  /// \brief Checks whether all keys of the given set are in the container.
+  bool ContainsSet(const ezBTreeSetBase<KeyType, Comparer>& operand) const; // [tested]
+
+  /// \brief Returns an Iterator to the element with a key equal or larger than the given key. Returns an invalid iterator, if there is no
+  /// such element.
+  template <typename CompatibleKeyType>
+  Iterator LowerBound(const CompatibleKeyType& key) const; // [tested]
+
+  /// \brief Returns an Iterator to the element with a key that is LARGER than the given key. Returns an invalid iterator, if there is no
+  /// such element.
+  template <typename CompatibleKeyType>
+  Iterator UpperBound(const CompatibleKeyType& key) const; // [tested]
+
+  /// \brief Makes this set the union of itself and the operand.
+  void Union(const ezBTreeSetBase<KeyType, Comparer>& operand); // [tested]
+
+  /// \brief Makes this set the difference of itself and the operand, i.e. subtracts operand.
+  void Difference(const ezBTreeSetBase<KeyType, Comparer>& operand); // [tested]
+
+  /// \brief Modifies this to only contain the elements that were in both this and the operand.
+  void Intersection(const ezBTreeSetBase<KeyType, Comparer>& operand); // [tested]
+
+  /// \brief Replaces the content of the set with the given keys, which must be sorted and unique. O(n) operation.
+  void BuildFromSorted(ezArrayPtr<const KeyType> keys); // [tested]
+
+  /// \brief Returns the allocator that is used by this instance.
+  ezAllocator* GetAllocator() const { return m_Elements.GetAllocator(); }
+
+  /// \brief Comparison operator
+  bool operator==(const ezBTreeSetBase<KeyType, Comparer>& rhs) const { return m_Elements == rhs.m_Elements; } // [tested]
+  EZ_ADD_DEFAULT_OPERATOR_NOTEQUAL(const ezBTreeSetBase<KeyType, Comparer>&);
+
+  /// \brief Returns the amount of bytes that are currently allocated on the heap.
+  ezUInt64 GetHeapMemoryUsage() const { return m_Elements.GetHeapMemoryUsage(); } // [tested]
+
+  /// \brief Swaps this set with the other one.
+  void Swap(ezBTreeSetBase<KeyType, Comparer>& other) { m_Elements.Swap(other.m_Elements); } // [tested]
+
+private:
+  /// \brief The iterators of the set only allow read access, but the underlying tree iterators are needed for Remove().
+  Tree& GetTree() const { return const_cast<Tree&>(m_Elements); }
+
+  Tree m_Elements;
+};
+
+/// \brief \see ezBTreeSetBase
+template <typename KeyType, typename Comparer = ezCompareHelper<KeyType>, typename AllocatorWrapper = ezDefaultAllocatorWrapper>
+class ezBTreeSet : public ezBTreeSetBase<KeyType, Comparer>
+{
+public:
+  ezBTreeSet();
+  explicit ezBTreeSet(ezAllocator* pAllocator);
+  ezBTreeSet(const Comparer& comparer, ezAllocator* pAllocator);
+
+  ezBTreeSet(const ezBTreeSet<KeyType, Comparer, AllocatorWrapper>& other);
+  ezBTreeSet(const ezBTreeSetBase<KeyType, Comparer>& other);
+
+  void operator=(const ezBTreeSet<KeyType, Comparer, AllocatorWrapper>& rhs);
+  void operator=(const ezBTreeSetBase<KeyType, Comparer>& rhs);
+};
+
+
+template <typename KeyType, typename Comparer>
+typename ezBTreeSetBase<KeyType, Comparer>::Iterator begin(const ezBTreeSetBase<KeyType, Comparer>& container)
+{
+  return container.GetIterator();
+}
+
+template <typename KeyType, typename Comparer>
+typename ezBTreeSetBase<KeyType, Comparer>::Iterator cbegin(const ezBTreeSetBase<KeyType, Comparer>& container)
+{
+  return container.GetIterator();
+}
+
+template <typename KeyType, typename Comparer>
+typename ezBTreeSetBase<KeyType, Comparer>::Iterator end(const ezBTreeSetBase<KeyType, Comparer>& container)
+{
+  EZ_IGNORE_UNUSED(container);
+  return typename ezBTreeSetBase<KeyType, Comparer>::Iterator();
+}
+
+template <typename KeyType, typename Comparer>
+typename ezBTreeSetBase<KeyType, Comparer>::Iterator cend(const ezBTreeSetBase<KeyType, Comparer>& container)
+{
+  EZ_IGNORE_UNUSED(container);
+  return typename ezBTreeSetBase<KeyType, Comparer>::Iterator();
+}
+
+#include <Foundation/Containers/Implementation/BTreeSet_inl.h>
@@ -0,0 +1,1150 @@
+#pragma once
+
+// ***** Const Iterator *****
+
+template <typename KeyType, typename ValueType, typename Comparer, bool REVERSE>
+void ezBTreeMapBaseConstIteratorBase<KeyType, ValueType, Comparer, REVERSE>::Forward()
+{
+  EZ_ASSERT_DEBUG(m_pNode != nullptr, "The Iterator is invalid (end).");
+
+  using Map = ezBTreeMapBase<KeyType, ValueType, Comparer>;
+
+  // in an inner node, the next element is the left-most one in the subtree right of the current key
+  if (!m_pNode->m_bLeaf)
+  {
+    m_pNode = Map::AsInner(m_pNode)->m_pChildren[m_uiIndex + 1];
+
+    while (!m_pNode->m_bLeaf)
+      m_pNode = Map::AsInner(m_pNode)->m_pChildren[0];
+
+    m_uiIndex = 0;
+    return;
+  }
+
+  ++m_uiIndex;
+
+  // at the end of a leaf, go up until we come from a child that has a key to its right
+  while (m_uiIndex == m_pNode->m_uiCount)
+  {
+    if (m_pNode->m_pParent == nullptr)
+    {
+      m_pNode = nullptr;
+      m_uiIndex = 0;
+      return;
+    }
+
+    m_uiIndex = m_pNode->m_uiPosInParent;
+    m_pNode = m_pNode->m_pParent;
+  }
+}
+
+template <typename KeyType, typename ValueType, typename Comparer, bool REVERSE>
+void ezBTreeMapBaseConstIteratorBase<KeyType, ValueType, Comparer, REVERSE>::Backward()
+{
+  EZ_ASSERT_DEBUG(m_pNode != nullptr, "The Iterator is invalid (end).");
+
+  using Map = ezBTreeMapBase<KeyType, ValueType, Comparer>;
+
+  // in an inner node, the previous element is the right-most one in the subtree left of the current key
+  if (!m_pNode->m_bLeaf)
+  {
+    m_pNode = Map::AsInner(m_pNode)->m_pChildren[m_uiIndex];
+
+    while (!m_pNode->m_bLeaf)
+      m_pNode = Map::AsInner(m_pNode)->m_pChildren[m_pNode->m_uiCount];
+
+    m_uiIndex = m_pNode->m_uiCount - 1;
+    return;
+  }
+
+  // at the start of a leaf, go up until we come from a child that has a key to its left
+  while (m_uiIndex == 0)
+  {
+    if (m_pNode->m_pParent == nullptr)
+    {
+      m_pNode = nullptr;
+      return;
+    }
+
+    m_uiIndex = m_pNode->m_uiPosInParent;
+    m_pNode = m_pNode->m_pParent;
+  }
+
+  --m_uiIndex;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer, bool REVERSE>
+void ezBTreeMapBaseConstIteratorBase<KeyType, ValueType, Comparer, REVERSE>::Next()
+{
+  if constexpr (REVERSE)
+  {
+    Backward();
+  }
+  else
+  {
+    Forward();
+  }
+}
+
+template <typename KeyType, typename ValueType, typename Comparer, bool REVERSE>
+void ezBTreeMapBaseConstIteratorBase<KeyType, ValueType, Comparer, REVERSE>::Prev()
+{
+  if constexpr (REVERSE)
+  {
+    Forward();
+  }
+  else
+  {
+    Backward();
+  }
+}
+
+// ***** ezBTreeMapBase *****
+
+template <typename KeyType, typename ValueType, typename Comparer>
+ezBTreeMapBase<KeyType, ValueType, Comparer>::ezBTreeMapBase(const Comparer& comparer, ezAllocator* pAllocator)
+  : m_pAllocator(pAllocator)
+  , m_Comparer(comparer)
+{
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+ezBTreeMapBase<KeyType, ValueType, Comparer>::ezBTreeMapBase(const ezBTreeMapBase<KeyType, ValueType, Comparer>& cc, ezAllocator* pAllocator)
+  : m_pAllocator(pAllocator)
+  , m_Comparer(cc.m_Comparer)
+{
+  operator=(cc);
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+ezBTreeMapBase<KeyType, ValueType, Comparer>::~ezBTreeMapBase()
+{
+  Clear();
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+void ezBTreeMapBase<KeyType, ValueType, Comparer>::operator=(const ezBTreeMapBase<KeyType, ValueType, Comparer>& rhs)
+{
+  if (this == &rhs)
+    return;
+
+  Clear();
+
+  // the structure is copied as is, which is a lot cheaper than inserting all elements one by one
+  if (rhs.m_pRoot != nullptr)
+  {
+    m_pRoot = CloneSubtree(rhs.m_pRoot, nullptr, 0);
+  }
+
+  m_uiCount = rhs.m_uiCount;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+void ezBTreeMapBase<KeyType, ValueType, Comparer>::Clear()
+{
+  if (m_pRoot != nullptr)
+  {
+    DestroySubtree(m_pRoot);
+    m_pRoot = nullptr;
+  }
+
+  m_uiCount = 0;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+EZ_ALWAYS_INLINE bool ezBTreeMapBase<KeyType, ValueType, Comparer>::IsEmpty() const
+{
+  return (m_uiCount == 0);
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+EZ_ALWAYS_INLINE ezUInt32 ezBTreeMapBase<KeyType, ValueType, Comparer>::GetCount() const
+{
+  return m_uiCount;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+EZ_ALWAYS_INLINE typename ezBTreeMapBase<KeyType, ValueType, Comparer>::Iterator ezBTreeMapBase<KeyType, ValueType, Comparer>::GetIterator()
+{
+  ezUInt32 uiIndex = 0;
+  Node* pNode = GetLeftMost(uiIndex);
+  return Iterator(pNode, uiIndex);
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+EZ_ALWAYS_INLINE typename ezBTreeMapBase<KeyType, ValueType, Comparer>::ConstIterator ezBTreeMapBase<KeyType, ValueType, Comparer>::GetIterator() const
+{
+  ezUInt32 uiIndex = 0;
+  Node* pNode = GetLeftMost(uiIndex);
+  return ConstIterator(pNode, uiIndex);
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+EZ_ALWAYS_INLINE typename ezBTreeMapBase<KeyType, ValueType, Comparer>::ReverseIterator ezBTreeMapBase<KeyType, ValueType, Comparer>::GetReverseIterator()
+{
+  ezUInt32 uiIndex = 0;
+  Node* pNode = GetRightMost(uiIndex);
+  return ReverseIterator(pNode, uiIndex);
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+EZ_ALWAYS_INLINE typename ezBTreeMapBase<KeyType, ValueType, Comparer>::ConstReverseIterator ezBTreeMapBase<KeyType, ValueType, Comparer>::GetReverseIterator() const
+{
+  ezUInt32 uiIndex = 0;
+  Node* pNode = GetRightMost(uiIndex);
+  return ConstReverseIterator(pNode, uiIndex);
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+typename ezBTreeMapBase<KeyType, ValueType, Comparer>::Node* ezBTreeMapBase<KeyType, ValueType, Comparer>::GetLeftMost(ezUInt32& out_uiIndex) const
+{
+  out_uiIndex = 0;
+
+  if (IsEmpty())
+    return nullptr;
+
+  Node* pNode = m_pRoot;
+
+  while (!pNode->m_bLeaf)
+    pNode = AsInner(pNode)->m_pChildren[0];
+
+  return pNode;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+typename ezBTreeMapBase<KeyType, ValueType, Comparer>::Node* ezBTreeMapBase<KeyType, ValueType, Comparer>::GetRightMost(ezUInt32& out_uiIndex) const
+{
+  out_uiIndex = 0;
+
+  if (IsEmpty())
+    return nullptr;
+
+  Node* pNode = m_pRoot;
+
+  while (!pNode->m_bLeaf)
+    pNode = AsInner(pNode)->m_pChildren[pNode->m_uiCount];
+
+  out_uiIndex = pNode->m_uiCount - 1;
+  return pNode;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+template <typename CompatibleKeyType>
+EZ_FORCE_INLINE ezUInt32 ezBTreeMapBase<KeyType, ValueType, Comparer>::LowerBoundInNode(Node* pNode, const CompatibleKeyType& key) const
+{
+  // binary search for the first key that is not less than the given key,
+  // written such that the compiler can use conditional moves instead of hard to predict branches
+  const KeyType* pKeys = pNode->Keys();
+  ezUInt32 uiCount = pNode->m_uiCount;
+
+  if (uiCount == 0)
+    return 0;
+
+  ezUInt32 uiBase = 0;
+  while (uiCount > 1)
+  {
+    const ezUInt32 uiHalf = uiCount / 2;
+    uiBase = m_Comparer.Less(pKeys[uiBase + uiHalf], key) ? uiBase + uiHalf : uiBase;
+    uiCount -= uiHalf;
+  }
+
+  return uiBase + (m_Comparer.Less(pKeys[uiBase], key) ? 1 : 0);
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+template <typename CompatibleKeyType>
+EZ_FORCE_INLINE ezUInt32 ezBTreeMapBase<KeyType, ValueType, Comparer>::UpperBoundInNode(Node* pNode, const CompatibleKeyType& key) const
+{
+  // binary search for the first key that is larger than the given key, see LowerBoundInNode()
+  const KeyType* pKeys = pNode->Keys();
+  ezUInt32 uiCount = pNode->m_uiCount;
+
+  if (uiCount == 0)
+    return 0;
+
+  ezUInt32 uiBase = 0;
+  while (uiCount > 1)
+  {
+    const ezUInt32 uiHalf = uiCount / 2;
+    uiBase = !m_Comparer.Less(key, pKeys[uiBase + uiHalf]) ? uiBase + uiHalf : uiBase;
+    uiCount -= uiHalf;
+  }
+
+  return uiBase + (!m_Comparer.Less(key, pKeys[uiBase]) ? 1 : 0);
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+template <typename CompatibleKeyType>
+typename ezBTreeMapBase<KeyType, ValueType, Comparer>::Node* ezBTreeMapBase<KeyType, ValueType, Comparer>::Internal_Find(const CompatibleKeyType& key, ezUInt32& out_uiIndex) const
+{
+  Node* pNode = m_pRoot;
+
+  while (pNode != nullptr)
+  {
+    const ezUInt32 uiIndex = LowerBoundInNode(pNode, key);
+
+    if (uiIndex < pNode->m_uiCount && m_Comparer.Equal(pNode->Keys()[uiIndex], key))
+    {
+      out_uiIndex = uiIndex;
+      return pNode;
+    }
+
+    if (pNode->m_bLeaf)
+      break;
+
+    pNode = AsInner(pNode)->m_pChildren[uiIndex];
+  }
+
+  out_uiIndex = 0;
+  return nullptr;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+template <typename CompatibleKeyType>
+typename ezBTreeMapBase<KeyType, ValueType, Comparer>::Node* ezBTreeMapBase<KeyType, ValueType, Comparer>::Internal_LowerBound(const CompatibleKeyType& key, ezUInt32& out_uiIndex) const
+{
+  Node* pNode = m_pRoot;
+  Node* pCandidate = nullptr;
+  ezUInt32 uiCandidate = 0;
+
+  while (pNode != nullptr)
+  {
+    const ezUInt32 uiIndex = LowerBoundInNode(pNode, key);
+
+    if (uiIndex < pNode->m_uiCount)
+    {
+      // everything in the subtree left of this key is smaller, but might still be equal or larger than the given key
+      pCandidate = pNode;
+      uiCandidate = uiIndex;
+
+      if (m_Comparer.Equal(pNode->Keys()[uiIndex], key))
+        break;
+    }
+
+    if (pNode->m_bLeaf)
+      break;
+
+    pNode = AsInner(pNode)->m_pChildren[uiIndex];
+  }
+
+  out_uiIndex = uiCandidate;
+  return pCandidate;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+template <typename CompatibleKeyType>
+typename ezBTreeMapBase<KeyType, ValueType, Comparer>::Node* ezBTreeMapBase<KeyType, ValueType, Comparer>::Internal_UpperBound(const CompatibleKeyType& key, ezUInt32& out_uiIndex) const
+{
+  Node* pNode = m_pRoot;
+  Node* pCandidate = nullptr;
+  ezUInt32 uiCandidate = 0;
+
+  while (pNode != nullptr)
+  {
+    const ezUInt32 uiIndex = UpperBoundInNode(pNode, key);
+
+    if (uiIndex < pNode->m_uiCount)
+    {
+      pCandidate = pNode;
+      uiCandidate = uiIndex;
+    }
+
+    if (pNode->m_bLeaf)
+      break;
+
+    pNode = AsInner(pNode)->m_pChildren[uiIndex];
+  }
+
+  out_uiIndex = uiCandidate;
+  return pCandidate;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+template <typename CompatibleKeyType>
+EZ_ALWAYS_INLINE bool ezBTreeMapBase<KeyType, ValueType, Comparer>::TryGetValue(const CompatibleKeyType& key, ValueType& out_value) const
+{
+  ezUInt32 uiIndex = 0;
+  Node* pNode = Internal_Find<CompatibleKeyType>(key, uiIndex);
+  if (pNode != nullptr)
+  {
+    out_value = pNode->Value(uiIndex);
+    return true;
+  }
+
+  return false;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+template <typename CompatibleKeyType>
+EZ_ALWAYS_INLINE bool ezBTreeMapBase<KeyType, ValueType, Comparer>::TryGetValue(const CompatibleKeyType& key, const ValueType*& out_pValue) const
+{
+  ezUInt32 uiIndex = 0;
+  Node* pNode = Internal_Find<CompatibleKeyType>(key, uiIndex);
+  if (pNode != nullptr)
+  {
+    out_pValue = &pNode->Value(uiIndex);
+    return true;
+  }
+
+  return false;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+template <typename CompatibleKeyType>
+EZ_ALWAYS_INLINE bool ezBTreeMapBase<KeyType, ValueType, Comparer>::TryGetValue(const CompatibleKeyType& key, ValueType*& out_pValue) const
+{
+  ezUInt32 uiIndex = 0;
+  Node* pNode = Internal_Find<CompatibleKeyType>(key, uiIndex);
+  if (pNode != nullptr)
+  {
+    out_pValue = &pNode->Value(uiIndex);
+    return true;
+  }
+
+  return false;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+template <typename CompatibleKeyType>
+EZ_ALWAYS_INLINE const ValueType* ezBTreeMapBase<KeyType, ValueType, Comparer>::GetValue(const CompatibleKeyType& key) const
+{
+  ezUInt32 uiIndex = 0;
+  Node* pNode = Internal_Find<CompatibleKeyType>(key, uiIndex);
+  return pNode ? &pNode->Value(uiIndex) : nullptr;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+template <typename CompatibleKeyType>
+EZ_ALWAYS_INLINE ValueType* ezBTreeMapBase<KeyType, ValueType, Comparer>::GetValue(const CompatibleKeyType& key)
+{
+  ezUInt32 uiIndex = 0;
+  Node* pNode = Internal_Find<CompatibleKeyType>(key, uiIndex);
+  return pNode ? &pNode->Value(uiIndex) : nullptr;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+template <typename CompatibleKeyType>
+EZ_ALWAYS_INLINE const ValueType& ezBTreeMapBase<KeyType, ValueType, Comparer>::GetValueOrDefault(const CompatibleKeyType& key, const ValueType& defaultValue) const
+{
+  ezUInt32 uiIndex = 0;
+  Node* pNode = Internal_Find<CompatibleKeyType>(key, uiIndex);
+  return pNode ? pNode->Value(uiIndex) : defaultValue;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+template <typename CompatibleKeyType>
+EZ_ALWAYS_INLINE typename ezBTreeMapBase<KeyType, ValueType, Comparer>::Iterator ezBTreeMapBase<KeyType, ValueType, Comparer>::Find(const CompatibleKeyType& key)
+{
+  ezUInt32 uiIndex = 0;
+  Node* pNode = Internal_Find<CompatibleKeyType>(key, uiIndex);
+  return Iterator(pNode, uiIndex);
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+template <typename CompatibleKeyType>
+EZ_ALWAYS_INLINE typename ezBTreeMapBase<KeyType, ValueType, Comparer>::ConstIterator ezBTreeMapBase<KeyType, ValueType, Comparer>::Find(const CompatibleKeyType& key) const
+{
+  ezUInt32 uiIndex = 0;
+  Node* pNode = Internal_Find<CompatibleKeyType>(key, uiIndex);
+  return ConstIterator(pNode, uiIndex);
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+template <typename CompatibleKeyType>
+EZ_ALWAYS_INLINE bool ezBTreeMapBase<KeyType, ValueType, Comparer>::Contains(const CompatibleKeyType& key) const
+{
+  ezUInt32 uiIndex = 0;
+  return Internal_Find(key, uiIndex) != nullptr;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+template <typename CompatibleKeyType>
+EZ_ALWAYS_INLINE typename ezBTreeMapBase<KeyType, ValueType, Comparer>::Iterator ezBTreeMapBase<KeyType, ValueType, Comparer>::LowerBound(const CompatibleKeyType& key)
+{
+  ezUInt32 uiIndex = 0;
+  Node* pNode = Internal_LowerBound(key, uiIndex);
+  return Iterator(pNode, uiIndex);
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+template <typename CompatibleKeyType>
+EZ_ALWAYS_INLINE typename ezBTreeMapBase<KeyType, ValueType, Comparer>::ConstIterator ezBTreeMapBase<KeyType, ValueType, Comparer>::LowerBound(const CompatibleKeyType& key) const
+{
+  ezUInt32 uiIndex = 0;
+  Node* pNode = Internal_LowerBound(key, uiIndex);
+  return ConstIterator(pNode, uiIndex);
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+template <typename CompatibleKeyType>
+EZ_ALWAYS_INLINE typename ezBTreeMapBase<KeyType, ValueType, Comparer>::Iterator ezBTreeMapBase<KeyType, ValueType, Comparer>::UpperBound(const CompatibleKeyType& key)
+{
+  ezUInt32 uiIndex = 0;
+  Node* pNode = Internal_UpperBound(key, uiIndex);
+  return Iterator(pNode, uiIndex);
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+template <typename CompatibleKeyType>
+EZ_ALWAYS_INLINE typename ezBTreeMapBase<KeyType, ValueType, Comparer>::ConstIterator ezBTreeMapBase<KeyType, ValueType, Comparer>::UpperBound(const CompatibleKeyType& key) const
+{
+  ezUInt32 uiIndex = 0;
+  Node* pNode = Internal_UpperBound(key, uiIndex);
+  return ConstIterator(pNode, uiIndex);
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+template <typename CompatibleKeyType>
+ValueType& ezBTreeMapBase<KeyType, ValueType, Comparer>::operator[](const CompatibleKeyType& key)
+{
+  return FindOrAdd(key).Value();
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+template <typename CompatibleKeyType>
+typename ezBTreeMapBase<KeyType, ValueType, Comparer>::Iterator ezBTreeMapBase<KeyType, ValueType, Comparer>::FindOrAdd(CompatibleKeyType&& key, bool* out_pExisted)
+{
+  if (m_pRoot == nullptr)
+  {
+    m_pRoot = AcquireLeaf();
+  }
+
+  Node* pNode = m_pRoot;
+  ezUInt32 uiIndex = 0;
+
+  while (true)
+  {
+    uiIndex = LowerBoundInNode(pNode, key);
+
+    if (uiIndex < pNode->m_uiCount && m_Comparer.Equal(pNode->Keys()[uiIndex], key))
+    {
+      if (out_pExisted)
+        *out_pExisted = true;
+
+      return Iterator(pNode, uiIndex);
+    }
+
+    if (pNode->m_bLeaf)
+      break;
+
+    pNode = AsInner(pNode)->m_pChildren[uiIndex];
+  }
+
+  // new elements are always inserted into leaves, a full leaf gets split first
+  if (pNode->m_uiCount == MaxKeysPerNode)
+  {
+    SplitNode(pNode);
+
+    constexpr ezUInt32 uiMedian = MaxKeysPerNode / 2;
+    if (uiIndex > uiMedian)
+    {
+      pNode = pNode->m_pParent->m_pChildren[pNode->m_uiPosInParent + 1];
+      uiIndex -= uiMedian + 1;
+    }
+  }
+
+  ShiftEntries(pNode, uiIndex + 1, uiIndex, pNode->m_uiCount - uiIndex);
+  ezMemoryUtils::CopyOrMoveConstruct<KeyType>(pNode->Keys() + uiIndex, std::forward<CompatibleKeyType>(key));
+
+  if constexpr (!EmptyValues)
+  {
+    ezMemoryUtils::Construct<ConstructAll>(pNode->Values() + uiIndex, 1);
+  }
+
+  ++pNode->m_uiCount;
+  ++m_uiCount;
+
+  if (out_pExisted)
+    *out_pExisted = false;
+
+  return Iterator(pNode, uiIndex);
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+template <typename CompatibleKeyType, typename CompatibleValueType>
+typename ezBTreeMapBase<KeyType, ValueType, Comparer>::Iterator ezBTreeMapBase<KeyType, ValueType, Comparer>::Insert(CompatibleKeyType&& key, CompatibleValueType&& value)
+{
+  auto it = FindOrAdd(std::forward<CompatibleKeyType>(key));
+  it.Value() = std::forward<CompatibleValueType>(value);
+
+  return it;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+template <typename CompatibleKeyType>
+bool ezBTreeMapBase<KeyType, ValueType, Comparer>::Remove(const CompatibleKeyType& key)
+{
+  ezUInt32 uiIndex = 0;
+  Node* pNode = Internal_Find(key, uiIndex);
+
+  if (pNode == nullptr)
+    return false;
+
+  RemoveAt(pNode, uiIndex, nullptr);
+  return true;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+typename ezBTreeMapBase<KeyType, ValueType, Comparer>::Iterator ezBTreeMapBase<KeyType, ValueType, Comparer>::Remove(const Iterator& pos)
+{
+  EZ_ASSERT_DEBUG(pos.IsValid(), "The Iterator(pos) is invalid.");
+
+  // the tree gets restructured, so the position of the next element is unknown afterwards,
+  // but it is the first element that is larger than the removed one
+  alignas(KeyType) ezUInt8 removedKeyStorage[sizeof(KeyType)];
+  KeyType* pRemovedKey = reinterpret_cast<KeyType*>(removedKeyStorage);
+
+  RemoveAt(pos.m_pNode, pos.m_uiIndex, pRemovedKey);
+
+  Iterator next = UpperBound(*pRemovedKey);
+  ezMemoryUtils::Destruct<KeyType>(pRemovedKey, 1);
+
+  return next;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+void ezBTreeMapBase<KeyType, ValueType, Comparer>::RemoveAt(Node* pNode, ezUInt32 uiIndex, KeyType* out_pRemovedKey)
+{
+  if (out_pRemovedKey != nullptr)
+    ezMemoryUtils::RelocateConstruct<KeyType>(out_pRemovedKey, pNode->Keys() + uiIndex, 1);
+  else
+    ezMemoryUtils::Destruct<KeyType>(pNode->Keys() + uiIndex, 1);
+
+  if constexpr (!EmptyValues)
+  {
+    ezMemoryUtils::Destruct<ValueType>(pNode->Values() + uiIndex, 1);
+  }
+
+  if (!pNode->m_bLeaf)
+  {
+    // elements can only be taken out of leaves, so the gap is filled with the largest element of the left subtree
+    Node* pLeaf = AsInner(pNode)->m_pChildren[uiIndex];
+    while (!pLeaf->m_bLeaf)
+      pLeaf = AsInner(pLeaf)->m_pChildren[pLeaf->m_uiCount];
+
+    MoveEntries(pNode, uiIndex, pLeaf, pLeaf->m_uiCount - 1, 1);
+    --pLeaf->m_uiCount;
+    pNode = pLeaf;
+  }
+  else
+  {
+    ShiftEntries(pNode, uiIndex, uiIndex + 1, pNode->m_uiCount - uiIndex - 1);
+    --pNode->m_uiCount;
+  }
+
+  --m_uiCount;
+  Rebalance(pNode);
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+void ezBTreeMapBase<KeyType, ValueType, Comparer>::Rebalance(Node* pNode)
+{
+  while (true)
+  {
+    if (pNode == m_pRoot)
+    {
+      if (pNode->m_uiCount == 0)
+      {
+        // the tree shrinks by one level
+        if (pNode->m_bLeaf)
+        {
+          m_pRoot = nullptr;
+        }
+        else
+        {
+          m_pRoot = AsInner(pNode)->m_pChildren[0];
+          m_pRoot->m_pParent = nullptr;
+          m_pRoot->m_uiPosInParent = 0;
+        }
+
+        ReleaseNode(pNode);
+      }
+
+      return;
+    }
+
+    if (pNode->m_uiCount >= MinKeysPerNode)
+      return;
+
+    InnerNode* pParent = pNode->m_pParent;
+    const ezUInt32 uiPos = pNode->m_uiPosInParent;
+
+    Node* pLeft = uiPos > 0 ? pParent->m_pChildren[uiPos - 1] : nullptr;
+    Node* pRight = uiPos < pParent->m_uiCount ? pParent->m_pChildren[uiPos + 1] : nullptr;
+
+    if (pLeft != nullptr && pLeft->m_uiCount > MinKeysPerNode)
+    {
+      RotateRight(pParent, uiPos - 1);
+      return;
+    }
+
+    if (pRight != nullptr && pRight->m_uiCount > MinKeysPerNode)
+    {
+      RotateLeft(pParent, uiPos);
+      return;
+    }
+
+    // both neighbors are at the minimum, so the two nodes plus the separator fit into one
+    Merge(pParent, pLeft != nullptr ? uiPos - 1 : uiPos);
+    pNode = pParent;
+  }
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+void ezBTreeMapBase<KeyType, ValueType, Comparer>::RotateRight(InnerNode* pParent, ezUInt32 uiSeparator)
+{
+  // moves the separator down into the right node and the largest element of the left node up into the parent
+  Node* pLeft = pParent->m_pChildren[uiSeparator];
+  Node* pRight = pParent->m_pChildren[uiSeparator + 1];
+
+  ShiftEntries(pRight, 1, 0, pRight->m_uiCount);
+  MoveEntries(pRight, 0, pParent, uiSeparator, 1);
+  MoveEntries(pParent, uiSeparator, pLeft, pLeft->m_uiCount - 1, 1);
+
+  if (!pRight->m_bLeaf)
+  {
+    ShiftChildren(AsInner(pRight), 1, 0, pRight->m_uiCount + 1);
+    SetChild(AsInner(pRight), 0, AsInner(pLeft)->m_pChildren[pLeft->m_uiCount]);
+  }
+
+  --pLeft->m_uiCount;
+  ++pRight->m_uiCount;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+void ezBTreeMapBase<KeyType, ValueType, Comparer>::RotateLeft(InnerNode* pParent, ezUInt32 uiSeparator)
+{
+  // moves the separator down into the left node and the smallest element of the right node up into the parent
+  Node* pLeft = pParent->m_pChildren[uiSeparator];
+  Node* pRight = pParent->m_pChildren[uiSeparator + 1];
+
+  MoveEntries(pLeft, pLeft->m_uiCount, pParent, uiSeparator, 1);
+  MoveEntries(pParent, uiSeparator, pRight, 0, 1);
+  ShiftEntries(pRight, 0, 1, pRight->m_uiCount - 1);
+
+  if (!pRight->m_bLeaf)
+  {
+    SetChild(AsInner(pLeft), pLeft->m_uiCount + 1, AsInner(pRight)->m_pChildren[0]);
+    ShiftChildren(AsInner(pRight), 0, 1, pRight->m_uiCount);
+  }
+
+  ++pLeft->m_uiCount;
+  --pRight->m_uiCount;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+void ezBTreeMapBase<KeyType, ValueType, Comparer>::Merge(InnerNode* pParent, ezUInt32 uiSeparator)
+{
+  // appends the separator and all elements of the right node to the left node and removes the right node
+  Node* pLeft = pParent->m_pChildren[uiSeparator];
+  Node* pRight = pParent->m_pChildren[uiSeparator + 1];
+
+  const ezUInt32 uiLeftCount = pLeft->m_uiCount;
+
+  EZ_ASSERT_DEBUG(uiLeftCount + 1 + pRight->m_uiCount <= MaxKeysPerNode, "Implementation error.");
+
+  MoveEntries(pLeft, uiLeftCount, pParent, uiSeparator, 1);
+  MoveEntries(pLeft, uiLeftCount + 1, pRight, 0, pRight->m_uiCount);
+
+  if (!pLeft->m_bLeaf)
+  {
+    for (ezUInt32 i = 0; i <= pRight->m_uiCount; ++i)
+    {
+      SetChild(AsInner(pLeft), uiLeftCount + 1 + i, AsInner(pRight)->m_pChildren[i]);
+    }
+  }
+
+  pLeft->m_uiCount = static_cast<ezUInt16>(uiLeftCount + 1 + pRight->m_uiCount);
+
+  ShiftEntries(pParent, uiSeparator, uiSeparator + 1, pParent->m_uiCount - uiSeparator - 1);
+  ShiftChildren(pParent, uiSeparator + 1, uiSeparator + 2, pParent->m_uiCount - uiSeparator - 1);
+  --pParent->m_uiCount;
+
+  // all elements were moved out already
+  pRight->m_uiCount = 0;
+  ReleaseNode(pRight);
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+void ezBTreeMapBase<KeyType, ValueType, Comparer>::SplitNode(Node* pNode)
+{
+  EZ_ASSERT_DEBUG(pNode->m_uiCount == MaxKeysPerNode, "Only full nodes need to be split.");
+
+  if (pNode->m_pParent == nullptr)
+  {
+    InnerNode* pNewRoot = AcquireInnerNode();
+    SetChild(pNewRoot, 0, pNode);
+    m_pRoot = pNewRoot;
+  }
+  else if (pNode->m_pParent->m_uiCount == MaxKeysPerNode)
+  {
+    // makes room for the median, afterwards pNode may have a different parent
+    SplitNode(pNode->m_pParent);
+  }
+
+  constexpr ezUInt32 uiMedian = MaxKeysPerNode / 2;
+  constexpr ezUInt32 uiRightCount = MaxKeysPerNode - uiMedian - 1;
+
+  InnerNode* pParent = pNode->m_pParent;
+  const ezUInt32 uiPos = pNode->m_uiPosInParent;
+
+  Node* pRight = pNode->m_bLeaf ? AcquireLeaf() : AcquireInnerNode();
+  MoveEntries(pRight, 0, pNode, uiMedian + 1, uiRightCount);
+
+  if (!pNode->m_bLeaf)
+  {
+    for (ezUInt32 i = 0; i <= uiRightCount; ++i)
+    {
+      SetChild(AsInner(pRight), i, AsInner(pNode)->m_pChildren[uiMedian + 1 + i]);
+    }
+  }
+
+  pRight->m_uiCount = uiRightCount;
+
+  // the median moves up into the parent
+  ShiftEntries(pParent, uiPos + 1, uiPos, pParent->m_uiCount - uiPos);
+  ShiftChildren(pParent, uiPos + 2, uiPos + 1, pParent->m_uiCount - uiPos);
+  MoveEntries(pParent, uiPos, pNode, uiMedian, 1);
+  SetChild(pParent, uiPos + 1, pRight);
+  ++pParent->m_uiCount;
+
+  pNode->m_uiCount = uiMedian;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+void ezBTreeMapBase<KeyType, ValueType, Comparer>::BuildFromSorted(ezArrayPtr<const KeyType> keys, ezArrayPtr<const ValueType> values)
+{
+  EZ_ASSERT_DEV(keys.GetCount() == values.GetCount(), "Number of keys ({}) and values ({}) must be equal.", keys.GetCount(), values.GetCount());
+
+  BuildFromSortedInternal(keys, values.GetPtr());
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+void ezBTreeMapBase<KeyType, ValueType, Comparer>::BuildFromSortedInternal(ezArrayPtr<const KeyType> keys, const ValueType* pValues)
+{
+  Clear();
+
+  const ezUInt32 uiNumElements = keys.GetCount();
+  if (uiNumElements == 0)
+    return;
+
+#if EZ_ENABLED(EZ_COMPILE_FOR_DEBUG)
+  for (ezUInt32 i = 1; i < uiNumElements; ++i)
+  {
+    EZ_ASSERT_DEBUG(m_Comparer.Less(keys[i - 1], keys[i]), "The keys must be sorted and unique.");
+  }
+#endif
+
+  auto CopyElement = [&](Node* pNode, ezUInt32 uiIndex, ezUInt32 uiElement)
+  {
+    ezMemoryUtils::CopyConstruct<KeyType>(pNode->Keys() + uiIndex, keys[uiElement], 1);
+
+    if constexpr (!EmptyValues)
+    {
+      if (pValues != nullptr)
+        ezMemoryUtils::CopyConstruct<ValueType>(pNode->Values() + uiIndex, pValues[uiElement], 1);
+      else
+        ezMemoryUtils::Construct<ConstructAll>(pNode->Values() + uiIndex, 1);
+    }
+  };
+
+  // the nodes of the current level and the elements that separate them, which go into the next level
+  ezDynamicArray<Node*> nodes;
+  ezDynamicArray<ezUInt32> separators;
+  ezDynamicArray<Node*> parentNodes;
+  ezDynamicArray<ezUInt32> parentSeparators;
+
+  // fill the leaves as much as possible, every leaf except the last one is followed by a separator
+  {
+    const ezUInt32 uiNumLeaves = (uiNumElements + MaxKeysPerNode) / (MaxKeysPerNode + 1);
+    const ezUInt32 uiNumInLeaves = uiNumElements - (uiNumLeaves - 1);
+
+    nodes.Reserve(uiNumLeaves);
+    separators.Reserve(uiNumLeaves);
+
+    ezUInt32 uiElement = 0;
+    for (ezUInt32 leaf = 0; leaf < uiNumLeaves; ++leaf)
+    {
+      const ezUInt32 uiCount = uiNumInLeaves / uiNumLeaves + (leaf < uiNumInLeaves % uiNumLeaves ? 1 : 0);
+
+      Node* pLeaf = AcquireLeaf();
+      for (ezUInt32 i = 0; i < uiCount; ++i)
+      {
+        CopyElement(pLeaf, i, uiElement++);
+      }
+
+      pLeaf->m_uiCount = static_cast<ezUInt16>(uiCount);
+      nodes.PushBack(pLeaf);
+
+      if (leaf + 1 < uiNumLeaves)
+        separators.PushBack(uiElement++);
+    }
+  }
+
+  // group the nodes of each level under as few parents as possible, until only the root is left
+  while (nodes.GetCount() > 1)
+  {
+    const ezUInt32 uiNumChildren = nodes.GetCount();
+    const ezUInt32 uiNumParents = (uiNumChildren + MaxKeysPerNode) / (MaxKeysPerNode + 1);
+
+    parentNodes.Clear();
+    parentSeparators.Clear();
+
+    ezUInt32 uiChild = 0;
+    for (ezUInt32 parent = 0; parent < uiNumParents; ++parent)
+    {
+      const ezUInt32 uiCount = uiNumChildren / uiNumParents + (parent < uiNumChildren % uiNumParents ? 1 : 0);
+
+      InnerNode* pParent = AcquireInnerNode();
+      for (ezUInt32 i = 0; i < uiCount; ++i, ++uiChild)
+      {
+        SetChild(pParent, i, nodes[uiChild]);
+
+        if (i + 1 < uiCount)
+          CopyElement(pParent, i, separators[uiChild]);
+      }
+
+      pParent->m_uiCount = static_cast<ezUInt16>(uiCount - 1);
+      parentNodes.PushBack(pParent);
+
+      if (parent + 1 < uiNumParents)
+        parentSeparators.PushBack(separators[uiChild - 1]);
+    }
+
+    nodes.Swap(parentNodes);
+    separators.Swap(parentSeparators);
+  }
+
+  m_pRoot = nodes[0];
+  m_uiCount = uiNumElements;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+EZ_ALWAYS_INLINE void ezBTreeMapBase<KeyType, ValueType, Comparer>::SetChild(InnerNode* pParent, ezUInt32 uiPos, Node* pChild)
+{
+  pParent->m_pChildren[uiPos] = pChild;
+  pChild->m_pParent = pParent;
+  pChild->m_uiPosInParent = static_cast<ezUInt16>(uiPos);
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+void ezBTreeMapBase<KeyType, ValueType, Comparer>::MoveEntries(Node* pDst, ezUInt32 uiDstIndex, Node* pSrc, ezUInt32 uiSrcIndex, ezUInt32 uiCount)
+{
+  ezMemoryUtils::RelocateConstruct<KeyType>(pDst->Keys() + uiDstIndex, pSrc->Keys() + uiSrcIndex, uiCount);
+
+  if constexpr (!EmptyValues)
+  {
+    ezMemoryUtils::RelocateConstruct<ValueType>(pDst->Values() + uiDstIndex, pSrc->Values() + uiSrcIndex, uiCount);
+  }
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+void ezBTreeMapBase<KeyType, ValueType, Comparer>::ShiftEntries(Node* pNode, ezUInt32 uiDstIndex, ezUInt32 uiSrcIndex, ezUInt32 uiCount)
+{
+  if (uiCount == 0)
+    return;
+
+  RelocateWithinNode<KeyType>(pNode->Keys(), uiDstIndex, uiSrcIndex, uiCount);
+
+  if constexpr (!EmptyValues)
+  {
+    RelocateWithinNode<ValueType>(pNode->Values(), uiDstIndex, uiSrcIndex, uiCount);
+  }
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+template <typename T>
+void ezBTreeMapBase<KeyType, ValueType, Comparer>::RelocateWithinNode(T* pArray, ezUInt32 uiDstIndex, ezUInt32 uiSrcIndex, ezUInt32 uiCount)
+{
+  // in contrast to ezMemoryUtils::RelocateOverlapped the uncovered destination slots are uninitialized
+  if constexpr (ezGetTypeClass<T>::value != 0)
+  {
+    memmove(static_cast<void*>(pArray + uiDstIndex), pArray + uiSrcIndex, uiCount * sizeof(T));
+  }
+  else if (uiDstIndex < uiSrcIndex)
+  {
+    for (ezUInt32 i = 0; i < uiCount; ++i)
+    {
+      ezMemoryUtils::RelocateConstruct<T>(pArray + uiDstIndex + i, pArray + uiSrcIndex + i, 1);
+    }
+  }
+  else
+  {
+    for (ezUInt32 i = uiCount; i > 0; --i)
+    {
+      ezMemoryUtils::RelocateConstruct<T>(pArray + uiDstIndex + i - 1, pArray + uiSrcIndex + i - 1, 1);
+    }
+  }
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+void ezBTreeMapBase<KeyType, ValueType, Comparer>::ShiftChildren(InnerNode* pNode, ezUInt32 uiDstIndex, ezUInt32 uiSrcIndex, ezUInt32 uiCount)
+{
+  if (uiCount == 0)
+    return;
+
+  ezMemoryUtils::CopyOverlapped(pNode->m_pChildren + uiDstIndex, pNode->m_pChildren + uiSrcIndex, uiCount);
+
+  for (ezUInt32 i = uiDstIndex; i < uiDstIndex + uiCount; ++i)
+  {
+    pNode->m_pChildren[i]->m_uiPosInParent = static_cast<ezUInt16>(i);
+  }
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+typename ezBTreeMapBase<KeyType, ValueType, Comparer>::Node* ezBTreeMapBase<KeyType, ValueType, Comparer>::AcquireLeaf()
+{
+  ++m_uiNumLeafNodes;
+  return new (m_pAllocator->Allocate(sizeof(Node), alignof(Node))) Node;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+typename ezBTreeMapBase<KeyType, ValueType, Comparer>::InnerNode* ezBTreeMapBase<KeyType, ValueType, Comparer>::AcquireInnerNode()
+{
+  ++m_uiNumInnerNodes;
+  InnerNode* pNode = new (m_pAllocator->Allocate(sizeof(InnerNode), alignof(InnerNode))) InnerNode;
+  pNode->m_bLeaf = false;
+  return pNode;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+void ezBTreeMapBase<KeyType, ValueType, Comparer>::ReleaseNode(Node* pNode)
+{
+  // the node itself is trivially destructible, its elements have been destroyed or moved out already
+  if (pNode->m_bLeaf)
+    --m_uiNumLeafNodes;
+  else
+    --m_uiNumInnerNodes;
+
+  m_pAllocator->Deallocate(pNode);
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+void ezBTreeMapBase<KeyType, ValueType, Comparer>::DestroySubtree(Node* pNode)
+{
+  if (!pNode->m_bLeaf)
+  {
+    for (ezUInt32 i = 0; i <= pNode->m_uiCount; ++i)
+    {
+      DestroySubtree(AsInner(pNode)->m_pChildren[i]);
+    }
+  }
+
+  ezMemoryUtils::Destruct<KeyType>(pNode->Keys(), pNode->m_uiCount);
+
+  if constexpr (!EmptyValues)
+  {
+    ezMemoryUtils::Destruct<ValueType>(pNode->Values(), pNode->m_uiCount);
+  }
+
+  ReleaseNode(pNode);
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+typename ezBTreeMapBase<KeyType, ValueType, Comparer>::Node* ezBTreeMapBase<KeyType, ValueType, Comparer>::CloneSubtree(Node* pSource, InnerNode* pParent, ezUInt32 uiPosInParent)
+{
+  Node* pNode = pSource->m_bLeaf ? AcquireLeaf() : AcquireInnerNode();
+
+  ezMemoryUtils::CopyConstructArray<KeyType>(pNode->Keys(), pSource->Keys(), pSource->m_uiCount);
+
+  if constexpr (!EmptyValues)
+  {
+    ezMemoryUtils::CopyConstructArray<ValueType>(pNode->Values(), pSource->Values(), pSource->m_uiCount);
+  }
+
+  pNode->m_uiCount = pSource->m_uiCount;
+  pNode->m_pParent = pParent;
+  pNode->m_uiPosInParent = static_cast<ezUInt16>(uiPosInParent);
+
+  if (!pSource->m_bLeaf)
+  {
+    for (ezUInt32 i = 0; i <= pSource->m_uiCount; ++i)
+    {
+      AsInner(pNode)->m_pChildren[i] = CloneSubtree(AsInner(pSource)->m_pChildren[i], AsInner(pNode), i);
+    }
+  }
+
+  return pNode;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+bool ezBTreeMapBase<KeyType, ValueType, Comparer>::operator==(const ezBTreeMapBase<KeyType, ValueType, Comparer>& rhs) const
+{
+  if (GetCount() != rhs.GetCount())
+    return false;
+
+  auto itLhs = GetIterator();
+  auto itRhs = rhs.GetIterator();
+
+  while (itLhs.IsValid())
+  {
+    if (!m_Comparer.Equal(itLhs.Key(), itRhs.Key()))
+      return false;
+
+    if constexpr (!EmptyValues)
+    {
+      if (itLhs.Value() != itRhs.Value())
+        return false;
+    }
+
+    ++itLhs;
+    ++itRhs;
+  }
+
+  return true;
+}
+
+template <typename KeyType, typename ValueType, typename Comparer>
+void ezBTreeMapBase<KeyType, ValueType, Comparer>::Swap(ezBTreeMapBase<KeyType, ValueType, Comparer>& other)
+{
+  ezMath::Swap(m_pRoot, other.m_pRoot);
+  ezMath::Swap(m_uiCount, other.m_uiCount);
+  ezMath::Swap(m_uiNumLeafNodes, other.m_uiNumLeafNodes);
+  ezMath::Swap(m_uiNumInnerNodes, other.m_uiNumInnerNodes);
+  ezMath::Swap(m_pAllocator, other.m_pAllocator);
+  ezMath::Swap(m_Comparer, other.m_Comparer);
+}
+
+// ***** ezBTreeMap *****
+
+template <typename KeyType, typename ValueType, typename Comparer, typename AllocatorWrapper>
+ezBTreeMap<KeyType, ValueType, Comparer, AllocatorWrapper>::ezBTreeMap()
+  : ezBTreeMapBase<KeyType, ValueType, Comparer>(Comparer(), AllocatorWrapper::GetAllocator())
+{
+}
+
+template <typename KeyType, typename ValueType, typename Comparer, typename AllocatorWrapper>
+ezBTreeMap<KeyType, ValueType, Comparer, AllocatorWrapper>::ezBTreeMap(ezAllocator* pAllocator)
+  : ezBTreeMapBase<KeyType, ValueType, Comparer>(Comparer(), pAllocator)
+{
+}
+
+template <typename KeyType, typename ValueType, typename Comparer, typename AllocatorWrapper>
+ezBTreeMap<KeyType, ValueType, Comparer, AllocatorWrapper>::ezBTreeMap(const Comparer& comparer, ezAllocator* pAllocator)
+  : ezBTreeMapBase<KeyType, ValueType, Comparer>(comparer, pAllocator)
+{
+}
+
+template <typename KeyType, typename ValueType, typename Comparer, typename AllocatorWrapper>
+ezBTreeMap<KeyType, ValueType, Comparer, AllocatorWrapper>::ezBTreeMap(const ezBTreeMap<KeyType, ValueType, Comparer, AllocatorWrapper>& other)
+  : ezBTreeMapBase<KeyType, ValueType, Comparer>(other, AllocatorWrapper::GetAllocator())
+{
+}
+
+template <typename KeyType, typename ValueType, typename Comparer, typename AllocatorWrapper>
+ezBTreeMap<KeyType, ValueType, Comparer, AllocatorWrapper>::ezBTreeMap(const ezBTreeMapBase<KeyType, ValueType, Comparer>& other)
+  : ezBTreeMapBase<KeyType, ValueType, Comparer>(other, AllocatorWrapper::GetAllocator())
+{
+}
+
+template <typename KeyType, typename ValueType, typename Comparer, typename AllocatorWrapper>
+void ezBTreeMap<KeyType, ValueType, Comparer, AllocatorWrapper>::operator=(const ezBTreeMap<KeyType, ValueType, Comparer, AllocatorWrapper>& rhs)
+{
+  ezBTreeMapBase<KeyType, ValueType, Comparer>::operator=(rhs);
+}
+
+template <typename KeyType, typename ValueType, typename Comparer, typename AllocatorWrapper>
+void ezBTreeMap<KeyType, ValueType, Comparer, AllocatorWrapper>::operator=(const ezBTreeMapBase<KeyType, ValueType, Comparer>& rhs)
+{
+  ezBTreeMapBase<KeyType, ValueType, Comparer>::operator=(rhs);
+}
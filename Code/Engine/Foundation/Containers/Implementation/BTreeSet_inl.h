@@ -0,0 +1,173 @@
+#pragma once
+
+// ***** ezBTreeSetBase *****
+
+template <typename KeyType, typename Comparer>
+ezBTreeSetBase<KeyType, Comparer>::ezBTreeSetBase(const Comparer& comparer, ezAllocator* pAllocator)
+  : m_Elements(comparer, pAllocator)
+{
+}
+
+template <typename KeyType, typename Comparer>
+ezBTreeSetBase<KeyType, Comparer>::ezBTreeSetBase(const ezBTreeSetBase<KeyType, Comparer>& cc, ezAllocator* pAllocator)
+  : m_Elements(cc.m_Elements, pAllocator)
+{
+}
+
+template <typename KeyType, typename Comparer>
+void ezBTreeSetBase<KeyType, Comparer>::operator=(const ezBTreeSetBase<KeyType, Comparer>& rhs)
+{
+  m_Elements = rhs.m_Elements;
+}
+
+template <typename KeyType, typename Comparer>
+EZ_ALWAYS_INLINE typename ezBTreeSetBase<KeyType, Comparer>::Iterator ezBTreeSetBase<KeyType, Comparer>::GetIterator() const
+{
+  return Iterator(GetTree().GetIterator());
+}
+
+template <typename KeyType, typename Comparer>
+EZ_ALWAYS_INLINE typename ezBTreeSetBase<KeyType, Comparer>::ReverseIterator ezBTreeSetBase<KeyType, Comparer>::GetReverseIterator() const
+{
+  return ReverseIterator(GetTree().GetReverseIterator());
+}
+
+template <typename KeyType, typename Comparer>
+template <typename CompatibleKeyType>
+EZ_ALWAYS_INLINE typename ezBTreeSetBase<KeyType, Comparer>::Iterator ezBTreeSetBase<KeyType, Comparer>::Insert(CompatibleKeyType&& key)
+{
+  return Iterator(m_Elements.FindOrAdd(std::forward<CompatibleKeyType>(key)));
+}
+
+template <typename KeyType, typename Comparer>
+template <typename CompatibleKeyType>
+EZ_ALWAYS_INLINE bool ezBTreeSetBase<KeyType, Comparer>::Remove(const CompatibleKeyType& key)
+{
+  return m_Elements.Remove(key);
+}
+
+template <typename KeyType, typename Comparer>
+EZ_ALWAYS_INLINE typename ezBTreeSetBase<KeyType, Comparer>::Iterator ezBTreeSetBase<KeyType, Comparer>::Remove(const Iterator& pos)
+{
+  return Iterator(m_Elements.Remove(pos.m_It));
+}
+
+template <typename KeyType, typename Comparer>
+template <typename CompatibleKeyType>
+EZ_ALWAYS_INLINE typename ezBTreeSetBase<KeyType, Comparer>::Iterator ezBTreeSetBase<KeyType, Comparer>::Find(const CompatibleKeyType& key) const
+{
+  return Iterator(GetTree().Find(key));
+}
+
+template <typename KeyType, typename Comparer>
+template <typename CompatibleKeyType>
+EZ_ALWAYS_INLINE bool ezBTreeSetBase<KeyType, Comparer>::Contains(const CompatibleKeyType& key) const
+{
+  return m_Elements.Contains(key);
+}
+
+template <typename KeyType, typename Comparer>
+bool ezBTreeSetBase<KeyType, Comparer>::ContainsSet(const ezBTreeSetBase<KeyType, Comparer>& operand) const
+{
+  for (const KeyType& key : operand)
+  {
+    if (!Contains(key))
+      return false;
+  }
+
+  return true;
+}
+
+template <typename KeyType, typename Comparer>
+template <typename CompatibleKeyType>
+EZ_ALWAYS_INLINE typename ezBTreeSetBase<KeyType, Comparer>::Iterator ezBTreeSetBase<KeyType, Comparer>::LowerBound(const CompatibleKeyType& key) const
+{
+  return Iterator(GetTree().LowerBound(key));
+}
+
+template <typename KeyType, typename Comparer>
+template <typename CompatibleKeyType>
+EZ_ALWAYS_INLINE typename ezBTreeSetBase<KeyType, Comparer>::Iterator ezBTreeSetBase<KeyType, Comparer>::UpperBound(const CompatibleKeyType& key) const
+{
+  return Iterator(GetTree().UpperBound(key));
+}
+
+template <typename KeyType, typename Comparer>
+void ezBTreeSetBase<KeyType, Comparer>::Union(const ezBTreeSetBase<KeyType, Comparer>& operand)
+{
+  for (const auto& key : operand)
+  {
+    Insert(key);
+  }
+}
+
+template <typename KeyType, typename Comparer>
+void ezBTreeSetBase<KeyType, Comparer>::Difference(const ezBTreeSetBase<KeyType, Comparer>& operand)
+{
+  for (const auto& key : operand)
+  {
+    Remove(key);
+  }
+}
+
+template <typename KeyType, typename Comparer>
+void ezBTreeSetBase<KeyType, Comparer>::Intersection(const ezBTreeSetBase<KeyType, Comparer>& operand)
+{
+  for (auto it = GetIterator(); it.IsValid();)
+  {
+    if (!operand.Contains(it.Key()))
+      it = Remove(it);
+    else
+      ++it;
+  }
+}
+
+template <typename KeyType, typename Comparer>
+void ezBTreeSetBase<KeyType, Comparer>::BuildFromSorted(ezArrayPtr<const KeyType> keys)
+{
+  m_Elements.BuildFromSortedInternal(keys, nullptr);
+}
+
+// ***** ezBTreeSet *****
+
+template <typename KeyType, typename Comparer, typename AllocatorWrapper>
+ezBTreeSet<KeyType, Comparer, AllocatorWrapper>::ezBTreeSet()
+  : ezBTreeSetBase<KeyType, Comparer>(Comparer(), AllocatorWrapper::GetAllocator())
+{
+}
+
+template <typename KeyType, typename Comparer, typename AllocatorWrapper>
+ezBTreeSet<KeyType, Comparer, AllocatorWrapper>::ezBTreeSet(ezAllocator* pAllocator)
+  : ezBTreeSetBase<KeyType, Comparer>(Comparer(), pAllocator)
+{
+}
+
+template <typename KeyType, typename Comparer, typename AllocatorWrapper>
+ezBTreeSet<KeyType, Comparer, AllocatorWrapper>::ezBTreeSet(const Comparer& comparer, ezAllocator* pAllocator)
+  : ezBTreeSetBase<KeyType, Comparer>(comparer, pAllocator)
+{
+}
+
+template <typename KeyType, typename Comparer, typename AllocatorWrapper>
+ezBTreeSet<KeyType, Comparer, AllocatorWrapper>::ezBTreeSet(const ezBTreeSet<KeyType, Comparer, AllocatorWrapper>& other)
+  : ezBTreeSetBase<KeyType, Comparer>(other, AllocatorWrapper::GetAllocator())
+{
+}
+
+template <typename KeyType, typename Comparer, typename AllocatorWrapper>
+ezBTreeSet<KeyType, Comparer, AllocatorWrapper>::ezBTreeSet(const ezBTreeSetBase<KeyType, Comparer>& other)
+  : ezBTreeSetBase<KeyType, Comparer>(other, AllocatorWrapper::GetAllocator())
+{
+}
+
+template <typename KeyType, typename Comparer, typename AllocatorWrapper>
+void ezBTreeSet<KeyType, Comparer, AllocatorWrapper>::operator=(const ezBTreeSet<KeyType, Comparer, AllocatorWrapper>& rhs)
+{
+  ezBTreeSetBase<KeyType, Comparer>::operator=(rhs);
+}
+
+template <typename KeyType, typename Comparer, typename AllocatorWrapper>
+void ezBTreeSet<KeyType, Comparer, AllocatorWrapper>::operator=(const ezBTreeSetBase<KeyType, Comparer>& rhs)
+{
+  ezBTreeSetBase<KeyType, Comparer>::operator=(rhs);
+}
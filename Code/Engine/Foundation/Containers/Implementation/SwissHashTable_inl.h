@@ -0,0 +1,915 @@
+#pragma once
+
+/// \brief Value used by containers for indices to indicate an invalid index.
+#ifndef ezInvalidIndex
+#  define ezInvalidIndex 0xFFFFFFFF
+#endif
+
+namespace ezInternal
+{
+  /// \brief A bitmask with one entry per slot of a control byte group, as returned by the ezSwissHashTableGroup match functions.
+  ///
+  /// SSE2 and the scalar fallback produce one bit per slot. NEON has no movemask instruction, there every slot is represented by a nibble,
+  /// of which only the highest bit is kept.
+  struct ezSwissHashTableBitMask
+  {
+#if EZ_SIMD_IMPLEMENTATION == EZ_SIMD_IMPLEMENTATION_NEON
+    static constexpr ezUInt32 Shift = 2;
+#else
+    static constexpr ezUInt32 Shift = 0;
+#endif
+
+    EZ_ALWAYS_INLINE bool HasAny() const { return m_uiMask != 0; }
+    EZ_ALWAYS_INLINE ezUInt32 GetLowestSlot() const { return ezMath::CountTrailingZeros(m_uiMask) >> Shift; }
+    EZ_ALWAYS_INLINE void ClearLowestSlot() { m_uiMask &= m_uiMask - 1; }
+    EZ_ALWAYS_INLINE void ClearSlotsBelow(ezUInt32 uiSlot) { m_uiMask &= ~0ull << (uiSlot << Shift); }
+
+    ezUInt64 m_uiMask;
+  };
+
+  /// \brief Loads 16 control bytes and compares them all at once.
+  struct ezSwissHashTableGroup
+  {
+    static constexpr ezInt8 Empty = -128;
+
+    EZ_ALWAYS_INLINE explicit ezSwissHashTableGroup(const ezInt8* pControl)
+    {
+#if EZ_SIMD_IMPLEMENTATION == EZ_SIMD_IMPLEMENTATION_SSE
+      m_Control = _mm_load_si128(reinterpret_cast<const __m128i*>(pControl));
+#elif EZ_SIMD_IMPLEMENTATION == EZ_SIMD_IMPLEMENTATION_NEON
+      m_Control = vld1q_s8(pControl);
+#else
+      m_pControl = pControl;
+#endif
+    }
+
+    /// \brief Returns the slots whose control byte equals the given hash bits.
+    EZ_ALWAYS_INLINE ezSwissHashTableBitMask Match(ezInt8 iHash) const
+    {
+#if EZ_SIMD_IMPLEMENTATION == EZ_SIMD_IMPLEMENTATION_SSE
+      return {static_cast<ezUInt32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(iHash), m_Control)))};
+#elif EZ_SIMD_IMPLEMENTATION == EZ_SIMD_IMPLEMENTATION_NEON
+      return ToMask(vceqq_s8(vdupq_n_s8(iHash), m_Control));
+#else
+      ezUInt32 uiMask = 0;
+      for (ezUInt32 i = 0; i < 16; ++i)
+        uiMask |= static_cast<ezUInt32>(m_pControl[i] == iHash) << i;
+      return {uiMask};
+#endif
+    }
+
+    /// \brief Returns the slots that have never been used since the last rehash.
+    EZ_ALWAYS_INLINE ezSwissHashTableBitMask MatchEmpty() const { return Match(Empty); }
+
+    /// \brief Returns the slots that are empty or deleted, ie. all control bytes with the sign bit set.
+    EZ_ALWAYS_INLINE ezSwissHashTableBitMask MatchEmptyOrDeleted() const
+    {
+#if EZ_SIMD_IMPLEMENTATION == EZ_SIMD_IMPLEMENTATION_SSE
+      return {static_cast<ezUInt32>(_mm_movemask_epi8(m_Control))};
+#elif EZ_SIMD_IMPLEMENTATION == EZ_SIMD_IMPLEMENTATION_NEON
+      return ToMask(vcltzq_s8(m_Control));
+#else
+      ezUInt32 uiMask = 0;
+      for (ezUInt32 i = 0; i < 16; ++i)
+        uiMask |= static_cast<ezUInt32>(m_pControl[i] < 0) << i;
+      return {uiMask};
+#endif
+    }
+
+    /// \brief Returns the slots that contain an element.
+    EZ_ALWAYS_INLINE ezSwissHashTableBitMask MatchFull() const
+    {
+#if EZ_SIMD_IMPLEMENTATION == EZ_SIMD_IMPLEMENTATION_SSE
+      return {static_cast<ezUInt32>(_mm_movemask_epi8(m_Control)) ^ 0xFFFFu};
+#elif EZ_SIMD_IMPLEMENTATION == EZ_SIMD_IMPLEMENTATION_NEON
+      return ToMask(vcgezq_s8(m_Control));
+#else
+      ezUInt32 uiMask = 0;
+      for (ezUInt32 i = 0; i < 16; ++i)
+        uiMask |= static_cast<ezUInt32>(m_pControl[i] >= 0) << i;
+      return {uiMask};
+#endif
+    }
+
+  private:
+#if EZ_SIMD_IMPLEMENTATION == EZ_SIMD_IMPLEMENTATION_SSE
+    __m128i m_Control;
+#elif EZ_SIMD_IMPLEMENTATION == EZ_SIMD_IMPLEMENTATION_NEON
+    static EZ_ALWAYS_INLINE ezSwissHashTableBitMask ToMask(uint8x16_t cmp)
+    {
+      // narrowing shift packs every byte of the comparison result into a nibble
+      const uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(cmp), 4);
+      return {vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & 0x8888888888888888ull};
+    }
+
+    int8x16_t m_Control;
+#else
+    const ezInt8* m_pControl;
+#endif
+  };
+} // namespace ezInternal
+
+// ***** Const Iterator *****
+
+template <typename K, typename V, typename H>
+EZ_ALWAYS_INLINE ezSwissHashTableBaseConstIterator<K, V, H>::ezSwissHashTableBaseConstIterator(const ezSwissHashTableBase<K, V, H>& hashTable, ezUInt32 uiIndex)
+  : m_pHashTable(&hashTable)
+  , m_uiCurrentIndex(uiIndex)
+{
+}
+
+template <typename K, typename V, typename H>
+EZ_ALWAYS_INLINE bool ezSwissHashTableBaseConstIterator<K, V, H>::IsValid() const
+{
+  return m_pHashTable != nullptr && m_uiCurrentIndex < m_pHashTable->m_uiCapacity;
+}
+
+template <typename K, typename V, typename H>
+EZ_ALWAYS_INLINE bool ezSwissHashTableBaseConstIterator<K, V, H>::operator==(const ezSwissHashTableBaseConstIterator<K, V, H>& rhs) const
+{
+  return m_pHashTable == rhs.m_pHashTable && m_uiCurrentIndex == rhs.m_uiCurrentIndex;
+}
+
+template <typename K, typename V, typename H>
+EZ_ALWAYS_INLINE const K& ezSwissHashTableBaseConstIterator<K, V, H>::Key() const
+{
+  return m_pHashTable->m_pEntries[m_uiCurrentIndex].key;
+}
+
+template <typename K, typename V, typename H>
+EZ_ALWAYS_INLINE const V& ezSwissHashTableBaseConstIterator<K, V, H>::Value() const
+{
+  return m_pHashTable->m_pEntries[m_uiCurrentIndex].value;
+}
+
+template <typename K, typename V, typename H>
+EZ_ALWAYS_INLINE void ezSwissHashTableBaseConstIterator<K, V, H>::Next()
+{
+  if (m_uiCurrentIndex < m_pHashTable->m_uiCapacity)
+  {
+    m_uiCurrentIndex = m_pHashTable->FindNextValid(m_uiCurrentIndex + 1);
+  }
+}
+
+template <typename K, typename V, typename H>
+EZ_ALWAYS_INLINE void ezSwissHashTableBaseConstIterator<K, V, H>::operator++()
+{
+  Next();
+}
+
+#if EZ_ENABLED(EZ_USE_CPP20_OPERATORS)
+// These functions are used for structured bindings.
+// They describe how many elements can be accessed in the binding and which type they are.
+namespace std
+{
+  template <typename K, typename V, typename H>
+  struct tuple_size<ezSwissHashTableBaseConstIterator<K, V, H>> : integral_constant<size_t, 2>
+  {
+  };
+
+  template <typename K, typename V, typename H>
+  struct tuple_element<0, ezSwissHashTableBaseConstIterator<K, V, H>>
+  {
+    using type = const K&;
+  };
+
+  template <typename K, typename V, typename H>
+  struct tuple_element<1, ezSwissHashTableBaseConstIterator<K, V, H>>
+  {
+    using type = const V&;
+  };
+} // namespace std
+#endif
+
+// ***** Iterator *****
+
+template <typename K, typename V, typename H>
+EZ_ALWAYS_INLINE ezSwissHashTableBaseIterator<K, V, H>::ezSwissHashTableBaseIterator(const ezSwissHashTableBase<K, V, H>& hashTable, ezUInt32 uiIndex)
+  : ezSwissHashTableBaseConstIterator<K, V, H>(hashTable, uiIndex)
+{
+}
+
+template <typename K, typename V, typename H>
+EZ_FORCE_INLINE V& ezSwissHashTableBaseIterator<K, V, H>::Value()
+{
+  return this->m_pHashTable->m_pEntries[this->m_uiCurrentIndex].value;
+}
+
+template <typename K, typename V, typename H>
+EZ_FORCE_INLINE V& ezSwissHashTableBaseIterator<K, V, H>::Value() const
+{
+  return this->m_pHashTable->m_pEntries[this->m_uiCurrentIndex].value;
+}
+
+#if EZ_ENABLED(EZ_USE_CPP20_OPERATORS)
+// These functions are used for structured bindings.
+// They describe how many elements can be accessed in the binding and which type they are.
+namespace std
+{
+  template <typename K, typename V, typename H>
+  struct tuple_size<ezSwissHashTableBaseIterator<K, V, H>> : integral_constant<size_t, 2>
+  {
+  };
+
+  template <typename K, typename V, typename H>
+  struct tuple_element<0, ezSwissHashTableBaseIterator<K, V, H>>
+  {
+    using type = const K&;
+  };
+
+  template <typename K, typename V, typename H>
+  struct tuple_element<1, ezSwissHashTableBaseIterator<K, V, H>>
+  {
+    using type = V&;
+  };
+} // namespace std
+#endif
+
+// ***** ezSwissHashTableBase *****
+
+template <typename K, typename V, typename H>
+ezSwissHashTableBase<K, V, H>::ezSwissHashTableBase(ezAllocator* pAllocator)
+  : m_pAllocator(pAllocator)
+{
+}
+
+template <typename K, typename V, typename H>
+ezSwissHashTableBase<K, V, H>::ezSwissHashTableBase(const ezSwissHashTableBase<K, V, H>& other, ezAllocator* pAllocator)
+  : m_pAllocator(pAllocator)
+{
+  *this = other;
+}
+
+template <typename K, typename V, typename H>
+ezSwissHashTableBase<K, V, H>::ezSwissHashTableBase(ezSwissHashTableBase<K, V, H>&& other, ezAllocator* pAllocator)
+  : m_pAllocator(pAllocator)
+{
+  *this = std::move(other);
+}
+
+template <typename K, typename V, typename H>
+ezSwissHashTableBase<K, V, H>::~ezSwissHashTableBase()
+{
+  Clear();
+  FreeBuffer();
+}
+
+template <typename K, typename V, typename H>
+void ezSwissHashTableBase<K, V, H>::operator=(const ezSwissHashTableBase<K, V, H>& rhs)
+{
+  if (this == &rhs)
+    return;
+
+  Clear();
+
+  if (rhs.IsEmpty())
+    return;
+
+  if (m_uiCapacity != rhs.m_uiCapacity)
+  {
+    FreeBuffer();
+    AllocateBuffer(rhs.m_uiCapacity);
+  }
+
+  // same capacity, so every element can be copied into the same slot, no rehashing necessary
+  ezMemoryUtils::Copy(m_pControl, rhs.m_pControl, m_uiCapacity);
+
+  for (ezUInt32 i = rhs.FindNextValid(0); i < m_uiCapacity; i = rhs.FindNextValid(i + 1))
+  {
+    ezMemoryUtils::CopyConstruct(&m_pEntries[i].key, rhs.m_pEntries[i].key, 1);
+    ezMemoryUtils::CopyConstruct(&m_pEntries[i].value, rhs.m_pEntries[i].value, 1);
+  }
+
+  m_uiCount = rhs.m_uiCount;
+  m_uiGrowthLeft = rhs.m_uiGrowthLeft;
+}
+
+template <typename K, typename V, typename H>
+void ezSwissHashTableBase<K, V, H>::operator=(ezSwissHashTableBase<K, V, H>&& rhs)
+{
+  if (this == &rhs)
+    return;
+
+  // Clear any existing data (calls destructors if necessary)
+  Clear();
+
+  if (m_pAllocator != rhs.m_pAllocator)
+  {
+    Reserve(rhs.m_uiCount);
+
+    for (ezUInt32 i = rhs.FindNextValid(0); i < rhs.m_uiCapacity; i = rhs.FindNextValid(i + 1))
+    {
+      Insert(std::move(rhs.m_pEntries[i].key), std::move(rhs.m_pEntries[i].value));
+    }
+
+    rhs.Clear();
+  }
+  else
+  {
+    FreeBuffer();
+
+    // Move all data over.
+    m_pControl = rhs.m_pControl;
+    m_pEntries = rhs.m_pEntries;
+    m_uiCount = rhs.m_uiCount;
+    m_uiCapacity = rhs.m_uiCapacity;
+    m_uiGrowthLeft = rhs.m_uiGrowthLeft;
+
+    // Temp copy forgets all its state.
+    rhs.m_pControl = nullptr;
+    rhs.m_pEntries = nullptr;
+    rhs.m_uiCount = 0;
+    rhs.m_uiCapacity = 0;
+    rhs.m_uiGrowthLeft = 0;
+  }
+}
+
+template <typename K, typename V, typename H>
+bool ezSwissHashTableBase<K, V, H>::operator==(const ezSwissHashTableBase<K, V, H>& rhs) const
+{
+  if (m_uiCount != rhs.m_uiCount)
+    return false;
+
+  for (ezUInt32 i = FindNextValid(0); i < m_uiCapacity; i = FindNextValid(i + 1))
+  {
+    const V* pRhsValue = nullptr;
+    if (!rhs.TryGetValue(m_pEntries[i].key, pRhsValue))
+      return false;
+
+    if (m_pEntries[i].value != *pRhsValue)
+      return false;
+  }
+
+  return true;
+}
+
+template <typename K, typename V, typename H>
+void ezSwissHashTableBase<K, V, H>::Reserve(ezUInt32 uiCapacity)
+{
+  if (uiCapacity <= m_uiCount + m_uiGrowthLeft)
+    return;
+
+  // if the table is already large enough, but too many slots are taken by deleted entries, this rehashes without growing
+  SetCapacity(ezMath::Max(GetCapacityForCount(uiCapacity), m_uiCapacity));
+}
+
+template <typename K, typename V, typename H>
+void ezSwissHashTableBase<K, V, H>::Compact()
+{
+  if (IsEmpty())
+  {
+    // completely deallocate all data, if the table is empty.
+    FreeBuffer();
+    return;
+  }
+
+  const ezUInt32 uiNewCapacity = GetCapacityForCount(m_uiCount);
+
+  // also rehash when the capacity stays the same, but there are deleted entries
+  if (m_uiCapacity != uiNewCapacity || m_uiCount + m_uiGrowthLeft != GetMaxLoad(m_uiCapacity))
+  {
+    SetCapacity(uiNewCapacity);
+  }
+}
+
+template <typename K, typename V, typename H>
+EZ_ALWAYS_INLINE ezUInt32 ezSwissHashTableBase<K, V, H>::GetCount() const
+{
+  return m_uiCount;
+}
+
+template <typename K, typename V, typename H>
+EZ_ALWAYS_INLINE bool ezSwissHashTableBase<K, V, H>::IsEmpty() const
+{
+  return m_uiCount == 0;
+}
+
+template <typename K, typename V, typename H>
+void ezSwissHashTableBase<K, V, H>::Clear()
+{
+  if (m_uiCapacity == 0)
+    return;
+
+  if constexpr (!std::is_trivially_destructible<Entry>::value)
+  {
+    for (ezUInt32 i = FindNextValid(0); i < m_uiCapacity; i = FindNextValid(i + 1))
+    {
+      ezMemoryUtils::Destruct(&m_pEntries[i].key, 1);
+      ezMemoryUtils::Destruct(&m_pEntries[i].value, 1);
+    }
+  }
+
+  ezMemoryUtils::PatternFill(m_pControl, static_cast<ezUInt8>(CONTROL_EMPTY), m_uiCapacity);
+  m_uiCount = 0;
+  m_uiGrowthLeft = GetMaxLoad(m_uiCapacity);
+}
+
+template <typename K, typename V, typename H>
+template <typename CompatibleKeyType, typename CompatibleValueType>
+bool ezSwissHashTableBase<K, V, H>::Insert(CompatibleKeyType&& key, CompatibleValueType&& value, V* out_pOldValue /*= nullptr*/)
+{
+  const ezUInt32 uiHash = H::Hash(key);
+  ezUInt32 uiIndex = FindEntry(uiHash, key);
+
+  if (uiIndex != ezInvalidIndex)
+  {
+    if (out_pOldValue != nullptr)
+      *out_pOldValue = std::move(m_pEntries[uiIndex].value);
+
+    m_pEntries[uiIndex].value = std::forward<CompatibleValueType>(value); // Either move or copy assignment.
+    return true;
+  }
+
+  uiIndex = PrepareInsert(uiHash);
+
+  // Both constructions might either be a move or a copy.
+  ezMemoryUtils::CopyOrMoveConstruct(&m_pEntries[uiIndex].key, std::forward<CompatibleKeyType>(key));
+  ezMemoryUtils::CopyOrMoveConstruct(&m_pEntries[uiIndex].value, std::forward<CompatibleValueType>(value));
+
+  return false;
+}
+
+template <typename K, typename V, typename H>
+template <typename CompatibleKeyType>
+bool ezSwissHashTableBase<K, V, H>::Remove(const CompatibleKeyType& key, V* out_pOldValue /*= nullptr*/)
+{
+  const ezUInt32 uiIndex = FindEntry(key);
+  if (uiIndex != ezInvalidIndex)
+  {
+    if (out_pOldValue != nullptr)
+      *out_pOldValue = std::move(m_pEntries[uiIndex].value);
+
+    RemoveInternal(uiIndex);
+    return true;
+  }
+
+  return false;
+}
+
+template <typename K, typename V, typename H>
+typename ezSwissHashTableBase<K, V, H>::Iterator ezSwissHashTableBase<K, V, H>::Remove(const typename ezSwissHashTableBase<K, V, H>::Iterator& pos)
+{
+  EZ_ASSERT_DEBUG(pos.m_pHashTable == this, "Iterator from wrong hashtable");
+  EZ_ASSERT_DEBUG(pos.IsValid(), "Invalid iterator");
+
+  const ezUInt32 uiIndex = pos.m_uiCurrentIndex;
+  RemoveInternal(uiIndex);
+
+  // no element is moved by the removal, so the next element can be searched after the removed one
+  return Iterator(*this, FindNextValid(uiIndex + 1));
+}
+
+template <typename K, typename V, typename H>
+template <typename CompatibleKeyType>
+inline bool ezSwissHashTableBase<K, V, H>::TryGetValue(const CompatibleKeyType& key, V& out_value) const
+{
+  const ezUInt32 uiIndex = FindEntry(key);
+  if (uiIndex != ezInvalidIndex)
+  {
+    EZ_ASSERT_DEBUG(m_pEntries != nullptr, "No entries present"); // To fix static analysis
+    out_value = m_pEntries[uiIndex].value;
+    return true;
+  }
+
+  return false;
+}
+
+template <typename K, typename V, typename H>
+template <typename CompatibleKeyType>
+inline bool ezSwissHashTableBase<K, V, H>::TryGetValue(const CompatibleKeyType& key, const V*& out_pValue) const
+{
+  const ezUInt32 uiIndex = FindEntry(key);
+  if (uiIndex != ezInvalidIndex)
+  {
+    out_pValue = &m_pEntries[uiIndex].value;
+    EZ_ANALYSIS_ASSUME(out_pValue != nullptr);
+    return true;
+  }
+
+  return false;
+}
+
+template <typename K, typename V, typename H>
+template <typename CompatibleKeyType>
+inline bool ezSwissHashTableBase<K, V, H>::TryGetValue(const CompatibleKeyType& key, V*& out_pValue) const
+{
+  const ezUInt32 uiIndex = FindEntry(key);
+  if (uiIndex != ezInvalidIndex)
+  {
+    out_pValue = &m_pEntries[uiIndex].value;
+    EZ_ANALYSIS_ASSUME(out_pValue != nullptr);
+    return true;
+  }
+
+  return false;
+}
+
+template <typename K, typename V, typename H>
+template <typename CompatibleKeyType>
+inline typename ezSwissHashTableBase<K, V, H>::ConstIterator ezSwissHashTableBase<K, V, H>::Find(const CompatibleKeyType& key) const
+{
+  const ezUInt32 uiIndex = FindEntry(key);
+  return ConstIterator(*this, uiIndex != ezInvalidIndex ? uiIndex : m_uiCapacity);
+}
+
+template <typename K, typename V, typename H>
+template <typename CompatibleKeyType>
+inline typename ezSwissHashTableBase<K, V, H>::Iterator ezSwissHashTableBase<K, V, H>::Find(const CompatibleKeyType& key)
+{
+  const ezUInt32 uiIndex = FindEntry(key);
+  return Iterator(*this, uiIndex != ezInvalidIndex ? uiIndex : m_uiCapacity);
+}
+
+template <typename K, typename V, typename H>
+template <typename CompatibleKeyType>
+inline const V* ezSwissHashTableBase<K, V, H>::GetValue(const CompatibleKeyType& key) const
+{
+  const ezUInt32 uiIndex = FindEntry(key);
+  return (uiIndex != ezInvalidIndex) ? &m_pEntries[uiIndex].value : nullptr;
+}
+
+template <typename K, typename V, typename H>
+template <typename CompatibleKeyType>
+inline V* ezSwissHashTableBase<K, V, H>::GetValue(const CompatibleKeyType& key)
+{
+  const ezUInt32 uiIndex = FindEntry(key);
+  return (uiIndex != ezInvalidIndex) ? &m_pEntries[uiIndex].value : nullptr;
+}
+
+template <typename K, typename V, typename H>
+inline V& ezSwissHashTableBase<K, V, H>::operator[](const K& key)
+{
+  return FindOrAdd(key, nullptr);
+}
+
+template <typename K, typename V, typename H>
+V& ezSwissHashTableBase<K, V, H>::FindOrAdd(const K& key, bool* out_pExisted)
+{
+  const ezUInt32 uiHash = H::Hash(key);
+  ezUInt32 uiIndex = FindEntry(uiHash, key);
+
+  if (out_pExisted)
+  {
+    *out_pExisted = uiIndex != ezInvalidIndex;
+  }
+
+  if (uiIndex == ezInvalidIndex)
+  {
+    uiIndex = PrepareInsert(uiHash);
+
+    // new entry
+    ezMemoryUtils::CopyConstruct(&m_pEntries[uiIndex].key, key, 1);
+    ezMemoryUtils::Construct<ConstructAll>(&m_pEntries[uiIndex].value, 1);
+  }
+
+  EZ_ASSERT_DEBUG(m_pEntries != nullptr, "Entries should be present");
+  return m_pEntries[uiIndex].value;
+}
+
+template <typename K, typename V, typename H>
+template <typename CompatibleKeyType>
+EZ_FORCE_INLINE bool ezSwissHashTableBase<K, V, H>::Contains(const CompatibleKeyType& key) const
+{
+  return FindEntry(key) != ezInvalidIndex;
+}
+
+template <typename K, typename V, typename H>
+EZ_ALWAYS_INLINE typename ezSwissHashTableBase<K, V, H>::Iterator ezSwissHashTableBase<K, V, H>::GetIterator()
+{
+  return Iterator(*this, FindNextValid(0));
+}
+
+template <typename K, typename V, typename H>
+EZ_ALWAYS_INLINE typename ezSwissHashTableBase<K, V, H>::Iterator ezSwissHashTableBase<K, V, H>::GetEndIterator()
+{
+  return Iterator(*this, m_uiCapacity);
+}
+
+template <typename K, typename V, typename H>
+EZ_ALWAYS_INLINE typename ezSwissHashTableBase<K, V, H>::ConstIterator ezSwissHashTableBase<K, V, H>::GetIterator() const
+{
+  return ConstIterator(*this, FindNextValid(0));
+}
+
+template <typename K, typename V, typename H>
+EZ_ALWAYS_INLINE typename ezSwissHashTableBase<K, V, H>::ConstIterator ezSwissHashTableBase<K, V, H>::GetEndIterator() const
+{
+  return ConstIterator(*this, m_uiCapacity);
+}
+
+template <typename K, typename V, typename H>
+EZ_ALWAYS_INLINE ezAllocator* ezSwissHashTableBase<K, V, H>::GetAllocator() const
+{
+  return m_pAllocator;
+}
+
+template <typename K, typename V, typename H>
+ezUInt64 ezSwissHashTableBase<K, V, H>::GetHeapMemoryUsage() const
+{
+  return m_uiCapacity > 0 ? GetEntriesOffset(m_uiCapacity) + (ezUInt64)m_uiCapacity * sizeof(Entry) : 0;
+}
+
+template <typename K, typename V, typename H>
+void ezSwissHashTableBase<K, V, H>::Swap(ezSwissHashTableBase<K, V, H>& other)
+{
+  ezMath::Swap(this->m_pControl, other.m_pControl);
+  ezMath::Swap(this->m_pEntries, other.m_pEntries);
+  ezMath::Swap(this->m_uiCount, other.m_uiCount);
+  ezMath::Swap(this->m_uiCapacity, other.m_uiCapacity);
+  ezMath::Swap(this->m_uiGrowthLeft, other.m_uiGrowthLeft);
+  ezMath::Swap(this->m_pAllocator, other.m_pAllocator);
+}
+
+// private methods
+
+template <typename K, typename V, typename H>
+ezUInt32 ezSwissHashTableBase<K, V, H>::GetCapacityForCount(ezUInt32 uiCount)
+{
+  const ezUInt64 uiCount64 = static_cast<ezUInt64>(uiCount);
+  ezUInt64 uiCapacity64 = uiCount64 + (uiCount64 / 7) + 1; // ensure a maximum load of 87.5%
+
+  uiCapacity64 = ezMath::Min<ezUInt64>(uiCapacity64, 0x80000000llu); // the largest power-of-two in 32 bit
+
+  const ezUInt32 uiCapacity = ezMath::Max<ezUInt32>(ezMath::PowerOfTwo_Ceil(static_cast<ezUInt32>(uiCapacity64)), GROUP_SIZE);
+  EZ_ASSERT_DEBUG(uiCount <= GetMaxLoad(uiCapacity), "ezSwissHashTable does not support more than 1.8 billion entries.");
+
+  return uiCapacity;
+}
+
+template <typename K, typename V, typename H>
+EZ_ALWAYS_INLINE ezUInt32 ezSwissHashTableBase<K, V, H>::GetEntriesOffset(ezUInt32 uiCapacity)
+{
+  // the capacity is a multiple of 16, thus the entries following the control bytes are 16 byte aligned
+  return ezMemoryUtils::AlignSize<ezUInt32>(uiCapacity, alignof(Entry));
+}
+
+template <typename K, typename V, typename H>
+void ezSwissHashTableBase<K, V, H>::AllocateBuffer(ezUInt32 uiCapacity)
+{
+  EZ_ASSERT_DEBUG(ezMath::IsPowerOf2(uiCapacity) && uiCapacity >= GROUP_SIZE, "uiCapacity must be a power of two and at least one group.");
+
+  const size_t uiSize = GetEntriesOffset(uiCapacity) + static_cast<size_t>(uiCapacity) * sizeof(Entry);
+  const size_t uiAlign = ezMath::Max<size_t>(GROUP_SIZE, alignof(Entry));
+
+  ezUInt8* pBuffer = static_cast<ezUInt8*>(m_pAllocator->Allocate(uiSize, uiAlign));
+  m_pControl = reinterpret_cast<ezInt8*>(pBuffer);
+  m_pEntries = reinterpret_cast<Entry*>(pBuffer + GetEntriesOffset(uiCapacity));
+  m_uiCapacity = uiCapacity;
+  m_uiGrowthLeft = GetMaxLoad(uiCapacity);
+
+  ezMemoryUtils::PatternFill(m_pControl, static_cast<ezUInt8>(CONTROL_EMPTY), uiCapacity);
+}
+
+template <typename K, typename V, typename H>
+void ezSwissHashTableBase<K, V, H>::FreeBuffer()
+{
+  EZ_ASSERT_DEBUG(m_uiCount == 0, "Elements must be destructed before the buffer is freed.");
+
+  if (m_pControl != nullptr)
+  {
+    m_pAllocator->Deallocate(m_pControl);
+  }
+
+  m_pControl = nullptr;
+  m_pEntries = nullptr;
+  m_uiCapacity = 0;
+  m_uiGrowthLeft = 0;
+}
+
+template <typename K, typename V, typename H>
+void ezSwissHashTableBase<K, V, H>::SetCapacity(ezUInt32 uiCapacity)
+{
+  EZ_ASSERT_DEBUG(GetMaxLoad(uiCapacity) >= m_uiCount, "The new capacity is too small.");
+
+  ezInt8* pOldControl = m_pControl;
+  Entry* pOldEntries = m_pEntries;
+  const ezUInt32 uiOldCapacity = m_uiCapacity;
+
+  AllocateBuffer(uiCapacity);
+
+  for (ezUInt32 i = 0; i < uiOldCapacity; ++i)
+  {
+    if (pOldControl[i] >= 0)
+    {
+      const ezUInt32 uiHash = H::Hash(pOldEntries[i].key);
+      const ezUInt32 uiIndex = FindInsertSlot(uiHash);
+      SetControl(uiIndex, GetControlHash(uiHash));
+
+      ezMemoryUtils::RelocateConstruct(&m_pEntries[uiIndex].key, &pOldEntries[i].key, 1);
+      ezMemoryUtils::RelocateConstruct(&m_pEntries[uiIndex].value, &pOldEntries[i].value, 1);
+    }
+  }
+
+  m_uiGrowthLeft -= m_uiCount;
+
+  if (pOldControl != nullptr)
+  {
+    m_pAllocator->Deallocate(pOldControl);
+  }
+}
+
+template <typename K, typename V, typename H>
+void ezSwissHashTableBase<K, V, H>::RemoveInternal(ezUInt32 uiIndex)
+{
+  ezMemoryUtils::Destruct(&m_pEntries[uiIndex].key, 1);
+  ezMemoryUtils::Destruct(&m_pEntries[uiIndex].value, 1);
+
+  // A lookup only continues past a group if that group has no empty slot. Once a group is completely filled it never gets an empty slot
+  // again (until the next rehash), so if there is an empty slot in the group now, no lookup can depend on passing this slot.
+  const ezUInt32 uiGroupStart = uiIndex & ~(GROUP_SIZE - 1);
+  if (ezInternal::ezSwissHashTableGroup(m_pControl + uiGroupStart).MatchEmpty().HasAny())
+  {
+    SetControl(uiIndex, CONTROL_EMPTY);
+    ++m_uiGrowthLeft;
+  }
+  else
+  {
+    SetControl(uiIndex, CONTROL_DELETED);
+  }
+
+  --m_uiCount;
+}
+
+template <typename K, typename V, typename H>
+template <typename CompatibleKeyType>
+EZ_ALWAYS_INLINE ezUInt32 ezSwissHashTableBase<K, V, H>::FindEntry(const CompatibleKeyType& key) const
+{
+  return FindEntry(H::Hash(key), key);
+}
+
+template <typename K, typename V, typename H>
+template <typename CompatibleKeyType>
+inline ezUInt32 ezSwissHashTableBase<K, V, H>::FindEntry(ezUInt32 uiHash, const CompatibleKeyType& key) const
+{
+  if (m_uiCapacity == 0)
+    return ezInvalidIndex;
+
+  const ezInt8 iControlHash = GetControlHash(uiHash);
+  const ezUInt32 uiGroupMask = (m_uiCapacity / GROUP_SIZE) - 1;
+  ezUInt32 uiGroup = uiHash & uiGroupMask;
+
+  // triangular probing visits every group exactly once, since the number of groups is a power of two
+  for (ezUInt32 uiProbe = 1; uiProbe <= uiGroupMask + 1; ++uiProbe)
+  {
+    const ezUInt32 uiGroupStart = uiGroup * GROUP_SIZE;
+    const ezInternal::ezSwissHashTableGroup group(m_pControl + uiGroupStart);
+
+    for (auto match = group.Match(iControlHash); match.HasAny(); match.ClearLowestSlot())
+    {
+      const ezUInt32 uiIndex = uiGroupStart + match.GetLowestSlot();
+      if (H::Equal(m_pEntries[uiIndex].key, key))
+        return uiIndex;
+    }
+
+    // an empty slot would have been used by an insertion, so the key cannot be in any later group
+    if (group.MatchEmpty().HasAny())
+      break;
+
+    uiGroup = (uiGroup + uiProbe) & uiGroupMask;
+  }
+
+  // not found
+  return ezInvalidIndex;
+}
+
+template <typename K, typename V, typename H>
+ezUInt32 ezSwissHashTableBase<K, V, H>::FindInsertSlot(ezUInt32 uiHash) const
+{
+  const ezUInt32 uiGroupMask = (m_uiCapacity / GROUP_SIZE) - 1;
+  ezUInt32 uiGroup = uiHash & uiGroupMask;
+
+  for (ezUInt32 uiProbe = 1;; ++uiProbe)
+  {
+    const ezUInt32 uiGroupStart = uiGroup * GROUP_SIZE;
+    const auto free = ezInternal::ezSwissHashTableGroup(m_pControl + uiGroupStart).MatchEmptyOrDeleted();
+
+    if (free.HasAny())
+      return uiGroupStart + free.GetLowestSlot();
+
+    // the maximum load guarantees that there is always a free slot somewhere
+    EZ_ASSERT_DEBUG(uiProbe <= uiGroupMask, "Implementation error");
+    uiGroup = (uiGroup + uiProbe) & uiGroupMask;
+  }
+}
+
+template <typename K, typename V, typename H>
+ezUInt32 ezSwissHashTableBase<K, V, H>::PrepareInsert(ezUInt32 uiHash)
+{
+  ezUInt32 uiIndex = ezInvalidIndex;
+
+  if (m_uiCapacity > 0)
+  {
+    uiIndex = FindInsertSlot(uiHash);
+  }
+
+  // re-using a deleted slot does not reduce the number of empty slots, so this is always possible
+  if (uiIndex == ezInvalidIndex || (m_uiGrowthLeft == 0 && m_pControl[uiIndex] == CONTROL_EMPTY))
+  {
+    if (m_uiCapacity == 0)
+    {
+      AllocateBuffer(GROUP_SIZE);
+    }
+    else if (m_uiCount * 2 < GetMaxLoad(m_uiCapacity))
+    {
+      // mostly filled with deleted entries, rehashing in place gets rid of them
+      SetCapacity(m_uiCapacity);
+    }
+    else
+    {
+      SetCapacity(m_uiCapacity * 2);
+    }
+
+    uiIndex = FindInsertSlot(uiHash);
+  }
+
+  if (m_pControl[uiIndex] == CONTROL_EMPTY)
+  {
+    --m_uiGrowthLeft;
+  }
+
+  SetControl(uiIndex, GetControlHash(uiHash));
+  ++m_uiCount;
+
+  return uiIndex;
+}
+
+template <typename K, typename V, typename H>
+ezUInt32 ezSwissHashTableBase<K, V, H>::FindNextValid(ezUInt32 uiIndex) const
+{
+  while (uiIndex < m_uiCapacity)
+  {
+    const ezUInt32 uiGroupStart = uiIndex & ~(GROUP_SIZE - 1);
+
+    auto full = ezInternal::ezSwissHashTableGroup(m_pControl + uiGroupStart).MatchFull();
+    full.ClearSlotsBelow(uiIndex - uiGroupStart);
+
+    if (full.HasAny())
+      return uiGroupStart + full.GetLowestSlot();
+
+    uiIndex = uiGroupStart + GROUP_SIZE;
+  }
+
+  return m_uiCapacity;
+}
+
+// ***** ezSwissHashTable *****
+
+template <typename K, typename V, typename H, typename A>
+ezSwissHashTable<K, V, H, A>::ezSwissHashTable()
+  : ezSwissHashTableBase<K, V, H>(A::GetAllocator())
+{
+}
+
+template <typename K, typename V, typename H, typename A>
+ezSwissHashTable<K, V, H, A>::ezSwissHashTable(ezAllocator* pAllocator)
+  : ezSwissHashTableBase<K, V, H>(pAllocator)
+{
+}
+
+template <typename K, typename V, typename H, typename A>
+ezSwissHashTable<K, V, H, A>::ezSwissHashTable(const ezSwissHashTable<K, V, H, A>& other)
+  : ezSwissHashTableBase<K, V, H>(other, A::GetAllocator())
+{
+}
+
+template <typename K, typename V, typename H, typename A>
+ezSwissHashTable<K, V, H, A>::ezSwissHashTable(const ezSwissHashTableBase<K, V, H>& other)
+  : ezSwissHashTableBase<K, V, H>(other, A::GetAllocator())
+{
+}
+
+template <typename K, typename V, typename H, typename A>
+ezSwissHashTable<K, V, H, A>::ezSwissHashTable(ezSwissHashTable<K, V, H, A>&& other)
+  : ezSwissHashTableBase<K, V, H>(std::move(other), other.GetAllocator())
+{
+}
+
+template <typename K, typename V, typename H, typename A>
+ezSwissHashTable<K, V, H, A>::ezSwissHashTable(ezSwissHashTableBase<K, V, H>&& other)
+  : ezSwissHashTableBase<K, V, H>(std::move(other), other.GetAllocator())
+{
+}
+
+template <typename K, typename V, typename H, typename A>
+void ezSwissHashTable<K, V, H, A>::operator=(const ezSwissHashTable<K, V, H, A>& rhs)
+{
+  ezSwissHashTableBase<K, V, H>::operator=(rhs);
+}
+
+template <typename K, typename V, typename H, typename A>
+void ezSwissHashTable<K, V, H, A>::operator=(const ezSwissHashTableBase<K, V, H>& rhs)
+{
+  ezSwissHashTableBase<K, V, H>::operator=(rhs);
+}
+
+template <typename K, typename V, typename H, typename A>
+void ezSwissHashTable<K, V, H, A>::operator=(ezSwissHashTable<K, V, H, A>&& rhs)
+{
+  ezSwissHashTableBase<K, V, H>::operator=(std::move(rhs));
+}
+
+template <typename K, typename V, typename H, typename A>
+void ezSwissHashTable<K, V, H, A>::operator=(ezSwissHashTableBase<K, V, H>&& rhs)
+{
+  ezSwissHashTableBase<K, V, H>::operator=(std::move(rhs));
+}
@@ -0,0 +1,410 @@
+#pragma once
+
+#include <Foundation/Algorithm/HashingUtils.h>
+#include <Foundation/Math/Math.h>
+#include <Foundation/Memory/AllocatorWrapper.h>
+#include <Foundation/SimdMath/SimdTypes.h>
+
+template <typename KeyType, typename ValueType, typename Hasher>
+class ezSwissHashTableBase;
+
+/// \brief Const iterator.
+template <typename KeyType, typename ValueType, typename Hasher>
+struct ezSwissHashTableBaseConstIterator
+{
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = ezSwissHashTableBaseConstIterator;
+  using difference_type = std::ptrdiff_t;
+  using pointer = ezSwissHashTableBaseConstIterator*;
+  using reference = ezSwissHashTableBaseConstIterator&;
+
+  EZ_DECLARE_POD_TYPE();
+
+  ezSwissHashTableBaseConstIterator() = default;
+
+  /// \brief Checks whether this iterator points to a valid element.
+  bool IsValid() const; // [tested]
+
+  /// \brief Checks whether the two iterators point to the same element.
+  bool operator==(const ezSwissHashTableBaseConstIterator& rhs) const;
+  EZ_ADD_DEFAULT_OPERATOR_NOTEQUAL(const ezSwissHashTableBaseConstIterator&);
+
+  /// \brief Returns the 'key' of the element that this iterator points to.
+  const KeyType& Key() const; // [tested]
+
+  /// \brief Returns the 'value' of the element that this iterator points to.
+  const ValueType& Value() const; // [tested]
+
+  /// \brief Advances the iterator to the next element in the map. The iterator will not be valid anymore, if the end is reached.
+  void Next(); // [tested]
+
+  /// \brief Shorthand for 'Next'
+  void operator++(); // [tested]
+
+  /// \brief Returns '*this' to enable foreach
+  EZ_ALWAYS_INLINE ezSwissHashTableBaseConstIterator& operator*() { return *this; } // [tested]
+
+protected:
+  friend class ezSwissHashTableBase<KeyType, ValueType, Hasher>;
+
+  ezSwissHashTableBaseConstIterator(const ezSwissHashTableBase<KeyType, ValueType, Hasher>& hashTable, ezUInt32 uiIndex);
+
+  const ezSwissHashTableBase<KeyType, ValueType, Hasher>* m_pHashTable = nullptr;
+  ezUInt32 m_uiCurrentIndex = 0; // current element index that this iterator points to, equal to the capacity at the end.
+
+#if EZ_ENABLED(EZ_USE_CPP20_OPERATORS)
+public:
+  struct Pointer
+  {
+    std::pair<const KeyType&, const ValueType&> value;
+    const std::pair<const KeyType&, const ValueType&>* operator->() const { return &value; }
+  };
+
+  EZ_ALWAYS_INLINE Pointer operator->() const
+  {
+    return Pointer{.value = {Key(), Value()}};
+  }
+
+  // These function is used to return the values for structured bindings.
+  // The number and type of type of each slot are defined in the inl file.
+  template <std::size_t Index>
+  std::tuple_element_t<Index, ezSwissHashTableBaseConstIterator>& get() const
+  {
+    if constexpr (Index == 0)
+      return Key();
+    if constexpr (Index == 1)
+      return Value();
+  }
+#endif
+};
+
+/// \brief Iterator with write access.
+template <typename KeyType, typename ValueType, typename Hasher>
+struct ezSwissHashTableBaseIterator : public ezSwissHashTableBaseConstIterator<KeyType, ValueType, Hasher>
+{
+  EZ_DECLARE_POD_TYPE();
+
+  ezSwissHashTableBaseIterator() = default;
+
+  // this is required to pull in the const version of this function
+  using ezSwissHashTableBaseConstIterator<KeyType, ValueType, Hasher>::Value;
+
+  /// \brief Returns the 'value' of the element that this iterator points to.
+  EZ_FORCE_INLINE ValueType& Value(); // [tested]
+
+  /// \brief Returns the 'value' of the element that this iterator points to.
+  EZ_FORCE_INLINE ValueType& Value() const;
+
+  /// \brief Returns '*this' to enable foreach
+  EZ_ALWAYS_INLINE ezSwissHashTableBaseIterator& operator*() { return *this; } // [tested]
+
+private:
+  friend class ezSwissHashTableBase<KeyType, ValueType, Hasher>;
+
+  ezSwissHashTableBaseIterator(const ezSwissHashTableBase<KeyType, ValueType, Hasher>& hashTable, ezUInt32 uiIndex);
+
+#if EZ_ENABLED(EZ_USE_CPP20_OPERATORS)
+public:
+  struct Pointer
+  {
+    std::pair<const KeyType&, ValueType&> value;
+    const std::pair<const KeyType&, ValueType&>* operator->() const { return &value; }
+  };
+
+  EZ_ALWAYS_INLINE Pointer operator->() const
+  {
+    return Pointer{.value = {ezSwissHashTableBaseConstIterator<KeyType, ValueType, Hasher>::Key(), Value()}};
+  }
+
+  // These functions are used to return the values for structured bindings.
+  // The number and type of type of each slot are defined in the inl file.
+  template <std::size_t Index>
+  std::tuple_element_t<Index, ezSwissHashTableBaseIterator>& get() const
+  {
+    if constexpr (Index == 0)
+      return ezSwissHashTableBaseConstIterator<KeyType, ValueType, Hasher>::Key();
+    if constexpr (Index == 1)
+      return Value();
+  }
+#endif
+};
+
+/// \brief A hashtable with the same interface as ezHashTable, which probes 16 slots at once with SIMD instructions.
+///
+/// ezHashTable resolves collisions with linear probing and keeps the state of each slot in a separate bitfield,
+/// so every probe step reads a flag and then compares a key, which often means a cache miss per step.
+///
+/// This table instead stores one control byte per slot, which either marks the slot as empty or deleted, or holds
+/// 7 bits of the hash of the stored key. The slots are organized in groups of 16. A lookup loads the 16 control bytes
+/// of a group with one SSE2 / NEON instruction and compares all of them against the hash bits of the searched key.
+/// Only the (rare) slots with matching hash bits need a real key comparison, and a group containing an empty slot
+/// terminates the search. This makes misses nearly as cheap as hits and keeps performance stable at a higher load factor
+/// (up to 87.5%) than ezHashTable.
+///
+/// The lower bits of the hash select the group at which probing starts, the control bytes are derived from a scrambled version of the
+/// hash. No changes to existing hashers are needed.
+///
+/// Iterators stay valid when other elements are removed, but not when elements are added, as that may reallocate the table.
+///
+/// Use when:
+/// - Lookups, especially failing ones, dominate and the table is large
+///
+/// Stick to ezHashTable when:
+/// - The table is tiny (the minimum capacity is 16 slots)
+/// - Code needs to interoperate with functions that take an ezHashTableBase
+template <typename KeyType, typename ValueType, typename Hasher>
+class ezSwissHashTableBase
+{
+public:
+  using Iterator = ezSwissHashTableBaseIterator<KeyType, ValueType, Hasher>;
+  using ConstIterator = ezSwissHashTableBaseConstIterator<KeyType, ValueType, Hasher>;
+
+protected:
+  /// \brief Creates an empty hashtable. Does not allocate any data yet.
+  explicit ezSwissHashTableBase(ezAllocator* pAllocator); // [tested]
+
+  /// \brief Creates a copy of the given hashtable.
+  ezSwissHashTableBase(const ezSwissHashTableBase<KeyType, ValueType, Hasher>& rhs, ezAllocator* pAllocator); // [tested]
+
+  /// \brief Moves data from an existing hashtable into this one.
+  ezSwissHashTableBase(ezSwissHashTableBase<KeyType, ValueType, Hasher>&& rhs, ezAllocator* pAllocator); // [tested]
+
+  /// \brief Destructor.
+  ~ezSwissHashTableBase(); // [tested]
+
+  /// \brief Copies the data from another hashtable into this one.
+  void operator=(const ezSwissHashTableBase<KeyType, ValueType, Hasher>& rhs); // [tested]
+
+  /// \brief Moves data from an existing hashtable into this one.
+  void operator=(ezSwissHashTableBase<KeyType, ValueType, Hasher>&& rhs); // [tested]
+
+public:
+  /// \brief Compares this table to another table.
+  bool operator==(const ezSwissHashTableBase<KeyType, ValueType, Hasher>& rhs) const; // [tested]
+  EZ_ADD_DEFAULT_OPERATOR_NOTEQUAL(const ezSwissHashTableBase<KeyType, ValueType, Hasher>&);
+
+  /// \brief Expands the hashtable such that the given number of entries can be inserted without growing it again.
+  void Reserve(ezUInt32 uiCapacity); // [tested]
+
+  /// \brief Tries to compact the hashtable to avoid wasting memory.
+  ///
+  /// The resulting capacity is at least 'GetCount' (no elements get removed).
+  /// Will deallocate all data, if the hashtable is empty.
+  void Compact(); // [tested]
+
+  /// \brief Returns the number of active entries in the table.
+  ezUInt32 GetCount() const; // [tested]
+
+  /// \brief Returns true, if the hashtable does not contain any elements.
+  bool IsEmpty() const; // [tested]
+
+  /// \brief Clears the table.
+  void Clear(); // [tested]
+
+  /// \brief Inserts the key value pair or replaces value if an entry with the given key already exists.
+  ///
+  /// Returns true if an existing value was replaced and optionally writes out the old value to out_oldValue.
+  template <typename CompatibleKeyType, typename CompatibleValueType>
+  bool Insert(CompatibleKeyType&& key, CompatibleValueType&& value, ValueType* out_pOldValue = nullptr); // [tested]
+
+  /// \brief Removes the entry with the given key. Returns whether an entry was removed and optionally writes out the old value to out_oldValue.
+  template <typename CompatibleKeyType>
+  bool Remove(const CompatibleKeyType& key, ValueType* out_pOldValue = nullptr); // [tested]
+
+  /// \brief Erases the key/value pair at the given Iterator. Returns an iterator to the element after the given iterator.
+  Iterator Remove(const Iterator& pos); // [tested]
+
+  /// \brief Cannot remove an element with just a ConstIterator
+  void Remove(const ConstIterator& pos) = delete;
+
+  /// \brief Returns whether an entry with the given key was found and if found writes out the corresponding value to out_value.
+  template <typename CompatibleKeyType>
+  bool TryGetValue(const CompatibleKeyType& key, ValueType& out_value) const; // [tested]
+
+  /// \brief Returns whether an entry with the given key was found and if found writes out the pointer to the corresponding value to out_pValue.
+  template <typename CompatibleKeyType>
+  bool TryGetValue(const CompatibleKeyType& key, const ValueType*& out_pValue) const; // [tested]
+
+  /// \brief Returns whether an entry with the given key was found and if found writes out the pointer to the corresponding value to out_pValue.
+  template <typename CompatibleKeyType>
+  bool TryGetValue(const CompatibleKeyType& key, ValueType*& out_pValue) const; // [tested]
+
+  /// \brief Searches for key, returns a ConstIterator to it or an invalid iterator, if no such key is found. O(1) operation.
+  template <typename CompatibleKeyType>
+  ConstIterator Find(const CompatibleKeyType& key) const;
+
+  /// \brief Searches for key, returns an Iterator to it or an invalid iterator, if no such key is found. O(1) operation.
+  template <typename CompatibleKeyType>
+  Iterator Find(const CompatibleKeyType& key);
+
+  /// \brief Returns a pointer to the value of the entry with the given key if found, otherwise returns nullptr.
+  template <typename CompatibleKeyType>
+  const ValueType* GetValue(const CompatibleKeyType& key) const; // [tested]
+
+  /// \brief Returns a pointer to the value of the entry with the given key if found, otherwise returns nullptr.
+  template <typename CompatibleKeyType>
+  ValueType* GetValue(const CompatibleKeyType& key); // [tested]
+
+  /// \brief Returns the value to the given key if found or creates a new entry with the given key and a default constructed value.
+  ValueType& operator[](const KeyType& key); // [tested]
+
+  /// \brief Returns the value stored at the given key. If none exists, one is created. \a bExisted indicates whether an element needed to be created.
+  ValueType& FindOrAdd(const KeyType& key, bool* out_pExisted = nullptr); // [tested]
+
+  /// \brief Returns if an entry with given key exists in the table.
+  template <typename CompatibleKeyType>
+  bool Contains(const CompatibleKeyType& key) const; // [tested]
+
+  /// \brief Returns an Iterator to the very first element.
+  Iterator GetIterator(); // [tested]
+
+  /// \brief Returns an Iterator to the first element that is not part of the hash-table. Needed to support range based for loops.
+  Iterator GetEndIterator(); // [tested]
+
+  /// \brief Returns a constant Iterator to the very first element.
+  ConstIterator GetIterator() const; // [tested]
+
+  /// \brief Returns a ConstIterator to the first element that is not part of the hash-table. Needed to support range based for loops.
+  ConstIterator GetEndIterator() const; // [tested]
+
+  /// \brief Returns the allocator that is used by this instance.
+  ezAllocator* GetAllocator() const;
+
+  /// \brief Returns the amount of bytes that are currently allocated on the heap.
+  ezUInt64 GetHeapMemoryUsage() const; // [tested]
+
+  /// \brief Swaps this map with the other one.
+  void Swap(ezSwissHashTableBase<KeyType, ValueType, Hasher>& other); // [tested]
+
+private:
+  friend struct ezSwissHashTableBaseConstIterator<KeyType, ValueType, Hasher>;
+  friend struct ezSwissHashTableBaseIterator<KeyType, ValueType, Hasher>;
+
+  struct Entry
+  {
+    KeyType key;
+    ValueType value;
+  };
+
+  /// \brief One control byte per slot, followed by the entries, in one allocation.
+  ezInt8* m_pControl = nullptr;
+  Entry* m_pEntries = nullptr;
+
+  ezUInt32 m_uiCount = 0;
+  ezUInt32 m_uiCapacity = 0;
+
+  /// \brief How many empty slots may still be used, before the table needs to be rehashed.
+  ezUInt32 m_uiGrowthLeft = 0;
+
+  ezAllocator* m_pAllocator = nullptr;
+
+  enum : ezInt8
+  {
+    CONTROL_EMPTY = -128,  // 0b10000000
+    CONTROL_DELETED = -2,  // 0b11111110
+  };
+
+  enum : ezUInt32
+  {
+    GROUP_SIZE = 16,
+  };
+
+  static ezUInt32 GetMaxLoad(ezUInt32 uiCapacity) { return uiCapacity - uiCapacity / 8; }
+
+  /// \brief The control byte stores the upper 7 bits of the hash. The hash is scrambled once more, so that hashers which only produce
+  /// good lower bits (e.g. for small 64 bit integers) still result in well distributed control bytes.
+  static ezInt8 GetControlHash(ezUInt32 uiHash) { return static_cast<ezInt8>((uiHash * 2654435761U) >> 25); }
+
+  /// \brief Returns the smallest valid capacity, at which the given number of elements can be stored.
+  static ezUInt32 GetCapacityForCount(ezUInt32 uiCount);
+
+  static ezUInt32 GetEntriesOffset(ezUInt32 uiCapacity);
+
+  /// \brief Allocates the control bytes and entries for the given capacity and marks all slots as empty. Does not free the previous buffer.
+  void AllocateBuffer(ezUInt32 uiCapacity);
+  void FreeBuffer();
+
+  /// \brief Moves all elements into a newly allocated buffer with the given capacity. This also gets rid of all deleted entries.
+  void SetCapacity(ezUInt32 uiCapacity);
+
+  void RemoveInternal(ezUInt32 uiIndex);
+
+  template <typename CompatibleKeyType>
+  ezUInt32 FindEntry(const CompatibleKeyType& key) const;
+
+  template <typename CompatibleKeyType>
+  ezUInt32 FindEntry(ezUInt32 uiHash, const CompatibleKeyType& key) const;
+
+  /// \brief Returns the index of a free or deleted slot, at which an entry with the given hash can be inserted. Grows the table if needed.
+  ezUInt32 PrepareInsert(ezUInt32 uiHash);
+
+  /// \brief Returns the index of the first empty or deleted slot in the probe sequence of the given hash.
+  ezUInt32 FindInsertSlot(ezUInt32 uiHash) const;
+
+  void SetControl(ezUInt32 uiIndex, ezInt8 control) { m_pControl[uiIndex] = control; }
+
+  /// \brief Returns the index of the first valid entry at or after the given index, or the capacity if there is none.
+  ezUInt32 FindNextValid(ezUInt32 uiIndex) const;
+};
+
+/// \brief \see ezSwissHashTableBase
+template <typename KeyType, typename ValueType, typename Hasher = ezHashHelper<KeyType>, typename AllocatorWrapper = ezDefaultAllocatorWrapper>
+class ezSwissHashTable : public ezSwissHashTableBase<KeyType, ValueType, Hasher>
+{
+public:
+  ezSwissHashTable();
+  explicit ezSwissHashTable(ezAllocator* pAllocator);
+
+  ezSwissHashTable(const ezSwissHashTable<KeyType, ValueType, Hasher, AllocatorWrapper>& other);
+  ezSwissHashTable(const ezSwissHashTableBase<KeyType, ValueType, Hasher>& other);
+
+  ezSwissHashTable(ezSwissHashTable<KeyType, ValueType, Hasher, AllocatorWrapper>&& other);
+  ezSwissHashTable(ezSwissHashTableBase<KeyType, ValueType, Hasher>&& other);
+
+  void operator=(const ezSwissHashTable<KeyType, ValueType, Hasher, AllocatorWrapper>& rhs);
+  void operator=(const ezSwissHashTableBase<KeyType, ValueType, Hasher>& rhs);
+
+  void operator=(ezSwissHashTable<KeyType, ValueType, Hasher, AllocatorWrapper>&& rhs);
+  void operator=(ezSwissHashTableBase<KeyType, ValueType, Hasher>&& rhs);
+};
+
+//////////////////////////////////////////////////////////////////////////
+// begin() /end() for range-based for-loop support
+
+template <typename KeyType, typename ValueType, typename Hasher>
+typename ezSwissHashTableBase<KeyType, ValueType, Hasher>::Iterator begin(ezSwissHashTableBase<KeyType, ValueType, Hasher>& ref_container)
+{
+  return ref_container.GetIterator();
+}
+
+template <typename KeyType, typename ValueType, typename Hasher>
+typename ezSwissHashTableBase<KeyType, ValueType, Hasher>::ConstIterator begin(const ezSwissHashTableBase<KeyType, ValueType, Hasher>& container)
+{
+  return container.GetIterator();
+}
+
+template <typename KeyType, typename ValueType, typename Hasher>
+typename ezSwissHashTableBase<KeyType, ValueType, Hasher>::ConstIterator cbegin(const ezSwissHashTableBase<KeyType, ValueType, Hasher>& container)
+{
+  return container.GetIterator();
+}
+
+template <typename KeyType, typename ValueType, typename Hasher>
+typename ezSwissHashTableBase<KeyType, ValueType, Hasher>::Iterator end(ezSwissHashTableBase<KeyType, ValueType, Hasher>& ref_container)
+{
+  return ref_container.GetEndIterator();
+}
+
+template <typename KeyType, typename ValueType, typename Hasher>
+typename ezSwissHashTableBase<KeyType, ValueType, Hasher>::ConstIterator end(const ezSwissHashTableBase<KeyType, ValueType, Hasher>& container)
+{
+  return container.GetEndIterator();
+}
+
+template <typename KeyType, typename ValueType, typename Hasher>
+typename ezSwissHashTableBase<KeyType, ValueType, Hasher>::ConstIterator cend(const ezSwissHashTableBase<KeyType, ValueType, Hasher>& container)
+{
+  return container.GetEndIterator();
+}
+
+#include <Foundation/Containers/Implementation/SwissHashTable_inl.h>
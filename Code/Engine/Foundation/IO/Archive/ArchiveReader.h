@@ -30,6 +30,11 @@ public:
   /// \brief Sets up \a memReader for reading the raw (potentially compressed) data that is stored for the given entry in the archive.
   void ConfigureRawMemoryStreamReader(ezUInt32 uiEntryIdx, ezRawMemoryStreamReader& ref_memReader) const;
 
+  /// \brief Returns the data of the given entry directly from the memory mapped archive, if it is stored uncompressed. Otherwise an empty array is returned.
+  ///
+  /// The memory is read-only and stays valid as long as the archive is open.
+  ezArrayPtr<const ezUInt8> GetUncompressedEntryData(ezUInt32 uiEntryIdx) const;
+
   /// \brief Creates a reader that will decompress the given file entry.
   ezUniquePtr<ezStreamReader> CreateEntryReader(ezUInt32 uiEntryIdx) const;
 
@@ -66,6 +66,7 @@ namespace ezDataDirectory
     ArchiveReaderCommon(ezInt32 iDataDirUserData);
 
     virtual ezUInt64 GetFileSize() const override;
+    virtual ezArrayPtr<const ezUInt8> GetMemoryView() const override;
 
   protected:
     friend class ArchiveType;
@@ -73,6 +74,9 @@ namespace ezDataDirectory
     ezUInt64 m_uiUncompressedSize = 0;
     ezUInt64 m_uiCompressedSize = 0;
     ezRawMemoryStreamReader m_MemStreamReader;
+
+    // only set for uncompressed entries, points into the memory mapped archive
+    ezArrayPtr<const ezUInt8> m_MemoryView;
   };
 
   class EZ_FOUNDATION_DLL ArchiveReaderUncompressed : public ArchiveReaderCommon
@@ -122,6 +122,18 @@ void ezArchiveReader::ConfigureRawMemoryStreamReader(ezUInt32 uiEntryIdx, ezRawM
   ezArchiveUtils::ConfigureRawMemoryStreamReader(m_ArchiveTOC.m_Entries[uiEntryIdx], m_pDataStart, ref_memReader);
 }
 
+ezArrayPtr<const ezUInt8> ezArchiveReader::GetUncompressedEntryData(ezUInt32 uiEntryIdx) const
+{
+  const ezArchiveEntry& entry = m_ArchiveTOC.m_Entries[uiEntryIdx];
+
+  // array pointers can't address more than 4 GB, such entries have to be read through a stream
+  if (entry.m_CompressionMode != ezArchiveCompressionMode::Uncompressed || entry.m_uiStoredDataSize > ezMath::MaxValue<ezUInt32>())
+    return {};
+
+  const ezUInt8* pData = static_cast<const ezUInt8*>(ezMemoryUtils::AddByteOffset(m_pDataStart, static_cast<std::ptrdiff_t>(entry.m_uiDataStartOffset)));
+  return ezArrayPtr<const ezUInt8>(pData, static_cast<ezUInt32>(entry.m_uiStoredDataSize));
+}
+
 ezUniquePtr<ezStreamReader> ezArchiveReader::CreateEntryReader(ezUInt32 uiEntryIdx) const
 {
   return ezArchiveUtils::CreateEntryReader(m_ArchiveTOC.m_Entries[uiEntryIdx], m_pDataStart);
@@ -121,6 +121,7 @@ ezDataDirectoryReader* ezDataDirectory::ArchiveType::OpenFileToRead(ezStringView
   pReader->m_uiCompressedSize = pEntry->m_uiStoredDataSize;
 
   m_ArchiveReader.ConfigureRawMemoryStreamReader(uiEntryIndex, pReader->m_MemStreamReader);
+  pReader->m_MemoryView = m_ArchiveReader.GetUncompressedEntryData(uiEntryIndex);
 
   if (pReader->Open(sArchivePath, this, FileShareMode).Failed())
   {
@@ -280,6 +281,11 @@ ezUInt64 ezDataDirectory::ArchiveReaderCommon::GetFileSize() const
   return m_uiUncompressedSize;
 }
 
+ezArrayPtr<const ezUInt8> ezDataDirectory::ArchiveReaderCommon::GetMemoryView() const
+{
+  return m_MemoryView;
+}
+
 //////////////////////////////////////////////////////////////////////////
 
 ezDataDirectory::ArchiveReaderUncompressed::ArchiveReaderUncompressed(ezInt32 iDataDirUserData)
@@ -190,6 +190,12 @@ public:
 
   virtual ezUInt64 Read(void* pBuffer, ezUInt64 uiBytes) = 0;
 
+  /// \brief Returns the entire file content, if the data directory already holds it in memory (e.g. an uncompressed entry in a memory mapped archive).
+  ///
+  /// Returns an empty array, if the file has to be read through Read() instead. The memory is read-only and stays valid until this reader is closed.
+  /// It always covers the whole file, independent of the current read position.
+  virtual ezArrayPtr<const ezUInt8> GetMemoryView() const { return {}; }
+
   /// \brief Helper method to skip a number of bytes (implementations of the directory reader may implement this more efficiently for example)
   virtual ezUInt64 Skip(ezUInt64 uiBytes)
   {
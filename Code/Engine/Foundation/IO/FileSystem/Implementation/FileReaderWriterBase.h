@@ -36,6 +36,11 @@ public:
   /// \brief Returns the current total size of the file.
   ezUInt64 GetFileSize() const { return m_pDataDirReader->GetFileSize(); }
 
+  /// \brief Returns the entire file content without copying it, if the data directory provides it in memory. Otherwise the returned array is empty.
+  ///
+  /// The memory stays valid as long as the file is open. See ezDataDirectoryReader::GetMemoryView().
+  ezArrayPtr<const ezUInt8> GetMemoryView() const { return m_pDataDirReader->GetMemoryView(); }
+
 protected:
   ezDataDirectoryReader* GetFileReader(ezStringView sFile, ezFileShareMode::Enum FileShareMode, bool bAllowFileEvents)
   {
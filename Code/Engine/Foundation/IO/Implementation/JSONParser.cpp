@@ -8,23 +8,31 @@ ezJSONParser::ezJSONParser()
 {
   m_uiCurByte = '\0';
   m_uiNextByte = '\0';
-  m_pInput = nullptr;
   m_bSkippingMode = false;
   m_pLogInterface = nullptr;
-  m_uiCurLine = 1;
-  m_uiCurColumn = 0;
 }
 
 void ezJSONParser::SetInputStream(ezStreamReader& stream, ezUInt32 uiFirstLineOffset)
+{
+  m_Input.SetStream(stream, uiFirstLineOffset);
+
+  BeginInput();
+}
+
+void ezJSONParser::SetInputMemory(ezArrayPtr<const ezUInt8> data, ezUInt32 uiFirstLineOffset)
+{
+  m_Input.SetMemory(data, uiFirstLineOffset);
+
+  BeginInput();
+}
+
+void ezJSONParser::BeginInput()
 {
   m_StateStack.Clear();
   m_uiCurByte = '\0';
   m_TempString.Clear();
+  m_sCurrentString = {};
   m_bSkippingMode = false;
-  m_uiCurLine = 1 + uiFirstLineOffset;
-  m_uiCurColumn = 0;
-
-  m_pInput = &stream;
 
   m_uiNextByte = ' ';
   ReadCharacter(true);
@@ -116,11 +124,11 @@ void ezJSONParser::ParsingError(ezStringView sMessage, bool bFatal)
   }
 
   if (bFatal)
-    ezLog::Error(m_pLogInterface, "Line {0} ({1}): {2}", m_uiCurLine, m_uiCurColumn, sMessage);
+    ezLog::Error(m_pLogInterface, "Line {0} ({1}): {2}", m_Input.GetLine(), m_Input.GetColumn(), sMessage);
   else
     ezLog::Warning(m_pLogInterface, sMessage);
 
-  OnParsingError(sMessage, bFatal, m_uiCurLine, m_uiCurColumn);
+  OnParsingError(sMessage, bFatal, m_Input.GetLine(), m_Input.GetColumn());
 }
 
 void ezJSONParser::SkipObject()
@@ -299,7 +307,7 @@ void ezJSONParser::ContinueVariable()
 
   if (!m_bSkippingMode)
   {
-    if (!OnVariable((const char*)&m_TempString[0]))
+    if (!OnVariable(m_sCurrentString))
       SkipStack(ExpectSeparator);
   }
 }
@@ -325,7 +333,7 @@ void ezJSONParser::ContinueValue()
       m_StateStack.PopBack();
 
       if (!m_bSkippingMode)
-        OnReadValue(ezStringView((const char*)&m_TempString[0]));
+        OnReadValue(m_sCurrentString);
     }
       return;
 
@@ -475,15 +483,7 @@ void ezJSONParser::ContinueSeparator()
 
 void ezJSONParser::ReadNextByte()
 {
-  m_pInput->ReadBytes(&m_uiNextByte, sizeof(ezUInt8));
-
-  if (m_uiNextByte == '\n')
-  {
-    ++m_uiCurLine;
-    m_uiCurColumn = 0;
-  }
-  else
-    ++m_uiCurColumn;
+  m_uiNextByte = m_Input.ReadByte();
 }
 
 bool ezJSONParser::ReadCharacter(bool bSkipComments)
@@ -533,10 +533,14 @@ bool ezJSONParser::ReadCharacter(bool bSkipComments)
 
 void ezJSONParser::SkipWhitespace()
 {
-  EZ_ASSERT_DEBUG(m_pInput != nullptr, "Input Stream is not set up.");
+  EZ_ASSERT_DEBUG(m_Input.IsInitialized(), "Input Stream is not set up.");
 
   do
   {
+    // jump over all the whitespace that follows the next byte at once
+    if (ezStringUtils::IsWhiteSpace(m_uiNextByte))
+      m_Input.SkipWhitespace();
+
     m_uiCurByte = '\0';
 
     if (!ReadCharacter(true))
@@ -546,10 +550,24 @@ void ezJSONParser::SkipWhitespace()
 
 void ezJSONParser::SkipString()
 {
-  EZ_ASSERT_DEBUG(m_pInput != nullptr, "Input Stream is not set up.");
+  EZ_ASSERT_DEBUG(m_Input.IsInitialized(), "Input Stream is not set up.");
 
   m_TempString.Clear();
   m_TempString.PushBack('\0');
+  m_sCurrentString = {};
+
+  if (m_uiNextByte != '\0')
+  {
+    const ezUInt8* pEnd = ezInternal::ezTextParserInput::FindStringTerminator(m_Input.GetLastReadByte(), m_Input.GetReadEnd());
+
+    if (pEnd != m_Input.GetReadEnd() && *pEnd == '\"')
+    {
+      m_Input.SkipTo(pEnd + 1);
+      m_uiCurByte = '\"';
+      ReadNextByte();
+      return;
+    }
+  }
 
   bool bEscapeSequence = false;
 
@@ -570,10 +588,40 @@ void ezJSONParser::SkipString()
 
 void ezJSONParser::ReadString()
 {
-  EZ_ASSERT_DEBUG(m_pInput != nullptr, "Input Stream is not set up.");
+  EZ_ASSERT_DEBUG(m_Input.IsInitialized(), "Input Stream is not set up.");
 
   m_TempString.Clear();
 
+  // fast path for strings without escape sequences that are entirely inside the input window
+  if (m_uiNextByte != '\0')
+  {
+    const ezUInt8* pStart = m_Input.GetLastReadByte();
+    const ezUInt8* pEnd = ezInternal::ezTextParserInput::FindStringTerminator(pStart, m_Input.GetReadEnd());
+
+    if (pEnd != m_Input.GetReadEnd() && *pEnd == '\"')
+    {
+      const ezUInt32 uiLength = static_cast<ezUInt32>(pEnd - pStart);
+
+      if (m_Input.IsMemory())
+      {
+        m_TempString.PushBack('\0');
+        m_sCurrentString = ezStringView(reinterpret_cast<const char*>(pStart), uiLength);
+      }
+      else
+      {
+        m_TempString.SetCountUninitialized(uiLength + 1);
+        ezMemoryUtils::Copy(m_TempString.GetData(), pStart, uiLength);
+        m_TempString[uiLength] = '\0';
+        m_sCurrentString = ezStringView(reinterpret_cast<const char*>(m_TempString.GetData()), uiLength);
+      }
+
+      m_Input.SkipTo(pEnd + 1);
+      m_uiCurByte = '\"';
+      ReadNextByte();
+      return;
+    }
+  }
+
   bool bEscapeSequence = false;
 
   while (true)
@@ -702,11 +750,13 @@ void ezJSONParser::ReadString()
   }
 
   m_TempString.PushBack('\0');
+
+  m_sCurrentString = ezStringView(reinterpret_cast<const char*>(m_TempString.GetData()), m_TempString.GetCount() - 1);
 }
 
 void ezJSONParser::ReadWord()
 {
-  EZ_ASSERT_DEBUG(m_pInput != nullptr, "Input Stream is not set up.");
+  EZ_ASSERT_DEBUG(m_Input.IsInitialized(), "Input Stream is not set up.");
 
   m_TempString.Clear();
 
@@ -725,10 +775,31 @@ void ezJSONParser::ReadWord()
 
 double ezJSONParser::ReadNumber()
 {
-  EZ_ASSERT_DEBUG(m_pInput != nullptr, "Input Stream is not set up.");
+  EZ_ASSERT_DEBUG(m_Input.IsInitialized(), "Input Stream is not set up.");
 
   m_TempString.Clear();
 
+  // take all number characters that are already in the input window at once, except for the last one,
+  // which becomes the next byte again, so that the loop below handles the end of the number as usual
+  if (m_uiNextByte != '\0')
+  {
+    const ezUInt8* pStart = m_Input.GetLastReadByte();
+    const ezUInt8* pEnd = ezInternal::ezTextParserInput::FindEndOfNumber(pStart, m_Input.GetReadEnd(), true, false);
+
+    if (pEnd > pStart)
+    {
+      const ezUInt32 uiCount = static_cast<ezUInt32>(pEnd - pStart);
+
+      m_TempString.SetCountUninitialized(uiCount);
+      m_TempString[0] = m_uiCurByte;
+      ezMemoryUtils::Copy(m_TempString.GetData() + 1, pStart, uiCount - 1);
+
+      m_Input.SkipTo(pEnd);
+      m_uiNextByte = pEnd[-1];
+      ReadCharacter(true);
+    }
+  }
+
   do
   {
     m_TempString.PushBack(m_uiCurByte);
@@ -9,13 +9,25 @@ ezJSONReader::ezJSONReader()
 }
 
 ezResult ezJSONReader::Parse(ezStreamReader& ref_inputStream, ezUInt32 uiFirstLineOffset)
+{
+  SetInputStream(ref_inputStream, uiFirstLineOffset);
+
+  return ParseInput();
+}
+
+ezResult ezJSONReader::Parse(ezArrayPtr<const ezUInt8> data, ezUInt32 uiFirstLineOffset)
+{
+  SetInputMemory(data, uiFirstLineOffset);
+
+  return ParseInput();
+}
+
+ezResult ezJSONReader::ParseInput()
 {
   m_bParsingError = false;
   m_Stack.Clear();
   m_sLastName.Clear();
 
-  SetInputStream(ref_inputStream, uiFirstLineOffset);
-
   while (!m_bParsingError && ContinueParsing())
   {
   }
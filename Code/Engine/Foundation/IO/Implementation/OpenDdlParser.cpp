@@ -39,11 +39,23 @@ void ezOpenDdlParser::SetInputStream(ezStreamReader& stream, ezUInt32 uiFirstLin
 {
   EZ_ASSERT_DEV(m_StateStack.IsEmpty(), "OpenDDL Parser cannot be restarted");
 
-  m_pInput = &stream;
+  m_Input.SetStream(stream, uiFirstLineOffset);
 
+  BeginInput();
+}
+
+void ezOpenDdlParser::SetInputMemory(ezArrayPtr<const ezUInt8> data, ezUInt32 uiFirstLineOffset /*= 0*/)
+{
+  EZ_ASSERT_DEV(m_StateStack.IsEmpty(), "OpenDDL Parser cannot be restarted");
+
+  m_Input.SetMemory(data, uiFirstLineOffset);
+
+  BeginInput();
+}
+
+void ezOpenDdlParser::BeginInput()
+{
   m_bSkippingMode = false;
-  m_uiCurLine = 1 + uiFirstLineOffset;
-  m_uiCurColumn = 0;
   m_uiCurByte = '\0';
   m_uiNumCachedPrimitives = 0;
 
@@ -167,11 +179,11 @@ void ezOpenDdlParser::StopParsing()
 void ezOpenDdlParser::ParsingError(ezStringView sMessage, bool bFatal)
 {
   if (bFatal)
-    ezLog::Error(m_pLogInterface, "Line {0} ({1}): {2}", m_uiCurLine, m_uiCurColumn, sMessage);
+    ezLog::Error(m_pLogInterface, "Line {0} ({1}): {2}", m_Input.GetLine(), m_Input.GetColumn(), sMessage);
   else
     ezLog::Warning(m_pLogInterface, sMessage);
 
-  OnParsingError(sMessage, bFatal, m_uiCurLine, m_uiCurColumn);
+  OnParsingError(sMessage, bFatal, m_Input.GetLine(), m_Input.GetColumn());
 
   if (bFatal)
   {
@@ -184,15 +196,7 @@ void ezOpenDdlParser::ParsingError(ezStringView sMessage, bool bFatal)
 
 void ezOpenDdlParser::ReadNextByte()
 {
-  m_pInput->ReadBytes(&m_uiNextByte, sizeof(ezUInt8));
-
-  if (m_uiNextByte == '\n')
-  {
-    ++m_uiCurLine;
-    m_uiCurColumn = 0;
-  }
-  else
-    ++m_uiCurColumn;
+  m_uiNextByte = m_Input.ReadByte();
 }
 
 bool ezOpenDdlParser::ReadCharacter()
@@ -254,6 +258,10 @@ void ezOpenDdlParser::SkipWhitespace()
 {
   do
   {
+    // jump over all the whitespace that follows the next byte at once
+    if (ezStringUtils::IsWhiteSpace(m_uiNextByte))
+      m_Input.SkipWhitespace();
+
     m_uiCurByte = '\0';
 
     if (!ReadCharacterSkipComments())
@@ -592,6 +600,38 @@ void ezOpenDdlParser::ReadString()
 {
   m_uiTempStringLength = 0;
 
+  // fast path for strings without escape sequences that are entirely inside the input window
+  if (m_uiNextByte != '\0')
+  {
+    const ezUInt8* pStart = m_Input.GetLastReadByte();
+    const ezUInt8* pEnd = ezInternal::ezTextParserInput::FindStringTerminator(pStart, m_Input.GetReadEnd());
+
+    if (pEnd != m_Input.GetReadEnd() && *pEnd == '\"')
+    {
+      m_uiTempStringLength = static_cast<ezUInt32>(pEnd - pStart);
+
+      if (m_Input.IsMemory())
+      {
+        m_sCurrentString = ezStringView(reinterpret_cast<const char*>(pStart), reinterpret_cast<const char*>(pEnd));
+      }
+      else
+      {
+        if (m_uiTempStringLength + 1 > m_TempString.GetCount())
+          m_TempString.SetCountUninitialized(ezMath::Max(m_uiTempStringLength + 1, m_TempString.GetCount() * 2));
+
+        ezMemoryUtils::Copy(m_TempString.GetData(), pStart, m_uiTempStringLength);
+        m_TempString[m_uiTempStringLength] = '\0';
+
+        m_sCurrentString = ezStringView(reinterpret_cast<const char*>(m_TempString.GetData()), m_uiTempStringLength);
+      }
+
+      m_Input.SkipTo(pEnd + 1);
+      m_uiCurByte = '\"';
+      ReadNextByte();
+      return;
+    }
+  }
+
   while (true)
   {
     const bool bEscapeSequence = (m_uiCurByte == '\\');
@@ -673,6 +713,8 @@ void ezOpenDdlParser::ReadString()
   }
 
   m_TempString[m_uiTempStringLength] = '\0';
+
+  m_sCurrentString = ezStringView(reinterpret_cast<const char*>(m_TempString.GetData()), m_uiTempStringLength);
 }
 
 void ezOpenDdlParser::ReadWord()
@@ -809,9 +851,7 @@ void ezOpenDdlParser::ContinueString()
 
       if (!m_bSkippingMode)
       {
-        ezStringView view((const char*)&m_TempString[0], (const char*)&m_TempString[m_uiTempStringLength]);
-
-        OnPrimitiveString(1, &view, false);
+        OnPrimitiveString(1, &m_sCurrentString, false);
       }
 
       return;
@@ -828,6 +868,19 @@ void ezOpenDdlParser::ContinueString()
 
 void ezOpenDdlParser::SkipString()
 {
+  if (m_uiNextByte != '\0')
+  {
+    const ezUInt8* pEnd = ezInternal::ezTextParserInput::FindStringTerminator(m_Input.GetLastReadByte(), m_Input.GetReadEnd());
+
+    if (pEnd != m_Input.GetReadEnd() && *pEnd == '\"')
+    {
+      m_Input.SkipTo(pEnd + 1);
+      m_uiCurByte = '\"';
+      ReadNextByte();
+      return;
+    }
+  }
+
   bool bEscapeSequence = false;
 
   do
@@ -1152,6 +1205,30 @@ void ezOpenDdlParser::ReadDecimalFloat()
 {
   m_uiTempStringLength = 0;
 
+  // take all number characters that are already in the input window at once, except for the last one,
+  // which becomes the next byte again, so that the loop below handles the end of the number as usual
+  if (m_uiNextByte != '\0')
+  {
+    const ezUInt8* pStart = m_Input.GetLastReadByte();
+    const ezUInt8* pEnd = ezInternal::ezTextParserInput::FindEndOfNumber(pStart, m_Input.GetReadEnd(), true, true);
+
+    if (pEnd > pStart)
+    {
+      const ezUInt32 uiCount = static_cast<ezUInt32>(pEnd - pStart);
+
+      if (uiCount + 2 > m_TempString.GetCount())
+        m_TempString.SetCountUninitialized(ezMath::Max(uiCount + 2, m_TempString.GetCount() * 2));
+
+      m_TempString[0] = m_uiCurByte;
+      ezMemoryUtils::Copy(m_TempString.GetData() + 1, pStart, uiCount - 1);
+      m_uiTempStringLength = uiCount;
+
+      m_Input.SkipTo(pEnd);
+      m_uiNextByte = pEnd[-1];
+      ReadCharacterSkipComments();
+    }
+  }
+
   do
   {
     m_TempString[m_uiTempStringLength] = m_uiCurByte;
@@ -1196,6 +1273,31 @@ ezUInt64 ezOpenDdlParser::ReadDecimalLiteral()
 {
   ezUInt64 value = 0;
 
+  // same as in ReadDecimalFloat(), the last digit in the input window is handled by the loop below
+  if (m_uiNextByte != '\0' && m_uiCurByte >= '0' && m_uiCurByte <= '9')
+  {
+    const ezUInt8* pStart = m_Input.GetLastReadByte();
+    const ezUInt8* pEnd = ezInternal::ezTextParserInput::FindEndOfNumber(pStart, m_Input.GetReadEnd(), false, true);
+
+    if (pEnd > pStart)
+    {
+      value = m_uiCurByte - '0';
+
+      for (const ezUInt8* p = pStart; p < pEnd - 1; ++p)
+      {
+        if (*p != '_')
+        {
+          // won't check for overflow
+          value = value * 10 + (*p - '0');
+        }
+      }
+
+      m_Input.SkipTo(pEnd);
+      m_uiNextByte = pEnd[-1];
+      ReadCharacterSkipComments();
+    }
+  }
+
   while ((m_uiCurByte >= '0' && m_uiCurByte <= '9') || m_uiCurByte == '_')
   {
     if (m_uiCurByte == '_')
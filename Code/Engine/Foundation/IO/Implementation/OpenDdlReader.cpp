@@ -21,6 +21,22 @@ ezResult ezOpenDdlReader::ParseDocument(ezStreamReader& inout_stream, ezUInt32 u
   SetCacheSize(uiCacheSizeInKB);
   SetInputStream(inout_stream, uiFirstLineOffset);
 
+  return ParseWithRootElement();
+}
+
+ezResult ezOpenDdlReader::ParseDocument(ezArrayPtr<const ezUInt8> data, ezUInt32 uiFirstLineOffset, ezLogInterface* pLog, ezUInt32 uiCacheSizeInKB)
+{
+  EZ_ASSERT_DEBUG(m_ObjectStack.IsEmpty(), "A reader can only be used once.");
+
+  SetLogInterface(pLog);
+  SetCacheSize(uiCacheSizeInKB);
+  SetInputMemory(data, uiFirstLineOffset);
+
+  return ParseWithRootElement();
+}
+
+ezResult ezOpenDdlReader::ParseWithRootElement()
+{
   m_TempCache.Reserve(s_uiChunkSize);
 
   ezOpenDdlReaderElement* pElement = &m_Elements.ExpandAndGetRef();
@@ -0,0 +1,226 @@
+#include <Foundation/FoundationPCH.h>
+
+#include <Foundation/IO/Implementation/TextParserInput.h>
+#include <Foundation/SimdMath/SimdTypes.h>
+
+namespace
+{
+  constexpr ezUInt32 s_uiStreamBufferSize = 4096;
+
+#if EZ_SIMD_IMPLEMENTATION == EZ_SIMD_IMPLEMENTATION_SSE
+
+  // one bit per byte
+  constexpr ezUInt32 s_uiMaskShift = 0;
+  constexpr ezUInt64 s_uiFullMask = 0xFFFFu;
+
+  using Block = __m128i;
+
+  EZ_ALWAYS_INLINE Block Load(const ezUInt8* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+  EZ_ALWAYS_INLINE Block Equal(Block v, ezUInt8 c) { return _mm_cmpeq_epi8(v, _mm_set1_epi8(static_cast<char>(c))); }
+  EZ_ALWAYS_INLINE Block Or(Block a, Block b) { return _mm_or_si128(a, b); }
+  EZ_ALWAYS_INLINE ezUInt64 ToMask(Block v) { return static_cast<ezUInt32>(_mm_movemask_epi8(v)); }
+
+  /// Unsigned lo <= v <= hi, through a wrapping subtraction followed by a saturating one.
+  EZ_ALWAYS_INLINE Block InRange(Block v, ezUInt8 lo, ezUInt8 hi)
+  {
+    const Block offset = _mm_sub_epi8(v, _mm_set1_epi8(static_cast<char>(lo)));
+    return _mm_cmpeq_epi8(_mm_subs_epu8(offset, _mm_set1_epi8(static_cast<char>(hi - lo))), _mm_setzero_si128());
+  }
+
+#  define EZ_TEXT_PARSER_SIMD EZ_ON
+
+#elif EZ_SIMD_IMPLEMENTATION == EZ_SIMD_IMPLEMENTATION_NEON
+
+  // NEON has no movemask, every byte is represented by the highest bit of a nibble
+  constexpr ezUInt32 s_uiMaskShift = 2;
+  constexpr ezUInt64 s_uiFullMask = 0x8888888888888888ull;
+
+  using Block = uint8x16_t;
+
+  EZ_ALWAYS_INLINE Block Load(const ezUInt8* p) { return vld1q_u8(p); }
+  EZ_ALWAYS_INLINE Block Equal(Block v, ezUInt8 c) { return vceqq_u8(v, vdupq_n_u8(c)); }
+  EZ_ALWAYS_INLINE Block Or(Block a, Block b) { return vorrq_u8(a, b); }
+  EZ_ALWAYS_INLINE ezUInt64 ToMask(Block v)
+  {
+    const uint8x8_t nibbles = vshrn_n_u16(vreinterpretq_u16_u8(v), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(nibbles), 0) & s_uiFullMask;
+  }
+
+  EZ_ALWAYS_INLINE Block InRange(Block v, ezUInt8 lo, ezUInt8 hi) { return vcleq_u8(vsubq_u8(v, vdupq_n_u8(lo)), vdupq_n_u8(hi - lo)); }
+
+#  define EZ_TEXT_PARSER_SIMD EZ_ON
+
+#else
+
+#  define EZ_TEXT_PARSER_SIMD EZ_OFF
+
+#endif
+
+  EZ_ALWAYS_INLINE bool IsNumberCharacter(ezUInt8 c, bool bFraction, bool bUnderscore)
+  {
+    if (c >= '0' && c <= '9')
+      return true;
+
+    if (bFraction && (c == '.' || c == 'e' || c == 'E' || c == '+' || c == '-'))
+      return true;
+
+    return bUnderscore && c == '_';
+  }
+} // namespace
+
+namespace ezInternal
+{
+  void ezTextParserInput::SetStream(ezStreamReader& ref_stream, ezUInt32 uiFirstLineOffset)
+  {
+    m_pStream = &ref_stream;
+    m_Buffer.SetCountUninitialized(s_uiStreamBufferSize);
+    m_pReadPos = m_Buffer.GetData();
+    m_pReadEnd = m_pReadPos;
+    m_uiLine = 1 + uiFirstLineOffset;
+    m_uiColumn = 0;
+    m_bInitialized = true;
+  }
+
+  void ezTextParserInput::SetMemory(ezArrayPtr<const ezUInt8> data, ezUInt32 uiFirstLineOffset)
+  {
+    m_pStream = nullptr;
+    m_Buffer.Clear();
+    m_pReadPos = data.GetPtr();
+    m_pReadEnd = data.GetEndPtr();
+    m_uiLine = 1 + uiFirstLineOffset;
+    m_uiColumn = 0;
+    m_bInitialized = true;
+  }
+
+  bool ezTextParserInput::Refill()
+  {
+    if (m_pStream == nullptr)
+      return false;
+
+    const ezUInt64 uiRead = m_pStream->ReadBytes(m_Buffer.GetData(), m_Buffer.GetCount());
+
+    m_pReadPos = m_Buffer.GetData();
+    m_pReadEnd = m_pReadPos + uiRead;
+
+    return uiRead > 0;
+  }
+
+  void ezTextParserInput::SkipTo(const ezUInt8* pNewReadPos)
+  {
+    EZ_ASSERT_DEBUG(pNewReadPos >= m_pReadPos && pNewReadPos <= m_pReadEnd, "Invalid read position");
+
+    const ezUInt8* p = m_pReadPos;
+    ezUInt32 uiNewLines = 0;
+
+#if EZ_ENABLED(EZ_TEXT_PARSER_SIMD)
+    for (; pNewReadPos - p >= 16; p += 16)
+    {
+      uiNewLines += ezMath::CountBits(ToMask(Equal(Load(p), '\n')));
+    }
+#endif
+
+    for (; p < pNewReadPos; ++p)
+    {
+      uiNewLines += (*p == '\n') ? 1 : 0;
+    }
+
+    if (uiNewLines == 0)
+    {
+      m_uiColumn += static_cast<ezUInt32>(pNewReadPos - m_pReadPos);
+    }
+    else
+    {
+      // the column restarts after the last line break
+      const ezUInt8* pLastNewLine = pNewReadPos - 1;
+      while (*pLastNewLine != '\n')
+        --pLastNewLine;
+
+      m_uiLine += uiNewLines;
+      m_uiColumn = static_cast<ezUInt32>(pNewReadPos - pLastNewLine - 1);
+    }
+
+    m_pReadPos = pNewReadPos;
+  }
+
+  void ezTextParserInput::SkipWhitespace()
+  {
+    while (true)
+    {
+      const ezUInt8* pEnd = FindNonWhitespace(m_pReadPos, m_pReadEnd);
+      SkipTo(pEnd);
+
+      if (pEnd != m_pReadEnd || !Refill())
+        return;
+    }
+  }
+
+  const ezUInt8* ezTextParserInput::FindNonWhitespace(const ezUInt8* pStart, const ezUInt8* pEnd)
+  {
+    const ezUInt8* p = pStart;
+
+#if EZ_ENABLED(EZ_TEXT_PARSER_SIMD)
+    for (; pEnd - p >= 16; p += 16)
+    {
+      const ezUInt64 uiMask = ToMask(InRange(Load(p), 1, 32)) ^ s_uiFullMask;
+
+      if (uiMask != 0)
+        return p + (ezMath::CountTrailingZeros(uiMask) >> s_uiMaskShift);
+    }
+#endif
+
+    while (p < pEnd && ezStringUtils::IsWhiteSpace(*p))
+      ++p;
+
+    return p;
+  }
+
+  const ezUInt8* ezTextParserInput::FindStringTerminator(const ezUInt8* pStart, const ezUInt8* pEnd)
+  {
+    const ezUInt8* p = pStart;
+
+#if EZ_ENABLED(EZ_TEXT_PARSER_SIMD)
+    for (; pEnd - p >= 16; p += 16)
+    {
+      const Block v = Load(p);
+      const ezUInt64 uiMask = ToMask(Or(Or(Equal(v, '\"'), Equal(v, '\\')), Equal(v, '\0')));
+
+      if (uiMask != 0)
+        return p + (ezMath::CountTrailingZeros(uiMask) >> s_uiMaskShift);
+    }
+#endif
+
+    while (p < pEnd && *p != '\"' && *p != '\\' && *p != '\0')
+      ++p;
+
+    return p;
+  }
+
+  const ezUInt8* ezTextParserInput::FindEndOfNumber(const ezUInt8* pStart, const ezUInt8* pEnd, bool bFraction, bool bUnderscore)
+  {
+    const ezUInt8* p = pStart;
+
+#if EZ_ENABLED(EZ_TEXT_PARSER_SIMD)
+    for (; pEnd - p >= 16; p += 16)
+    {
+      const Block v = Load(p);
+      Block accepted = InRange(v, '0', '9');
+
+      if (bFraction)
+        accepted = Or(Or(Or(accepted, Equal(v, '.')), Or(Equal(v, 'e'), Equal(v, 'E'))), Or(Equal(v, '+'), Equal(v, '-')));
+
+      if (bUnderscore)
+        accepted = Or(accepted, Equal(v, '_'));
+
+      const ezUInt64 uiMask = ToMask(accepted) ^ s_uiFullMask;
+
+      if (uiMask != 0)
+        return p + (ezMath::CountTrailingZeros(uiMask) >> s_uiMaskShift);
+    }
+#endif
+
+    while (p < pEnd && IsNumberCharacter(*p, bFraction, bUnderscore))
+      ++p;
+
+    return p;
+  }
+} // namespace ezInternal
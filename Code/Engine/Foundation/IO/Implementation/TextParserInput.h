@@ -0,0 +1,85 @@
+#pragma once
+
+#include <Foundation/Containers/DynamicArray.h>
+#include <Foundation/IO/Stream.h>
+
+namespace ezInternal
+{
+  /// \brief The input of ezOpenDdlParser and ezJSONParser.
+  ///
+  /// The parsers look at the document one byte at a time, but the bytes are not fetched from the stream one by one.
+  /// They are taken from a contiguous window, which either spans the entire document (SetMemory()) or is a buffer that gets
+  /// refilled from the stream in larger chunks (SetStream()). Since the window is contiguous, the parsers can also scan
+  /// whitespace, strings and numbers in bulk with the Find functions and then jump over them with SkipTo().
+  ///
+  /// Note that in stream mode, more data than the document itself may be read from the stream.
+  class EZ_FOUNDATION_DLL ezTextParserInput
+  {
+  public:
+    void SetStream(ezStreamReader& ref_stream, ezUInt32 uiFirstLineOffset);
+    void SetMemory(ezArrayPtr<const ezUInt8> data, ezUInt32 uiFirstLineOffset);
+
+    bool IsInitialized() const { return m_bInitialized; }
+
+    /// \brief If true, the window spans the entire document and pointers into it stay valid until the parser is done.
+    bool IsMemory() const { return m_pStream == nullptr; }
+
+    /// \brief Returns the next byte or '\0' at the end of the input.
+    EZ_ALWAYS_INLINE ezUInt8 ReadByte()
+    {
+      if (m_pReadPos == m_pReadEnd && !Refill())
+        return '\0';
+
+      const ezUInt8 uiByte = *m_pReadPos++;
+
+      if (uiByte == '\n')
+      {
+        ++m_uiLine;
+        m_uiColumn = 0;
+      }
+      else
+        ++m_uiColumn;
+
+      return uiByte;
+    }
+
+    /// \brief Where the byte that ReadByte() returned last is located in the window.
+    ///
+    /// Only valid directly after ReadByte() returned something other than '\0'.
+    const ezUInt8* GetLastReadByte() const { return m_pReadPos - 1; }
+
+    /// \brief The end of the currently available data.
+    const ezUInt8* GetReadEnd() const { return m_pReadEnd; }
+
+    /// \brief Treats all bytes up to pNewReadPos as read, the line and column are updated accordingly.
+    void SkipTo(const ezUInt8* pNewReadPos);
+
+    /// \brief Skips all whitespace, so that the next ReadByte() returns the first byte that isn't whitespace.
+    void SkipWhitespace();
+
+    ezUInt32 GetLine() const { return m_uiLine; }
+    ezUInt32 GetColumn() const { return m_uiColumn; }
+
+    /// \brief Returns the first byte in the range that is not whitespace (as defined by ezStringUtils::IsWhiteSpace()) or pEnd.
+    static const ezUInt8* FindNonWhitespace(const ezUInt8* pStart, const ezUInt8* pEnd);
+
+    /// \brief Returns the first '"', '\' or '\0' in the range or pEnd.
+    static const ezUInt8* FindStringTerminator(const ezUInt8* pStart, const ezUInt8* pEnd);
+
+    /// \brief Returns the first byte in the range that cannot be part of a number or pEnd.
+    ///
+    /// Digits are always accepted. If bFraction is set, so are '.', 'e', 'E', '+' and '-'. If bUnderscore is set, so is '_'.
+    static const ezUInt8* FindEndOfNumber(const ezUInt8* pStart, const ezUInt8* pEnd, bool bFraction, bool bUnderscore);
+
+  private:
+    bool Refill();
+
+    ezStreamReader* m_pStream = nullptr;
+    ezDynamicArray<ezUInt8> m_Buffer;
+    const ezUInt8* m_pReadPos = nullptr;
+    const ezUInt8* m_pReadEnd = nullptr;
+    ezUInt32 m_uiLine = 1;
+    ezUInt32 m_uiColumn = 0;
+    bool m_bInitialized = false;
+  };
+} // namespace ezInternal
@@ -2,6 +2,7 @@
 
 #include <Foundation/Basics.h>
 #include <Foundation/Containers/HybridArray.h>
+#include <Foundation/IO/Implementation/TextParserInput.h>
 #include <Foundation/IO/Stream.h>
 
 class ezLogInterface;
@@ -24,6 +25,12 @@ protected:
   /// \brief Resets the parser to the start state and configures it to read from the given stream.
   void SetInputStream(ezStreamReader& stream, ezUInt32 uiFirstLineOffset = 0);
 
+  /// \brief Resets the parser to the start state and configures it to read directly from a document in memory.
+  ///
+  /// Strings that contain no escape sequences are passed to OnVariable() and OnReadValue() as views into the given memory,
+  /// so the memory must stay valid until parsing is finished.
+  void SetInputMemory(ezArrayPtr<const ezUInt8> data, ezUInt32 uiFirstLineOffset = 0);
+
   /// \brief Does one parsing step.
   ///
   /// While this function returns true, the document has not been parsed completely.
@@ -122,6 +129,7 @@ private:
     State m_State;
   };
 
+  void BeginInput();
   void StartParsing();
   void SkipWhitespace();
   void SkipString();
@@ -142,12 +150,11 @@ private:
 
   ezUInt8 m_uiCurByte;
   ezUInt8 m_uiNextByte;
-  ezUInt32 m_uiCurLine;
-  ezUInt32 m_uiCurColumn;
 
-  ezStreamReader* m_pInput;
+  ezInternal::ezTextParserInput m_Input;
   ezHybridArray<JSONState, 32> m_StateStack;
   ezHybridArray<ezUInt8, 4096> m_TempString;
+  ezStringView m_sCurrentString; ///< The string that ReadString() read last, either points into m_TempString or directly into the input.
 
   bool m_bSkippingMode;
 };
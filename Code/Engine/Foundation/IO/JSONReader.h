@@ -34,6 +34,12 @@ public:
   /// \note After successful parsing, use GetTopLevelObject() or GetTopLevelArray() to access the data.
   ezResult Parse(ezStreamReader& ref_input, ezUInt32 uiFirstLineOffset = 0);
 
+  /// \brief Same as the stream overload, but parses a JSON document that is entirely in memory.
+  ///
+  /// This is faster than parsing from a stream, e.g. when the file is memory mapped or was already read into memory.
+  /// The memory only needs to stay valid until this function returns.
+  ezResult Parse(ezArrayPtr<const ezUInt8> data, ezUInt32 uiFirstLineOffset = 0);
+
   /// \brief Returns the top-level object of the JSON document.
   const ezVariantDictionary& GetTopLevelObject() const { return m_Stack.PeekBack().m_Dictionary; }
 
@@ -44,6 +50,8 @@ public:
   ElementType GetTopLevelElementType() const { return m_Stack.PeekBack().m_Mode; }
 
 private:
+  ezResult ParseInput();
+
   /// \brief This function can be overridden to skip certain variables, however the overriding function must still call this.
   virtual bool OnVariable(ezStringView sVarName) override;
 
@@ -3,6 +3,7 @@
 #include <Foundation/Basics.h>
 #include <Foundation/Containers/DynamicArray.h>
 #include <Foundation/Containers/HybridArray.h>
+#include <Foundation/IO/Implementation/TextParserInput.h>
 #include <Foundation/IO/Stream.h>
 
 class ezLogInterface;
@@ -59,6 +60,12 @@ protected:
   /// \brief Configures the parser to read from the given stream. This can only be called once on a parser instance.
   void SetInputStream(ezStreamReader& stream, ezUInt32 uiFirstLineOffset = 0); // [tested]
 
+  /// \brief Configures the parser to read directly from a document in memory, for example a memory mapped file.
+  ///
+  /// This is faster than reading from a stream, since strings are passed to OnPrimitiveString() as views into the given memory,
+  /// instead of being copied. The memory must stay valid until parsing is finished. This can only be called once on a parser instance.
+  void SetInputMemory(ezArrayPtr<const ezUInt8> data, ezUInt32 uiFirstLineOffset = 0);
+
   /// \brief Parses the next portion of the document and triggers appropriate callbacks
   ///
   /// Returns false when the end of the document has been reached or a fatal parsing error occurred.
@@ -175,6 +182,7 @@ private:
     State m_State;
   };
 
+  void BeginInput();
   void ReadNextByte();
   bool ReadCharacter();
   bool ReadCharacterSkipComments();
@@ -196,21 +204,20 @@ private:
   void ReadHexString();
 
   ezHybridArray<DdlState, 32> m_StateStack;
-  ezStreamReader* m_pInput;
+  ezInternal::ezTextParserInput m_Input;
   ezDynamicArray<ezUInt8> m_Cache;
 
   static constexpr ezUInt32 s_uiMaxIdentifierLength = 64;
 
   ezUInt8 m_uiCurByte;
   ezUInt8 m_uiNextByte;
-  ezUInt32 m_uiCurLine;
-  ezUInt32 m_uiCurColumn;
   bool m_bSkippingMode;
   bool m_bHadFatalParsingError;
   ezUInt8 m_szIdentifierType[s_uiMaxIdentifierLength];
   ezUInt8 m_szIdentifierName[s_uiMaxIdentifierLength];
   ezDynamicArray<ezUInt8> m_TempString;
   ezUInt32 m_uiTempStringLength;
+  ezStringView m_sCurrentString; ///< The string that ReadString() read last, either points into m_TempString or directly into the input.
 
   ezUInt32 m_uiNumCachedPrimitives;
   bool* m_pBoolCache;
@@ -146,6 +146,14 @@ public:
   ezResult ParseDocument(ezStreamReader& inout_stream, ezUInt32 uiFirstLineOffset = 0, ezLogInterface* pLog = ezLog::GetThreadLocalLogSystem(),
     ezUInt32 uiCacheSizeInKB = 4); // [tested]
 
+  /// \brief Parses an OpenDDL document that is entirely in memory, e.g. a memory mapped file.
+  ///
+  /// This is faster than parsing from a stream, since the document does not need to be copied byte by byte.
+  /// All strings are copied into the reader, so the memory only needs to stay valid until this function returns.
+  /// The parameters are the same as for the stream overload.
+  ezResult ParseDocument(ezArrayPtr<const ezUInt8> data, ezUInt32 uiFirstLineOffset = 0, ezLogInterface* pLog = ezLog::GetThreadLocalLogSystem(),
+    ezUInt32 uiCacheSizeInKB = 4);
+
   /// \brief Every document has exactly one root element.
   const ezOpenDdlReaderElement* GetRootElement() const; // [tested]
 
@@ -179,6 +187,7 @@ protected:
   virtual void OnParsingError(ezStringView sMessage, bool bFatal, ezUInt32 uiLine, ezUInt32 uiColumn) override;
 
 protected:
+  ezResult ParseWithRootElement();
   ezOpenDdlReaderElement* CreateElement(ezOpenDdlPrimitiveType type, ezStringView sType, ezStringView sName, bool bGlobalName);
   ezStringView CopyString(const ezStringView& string);
   void StorePrimitiveData(bool bThisIsAll, ezUInt32 bytecount, const ezUInt8* pData);
@@ -0,0 +1,347 @@
+#include <Foundation/FoundationPCH.h>
+
+#include <Foundation/Configuration/Startup.h>
+#include <Foundation/Logging/Log.h>
+#include <Foundation/Threading/Thread.h>
+#include <Foundation/Threading/ThreadSignal.h>
+#include <Foundation/Types/ScopeExit.h>
+
+class ezAsyncLogThread;
+
+// clang-format off
+EZ_BEGIN_SUBSYSTEM_DECLARATION(Foundation, AsyncLog)
+
+  BEGIN_SUBSYSTEM_DEPENDENCIES
+    "ThreadUtils"
+  END_SUBSYSTEM_DEPENDENCIES
+
+  ON_CORESYSTEMS_SHUTDOWN
+  {
+    ezGlobalLog::DisableAsyncMode();
+  }
+
+EZ_END_SUBSYSTEM_DECLARATION;
+// clang-format on
+
+namespace
+{
+  /// One entry of the message queue. The text and the tag of a message are stored back to back in m_sData, the builder keeps its
+  /// memory when the slot is reused, so only unusually long messages allocate.
+  struct AsyncLogSlot
+  {
+    /// Bounded multi-producer queue as described by Dmitry Vyukov: a slot can be written when its sequence equals the enqueue position and
+    /// read once it is one larger. After reading, the sequence is advanced by the capacity of the queue, which makes the slot writable
+    /// in the next round.
+    ezAtomicInteger64 m_iSequence;
+
+    ezLogMsgType::Enum m_EventType = ezLogMsgType::None;
+    ezUInt8 m_uiIndentation = 0;
+    ezUInt32 m_uiTextLength = 0;
+#if EZ_ENABLED(EZ_COMPILE_FOR_DEVELOPMENT)
+    double m_fSeconds = 0;
+#endif
+    ezStringBuilder m_sData;
+  };
+
+  struct AsyncLogState
+  {
+    ezAtomicBool m_bEnabled;
+    ezAtomicInteger32 m_iActiveProducers;
+    ezAtomicInteger64 m_iEnqueuePos;
+    ezAtomicInteger32 m_iDiscardedMessages;
+    ezAtomicInteger32 m_iDiscardedMessagesTotal;
+
+    ezAsyncLogSettings::OverflowPolicy m_OverflowPolicy = ezAsyncLogSettings::OverflowPolicy::Block;
+    ezUInt64 m_uiMask = 0;
+    ezDynamicArray<AsyncLogSlot> m_Slots;
+
+    /// Only accessed by the thread that holds m_DispatchMutex.
+    ezUInt64 m_uiDequeuePos = 0;
+    ezMutex m_DispatchMutex;
+
+    ezAsyncLogThread* m_pThread = nullptr;
+    ezThreadSignal m_WakeUp;
+    ezAtomicBool m_bWriterSleeping;
+    ezAtomicBool m_bQuit;
+  };
+
+  AsyncLogState s_AsyncLog;
+
+  /// Messages that are logged while passing messages to the log writers are not queued, otherwise that thread could wait for itself.
+  thread_local bool s_bIsDispatchingAsyncMessages = false;
+
+  void WakeUpWriter()
+  {
+    if (s_AsyncLog.m_bWriterSleeping.Set(false))
+    {
+      s_AsyncLog.m_WakeUp.RaiseSignal();
+    }
+  }
+
+  bool TryPush(const ezLoggingEventData& le)
+  {
+    ezInt64 iPos = s_AsyncLog.m_iEnqueuePos;
+    AsyncLogSlot* pSlot = nullptr;
+
+    while (true)
+    {
+      pSlot = &s_AsyncLog.m_Slots[static_cast<ezUInt32>(iPos & s_AsyncLog.m_uiMask)];
+      const ezInt64 iDiff = static_cast<ezInt64>(pSlot->m_iSequence) - iPos;
+
+      if (iDiff == 0)
+      {
+        if (s_AsyncLog.m_iEnqueuePos.TestAndSet(iPos, iPos + 1))
+          break;
+      }
+      else if (iDiff < 0)
+      {
+        // the slot from the previous round has not been read yet
+        return false;
+      }
+
+      iPos = s_AsyncLog.m_iEnqueuePos;
+    }
+
+    pSlot->m_EventType = le.m_EventType;
+    pSlot->m_uiIndentation = le.m_uiIndentation;
+    pSlot->m_uiTextLength = le.m_sText.GetElementCount();
+#if EZ_ENABLED(EZ_COMPILE_FOR_DEVELOPMENT)
+    pSlot->m_fSeconds = le.m_fSeconds;
+#endif
+    pSlot->m_sData.Set(le.m_sText, le.m_sTag);
+
+    pSlot->m_iSequence = iPos + 1;
+    return true;
+  }
+} // namespace
+
+class ezAsyncLogThread : public ezThread
+{
+public:
+  ezAsyncLogThread()
+    : ezThread("ezAsyncLog")
+  {
+  }
+
+private:
+  virtual ezUInt32 Run() override
+  {
+    while (true)
+    {
+      ezGlobalLog::DispatchAsyncMessages();
+
+      if (s_AsyncLog.m_bQuit)
+        return 0;
+
+      s_AsyncLog.m_bWriterSleeping = true;
+
+      // a message might have been queued before the flag was set, in which case nobody would wake us up
+      const AsyncLogSlot& nextSlot = s_AsyncLog.m_Slots[static_cast<ezUInt32>(s_AsyncLog.m_uiDequeuePos & s_AsyncLog.m_uiMask)];
+      if (static_cast<ezInt64>(nextSlot.m_iSequence) == static_cast<ezInt64>(s_AsyncLog.m_uiDequeuePos + 1) || s_AsyncLog.m_iDiscardedMessages > 0)
+      {
+        s_AsyncLog.m_bWriterSleeping = false;
+        continue;
+      }
+
+      // the timeout is only a safety net, producers wake up the thread
+      s_AsyncLog.m_WakeUp.WaitForSignal(ezTime::MakeFromMilliseconds(100));
+      s_AsyncLog.m_bWriterSleeping = false;
+    }
+  }
+};
+
+void ezGlobalLog::EnableAsyncMode(const ezAsyncLogSettings& settings)
+{
+  if (s_AsyncLog.m_bEnabled)
+    return;
+
+  const ezUInt32 uiCapacity = ezMath::PowerOfTwo_Ceil(ezMath::Max(settings.m_uiQueueCapacity, 2u));
+
+  s_AsyncLog.m_Slots.SetCount(uiCapacity);
+  for (ezUInt32 i = 0; i < uiCapacity; ++i)
+  {
+    s_AsyncLog.m_Slots[i].m_iSequence = i;
+  }
+
+  s_AsyncLog.m_uiMask = uiCapacity - 1;
+  s_AsyncLog.m_iEnqueuePos = 0;
+  s_AsyncLog.m_uiDequeuePos = 0;
+  s_AsyncLog.m_iDiscardedMessages = 0;
+  s_AsyncLog.m_iDiscardedMessagesTotal = 0;
+  s_AsyncLog.m_OverflowPolicy = settings.m_OverflowPolicy;
+  s_AsyncLog.m_bQuit = false;
+  s_AsyncLog.m_bWriterSleeping = false;
+
+  s_AsyncLog.m_pThread = EZ_DEFAULT_NEW(ezAsyncLogThread);
+  s_AsyncLog.m_pThread->Start();
+
+  s_AsyncLog.m_bEnabled = true;
+}
+
+void ezGlobalLog::DisableAsyncMode()
+{
+  if (!s_AsyncLog.m_bEnabled)
+    return;
+
+  s_AsyncLog.m_bEnabled = false;
+
+  // threads that already decided to queue their message may still be writing it
+  while (s_AsyncLog.m_iActiveProducers > 0)
+  {
+    ezThreadUtils::YieldTimeSlice();
+  }
+
+  s_AsyncLog.m_bQuit = true;
+  s_AsyncLog.m_WakeUp.RaiseSignal();
+  s_AsyncLog.m_pThread->Join();
+  EZ_DEFAULT_DELETE(s_AsyncLog.m_pThread);
+
+  // the thread dispatches everything before it quits, this only catches what a log writer logged in the meantime
+  DispatchAsyncMessages();
+
+  s_AsyncLog.m_Slots.Clear();
+  s_AsyncLog.m_Slots.Compact();
+}
+
+bool ezGlobalLog::IsAsyncModeEnabled()
+{
+  return s_AsyncLog.m_bEnabled;
+}
+
+void ezGlobalLog::FlushAsyncMessages()
+{
+  if (!s_AsyncLog.m_bEnabled || s_bIsDispatchingAsyncMessages)
+    return;
+
+  DispatchAsyncMessages();
+}
+
+void ezGlobalLog::FlushAsyncMessagesAfterCrash()
+{
+  if (!s_AsyncLog.m_bEnabled || s_bIsDispatchingAsyncMessages)
+    return;
+
+  // the writer thread might be in the middle of passing on a batch, but it could also be stuck, so don't wait forever
+  for (ezUInt32 uiAttempt = 0; uiAttempt < 100; ++uiAttempt)
+  {
+    if (s_AsyncLog.m_DispatchMutex.TryLock().Succeeded())
+    {
+      // keep holding the lock, otherwise the writer thread could grab it again in between (the mutex is recursive)
+      EZ_SCOPE_EXIT(s_AsyncLog.m_DispatchMutex.Unlock());
+
+      DispatchAsyncMessages();
+
+      ezLoggingEventData le;
+      le.m_EventType = ezLogMsgType::Flush;
+      s_LoggingEvent.Broadcast(le);
+      return;
+    }
+
+    ezThreadUtils::Sleep(ezTime::MakeFromMilliseconds(5));
+  }
+}
+
+ezUInt32 ezGlobalLog::GetNumDiscardedAsyncMessages()
+{
+  return static_cast<ezUInt32>(s_AsyncLog.m_iDiscardedMessagesTotal);
+}
+
+bool ezGlobalLog::EnqueueAsyncMessage(const ezLoggingEventData& le)
+{
+  if (!s_AsyncLog.m_bEnabled || s_bIsDispatchingAsyncMessages)
+    return false;
+
+  s_AsyncLog.m_iActiveProducers.Increment();
+  EZ_SCOPE_EXIT(s_AsyncLog.m_iActiveProducers.Decrement());
+
+  // checked again, DisableAsyncMode() waits for all active producers after switching this off
+  if (!s_AsyncLog.m_bEnabled)
+    return false;
+
+  while (!TryPush(le))
+  {
+    switch (s_AsyncLog.m_OverflowPolicy)
+    {
+      case ezAsyncLogSettings::OverflowPolicy::Block:
+        WakeUpWriter();
+        ezThreadUtils::YieldTimeSlice();
+        break;
+
+      case ezAsyncLogSettings::OverflowPolicy::Discard:
+        s_AsyncLog.m_iDiscardedMessages.Increment();
+        s_AsyncLog.m_iDiscardedMessagesTotal.Increment();
+        WakeUpWriter();
+        return true;
+
+      case ezAsyncLogSettings::OverflowPolicy::Synchronous:
+      {
+        // the message still goes through the queue, passing it on directly would let it overtake earlier ones from the same thread
+        EZ_LOCK(s_AsyncLog.m_DispatchMutex);
+
+        while (true)
+        {
+          DispatchAsyncMessages();
+
+          if (TryPush(le))
+          {
+            DispatchAsyncMessages();
+            return true;
+          }
+
+          // another thread is still writing the message at the front of the queue
+          ezThreadUtils::YieldTimeSlice();
+        }
+      }
+    }
+  }
+
+  WakeUpWriter();
+  return true;
+}
+
+void ezGlobalLog::DispatchAsyncMessages()
+{
+  EZ_LOCK(s_AsyncLog.m_DispatchMutex);
+
+  if (s_AsyncLog.m_Slots.IsEmpty())
+    return;
+
+  s_bIsDispatchingAsyncMessages = true;
+  EZ_SCOPE_EXIT(s_bIsDispatchingAsyncMessages = false);
+
+  while (true)
+  {
+    AsyncLogSlot& slot = s_AsyncLog.m_Slots[static_cast<ezUInt32>(s_AsyncLog.m_uiDequeuePos & s_AsyncLog.m_uiMask)];
+
+    if (static_cast<ezInt64>(slot.m_iSequence) != static_cast<ezInt64>(s_AsyncLog.m_uiDequeuePos + 1))
+      break;
+
+    const ezStringView sData = slot.m_sData;
+
+    ezLoggingEventData le;
+    le.m_EventType = slot.m_EventType;
+    le.m_uiIndentation = slot.m_uiIndentation;
+    le.m_sText = ezStringView(sData.GetStartPointer(), slot.m_uiTextLength);
+    le.m_sTag = ezStringView(sData.GetStartPointer() + slot.m_uiTextLength, sData.GetEndPointer());
+#if EZ_ENABLED(EZ_COMPILE_FOR_DEVELOPMENT)
+    le.m_fSeconds = slot.m_fSeconds;
+#endif
+
+    s_LoggingEvent.Broadcast(le);
+
+    slot.m_iSequence = static_cast<ezInt64>(s_AsyncLog.m_uiDequeuePos + s_AsyncLog.m_Slots.GetCount());
+    ++s_AsyncLog.m_uiDequeuePos;
+  }
+
+  if (const ezInt32 iDiscarded = s_AsyncLog.m_iDiscardedMessages.Set(0); iDiscarded > 0)
+  {
+    ezStringBuilder sText;
+    sText.SetFormat("{} log messages were discarded, because the asynchronous log queue was full.", iDiscarded);
+
+    ezLoggingEventData le;
+    le.m_EventType = ezLogMsgType::WarningMsg;
+    le.m_sText = sText;
+
+    s_LoggingEvent.Broadcast(le);
+  }
+}
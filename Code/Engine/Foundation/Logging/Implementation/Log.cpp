@@ -30,6 +30,9 @@ static thread_local ezLogInterface* s_DefaultLogSystem = nullptr;
 
 ezEventSubscriptionID ezGlobalLog::AddLogWriter(ezLoggingEvent::Handler handler)
 {
+  // messages that were queued before should not show up in the new writer
+  FlushAsyncMessages();
+
   if (s_LoggingEvent.HasEventHandler(handler))
     return 0;
 
@@ -38,6 +41,8 @@ ezEventSubscriptionID ezGlobalLog::AddLogWriter(ezLoggingEvent::Handler handler)
 
 void ezGlobalLog::RemoveLogWriter(ezLoggingEvent::Handler handler)
 {
+  FlushAsyncMessages();
+
   if (!s_LoggingEvent.HasEventHandler(handler))
     return;
 
@@ -46,6 +51,8 @@ void ezGlobalLog::RemoveLogWriter(ezLoggingEvent::Handler handler)
 
 void ezGlobalLog::RemoveLogWriter(ezEventSubscriptionID& ref_subscriptionID)
 {
+  FlushAsyncMessages();
+
   s_LoggingEvent.RemoveEventHandler(ref_subscriptionID);
 }
 
@@ -94,6 +101,10 @@ void ezGlobalLog::HandleLogMessage(const ezLoggingEventData& le)
       ezLog::Print(stmp);
     }
 #endif
+
+    if (EnqueueAsyncMessage(le))
+      return;
+
     s_LoggingEvent.Broadcast(le);
   }
 }
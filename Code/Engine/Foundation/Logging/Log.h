@@ -110,6 +110,23 @@ public:
 };
 
 
+/// \brief Configures the asynchronous mode of ezGlobalLog. See ezGlobalLog::EnableAsyncMode().
+struct ezAsyncLogSettings
+{
+  /// \brief What happens to a message when the queue is full.
+  enum class OverflowPolicy : ezUInt8
+  {
+    Block,       ///< The logging thread waits until the writer thread has made room in the queue. No message is lost.
+    Discard,     ///< The message is dropped. The number of dropped messages is reported through the log writers later.
+    Synchronous, ///< The logging thread passes all queued messages, including its own, on to the log writers itself.
+  };
+
+  /// \brief How many messages can be queued up, rounded up to the next power of two.
+  ezUInt32 m_uiQueueCapacity = 1024;
+
+  OverflowPolicy m_OverflowPolicy = OverflowPolicy::Block;
+};
+
 /// \brief This is the standard log system that ezLog sends all messages to.
 ///
 /// It allows to register log writers, such that you can be informed of all log messages and write them
@@ -139,7 +156,51 @@ public:
   /// override is set at the moment.
   static void SetGlobalLogOverride(ezLogInterface* pInterface);
 
+  /// \brief Switches ezGlobalLog to asynchronous mode.
+  ///
+  /// By default every message is passed to all log writers on the thread that logs it, so a slow log writer (e.g. one doing file I/O)
+  /// stalls that thread and every other thread that logs at the same time. In asynchronous mode messages are copied into a bounded
+  /// lock-free queue instead and a background thread passes them on to the log writers. The order of messages logged on the same thread
+  /// is preserved. What happens when the queue is full is configured through ezAsyncLogSettings::m_OverflowPolicy.
+  ///
+  /// Log writers that are registered while asynchronous mode is active are only ever called by one thread at a time, but not necessarily
+  /// always the same one, since FlushAsyncMessages() passes the queued messages on directly.
+  ///
+  /// This must not be called concurrently with DisableAsyncMode().
+  static void EnableAsyncMode(const ezAsyncLogSettings& settings = {});
+
+  /// \brief Passes all queued messages to the log writers, stops the background thread and returns to synchronous mode.
+  ///
+  /// This is also done automatically when the core systems are shut down.
+  static void DisableAsyncMode();
+
+  /// \brief Whether EnableAsyncMode() is active.
+  static bool IsAsyncModeEnabled();
+
+  /// \brief Passes all messages that are queued up at this point to the log writers before returning. Does nothing in synchronous mode.
+  ///
+  /// Log writers are removed through RemoveLogWriter() only after this was done, so that they receive everything that was logged before.
+  static void FlushAsyncMessages();
+
+  /// \brief Called by the crash handler to get as many queued messages as possible to the log writers before the process dies.
+  ///
+  /// Messages that are still in the queue when the process dies would otherwise be lost, which usually includes the ones that explain the
+  /// crash. Unlike FlushAsyncMessages() this gives up after a short time, in case the background thread got stuck or is the one that
+  /// crashed.
+  static void FlushAsyncMessagesAfterCrash();
+
+  /// \brief Returns how many messages were dropped due to ezAsyncLogSettings::OverflowPolicy::Discard since asynchronous mode was enabled.
+  static ezUInt32 GetNumDiscardedAsyncMessages();
+
 private:
+  friend class ezAsyncLogThread;
+
+  /// \brief Returns false, if the message was not queued and has to be passed to the log writers directly.
+  static bool EnqueueAsyncMessage(const ezLoggingEventData& le);
+
+  /// \brief Passes all queued messages to the log writers. Only one thread at a time does this.
+  static void DispatchAsyncMessages();
+
   /// \brief Counts the number of messages of each type.
   static ezAtomicInteger32 s_uiMessageCount[ezLogMsgType::ENUM_COUNT];
 
@@ -98,6 +98,16 @@ public:
   /// \brief Returns a const iterator for traversing objects in a specified range.
   ConstIterator GetIterator(ezUInt32 uiStartIndex = 0, ezUInt32 uiCount = ezInvalidIndex) const;
 
+  /// \brief Returns the index of the given object, or ezInvalidIndex if it is not stored in this container.
+  ///
+  /// This searches through all blocks, so the cost is linear in the number of blocks.
+  ezUInt32 GetIndex(const T* pObject) const;
+
+  /// \brief Returns the objects starting at uiStartIndex up to the end of the block that contains them, but at most uiMaxCount objects.
+  ///
+  /// Only available for Compact storage, where all objects in a block are stored without gaps.
+  ezArrayPtr<T> GetContiguousRange(ezUInt32 uiStartIndex, ezUInt32 uiMaxCount = ezInvalidIndex) const;
+
 private:
   void Delete(T* pObject, T*& out_pMovedObject, ezTraitInt<ezBlockStorageType::Compact>);
   void Delete(T* pObject, T*& out_pMovedObject, ezTraitInt<ezBlockStorageType::FreeList>);
@@ -225,6 +225,38 @@ EZ_ALWAYS_INLINE typename ezBlockStorage<T, BlockSize, StorageType>::ConstIterat
   return ConstIterator(*this, uiStartIndex, uiCount);
 }
 
+template <typename T, ezUInt32 BlockSize, ezBlockStorageType::Enum StorageType>
+ezUInt32 ezBlockStorage<T, BlockSize, StorageType>::GetIndex(const T* pObject) const
+{
+  for (ezUInt32 uiBlockIndex = 0; uiBlockIndex < m_Blocks.GetCount(); ++uiBlockIndex)
+  {
+    std::ptrdiff_t diff = pObject - m_Blocks[uiBlockIndex].m_pData;
+    if (diff >= 0 && diff < ezDataBlock<T, BlockSize>::CAPACITY)
+    {
+      return uiBlockIndex * ezDataBlock<T, BlockSize>::CAPACITY + (ezInt32)diff;
+    }
+  }
+
+  return ezInvalidIndex;
+}
+
+template <typename T, ezUInt32 BlockSize, ezBlockStorageType::Enum StorageType>
+ezArrayPtr<T> ezBlockStorage<T, BlockSize, StorageType>::GetContiguousRange(ezUInt32 uiStartIndex, ezUInt32 uiMaxCount /*= ezInvalidIndex*/) const
+{
+  static_assert(StorageType == ezBlockStorageType::Compact, "Contiguous ranges are only available for compact block storage");
+
+  if (uiStartIndex >= m_uiCount)
+    return ezArrayPtr<T>();
+
+  const ezUInt32 uiBlockIndex = uiStartIndex / ezDataBlock<T, BlockSize>::CAPACITY;
+  const ezUInt32 uiInnerIndex = uiStartIndex - uiBlockIndex * ezDataBlock<T, BlockSize>::CAPACITY;
+
+  const ezDataBlock<T, BlockSize>& block = m_Blocks[uiBlockIndex];
+  const ezUInt32 uiCount = ezMath::Min(block.m_uiCount - uiInnerIndex, uiMaxCount);
+
+  return ezArrayPtr<T>(block.m_pData + uiInnerIndex, uiCount);
+}
+
 template <typename T, ezUInt32 BlockSize, ezBlockStorageType::Enum StorageType>
 EZ_FORCE_INLINE void ezBlockStorage<T, BlockSize, StorageType>::Delete(T* pObject, T*& out_pMovedObject, ezTraitInt<ezBlockStorageType::Compact>)
 {
@@ -253,18 +285,16 @@ EZ_FORCE_INLINE void ezBlockStorage<T, BlockSize, StorageType>::Delete(T* pObjec
 template <typename T, ezUInt32 BlockSize, ezBlockStorageType::Enum StorageType>
 EZ_FORCE_INLINE void ezBlockStorage<T, BlockSize, StorageType>::Delete(T* pObject, T*& out_pMovedObject, ezTraitInt<ezBlockStorageType::FreeList>)
 {
-  ezUInt32 uiIndex = ezInvalidIndex;
-  for (ezUInt32 uiBlockIndex = 0; uiBlockIndex < m_Blocks.GetCount(); ++uiBlockIndex)
-  {
-    std::ptrdiff_t diff = pObject - m_Blocks[uiBlockIndex].m_pData;
-    if (diff >= 0 && diff < ezDataBlock<T, BlockSize>::CAPACITY)
-    {
-      uiIndex = uiBlockIndex * ezDataBlock<T, BlockSize>::CAPACITY + (ezInt32)diff;
-      break;
-    }
-  }
+  out_pMovedObject = nullptr;
 
+  const ezUInt32 uiIndex = GetIndex(pObject);
   EZ_ASSERT_DEV(uiIndex != ezInvalidIndex, "Invalid object {0} was not found in block storage.", ezArgP(pObject));
+  if (uiIndex == ezInvalidIndex)
+    return;
+
+  EZ_ASSERT_DEV(m_UsedEntries.IsBitSet(uiIndex), "Object {0} has already been deleted.", ezArgP(pObject));
+  if (!m_UsedEntries.IsBitSet(uiIndex))
+    return;
 
   m_UsedEntries.ClearBit(uiIndex);
 
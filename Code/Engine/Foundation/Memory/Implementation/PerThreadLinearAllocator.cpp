@@ -0,0 +1,195 @@
+#include <Foundation/FoundationPCH.h>
+
+#include <Foundation/Containers/StaticArray.h>
+#include <Foundation/Memory/MemoryTracker.h>
+#include <Foundation/Memory/PerThreadLinearAllocator.h>
+#include <Foundation/Threading/Lock.h>
+
+namespace
+{
+  // Thread indices are shared by all instances, so a thread uses the same arena slot in every per-thread allocator.
+  // The index of an exited thread is handed out again, otherwise an application that keeps starting new threads would
+  // eventually send all of them to the overflow arena.
+  ezMutex s_ThreadIndexMutex;
+  ezUInt32 s_uiNextThreadIndex = 0;                                                          // protected by s_ThreadIndexMutex
+  ezStaticArray<ezUInt32, ezPerThreadLinearAllocator::MaxThreadArenas> s_FreeThreadIndices; // protected by s_ThreadIndexMutex
+
+  struct ThreadIndex
+  {
+    ~ThreadIndex()
+    {
+      // threads that use the overflow arena don't own an index
+      if (m_uiIndex >= ezPerThreadLinearAllocator::MaxThreadArenas)
+        return;
+
+      EZ_LOCK(s_ThreadIndexMutex);
+      s_FreeThreadIndices.PushBack(m_uiIndex);
+    }
+
+    ezUInt32 m_uiIndex = ezInvalidIndex;
+  };
+
+  thread_local ThreadIndex tl_ThreadIndex;
+
+  EZ_ALWAYS_INLINE ezUInt32 GetThreadIndex()
+  {
+    if (tl_ThreadIndex.m_uiIndex == ezInvalidIndex)
+    {
+      EZ_LOCK(s_ThreadIndexMutex);
+
+      if (!s_FreeThreadIndices.IsEmpty())
+      {
+        tl_ThreadIndex.m_uiIndex = s_FreeThreadIndices.PeekBack();
+        s_FreeThreadIndices.PopBack();
+      }
+      else if (s_uiNextThreadIndex < ezPerThreadLinearAllocator::MaxThreadArenas)
+      {
+        tl_ThreadIndex.m_uiIndex = s_uiNextThreadIndex++;
+      }
+      else
+      {
+        tl_ThreadIndex.m_uiIndex = ezPerThreadLinearAllocator::MaxThreadArenas;
+      }
+    }
+
+    return tl_ThreadIndex.m_uiIndex;
+  }
+} // namespace
+
+ezPerThreadLinearAllocator::ezPerThreadLinearAllocator(ezStringView sName, ezAllocator* pParent)
+  : m_pParent(pParent)
+{
+  m_Id = ezMemoryTracker::RegisterAllocator(sName, ezAllocatorTrackingMode::Basics, pParent != nullptr ? pParent->GetId() : ezAllocatorId());
+}
+
+ezPerThreadLinearAllocator::~ezPerThreadLinearAllocator()
+{
+  Reset();
+
+  for (Arena*& pArena : m_Arenas)
+  {
+    EZ_DELETE(m_pParent, pArena);
+  }
+
+  ezMemoryTracker::DeregisterAllocator(m_Id);
+}
+
+void* ezPerThreadLinearAllocator::Allocate(size_t uiSize, size_t uiAlign, ezMemoryUtils::DestructorFunction destructorFunc)
+{
+  const ezUInt32 uiThreadIndex = GetThreadIndex();
+
+  if (uiThreadIndex < MaxThreadArenas)
+  {
+    return AllocateFromArena(uiThreadIndex, uiSize, uiAlign, destructorFunc);
+  }
+
+  EZ_LOCK(m_OverflowArenaMutex);
+  return AllocateFromArena(MaxThreadArenas, uiSize, uiAlign, destructorFunc);
+}
+
+void ezPerThreadLinearAllocator::Deallocate(void* pPtr)
+{
+  if (pPtr == nullptr)
+    return;
+
+  // The memory itself is only released on Reset, we just need to make sure the destructor isn't called a second time.
+  AllocationHeader* pHeader = static_cast<AllocationHeader*>(pPtr) - 1;
+  if (pHeader->m_pDestructData != nullptr)
+  {
+    pHeader->m_pDestructData->m_Func = nullptr;
+  }
+}
+
+size_t ezPerThreadLinearAllocator::AllocatedSize(const void* pPtr)
+{
+  const AllocationHeader* pHeader = static_cast<const AllocationHeader*>(pPtr) - 1;
+  return pHeader->m_uiSize;
+}
+
+ezAllocatorId ezPerThreadLinearAllocator::GetId() const
+{
+  return m_Id;
+}
+
+ezAllocator::Stats ezPerThreadLinearAllocator::GetStats() const
+{
+  return ezMemoryTracker::GetAllocatorStats(m_Id);
+}
+
+void ezPerThreadLinearAllocator::Reset()
+{
+  ezUInt64 uiUsedMemory = 0;
+
+  ezAllocator::Stats stats;
+
+  for (Arena* pArena : m_Arenas)
+  {
+    if (pArena == nullptr)
+      continue;
+
+    // The list is in reverse allocation order, so objects are destructed in reverse order of their construction.
+    for (DestructData* pData = pArena->m_pFirstDestructData; pData != nullptr; pData = pData->m_pNext)
+    {
+      if (pData->m_Func != nullptr)
+      {
+        pData->m_Func(pData->m_pPtr);
+      }
+    }
+
+    uiUsedMemory += pArena->m_uiUsedMemory;
+
+    ezAllocator::Stats arenaStats;
+    pArena->m_Allocator.FillStats(arenaStats);
+    stats.m_uiNumAllocations += arenaStats.m_uiNumAllocations;
+    stats.m_uiAllocationSize += arenaStats.m_uiAllocationSize;
+
+    pArena->m_pFirstDestructData = nullptr;
+    pArena->m_uiUsedMemory = 0;
+    pArena->m_Allocator.Reset();
+  }
+
+  m_uiUsedMemoryBeforeLastReset = uiUsedMemory;
+  m_uiHighWaterMark = ezMath::Max(m_uiHighWaterMark, uiUsedMemory);
+
+  stats.m_uiPerFrameAllocationSize = uiUsedMemory;
+  ezMemoryTracker::SetAllocatorStats(m_Id, stats);
+}
+
+void* ezPerThreadLinearAllocator::AllocateFromArena(ezUInt32 uiArenaIndex, size_t uiSize, size_t uiAlign, ezMemoryUtils::DestructorFunction destructorFunc)
+{
+  EZ_ASSERT_DEV(uiAlign <= alignof(AllocationHeader), "Unsupported alignment {0}", ((ezUInt32)uiAlign));
+  EZ_IGNORE_UNUSED(uiAlign);
+
+  // Only the owning thread (or the thread holding the overflow mutex) ever writes to this slot.
+  Arena* pArena = m_Arenas[uiArenaIndex];
+  if (pArena == nullptr)
+  {
+    pArena = EZ_NEW(m_pParent, Arena, m_pParent);
+    m_Arenas[uiArenaIndex] = pArena;
+  }
+
+  const size_t uiTotalSize = ezMemoryUtils::AlignSize(sizeof(AllocationHeader) + uiSize, alignof(AllocationHeader));
+
+  AllocationHeader* pHeader = static_cast<AllocationHeader*>(pArena->m_Allocator.Allocate(uiTotalSize, alignof(AllocationHeader)));
+  pHeader->m_pDestructData = nullptr;
+  pHeader->m_uiSize = uiSize;
+
+  void* pPtr = pHeader + 1;
+
+  pArena->m_uiUsedMemory += uiTotalSize;
+
+  if (destructorFunc != nullptr)
+  {
+    DestructData* pData = static_cast<DestructData*>(pArena->m_Allocator.Allocate(sizeof(DestructData), alignof(AllocationHeader)));
+    pData->m_Func = destructorFunc;
+    pData->m_pPtr = pPtr;
+    pData->m_pNext = pArena->m_pFirstDestructData;
+
+    pArena->m_pFirstDestructData = pData;
+    pArena->m_uiUsedMemory += ezMemoryUtils::AlignSize(sizeof(DestructData), alignof(AllocationHeader));
+
+    pHeader->m_pDestructData = pData;
+  }
+
+  return pPtr;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <Foundation/Memory/Allocator.h>
+#include <Foundation/Memory/Policies/AllocPolicyLinear.h>
+#include <Foundation/Threading/Mutex.h>
+
+/// \brief Linear allocator that gives every thread its own arena, so that allocations never take a lock.
+///
+/// ezLinearAllocator serializes all allocations through a mutex, which becomes a bottleneck when many worker threads
+/// allocate short-lived data at the same time (e.g. during render data extraction). This allocator instead hands
+/// out memory from a separate linear arena per thread. Allocation is just a pointer bump in the calling thread's arena.
+///
+/// Individual deallocations only prevent the destructor from running on Reset(), the memory itself is released in bulk
+/// when Reset() is called. Reset() must only be called when no other thread is allocating from this allocator.
+///
+/// The arenas keep their memory across resets, so after a few frames the allocator does not touch the parent allocator anymore.
+/// The amount of memory used between two resets is tracked and the maximum is available through GetHighWaterMark().
+///
+/// Only alignments up to 16 bytes are supported.
+class EZ_FOUNDATION_DLL ezPerThreadLinearAllocator : public ezAllocator
+{
+public:
+#if EZ_ENABLED(EZ_COMPILE_FOR_DEBUG)
+  static constexpr bool OverwriteMemoryOnReset = true;
+#else
+  static constexpr bool OverwriteMemoryOnReset = false;
+#endif
+
+  /// \brief The number of threads that get their own arena at the same time. All further threads share one arena that is protected by a mutex.
+  ///
+  /// When a thread exits, its arena is handed to the next thread that starts allocating.
+  static constexpr ezUInt32 MaxThreadArenas = 128;
+
+  ezPerThreadLinearAllocator(ezStringView sName, ezAllocator* pParent);
+  ~ezPerThreadLinearAllocator();
+
+  virtual void* Allocate(size_t uiSize, size_t uiAlign, ezMemoryUtils::DestructorFunction destructorFunc) override;
+  virtual void Deallocate(void* pPtr) override;
+  virtual size_t AllocatedSize(const void* pPtr) override;
+  virtual ezAllocatorId GetId() const override;
+  virtual Stats GetStats() const override;
+
+  /// \brief Calls the destructors of all objects that have not been deallocated and resets all arenas.
+  ///
+  /// All previously allocated pointers become invalid. Must not be called while any thread allocates from this allocator.
+  void Reset();
+
+  /// \brief Returns how many bytes were allocated between the last two calls to Reset().
+  ezUInt64 GetUsedMemoryBeforeLastReset() const { return m_uiUsedMemoryBeforeLastReset; }
+
+  /// \brief Returns the maximum number of bytes that were allocated between any two calls to Reset().
+  ezUInt64 GetHighWaterMark() const { return m_uiHighWaterMark; }
+
+private:
+  struct DestructData
+  {
+    ezMemoryUtils::DestructorFunction m_Func;
+    void* m_pPtr;
+    DestructData* m_pNext;
+  };
+
+  struct alignas(16) AllocationHeader
+  {
+    DestructData* m_pDestructData;
+    size_t m_uiSize;
+  };
+
+  struct Arena
+  {
+    Arena(ezAllocator* pParent)
+      : m_Allocator(pParent)
+    {
+    }
+
+    ezAllocPolicyLinear<OverwriteMemoryOnReset> m_Allocator;
+    DestructData* m_pFirstDestructData = nullptr;
+    ezUInt64 m_uiUsedMemory = 0;
+  };
+
+  void* AllocateFromArena(ezUInt32 uiArenaIndex, size_t uiSize, size_t uiAlign, ezMemoryUtils::DestructorFunction destructorFunc);
+
+  ezAllocator* m_pParent = nullptr;
+  ezAllocatorId m_Id;
+
+  ezUInt64 m_uiUsedMemoryBeforeLastReset = 0;
+  ezUInt64 m_uiHighWaterMark = 0;
+
+  ezMutex m_OverflowArenaMutex;
+
+  // Index MaxThreadArenas is the shared overflow arena.
+  Arena* m_Arenas[MaxThreadArenas + 1] = {};
+};
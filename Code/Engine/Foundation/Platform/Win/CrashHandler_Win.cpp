@@ -21,6 +21,8 @@ static LONG WINAPI ezCrashHandlerFunc(struct _EXCEPTION_POINTERS* pExceptionInfo
 
   if (s_bAlreadyHandled == false)
   {
+    ezGlobalLog::FlushAsyncMessagesAfterCrash();
+
     if (ezCrashHandler::GetCrashHandler() != nullptr)
     {
       s_bAlreadyHandled = true;
@@ -117,13 +117,11 @@ void ezSceneLoadUtility::TickSceneLoading()
 
       if (pCollection.GetAcquireResult() == ezResourceAcquireResult::Final)
       {
-        if (pCollection->PreloadResources())
-        {
-          EZ_REPORT_FAILURE("Failed to start preloading all resources.");
-        }
+        // resources are only queued once their dependencies are loaded, so this has to be repeated until everything is queued
+        const bool bAllQueued = !pCollection->UpdatePreloading(m_CollectionPreloadSettings);
 
         float progress = 0.0f;
-        if (pCollection->IsLoadingFinished(&progress))
+        if (pCollection->IsLoadingFinished(&progress) && bAllQueued)
         {
           m_fLoadingProgress = fCollectionPreloadPiece;
         }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <Core/Collection/CollectionResource.h>
 #include <Core/ResourceManager/ResourceHandle.h>
 #include <Core/WorldSerializer/WorldReader.h>
 #include <Foundation/IO/FileSystem/FileReader.h>
@@ -7,8 +8,6 @@
 #include <Foundation/Utilities/Progress.h>
 #include <GameEngine/GameEngineDLL.h>
 
-using ezCollectionResourceHandle = ezTypedResourceHandle<class ezCollectionResource>;
-
 /// \brief This class allows to load a scene in the background and switch to it, once loading has finished.
 class EZ_GAMEENGINE_DLL ezSceneLoadUtility
 {
@@ -42,6 +41,12 @@ public:
   /// for the first time, resulting in very long delays.
   void StartSceneLoading(ezStringView sSceneFile, ezStringView sPreloadCollectionFile);
 
+  /// \brief Limits how much of the preload collection is queued at once. Has to be set before loading starts to take full effect.
+  ///
+  /// By default there is no limit, resources are still queued in dependency order, though.
+  void SetCollectionPreloadSettings(const ezCollectionPreloadSettings& settings) { m_CollectionPreloadSettings = settings; }
+  const ezCollectionPreloadSettings& GetCollectionPreloadSettings() const { return m_CollectionPreloadSettings; }
+
   /// \brief This has to be called periodically (usually once per frame) to progress the scene loading.
   ///
   /// Call GetLoadingState() afterwards to check whether loading has finished or failed.
@@ -68,6 +73,7 @@ private:
   ezString m_sRequestedFile;
   ezString m_sRedirectedFile;
   ezCollectionResourceHandle m_hPreloadCollection;
+  ezCollectionPreloadSettings m_CollectionPreloadSettings;
   ezFileReader m_FileReader;
   ezWorldReader m_WorldReader;
   ezUniquePtr<ezWorld> m_pWorld;
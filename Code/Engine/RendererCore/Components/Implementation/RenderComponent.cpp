@@ -13,7 +13,8 @@ EZ_BEGIN_ABSTRACT_COMPONENT_TYPE(ezRenderComponent, 1)
   EZ_END_ATTRIBUTES;
   EZ_BEGIN_MESSAGEHANDLERS
   {
-    EZ_MESSAGE_HANDLER(ezMsgUpdateLocalBounds, OnUpdateLocalBounds)
+    EZ_MESSAGE_HANDLER(ezMsgUpdateLocalBounds, OnUpdateLocalBounds),
+    EZ_MESSAGE_HANDLER(ezMsgComponentStateRestored, OnMsgComponentStateRestored)
   }
   EZ_END_MESSAGEHANDLERS;
 }
@@ -63,6 +64,13 @@ void ezRenderComponent::OnUpdateLocalBounds(ezMsgUpdateLocalBounds& msg)
   }
 }
 
+void ezRenderComponent::OnMsgComponentStateRestored(ezMsgComponentStateRestored& msg)
+{
+  EZ_IGNORE_UNUSED(msg);
+
+  InvalidateCachedRenderData();
+}
+
 void ezRenderComponent::InvalidateCachedRenderData()
 {
   if (IsActiveAndInitialized())
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <Core/Messages/CommonMessages.h>
 #include <Core/Messages/UpdateLocalBoundsMessage.h>
 #include <Core/World/World.h>
 #include <RendererCore/RendererCoreDLL.h>
@@ -45,5 +46,6 @@ public:
 
 protected:
   void OnUpdateLocalBounds(ezMsgUpdateLocalBounds& msg);
+  void OnMsgComponentStateRestored(ezMsgComponentStateRestored& msg);
   void InvalidateCachedRenderData();
 };
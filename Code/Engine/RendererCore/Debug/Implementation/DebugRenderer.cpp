@@ -4,6 +4,7 @@
 #include <Core/Scripting/ScriptAttributes.h>
 #include <Core/World/World.h>
 #include <Foundation/Configuration/CVar.h>
+#include <Foundation/SimdMath/SimdConversion.h>
 #include <RendererCore/Debug/DebugRenderer.h>
 #include <RendererCore/Debug/SimpleASCIIFont.h>
 #include <RendererCore/Meshes/MeshBufferResource.h>
@@ -143,6 +144,69 @@ namespace
   static ezHashTable<ezDebugRendererContext, DoubleBufferedPerContextData> s_PerContextData;
   static ezMutex s_Mutex;
 
+  /// \brief Debug geometry that is drawn from any other thread than the render thread is recorded into buffers owned by that thread.
+  ///
+  /// This way gameplay code and async world module tasks don't serialize on s_Mutex. The render thread merges the buffers into
+  /// s_PerContextData right before it renders a context. The mutex of a thread is only ever contended during that merge.
+  struct PerThreadData
+  {
+    ezMutex m_Mutex;
+    ezHashTable<ezDebugRendererContext, DoubleBufferedPerContextData> m_PerContextData;
+
+    // most threads only ever draw into one context, so remember the last one to skip the hash table lookup
+    ezDebugRendererContext m_LastContext;
+    ezUInt32 m_uiLastDataIndex = ezInvalidIndex;
+    PerContextData* m_pLastData = nullptr;
+
+    bool m_bThreadExited = false; // protected by s_Mutex, the buffers are removed once everything in them has been rendered
+  };
+
+  static ezDynamicArray<ezUniquePtr<PerThreadData>> s_PerThreadData; // protected by s_Mutex
+  static ezAtomicInteger32 s_iPerThreadDataGeneration = 1;           // incremented on shutdown to invalidate the thread local pointers
+
+  thread_local PerThreadData* s_pThreadData = nullptr;
+  thread_local ezInt32 s_iThreadDataGeneration = 0;
+
+  /// \brief Flags the buffers of a thread when the thread exits, otherwise every short-lived thread that ever drew something would leave its
+  /// buffers behind.
+  struct ThreadDataOwner
+  {
+    ~ThreadDataOwner()
+    {
+      if (m_pData == nullptr)
+        return;
+
+      EZ_LOCK(s_Mutex);
+
+      // the buffers are already gone, if the debug renderer was shut down in the meantime
+      if (s_iThreadDataGeneration == s_iPerThreadDataGeneration)
+      {
+        m_pData->m_bThreadExited = true;
+      }
+    }
+
+    PerThreadData* m_pData = nullptr;
+  };
+
+  thread_local ThreadDataOwner s_ThreadDataOwner;
+
+  static PerThreadData& GetThreadData()
+  {
+    const ezInt32 iGeneration = s_iPerThreadDataGeneration;
+    if (s_iThreadDataGeneration != iGeneration)
+    {
+      EZ_LOCK(s_Mutex);
+
+      s_PerThreadData.PushBack(EZ_DEFAULT_NEW(PerThreadData));
+      s_pThreadData = s_PerThreadData.PeekBack().Borrow();
+      s_iThreadDataGeneration = iGeneration;
+      s_ThreadDataOwner.m_pData = s_pThreadData;
+    }
+
+    return *s_pThreadData;
+  }
+
+  /// \brief Must be called with s_Mutex locked.
   static PerContextData& GetDataForExtraction(const ezDebugRendererContext& context)
   {
     DoubleBufferedPerContextData& doubleBufferedData = s_PerContextData[context];
@@ -158,29 +222,222 @@ namespace
     return *pData;
   }
 
+  /// \brief Locks the data that the calling thread records debug geometry into, for the lifetime of the scope.
+  class ExtractionDataScope
+  {
+  public:
+    explicit ExtractionDataScope(const ezDebugRendererContext& context)
+    {
+      if (ezRenderWorld::IsRenderingThread())
+      {
+        // the render thread may still add to the frame that it is currently rendering, see GetDataForExtraction()
+        m_pMutex = &s_Mutex;
+        m_pMutex->Lock();
+        m_pData = &GetDataForExtraction(context);
+        return;
+      }
+
+      PerThreadData& threadData = GetThreadData();
+
+      m_pMutex = &threadData.m_Mutex;
+      m_pMutex->Lock();
+
+      const ezUInt32 uiDataIndex = ezRenderWorld::GetDataIndexForExtraction();
+      if (threadData.m_pLastData == nullptr || threadData.m_uiLastDataIndex != uiDataIndex || !(threadData.m_LastContext == context))
+      {
+        ezUniquePtr<PerContextData>& pData = threadData.m_PerContextData[context].m_pData[uiDataIndex];
+        if (pData == nullptr)
+        {
+          pData = EZ_DEFAULT_NEW(PerContextData);
+        }
+
+        threadData.m_LastContext = context;
+        threadData.m_uiLastDataIndex = uiDataIndex;
+        threadData.m_pLastData = pData.Borrow();
+      }
+
+      m_pData = threadData.m_pLastData;
+    }
+
+    ~ExtractionDataScope()
+    {
+      m_pMutex->Unlock();
+    }
+
+    EZ_ALWAYS_INLINE PerContextData& GetData() { return *m_pData; }
+
+  private:
+    ezMutex* m_pMutex = nullptr;
+    PerContextData* m_pData = nullptr;
+  };
+
+  static void ClearData(PerContextData& ref_data)
+  {
+    ref_data.m_lineVertices.Clear();
+    ref_data.m_line2DVertices.Clear();
+    ref_data.m_lineBoxes.Clear();
+    ref_data.m_solidBoxes.Clear();
+    ref_data.m_triangleVertices.Clear();
+    ref_data.m_triangle2DVertices.Clear();
+    ref_data.m_texTriangle2DVertices.Clear();
+    ref_data.m_texTriangle3DVertices.Clear();
+    ref_data.m_textLines2D.Clear();
+    ref_data.m_textLines3D.Clear();
+
+    for (ezUInt32 i = 0; i < (ezUInt32)ezDebugTextPlacement::ENUM_COUNT; ++i)
+    {
+      ref_data.m_infoTextData[i].Clear();
+    }
+  }
+
+  static bool IsEmpty(const PerContextData& data)
+  {
+    if (!data.m_lineVertices.IsEmpty() || !data.m_line2DVertices.IsEmpty() || !data.m_lineBoxes.IsEmpty() || !data.m_solidBoxes.IsEmpty() ||
+        !data.m_triangleVertices.IsEmpty() || !data.m_triangle2DVertices.IsEmpty() || !data.m_texTriangle2DVertices.IsEmpty() ||
+        !data.m_texTriangle3DVertices.IsEmpty() || !data.m_textLines2D.IsEmpty() || !data.m_textLines3D.IsEmpty())
+    {
+      return false;
+    }
+
+    for (ezUInt32 i = 0; i < (ezUInt32)ezDebugTextPlacement::ENUM_COUNT; ++i)
+    {
+      if (!data.m_infoTextData[i].IsEmpty())
+        return false;
+    }
+
+    return true;
+  }
+
+  /// \brief Must be called with the mutex of the thread data locked.
+  static bool IsEmpty(const PerThreadData& threadData)
+  {
+    for (auto it = threadData.m_PerContextData.GetIterator(); it.IsValid(); ++it)
+    {
+      for (const ezUniquePtr<PerContextData>& pData : it.Value().m_pData)
+      {
+        if (pData != nullptr && !IsEmpty(*pData))
+          return false;
+      }
+    }
+
+    return true;
+  }
+
+  template <typename T, typename A>
+  static void MoveAppend(ezDynamicArray<T, A>& ref_target, ezDynamicArray<T, A>& ref_source)
+  {
+    if (ref_target.IsEmpty())
+    {
+      // only swaps pointers, and the thread keeps the capacity of the previous target for recording the next frame
+      ref_target.Swap(ref_source);
+    }
+    else
+    {
+      ref_target.PushBackRange(ref_source);
+    }
+
+    ref_source.Clear();
+  }
+
+  template <typename T, typename A>
+  static void MoveAppend(ezMap<ezGALTextureHandle, ezDynamicArray<T, A>>& ref_target, ezMap<ezGALTextureHandle, ezDynamicArray<T, A>>& ref_source)
+  {
+    for (auto it = ref_source.GetIterator(); it.IsValid(); ++it)
+    {
+      MoveAppend(ref_target[it.Key()], it.Value());
+    }
+
+    ref_source.Clear();
+  }
+
+  static void MoveAppend(PerContextData& ref_target, PerContextData& ref_source)
+  {
+    MoveAppend(ref_target.m_lineVertices, ref_source.m_lineVertices);
+    MoveAppend(ref_target.m_line2DVertices, ref_source.m_line2DVertices);
+    MoveAppend(ref_target.m_lineBoxes, ref_source.m_lineBoxes);
+    MoveAppend(ref_target.m_solidBoxes, ref_source.m_solidBoxes);
+    MoveAppend(ref_target.m_triangleVertices, ref_source.m_triangleVertices);
+    MoveAppend(ref_target.m_triangle2DVertices, ref_source.m_triangle2DVertices);
+    MoveAppend(ref_target.m_texTriangle2DVertices, ref_source.m_texTriangle2DVertices);
+    MoveAppend(ref_target.m_texTriangle3DVertices, ref_source.m_texTriangle3DVertices);
+    MoveAppend(ref_target.m_textLines2D, ref_source.m_textLines2D);
+    MoveAppend(ref_target.m_textLines3D, ref_source.m_textLines3D);
+
+    for (ezUInt32 i = 0; i < (ezUInt32)ezDebugTextPlacement::ENUM_COUNT; ++i)
+    {
+      MoveAppend(ref_target.m_infoTextData[i], ref_source.m_infoTextData[i]);
+    }
+  }
+
+  /// \brief Moves everything that other threads recorded for the given context into s_PerContextData and returns the data to render.
+  static DoubleBufferedPerContextData* GetDataForRendering(const ezDebugRendererContext& context)
+  {
+    EZ_LOCK(s_Mutex);
+
+    const ezUInt32 uiDataIndex = ezRenderWorld::GetDataIndexForRendering();
+
+    for (ezUInt32 i = 0; i < s_PerThreadData.GetCount();)
+    {
+      PerThreadData& threadData = *s_PerThreadData[i];
+      bool bRemove = false;
+
+      {
+        EZ_LOCK(threadData.m_Mutex);
+
+        DoubleBufferedPerContextData* pThreadContextData = nullptr;
+        if (threadData.m_PerContextData.TryGetValue(context, pThreadContextData) && pThreadContextData->m_pData[uiDataIndex] != nullptr)
+        {
+          DoubleBufferedPerContextData& doubleBufferedData = s_PerContextData[context];
+          if (doubleBufferedData.m_pData[uiDataIndex] == nullptr)
+          {
+            doubleBufferedData.m_pData[uiDataIndex] = EZ_DEFAULT_NEW(PerContextData);
+          }
+
+          MoveAppend(*doubleBufferedData.m_pData[uiDataIndex], *pThreadContextData->m_pData[uiDataIndex]);
+        }
+
+        bRemove = threadData.m_bThreadExited && IsEmpty(threadData);
+      }
+
+      // an exited thread can't record anything anymore and everybody else only locks its mutex while holding s_Mutex
+      if (bRemove)
+      {
+        s_PerThreadData.RemoveAtAndSwap(i);
+        continue;
+      }
+
+      ++i;
+    }
+
+    DoubleBufferedPerContextData* pDoubleBufferedData = nullptr;
+    s_PerContextData.TryGetValue(context, pDoubleBufferedData);
+    return pDoubleBufferedData;
+  }
+
   static void ClearRenderData()
   {
     EZ_LOCK(s_Mutex);
 
+    const ezUInt32 uiDataIndex = ezRenderWorld::GetDataIndexForRendering();
+
     for (auto it = s_PerContextData.GetIterator(); it.IsValid(); ++it)
     {
-      PerContextData* pData = it.Value().m_pData[ezRenderWorld::GetDataIndexForRendering()].Borrow();
-      if (pData)
+      if (PerContextData* pData = it.Value().m_pData[uiDataIndex].Borrow())
+      {
+        ClearData(*pData);
+      }
+    }
+
+    // data of contexts that were not rendered this frame
+    for (auto& pThreadData : s_PerThreadData)
+    {
+      EZ_LOCK(pThreadData->m_Mutex);
+
+      for (auto it = pThreadData->m_PerContextData.GetIterator(); it.IsValid(); ++it)
       {
-        pData->m_lineVertices.Clear();
-        pData->m_line2DVertices.Clear();
-        pData->m_lineBoxes.Clear();
-        pData->m_solidBoxes.Clear();
-        pData->m_triangleVertices.Clear();
-        pData->m_triangle2DVertices.Clear();
-        pData->m_texTriangle2DVertices.Clear();
-        pData->m_texTriangle3DVertices.Clear();
-        pData->m_textLines2D.Clear();
-        pData->m_textLines3D.Clear();
-
-        for (ezUInt32 i = 0; i < (ezUInt32)ezDebugTextPlacement::ENUM_COUNT; ++i)
+        if (PerContextData* pData = it.Value().m_pData[uiDataIndex].Borrow())
         {
-          pData->m_infoTextData[i].Clear();
+          ClearData(*pData);
         }
       }
     }
@@ -341,9 +598,8 @@ namespace
       screenPosY -= lines.GetCount() * fLineHeight - fLineSpacing;
 
     {
-      EZ_LOCK(s_Mutex);
-
-      auto& data = GetDataForExtraction(context);
+      ExtractionDataScope scope(context);
+      auto& data = scope.GetData();
 
       ezVec2 currentPos(screenPosX, screenPosY);
 
@@ -407,6 +663,35 @@ namespace
     }
   }
 
+  EZ_ALWAYS_INLINE void AppendVertex(ezDynamicArray<Vertex, ezAlignedAllocatorWrapper>& ref_vertices, const ezSimdVec4f& vPosition, const ezColorLinearUB& color)
+  {
+    auto& vertex = ref_vertices.ExpandAndGetRef();
+    vPosition.Store<3>(&vertex.m_position.x);
+    vertex.m_color = color;
+  }
+
+  constexpr ezUInt32 s_uiNumCircleSegments = 32;
+
+  /// \brief Cosine and sine of the segment boundaries of a circle, so that spheres don't need to evaluate them for every call.
+  struct UnitCircle
+  {
+    UnitCircle()
+    {
+      const ezAngle stepAngle = ezAngle::MakeFromDegree(360.0f / (float)s_uiNumCircleSegments);
+
+      for (ezUInt32 s = 0; s <= s_uiNumCircleSegments; ++s)
+      {
+        m_fCos[s] = ezMath::Cos((float)s * stepAngle);
+        m_fSin[s] = ezMath::Sin((float)s * stepAngle);
+      }
+    }
+
+    float m_fCos[s_uiNumCircleSegments + 1];
+    float m_fSin[s_uiNumCircleSegments + 1];
+  };
+
+  static const UnitCircle s_UnitCircle;
+
   //////////////////////////////////////////////////////////////////////////
   // Persistent Items
 
@@ -491,21 +776,17 @@ void ezDebugRenderer::DrawLines(const ezDebugRendererContext& context, ezArrayPt
   if (lines.IsEmpty())
     return;
 
-  EZ_LOCK(s_Mutex);
+  const ezSimdMat4f transform = ezSimdConversion::ToMat4(mTransform.m_Mat4);
+
+  ExtractionDataScope scope(context);
+  auto& data = scope.GetData();
 
-  auto& data = GetDataForExtraction(context);
+  data.m_lineVertices.Reserve(data.m_lineVertices.GetCount() + lines.GetCount() * 2);
 
   for (auto& line : lines)
   {
-    const ezVec3* pPositions = &line.m_start;
-    const ezColor* pColors = &line.m_startColor;
-
-    for (ezUInt32 i = 0; i < 2; ++i)
-    {
-      auto& vertex = data.m_lineVertices.ExpandAndGetRef();
-      vertex.m_position = mTransform.m_Mat4.TransformPosition(pPositions[i]);
-      vertex.m_color = pColors[i] * color;
-    }
+    AppendVertex(data.m_lineVertices, transform.TransformPosition(ezSimdConversion::ToVec3(line.m_start)), line.m_startColor * color);
+    AppendVertex(data.m_lineVertices, transform.TransformPosition(ezSimdConversion::ToVec3(line.m_end)), line.m_endColor * color);
   }
 }
 
@@ -514,9 +795,8 @@ void ezDebugRenderer::Draw2DLines(const ezDebugRendererContext& context, ezArray
   if (lines.IsEmpty())
     return;
 
-  EZ_LOCK(s_Mutex);
-
-  auto& data = GetDataForExtraction(context);
+  ExtractionDataScope scope(context);
+  auto& data = scope.GetData();
 
   for (auto& line : lines)
   {
@@ -544,9 +824,8 @@ void ezDebugRenderer::DrawCross(const ezDebugRendererContext& context, const ezV
   const ezVec3 yAxis = ezVec3::MakeAxisY() * fHalfLineLength;
   const ezVec3 zAxis = ezVec3::MakeAxisZ() * fHalfLineLength;
 
-  EZ_LOCK(s_Mutex);
-
-  auto& data = GetDataForExtraction(context);
+  ExtractionDataScope scope(context);
+  auto& data = scope.GetData();
 
   data.m_lineVertices.PushBack({transform.TransformPosition(vGlobalPosition - xAxis), color});
   data.m_lineVertices.PushBack({transform.TransformPosition(vGlobalPosition + xAxis), color});
@@ -561,11 +840,10 @@ void ezDebugRenderer::DrawCross(const ezDebugRendererContext& context, const ezV
 // static
 void ezDebugRenderer::DrawLineBox(const ezDebugRendererContext& context, const ezBoundingBox& box, const ezColor& color, ezMatOrTransform mTransform0)
 {
-  EZ_LOCK(s_Mutex);
-
   const ezMat4& transform = mTransform0.m_Mat4;
 
-  auto& data = GetDataForExtraction(context);
+  ExtractionDataScope scope(context);
+  auto& data = scope.GetData();
 
   auto& boxData = data.m_lineBoxes.ExpandAndGetRef();
 
@@ -624,40 +902,46 @@ void ezDebugRenderer::DrawLineBoxCorners(const ezDebugRendererContext& context,
 // static
 void ezDebugRenderer::DrawLineSphere(const ezDebugRendererContext& context, const ezBoundingSphere& sphere, const ezColor& color, ezMatOrTransform mTransform0 /*= ezMat4::MakeIdentity()*/)
 {
-  enum
-  {
-    NUM_SEGMENTS = 32
-  };
+  const ezSimdMat4f transform = ezSimdConversion::ToMat4(mTransform0.m_Mat4);
+  const ezSimdFloat fRadius = sphere.m_fRadius;
 
-  const ezVec3 vCenter = sphere.m_vCenter;
-  const float fRadius = sphere.m_fRadius;
-  const ezAngle stepAngle = ezAngle::MakeFromDegree(360.0f / (float)NUM_SEGMENTS);
+  // the sphere axes in global space, scaled by the radius, so that every circle point is only two multiply-adds
+  const ezSimdVec4f vAxisX = transform.m_col0 * fRadius;
+  const ezSimdVec4f vAxisY = transform.m_col1 * fRadius;
+  const ezSimdVec4f vAxisZ = transform.m_col2 * fRadius;
+  const ezSimdVec4f vCenter = transform.TransformPosition(ezSimdConversion::ToVec3(sphere.m_vCenter));
 
-  const ezMat4& transform = mTransform0.m_Mat4;
+  ezSimdVec4f circleYZ[s_uiNumCircleSegments + 1];
+  ezSimdVec4f circleXZ[s_uiNumCircleSegments + 1];
+  ezSimdVec4f circleXY[s_uiNumCircleSegments + 1];
 
-  EZ_LOCK(s_Mutex);
+  for (ezUInt32 s = 0; s <= s_uiNumCircleSegments; ++s)
+  {
+    const ezSimdFloat fCos = s_UnitCircle.m_fCos[s];
+    const ezSimdFloat fSin = s_UnitCircle.m_fSin[s];
 
-  auto& data = GetDataForExtraction(context);
+    circleYZ[s] = ezSimdVec4f::MulAdd(vAxisY, fCos, ezSimdVec4f::MulAdd(vAxisZ, fSin, vCenter));
+    circleXZ[s] = ezSimdVec4f::MulAdd(vAxisX, fCos, ezSimdVec4f::MulAdd(vAxisZ, fSin, vCenter));
+    circleXY[s] = ezSimdVec4f::MulAdd(vAxisX, fCos, ezSimdVec4f::MulAdd(vAxisY, fSin, vCenter));
+  }
 
-  for (ezUInt32 s = 0; s < NUM_SEGMENTS; ++s)
-  {
-    const float fS1 = (float)s;
-    const float fS2 = (float)(s + 1);
+  const ezColorLinearUB lineColor = color;
 
-    const float fCos1 = ezMath::Cos(fS1 * stepAngle);
-    const float fCos2 = ezMath::Cos(fS2 * stepAngle);
+  ExtractionDataScope scope(context);
+  auto& data = scope.GetData();
 
-    const float fSin1 = ezMath::Sin(fS1 * stepAngle);
-    const float fSin2 = ezMath::Sin(fS2 * stepAngle);
+  data.m_lineVertices.Reserve(data.m_lineVertices.GetCount() + s_uiNumCircleSegments * 6);
 
-    data.m_lineVertices.PushBack({transform * (vCenter + ezVec3(0.0f, fCos1, fSin1) * fRadius), color});
-    data.m_lineVertices.PushBack({transform * (vCenter + ezVec3(0.0f, fCos2, fSin2) * fRadius), color});
+  for (ezUInt32 s = 0; s < s_uiNumCircleSegments; ++s)
+  {
+    AppendVertex(data.m_lineVertices, circleYZ[s], lineColor);
+    AppendVertex(data.m_lineVertices, circleYZ[s + 1], lineColor);
 
-    data.m_lineVertices.PushBack({transform * (vCenter + ezVec3(fCos1, 0.0f, fSin1) * fRadius), color});
-    data.m_lineVertices.PushBack({transform * (vCenter + ezVec3(fCos2, 0.0f, fSin2) * fRadius), color});
+    AppendVertex(data.m_lineVertices, circleXZ[s], lineColor);
+    AppendVertex(data.m_lineVertices, circleXZ[s + 1], lineColor);
 
-    data.m_lineVertices.PushBack({transform * (vCenter + ezVec3(fCos1, fSin1, 0.0f) * fRadius), color});
-    data.m_lineVertices.PushBack({transform * (vCenter + ezVec3(fCos2, fSin2, 0.0f) * fRadius), color});
+    AppendVertex(data.m_lineVertices, circleXY[s], lineColor);
+    AppendVertex(data.m_lineVertices, circleXY[s + 1], lineColor);
   }
 }
 
@@ -894,9 +1178,8 @@ void ezDebugRenderer::DrawSolidBox(const ezDebugRendererContext& context, const
 {
   const ezMat4& transform = mTransform0.m_Mat4;
 
-  EZ_LOCK(s_Mutex);
-
-  auto& data = GetDataForExtraction(context);
+  ExtractionDataScope scope(context);
+  auto& data = scope.GetData();
 
   auto& boxData = data.m_solidBoxes.ExpandAndGetRef();
 
@@ -912,9 +1195,8 @@ void ezDebugRenderer::DrawSolidTriangles(const ezDebugRendererContext& context,
   if (triangles.IsEmpty())
     return;
 
-  EZ_LOCK(s_Mutex);
-
-  auto& data = GetDataForExtraction(context);
+  ExtractionDataScope scope(context);
+  auto& data = scope.GetData();
 
   for (auto& triangle : triangles)
   {
@@ -956,9 +1238,8 @@ void ezDebugRenderer::DrawTexturedTriangles(const ezDebugRendererContext& contex
   ezResourceLock<ezTexture2DResource> pTexture(hTexture, ezResourceAcquireMode::AllowLoadingFallback);
   auto hGalTexture = pTexture->GetGALTexture();
 
-  EZ_LOCK(s_Mutex);
-
-  auto& data = GetDataForExtraction(context).m_texTriangle3DVertices[hGalTexture];
+  ExtractionDataScope scope(context);
+  auto& data = scope.GetData().m_texTriangle3DVertices[hGalTexture];
 
   for (auto& triangle : triangles)
   {
@@ -1013,9 +1294,8 @@ void ezDebugRenderer::Draw2DRectangle(const ezDebugRendererContext& context, con
   }
 
 
-  EZ_LOCK(s_Mutex);
-
-  auto& data = GetDataForExtraction(context);
+  ExtractionDataScope scope(context);
+  auto& data = scope.GetData();
 
   data.m_triangle2DVertices.PushBackRange(ezMakeArrayPtr(vertices));
 }
@@ -1049,9 +1329,8 @@ void ezDebugRenderer::Draw2DRectangle(const ezDebugRendererContext& context, con
   }
 
 
-  EZ_LOCK(s_Mutex);
-
-  auto& data = GetDataForExtraction(context);
+  ExtractionDataScope scope(context);
+  auto& data = scope.GetData();
 
   data.m_texTriangle2DVertices[hResourceView].PushBackRange(ezMakeArrayPtr(vertices));
 }
@@ -1089,9 +1368,8 @@ ezUInt32 ezDebugRenderer::Draw2DText(const ezDebugRendererContext& context, cons
 
 void ezDebugRenderer::DrawInfoText(const ezDebugRendererContext& context, ezDebugTextPlacement::Enum placement, ezStringView sGroupName, const ezFormatString& text, const ezColor& color)
 {
-  EZ_LOCK(s_Mutex);
-
-  auto& data = GetDataForExtraction(context);
+  ExtractionDataScope scope(context);
+  auto& data = scope.GetData();
 
   ezStringBuilder tmp;
 
@@ -1569,8 +1847,8 @@ void ezDebugRenderer::RenderInternalWorldSpace(const ezDebugRendererContext& con
     }
   }
 
-  DoubleBufferedPerContextData* pDoubleBufferedContextData = nullptr;
-  if (!s_PerContextData.TryGetValue(context, pDoubleBufferedContextData))
+  DoubleBufferedPerContextData* pDoubleBufferedContextData = GetDataForRendering(context);
+  if (pDoubleBufferedContextData == nullptr)
   {
     return;
   }
@@ -1832,8 +2110,8 @@ void ezDebugRenderer::RenderInternalScreenSpace(const ezDebugRendererContext& co
     }
   }
 
-  DoubleBufferedPerContextData* pDoubleBufferedContextData = nullptr;
-  if (!s_PerContextData.TryGetValue(context, pDoubleBufferedContextData))
+  DoubleBufferedPerContextData* pDoubleBufferedContextData = GetDataForRendering(context);
+  if (pDoubleBufferedContextData == nullptr)
   {
     return;
   }
@@ -2140,7 +2418,13 @@ void ezDebugRenderer::OnEngineShutdown()
   s_hDebugTexturedPrimitiveShader.Invalidate();
   s_hDebugTextShader.Invalidate();
 
-  s_PerContextData.Clear();
+  {
+    EZ_LOCK(s_Mutex);
+
+    s_PerContextData.Clear();
+    s_PerThreadData.Clear();
+    s_iPerThreadDataGeneration.Increment();
+  }
 
   s_PersistentPerContextData.Clear();
 }
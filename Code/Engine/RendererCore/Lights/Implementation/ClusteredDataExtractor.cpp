@@ -11,6 +11,7 @@
 #include <RendererCore/Lights/Implementation/ClusteredDataUtils.h>
 #include <RendererCore/Pipeline/ExtractedRenderData.h>
 #include <RendererCore/Pipeline/View.h>
+#include <RendererCore/RenderWorld/RenderWorld.h>
 
 #if EZ_ENABLED(EZ_COMPILE_FOR_DEVELOPMENT)
 ezCVarBool cvar_RenderingLightingVisClusterData("Rendering.Lighting.VisClusterData", false, ezCVarFlags::Default, "Enables debug visualization of clustered light data");
@@ -211,8 +212,8 @@ void ezClusteredDataExtractor::PostSortAndBatch(const ezView& view, const ezDyna
     FillClusterBoundingSpheres(*pCamera, mProj, m_ClusterBoundingSpheres);
   }
 
-  ezClusteredDataCPU* pData = EZ_NEW(ezFrameAllocator::GetCurrentAllocator(), ezClusteredDataCPU);
-  pData->m_ClusterData = EZ_NEW_ARRAY(ezFrameAllocator::GetCurrentAllocator(), ezPerClusterData, NUM_CLUSTERS);
+  ezClusteredDataCPU* pData = EZ_NEW(ezRenderWorld::GetRenderDataAllocator(), ezClusteredDataCPU);
+  pData->m_ClusterData = EZ_NEW_ARRAY(ezRenderWorld::GetRenderDataAllocator(), ezPerClusterData, NUM_CLUSTERS);
 
   ezMat4 tmp = pCamera->GetViewMatrix();
   ezSimdMat4f viewMatrix = ezSimdConversion::ToMat4(tmp);
@@ -324,7 +325,7 @@ void ezClusteredDataExtractor::PostSortAndBatch(const ezView& view, const ezDyna
       }
     }
 
-    pData->m_LightData = EZ_NEW_ARRAY(ezFrameAllocator::GetCurrentAllocator(), ezPerLightData, m_TempLightData.GetCount());
+    pData->m_LightData = EZ_NEW_ARRAY(ezRenderWorld::GetRenderDataAllocator(), ezPerLightData, m_TempLightData.GetCount());
     pData->m_LightData.CopyFrom(m_TempLightData);
 
     pData->m_uiBrightestDirectionalLightIndex = uiBrightestDirectionalLightIndex;
@@ -366,7 +367,7 @@ void ezClusteredDataExtractor::PostSortAndBatch(const ezView& view, const ezDyna
       }
     }
 
-    pData->m_DecalData = EZ_NEW_ARRAY(ezFrameAllocator::GetCurrentAllocator(), ezPerDecalData, m_TempDecalData.GetCount());
+    pData->m_DecalData = EZ_NEW_ARRAY(ezRenderWorld::GetRenderDataAllocator(), ezPerDecalData, m_TempDecalData.GetCount());
     pData->m_DecalData.CopyFrom(m_TempDecalData);
   }
 
@@ -438,7 +439,7 @@ void ezClusteredDataExtractor::PostSortAndBatch(const ezView& view, const ezDyna
       }
     }
 
-    pData->m_ReflectionProbeData = EZ_NEW_ARRAY(ezFrameAllocator::GetCurrentAllocator(), ezPerReflectionProbeData, m_TempReflectionProbeData.GetCount());
+    pData->m_ReflectionProbeData = EZ_NEW_ARRAY(ezRenderWorld::GetRenderDataAllocator(), ezPerReflectionProbeData, m_TempReflectionProbeData.GetCount());
     pData->m_ReflectionProbeData.CopyFrom(m_TempReflectionProbeData);
   }
 
@@ -585,7 +586,7 @@ void ezClusteredDataExtractor::FillItemListAndClusterData(ezClusteredDataCPU* pD
     clusterData.counts = uiLightCount | MakeDecalIndex(uiDecalCount) | MakeProbeIndex(uiReflectionProbeCount);
   }
 
-  pData->m_ClusterItemList = EZ_NEW_ARRAY(ezFrameAllocator::GetCurrentAllocator(), ezUInt32, m_TempClusterItemList.GetCount());
+  pData->m_ClusterItemList = EZ_NEW_ARRAY(ezRenderWorld::GetRenderDataAllocator(), ezUInt32, m_TempClusterItemList.GetCount());
   pData->m_ClusterItemList.CopyFrom(m_TempClusterItemList);
 }
 
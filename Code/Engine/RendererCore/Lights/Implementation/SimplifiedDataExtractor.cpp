@@ -4,6 +4,7 @@
 #include <RendererCore/Lights/Implementation/ClusteredDataUtils.h>
 #include <RendererCore/Lights/SimplifiedDataExtractor.h>
 #include <RendererCore/Pipeline/View.h>
+#include <RendererCore/RenderWorld/RenderWorld.h>
 
 //////////////////////////////////////////////////////////////////////////
 
@@ -29,7 +30,7 @@ ezSimplifiedDataExtractor::~ezSimplifiedDataExtractor() = default;
 void ezSimplifiedDataExtractor::PostSortAndBatch(
   const ezView& view, const ezDynamicArray<const ezGameObject*>& visibleObjects, ezExtractedRenderData& ref_extractedRenderData)
 {
-  ezSimplifiedDataCPU* pData = EZ_NEW(ezFrameAllocator::GetCurrentAllocator(), ezSimplifiedDataCPU);
+  ezSimplifiedDataCPU* pData = EZ_NEW(ezRenderWorld::GetRenderDataAllocator(), ezSimplifiedDataCPU);
 
   pData->m_uiSkyIrradianceIndex = view.GetWorld()->GetIndex();
   pData->m_cameraUsageHint = view.GetCameraUsageHint();
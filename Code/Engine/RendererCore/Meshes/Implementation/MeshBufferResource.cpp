@@ -786,6 +786,61 @@ ezBoundingBoxSphere ezMeshBufferResourceDescriptor::ComputeBounds() const
   return bounds;
 }
 
+float ezMeshBufferResourceDescriptor::ComputeTexCoord0Density() const
+{
+  if (m_Topology != ezGALPrimitiveTopology::Triangles || !m_VertexStreamConfig.HasPosition() || !m_VertexStreamConfig.HasTexCoord0() || m_uiVertexCount == 0)
+    return 0.0f;
+
+  const ezVec3* pPositions = GetPositionData().GetPtr();
+
+  ezUInt32 uiTexCoordStride = 0;
+  ezArrayPtr<const ezUInt8> texCoordData = GetTexCoord0Data(&uiTexCoordStride);
+  const ezGALResourceFormat::Enum texCoordFormat = m_VertexStreamConfig.GetTexCoordFormat();
+
+  auto getTexCoord = [&](ezUInt32 uiVertex) -> ezVec2
+  {
+    ezVec2 res(0.0f);
+    ezMeshBufferUtils::DecodeTexCoord(texCoordData.GetSubArray(uiVertex * uiTexCoordStride), texCoordFormat, res).IgnoreResult();
+    return res;
+  };
+
+  const ezUInt16* pIndices16 = reinterpret_cast<const ezUInt16*>(m_IndexBufferData.GetData());
+  const ezUInt32* pIndices32 = reinterpret_cast<const ezUInt32*>(m_IndexBufferData.GetData());
+  const bool bHasIndices = HasIndexBuffer();
+  const bool bUseIndices32 = Uses32BitIndices();
+
+  double fTotalAreaUV = 0.0;
+  double fTotalAreaObject = 0.0;
+
+  for (ezUInt32 triIdx = 0; triIdx < GetPrimitiveCount(); ++triIdx)
+  {
+    ezUInt32 v[3];
+    for (ezUInt32 i = 0; i < 3; ++i)
+    {
+      v[i] = !bHasIndices ? triIdx * 3 + i : (bUseIndices32 ? pIndices32[triIdx * 3 + i] : pIndices16[triIdx * 3 + i]);
+    }
+
+    const float fAreaObject = (pPositions[v[1]] - pPositions[v[0]]).CrossRH(pPositions[v[2]] - pPositions[v[0]]).GetLength();
+
+    const ezVec2 uv0 = getTexCoord(v[0]);
+    const ezVec2 d1 = getTexCoord(v[1]) - uv0;
+    const ezVec2 d2 = getTexCoord(v[2]) - uv0;
+    const float fAreaUV = ezMath::Abs(d1.x * d2.y - d1.y * d2.x);
+
+    if (!ezMath::IsFinite(fAreaObject) || !ezMath::IsFinite(fAreaUV))
+      continue;
+
+    fTotalAreaObject += fAreaObject;
+    fTotalAreaUV += fAreaUV;
+  }
+
+  if (fTotalAreaObject <= 0.0 || fTotalAreaUV <= 0.0)
+    return 0.0f;
+
+  // the ratio of the areas is the squared ratio of the lengths
+  return static_cast<float>(ezMath::Sqrt(fTotalAreaUV / fTotalAreaObject));
+}
+
 ezResult ezMeshBufferResourceDescriptor::RecomputeNormals()
 {
   if (m_Topology != ezGALPrimitiveTopology::Triangles)
@@ -1,14 +1,104 @@
 #include <RendererCore/RendererCorePCH.h>
 
+#include <Foundation/Configuration/CVar.h>
+#include <Foundation/SimdMath/SimdConversion.h>
 #include <RendererCore/Debug/DebugRenderer.h>
+#include <RendererCore/Material/MaterialResource.h>
 #include <RendererCore/Meshes/Implementation/MeshRendererUtils.h>
 #include <RendererCore/Meshes/InstancedMeshComponent.h>
 #include <RendererCore/Meshes/MeshRenderer.h>
 #include <RendererCore/Pipeline/InstanceDataProvider.h>
 #include <RendererCore/Pipeline/RenderPipeline.h>
 #include <RendererCore/Pipeline/RenderPipelinePass.h>
+#include <RendererCore/Rasterizer/RasterizerView.h>
 #include <RendererCore/RenderContext/RenderContext.h>
 
+extern ezCVarFloat cvar_SpatialCullingOcclusionBoundsInlation;
+
+ezCVarBool cvar_RenderingClusterCulling("Rendering.ClusterCulling", true, ezCVarFlags::Default, "Cull the clusters of clustered meshes individually against the frustum, normal cones and occlusion buffer");
+
+namespace
+{
+  struct ezClusterCullingContext
+  {
+    ezFrustum m_Frustum;
+    ezSimdVec4f m_vCameraPosition;
+    ezSimdVec4f m_vCameraDirection;
+    bool m_bPerspective = true;
+    bool m_bTwoSided = false;
+    const ezRasterizerView* m_pRasterizer = nullptr;
+  };
+
+  struct ezClusterDrawRange
+  {
+    EZ_DECLARE_POD_TYPE();
+
+    ezUInt32 m_uiFirstPrimitive;
+    ezUInt32 m_uiPrimitiveCount;
+  };
+
+  using ezClusterDrawRanges = ezHybridArray<ezClusterDrawRange, 64>;
+
+  void CullClusters(const ezClusterCullingContext& context, const ezMeshRenderData* pRenderData, ezArrayPtr<const ezMeshResourceDescriptor::Cluster> clusters, ezClusterDrawRanges& out_ranges)
+  {
+    out_ranges.Clear();
+
+    const ezSimdTransform transform = ezSimdConversion::ToTransform(pRenderData->m_GlobalTransform);
+    const ezSimdFloat fMaxScale = transform.GetMaxScale();
+
+    // the normal cones are only valid if the transform doesn't change the shape or winding of the triangles
+    const bool bConeCulling = !context.m_bTwoSided && pRenderData->m_uiUniformScale && !pRenderData->m_uiFlipWinding;
+    const bool bOcclusionCulling = context.m_pRasterizer != nullptr && context.m_pRasterizer->HasRasterizedAnyOccluders();
+    const ezSimdFloat fOcclusionInflation = 1.0f + cvar_SpatialCullingOcclusionBoundsInlation;
+
+    for (const ezMeshResourceDescriptor::Cluster& cluster : clusters)
+    {
+      const ezSimdVec4f vCenter = transform.TransformPosition(ezSimdConversion::ToVec3(cluster.m_Bounds.m_vCenter));
+      const ezSimdFloat fRadius = fMaxScale * ezSimdFloat(cluster.m_Bounds.m_fRadius);
+
+      if (bConeCulling && cluster.m_fConeCutoff < 1.0f)
+      {
+        const ezSimdVec4f vConeAxis = transform.TransformDirection(ezSimdConversion::ToVec3(cluster.m_vConeAxis)).GetNormalized<3>();
+
+        if (context.m_bPerspective)
+        {
+          const ezSimdVec4f vToCluster = vCenter - context.m_vCameraPosition;
+          const ezSimdFloat fDistance = vToCluster.GetLength<3>();
+
+          if (vToCluster.Dot<3>(vConeAxis) >= fDistance * ezSimdFloat(cluster.m_fConeCutoff) + fRadius)
+            continue;
+        }
+        else if (context.m_vCameraDirection.Dot<3>(vConeAxis) >= cluster.m_fConeCutoff)
+        {
+          continue;
+        }
+      }
+
+      if (!context.m_Frustum.Overlaps(ezSimdBSphere(vCenter, fRadius)))
+        continue;
+
+      if (bOcclusionCulling)
+      {
+        // grow the bbox by some percent to counter the lower precision of the occlusion buffer
+        const ezSimdBBox box = ezSimdBBox::MakeFromCenterAndHalfExtents(vCenter, ezSimdVec4f(fRadius * fOcclusionInflation));
+
+        if (!context.m_pRasterizer->IsVisible(box))
+          continue;
+      }
+
+      // merge adjacent clusters into one draw call
+      if (!out_ranges.IsEmpty() && out_ranges.PeekBack().m_uiFirstPrimitive + out_ranges.PeekBack().m_uiPrimitiveCount == cluster.m_uiFirstPrimitive)
+      {
+        out_ranges.PeekBack().m_uiPrimitiveCount += cluster.m_uiPrimitiveCount;
+      }
+      else
+      {
+        out_ranges.PushBack({cluster.m_uiFirstPrimitive, cluster.m_uiPrimitiveCount});
+      }
+    }
+  }
+} // namespace
+
 // clang-format off
 EZ_BEGIN_DYNAMIC_REFLECTED_TYPE(ezMeshRenderer, 1, ezRTTIDefaultAllocator<ezMeshRenderer>)
 EZ_END_DYNAMIC_REFLECTED_TYPE;
@@ -76,7 +166,14 @@ void ezMeshRenderer::RenderBatch(const ezRenderViewContext& renderViewContext, c
 
   pInstanceData->BindResources(pContext);
 
-  if (!bHasExplicitInstanceData)
+  const ezMeshResourceDescriptor::SubMesh& subMesh = subMeshes[uiPartIndex];
+
+  // skinned and other derived render data may deform the mesh, so the cluster bounds are only valid for plain meshes
+  if (!bHasExplicitInstanceData && subMesh.m_uiClusterCount > 0 && cvar_RenderingClusterCulling && pRenderData->GetDynamicRTTI() == ezGetStaticRTTI<ezMeshRenderData>() && !renderViewContext.m_pCamera->IsStereoscopic())
+  {
+    RenderClusters(renderViewContext, pPass, batch, pInstanceData, pMesh->GetClusters().GetSubArray(subMesh.m_uiFirstCluster, subMesh.m_uiClusterCount));
+  }
+  else if (!bHasExplicitInstanceData)
   {
     ezUInt32 uiStartIndex = 0;
     while (uiStartIndex < batch.GetCount())
@@ -123,6 +220,54 @@ void ezMeshRenderer::RenderBatch(const ezRenderViewContext& renderViewContext, c
   }
 }
 
+void ezMeshRenderer::RenderClusters(const ezRenderViewContext& renderViewContext, const ezRenderPipelinePass* pPass, const ezRenderDataBatch& batch, ezInstanceData* pInstanceData, ezArrayPtr<const ezMeshResourceDescriptor::Cluster> clusters) const
+{
+  EZ_PROFILE_SCOPE("RenderClusters");
+
+  ezRenderContext* pContext = renderViewContext.m_pRenderContext;
+  const ezCamera& camera = *renderViewContext.m_pCamera;
+
+  ezClusterCullingContext context;
+  context.m_Frustum = ezFrustum::MakeFromMVP(renderViewContext.m_pViewData->m_ViewProjectionMatrix[0]);
+  context.m_vCameraPosition = ezSimdConversion::ToVec3(camera.GetCenterPosition());
+  context.m_vCameraDirection = ezSimdConversion::ToVec3(camera.GetCenterDirForwards());
+  context.m_bPerspective = camera.IsPerspective();
+  context.m_pRasterizer = pPass->GetPipeline()->GetRenderData().GetOcclusionRasterizer();
+
+  {
+    ezResourceLock<ezMaterialResource> pMaterial(batch.GetFirstData<ezMeshRenderData>()->m_hMaterial, ezResourceAcquireMode::AllowLoadingFallback);
+    context.m_bTwoSided = pMaterial->GetPermutationValue("TWO_SIDED").GetView() == "TRUE";
+  }
+
+  ezClusterDrawRanges ranges;
+
+  // every object needs its own set of primitive ranges, so instancing is not possible here
+  ezUInt32 uiIndex = 0;
+  for (auto it = batch.GetIterator<ezMeshRenderData>(); it.IsValid(); ++it, ++uiIndex)
+  {
+    CullClusters(context, it, clusters, ranges);
+
+    if (ranges.IsEmpty())
+      continue;
+
+    ezUInt32 uiInstanceDataOffset = 0;
+    ezArrayPtr<ezPerInstanceData> instanceData = pInstanceData->GetInstanceData(pContext, 1, uiInstanceDataOffset);
+
+    ezUInt32 uiFilteredCount = 0;
+    FillPerInstanceData(instanceData, batch, uiIndex, uiFilteredCount);
+
+    if (uiFilteredCount == 0)
+      continue;
+
+    pInstanceData->UpdateInstanceData(pContext, uiFilteredCount);
+
+    for (const ezClusterDrawRange& range : ranges)
+    {
+      pContext->DrawMeshBuffer(range.m_uiPrimitiveCount, range.m_uiFirstPrimitive, 1).IgnoreResult();
+    }
+  }
+}
+
 void ezMeshRenderer::SetAdditionalData(const ezRenderViewContext& renderViewContext, const ezMeshRenderData* pRenderData) const
 {
   renderViewContext.m_pRenderContext->SetShaderPermutationVariable("VERTEX_SKINNING", "FALSE");
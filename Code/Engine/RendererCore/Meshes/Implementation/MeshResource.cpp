@@ -31,6 +31,8 @@ ezResourceLoadDesc ezMeshResource::UnloadData(Unload WhatToUnload)
   {
     m_SubMeshes.Clear();
     m_SubMeshes.Compact();
+    m_Clusters.Clear();
+    m_Clusters.Compact();
     m_Materials.Clear();
     m_Materials.Compact();
     m_Bones.Clear();
@@ -78,7 +80,7 @@ ezResourceLoadDesc ezMeshResource::UpdateContent(ezStreamReader* Stream)
 
 void ezMeshResource::UpdateMemoryUsage(MemoryUsage& out_NewMemoryUsage)
 {
-  out_NewMemoryUsage.m_uiMemoryCPU = sizeof(ezMeshResource) + (ezUInt32)m_SubMeshes.GetHeapMemoryUsage() + (ezUInt32)m_Materials.GetHeapMemoryUsage();
+  out_NewMemoryUsage.m_uiMemoryCPU = sizeof(ezMeshResource) + (ezUInt32)m_SubMeshes.GetHeapMemoryUsage() + (ezUInt32)m_Clusters.GetHeapMemoryUsage() + (ezUInt32)m_Materials.GetHeapMemoryUsage();
   out_NewMemoryUsage.m_uiMemoryGPU = 0;
 }
 
@@ -91,9 +93,13 @@ EZ_RESOURCE_IMPLEMENT_CREATEABLE(ezMeshResource, ezMeshResourceDescriptor)
   m_Bones = descriptor.m_Bones;
   m_fMaxBoneVertexOffset = descriptor.m_fMaxBoneVertexOffset;
 
+  m_fTexCoord0Density = 0.0f;
+
   // otherwise create a new mesh buffer from the descriptor
   if (!m_hMeshBuffer.IsValid())
   {
+    m_fTexCoord0Density = descriptor.MeshBufferDesc().ComputeTexCoord0Density();
+
     s_uiMeshBufferNameSuffix++;
     ezStringBuilder sMbName;
     sMbName.SetFormat("{0}  [MeshBuffer {1}]", GetResourceID(), ezArgU(s_uiMeshBufferNameSuffix, 4, true, 16, true));
@@ -105,6 +111,7 @@ EZ_RESOURCE_IMPLEMENT_CREATEABLE(ezMeshResource, ezMeshResourceDescriptor)
   }
 
   m_SubMeshes = descriptor.GetSubMeshes();
+  m_Clusters = descriptor.GetClusters();
 
   m_Materials.Clear();
   m_Materials.Reserve(descriptor.GetMaterials().GetCount());
@@ -11,6 +11,158 @@
 #  include <Foundation/IO/CompressedStreamZstd.h>
 #endif
 
+#include <meshoptimizer/meshoptimizer.h>
+
+EZ_DEFINE_AS_POD_TYPE(meshopt_Meshlet);
+
+namespace
+{
+  struct ezMeshBufferEncoding
+  {
+    enum Enum : ezUInt8
+    {
+      None = 0,
+      VertexCodec = 1,          ///< meshopt_encodeVertexBuffer
+      VertexCodecExpFilter = 2, ///< meshopt_encodeFilterExp followed by meshopt_encodeVertexBuffer
+      IndexBufferCodec = 3,     ///< meshopt_encodeIndexBuffer, only for triangle lists
+      IndexSequenceCodec = 4,   ///< meshopt_encodeIndexSequence
+    };
+  };
+
+  void ReadIndices(const ezMeshBufferResourceDescriptor& mb, ezDynamicArray<ezUInt32>& out_indices)
+  {
+    const ezArrayPtr<const ezUInt8> data = mb.GetIndexBufferData();
+
+    if (mb.Uses32BitIndices())
+    {
+      out_indices.SetCountUninitialized(data.GetCount() / sizeof(ezUInt32));
+      ezMemoryUtils::Copy(out_indices.GetData(), reinterpret_cast<const ezUInt32*>(data.GetPtr()), out_indices.GetCount());
+    }
+    else
+    {
+      const ezUInt16* pIndices16 = reinterpret_cast<const ezUInt16*>(data.GetPtr());
+
+      out_indices.SetCountUninitialized(data.GetCount() / sizeof(ezUInt16));
+      for (ezUInt32 i = 0; i < out_indices.GetCount(); ++i)
+      {
+        out_indices[i] = pIndices16[i];
+      }
+    }
+  }
+
+  void WriteIndices(ezMeshBufferResourceDescriptor& ref_mb, ezArrayPtr<const ezUInt32> indices)
+  {
+    ezArrayPtr<ezUInt8> data = ref_mb.GetIndexBufferData().GetArrayPtr();
+
+    if (ref_mb.Uses32BitIndices())
+    {
+      ezMemoryUtils::Copy(reinterpret_cast<ezUInt32*>(data.GetPtr()), indices.GetPtr(), indices.GetCount());
+    }
+    else
+    {
+      ezUInt16* pIndices16 = reinterpret_cast<ezUInt16*>(data.GetPtr());
+
+      for (ezUInt32 i = 0; i < indices.GetCount(); ++i)
+      {
+        pIndices16[i] = static_cast<ezUInt16>(indices[i]);
+      }
+    }
+  }
+
+  void WriteVertexStream(ezChunkStreamWriter& inout_chunk, ezArrayPtr<const ezUInt8> data, ezUInt32 uiVertexCount, ezUInt32 uiElementSize, bool bEncode, ezUInt8 uiPositionQuantizationBits)
+  {
+    // size in bytes
+    inout_chunk << data.GetCount();
+
+    // the vertex codec requires the vertex size to be a multiple of 4 and at most 256 bytes
+    if (!bEncode || data.IsEmpty() || (uiElementSize % 4) != 0 || uiElementSize > 256)
+    {
+      inout_chunk << (ezUInt8)ezMeshBufferEncoding::None;
+
+      if (!data.IsEmpty())
+      {
+        inout_chunk.WriteBytes(data.GetPtr(), data.GetCount()).IgnoreResult();
+      }
+
+      return;
+    }
+
+    ezDynamicArray<ezUInt8> filtered;
+    ezMeshBufferEncoding::Enum encoding = ezMeshBufferEncoding::VertexCodec;
+
+    if (uiPositionQuantizationBits > 0)
+    {
+      filtered.SetCountUninitialized(data.GetCount());
+      meshopt_encodeFilterExp(filtered.GetData(), uiVertexCount, uiElementSize, ezMath::Clamp<int>(uiPositionQuantizationBits, 1, 23), reinterpret_cast<const float*>(data.GetPtr()), meshopt_EncodeExpSharedVector);
+
+      data = filtered;
+      encoding = ezMeshBufferEncoding::VertexCodecExpFilter;
+    }
+
+    ezDynamicArray<ezUInt8> encoded;
+    encoded.SetCountUninitialized(static_cast<ezUInt32>(meshopt_encodeVertexBufferBound(uiVertexCount, uiElementSize)));
+    encoded.SetCount(static_cast<ezUInt32>(meshopt_encodeVertexBuffer(encoded.GetData(), encoded.GetCount(), data.GetPtr(), uiVertexCount, uiElementSize)));
+
+    inout_chunk << (ezUInt8)encoding;
+    inout_chunk << encoded.GetCount();
+    inout_chunk.WriteBytes(encoded.GetData(), encoded.GetCount()).IgnoreResult();
+  }
+
+  ezResult ReadVertexStream(ezChunkStreamReader& inout_chunk, ezArrayPtr<ezUInt8> data, ezUInt32 uiVertexCount, ezUInt32 uiElementSize, ezUInt32 uiChunkVersion)
+  {
+    // size in bytes
+    ezUInt32 uiCount = 0;
+    inout_chunk >> uiCount;
+    if (data.GetCount() != uiCount)
+    {
+      ezLog::Error("Buffer data size mismatch: Expected {} but got {}", ezArgFileSize(data.GetCount()), ezArgFileSize(uiCount));
+      return EZ_FAILURE;
+    }
+
+    ezUInt8 uiEncoding = ezMeshBufferEncoding::None;
+    if (uiChunkVersion >= 3)
+    {
+      inout_chunk >> uiEncoding;
+    }
+
+    if (uiEncoding == ezMeshBufferEncoding::None)
+    {
+      if (!data.IsEmpty())
+      {
+        inout_chunk.ReadBytes(data.GetPtr(), data.GetCount());
+      }
+
+      return EZ_SUCCESS;
+    }
+
+    if (uiEncoding != ezMeshBufferEncoding::VertexCodec && uiEncoding != ezMeshBufferEncoding::VertexCodecExpFilter)
+    {
+      ezLog::Error("Vertex buffer uses an unknown encoding ({})", uiEncoding);
+      return EZ_FAILURE;
+    }
+
+    ezUInt32 uiEncodedSize = 0;
+    inout_chunk >> uiEncodedSize;
+
+    ezDynamicArray<ezUInt8> encoded;
+    encoded.SetCountUninitialized(uiEncodedSize);
+    inout_chunk.ReadBytes(encoded.GetData(), encoded.GetCount());
+
+    if (meshopt_decodeVertexBuffer(data.GetPtr(), uiVertexCount, uiElementSize, encoded.GetData(), encoded.GetCount()) != 0)
+    {
+      ezLog::Error("Failed to decode vertex buffer");
+      return EZ_FAILURE;
+    }
+
+    if (uiEncoding == ezMeshBufferEncoding::VertexCodecExpFilter)
+    {
+      meshopt_decodeFilterExp(data.GetPtr(), uiVertexCount, uiElementSize);
+    }
+
+    return EZ_SUCCESS;
+  }
+} // namespace
+
 ezMeshResourceDescriptor::ezMeshResourceDescriptor()
 {
   m_Bounds = ezBoundingBoxSphere::MakeInvalid();
@@ -23,6 +175,7 @@ void ezMeshResourceDescriptor::Clear()
   m_Materials.Clear();
   m_MeshBufferDescriptor.Clear();
   m_SubMeshes.Clear();
+  m_Clusters.Clear();
 }
 
 ezMeshBufferResourceDescriptor& ezMeshResourceDescriptor::MeshBufferDesc()
@@ -55,12 +208,19 @@ ezArrayPtr<const ezMeshResourceDescriptor::SubMesh> ezMeshResourceDescriptor::Ge
   return m_SubMeshes;
 }
 
+ezArrayPtr<const ezMeshResourceDescriptor::Cluster> ezMeshResourceDescriptor::GetClusters() const
+{
+  return m_Clusters;
+}
+
 void ezMeshResourceDescriptor::CollapseSubMeshes()
 {
   for (ezUInt32 idx = 1; idx < m_SubMeshes.GetCount(); ++idx)
   {
     m_SubMeshes[0].m_uiFirstPrimitive = ezMath::Min(m_SubMeshes[0].m_uiFirstPrimitive, m_SubMeshes[idx].m_uiFirstPrimitive);
     m_SubMeshes[0].m_uiPrimitiveCount += m_SubMeshes[idx].m_uiPrimitiveCount;
+    m_SubMeshes[0].m_uiFirstCluster = ezMath::Min(m_SubMeshes[0].m_uiFirstCluster, m_SubMeshes[idx].m_uiFirstCluster);
+    m_SubMeshes[0].m_uiClusterCount += m_SubMeshes[idx].m_uiClusterCount;
 
     if (m_SubMeshes[0].m_Bounds.IsValid() && m_SubMeshes[idx].m_Bounds.IsValid())
     {
@@ -74,6 +234,139 @@ void ezMeshResourceDescriptor::CollapseSubMeshes()
   m_Materials.SetCount(1);
 }
 
+void ezMeshResourceDescriptor::OptimizeVertexOrder()
+{
+  ezMeshBufferResourceDescriptor& mb = m_MeshBufferDescriptor;
+
+  if (mb.GetTopology() != ezGALPrimitiveTopology::Triangles || !mb.HasIndexBuffer() || mb.GetVertexCount() == 0)
+    return;
+
+  const ezUInt32 uiVertexCount = mb.GetVertexCount();
+
+  ezDynamicArray<ezUInt32> indices;
+  ReadIndices(mb, indices);
+
+  // triangles are only reordered within each sub-mesh, so that the primitive ranges stay valid
+  // clustered meshes already have a cache friendly triangle order, which must not be changed anymore
+  if (m_SubMeshes.IsEmpty())
+  {
+    meshopt_optimizeVertexCache(indices.GetData(), indices.GetData(), indices.GetCount(), uiVertexCount);
+  }
+  else if (m_Clusters.IsEmpty())
+  {
+    for (const SubMesh& subMesh : m_SubMeshes)
+    {
+      ezUInt32* pSubMeshIndices = indices.GetData() + subMesh.m_uiFirstPrimitive * 3;
+      meshopt_optimizeVertexCache(pSubMeshIndices, pSubMeshIndices, subMesh.m_uiPrimitiveCount * 3, uiVertexCount);
+    }
+  }
+
+  ezDynamicArray<ezUInt32> remap;
+  remap.SetCountUninitialized(uiVertexCount);
+  ezUInt32 uiNextVertex = static_cast<ezUInt32>(meshopt_optimizeVertexFetchRemap(remap.GetData(), indices.GetData(), indices.GetCount(), uiVertexCount));
+
+  // unreferenced vertices are moved to the end, so that the vertex count doesn't change
+  for (ezUInt32& uiTarget : remap)
+  {
+    if (uiTarget == ~0u)
+    {
+      uiTarget = uiNextVertex++;
+    }
+  }
+
+  meshopt_remapIndexBuffer(indices.GetData(), indices.GetData(), indices.GetCount(), remap.GetData());
+  WriteIndices(mb, indices);
+
+  for (ezUInt32 idx : ezIterateBitIndices(mb.GetVertexStreamConfig().m_uiTypesMask))
+  {
+    auto type = static_cast<ezMeshVertexStreamType::Enum>(idx);
+    auto& data = mb.GetVertexBufferData(type);
+
+    meshopt_remapVertexBuffer(data.GetData(), data.GetData(), uiVertexCount, mb.GetVertexStreamConfig().GetStreamElementSize(type), remap.GetData());
+  }
+}
+
+void ezMeshResourceDescriptor::BuildClusters(ezUInt32 uiMaxVertices, ezUInt32 uiMaxTriangles)
+{
+  ezMeshBufferResourceDescriptor& mb = m_MeshBufferDescriptor;
+
+  if (mb.GetTopology() != ezGALPrimitiveTopology::Triangles || !mb.HasIndexBuffer() || mb.GetVertexCount() == 0 || !mb.GetVertexStreamConfig().HasPosition())
+    return;
+
+  // meshoptimizer limits
+  uiMaxVertices = ezMath::Clamp<ezUInt32>(uiMaxVertices, 3, 255);
+  uiMaxTriangles = ezMath::Clamp<ezUInt32>(uiMaxTriangles, 1, 512) & ~3u;
+
+  const ezUInt32 uiVertexCount = mb.GetVertexCount();
+  const ezArrayPtr<const ezVec3> positions = mb.GetPositionData();
+
+  ezDynamicArray<ezUInt32> indices;
+  ReadIndices(mb, indices);
+
+  if (m_SubMeshes.IsEmpty())
+  {
+    AddSubMesh(mb.GetPrimitiveCount(), 0, 0);
+  }
+
+  m_Clusters.Clear();
+
+  ezDynamicArray<meshopt_Meshlet> meshlets;
+  ezDynamicArray<ezUInt32> meshletVertices;
+  ezDynamicArray<ezUInt8> meshletTriangles;
+
+  for (SubMesh& subMesh : m_SubMeshes)
+  {
+    subMesh.m_uiFirstCluster = m_Clusters.GetCount();
+    subMesh.m_uiClusterCount = 0;
+
+    if (subMesh.m_uiPrimitiveCount == 0)
+      continue;
+
+    ezUInt32* pSubMeshIndices = indices.GetData() + subMesh.m_uiFirstPrimitive * 3;
+    const ezUInt32 uiIndexCount = subMesh.m_uiPrimitiveCount * 3;
+
+    const ezUInt32 uiMaxMeshlets = static_cast<ezUInt32>(meshopt_buildMeshletsBound(uiIndexCount, uiMaxVertices, uiMaxTriangles));
+    meshlets.SetCountUninitialized(uiMaxMeshlets);
+    meshletVertices.SetCountUninitialized(uiMaxMeshlets * uiMaxVertices);
+    meshletTriangles.SetCountUninitialized(uiMaxMeshlets * uiMaxTriangles * 3);
+
+    const ezUInt32 uiNumMeshlets = static_cast<ezUInt32>(meshopt_buildMeshlets(meshlets.GetData(), meshletVertices.GetData(), meshletTriangles.GetData(), pSubMeshIndices, uiIndexCount, &positions[0].x, uiVertexCount, sizeof(ezVec3), uiMaxVertices, uiMaxTriangles, 0.25f));
+
+    // write the triangles back in cluster order, so that every cluster becomes a contiguous range
+    ezUInt32 uiNextPrimitive = subMesh.m_uiFirstPrimitive;
+    ezUInt32* pTarget = pSubMeshIndices;
+
+    for (ezUInt32 m = 0; m < uiNumMeshlets; ++m)
+    {
+      const meshopt_Meshlet& meshlet = meshlets[m];
+      const ezUInt32* pVertices = meshletVertices.GetData() + meshlet.vertex_offset;
+      const ezUInt8* pTriangles = meshletTriangles.GetData() + meshlet.triangle_offset;
+
+      for (ezUInt32 i = 0; i < meshlet.triangle_count * 3; ++i)
+      {
+        *pTarget++ = pVertices[pTriangles[i]];
+      }
+
+      const meshopt_Bounds bounds = meshopt_computeMeshletBounds(pVertices, pTriangles, meshlet.triangle_count, &positions[0].x, uiVertexCount, sizeof(ezVec3));
+
+      Cluster& cluster = m_Clusters.ExpandAndGetRef();
+      cluster.m_uiFirstPrimitive = uiNextPrimitive;
+      cluster.m_uiPrimitiveCount = meshlet.triangle_count;
+      cluster.m_Bounds = ezBoundingSphere::MakeFromCenterAndRadius(ezVec3(bounds.center[0], bounds.center[1], bounds.center[2]), bounds.radius);
+      cluster.m_vConeAxis.Set(bounds.cone_axis[0], bounds.cone_axis[1], bounds.cone_axis[2]);
+      cluster.m_fConeCutoff = bounds.cone_cutoff;
+
+      uiNextPrimitive += meshlet.triangle_count;
+    }
+
+    EZ_ASSERT_DEV(uiNextPrimitive == subMesh.m_uiFirstPrimitive + subMesh.m_uiPrimitiveCount, "Not all triangles were assigned to a cluster");
+
+    subMesh.m_uiClusterCount = m_Clusters.GetCount() - subMesh.m_uiFirstCluster;
+  }
+
+  WriteIndices(mb, indices);
+}
+
 const ezBoundingBoxSphere& ezMeshResourceDescriptor::GetBounds() const
 {
   return m_Bounds;
@@ -85,6 +378,8 @@ void ezMeshResourceDescriptor::AddSubMesh(ezUInt32 uiPrimitiveCount, ezUInt32 ui
   p.m_uiFirstPrimitive = uiFirstPrimitive;
   p.m_uiPrimitiveCount = uiPrimitiveCount;
   p.m_uiMaterialIndex = uiMaterialIndex;
+  p.m_uiFirstCluster = 0;
+  p.m_uiClusterCount = 0;
   p.m_Bounds = ezBoundingBoxSphere::MakeInvalid();
 
   m_SubMeshes.PushBack(p);
@@ -165,6 +460,34 @@ void ezMeshResourceDescriptor::Save(ezStreamWriter& inout_stream)
     chunk.EndChunk();
   }
 
+  if (!m_Clusters.IsEmpty())
+  {
+    chunk.BeginChunk("Clusters", 1);
+
+    // cluster range of each sub-mesh
+    chunk << m_SubMeshes.GetCount();
+
+    for (ezUInt32 idx = 0; idx < m_SubMeshes.GetCount(); ++idx)
+    {
+      chunk << m_SubMeshes[idx].m_uiFirstCluster;
+      chunk << m_SubMeshes[idx].m_uiClusterCount;
+    }
+
+    chunk << m_Clusters.GetCount();
+
+    for (const Cluster& cluster : m_Clusters)
+    {
+      chunk << cluster.m_uiFirstPrimitive;
+      chunk << cluster.m_uiPrimitiveCount;
+      chunk << cluster.m_Bounds.m_vCenter;
+      chunk << cluster.m_Bounds.m_fRadius;
+      chunk << cluster.m_vConeAxis;
+      chunk << cluster.m_fConeCutoff;
+    }
+
+    chunk.EndChunk();
+  }
+
   {
     chunk.BeginChunk("MeshInfo", 5);
 
@@ -194,21 +517,17 @@ void ezMeshResourceDescriptor::Save(ezStreamWriter& inout_stream)
   }
 
   {
-    chunk.BeginChunk("VertexBuffer", 2);
+    chunk.BeginChunk("VertexBuffer", 3);
 
     const ezUInt32 uiNumBuffers = m_MeshBufferDescriptor.GetNumVertexBuffers();
     for (ezUInt32 i = 0; i < uiNumBuffers; ++i)
     {
       auto type = static_cast<ezMeshVertexStreamType::Enum>(i);
-      const auto& data = m_MeshBufferDescriptor.GetVertexBufferData(type);
+      const ezUInt32 uiElementSize = m_MeshBufferDescriptor.GetVertexStreamConfig().GetStreamElementSize(type);
+      const ezUInt8 uiQuantizationBits = (type == ezMeshVertexStreamType::Position) ? m_uiPositionQuantizationBits : 0;
 
-      // size in bytes
-      chunk << data.GetCount();
-
-      if (!data.IsEmpty())
-      {
-        chunk.WriteBytes(data.GetData(), data.GetCount()).IgnoreResult();
-      }
+      // Version 3: optional meshoptimizer encoding per stream
+      WriteVertexStream(chunk, m_MeshBufferDescriptor.GetVertexBufferData(type), m_MeshBufferDescriptor.GetVertexCount(), uiElementSize, m_bEncodeMeshBuffer, uiQuantizationBits);
     }
 
     chunk.EndChunk();
@@ -216,14 +535,47 @@ void ezMeshResourceDescriptor::Save(ezStreamWriter& inout_stream)
 
   // always write the index buffer chunk, even if it is empty
   {
-    chunk.BeginChunk("IndexBuffer", 1);
+    chunk.BeginChunk("IndexBuffer", 2);
+
+    const auto& indexData = m_MeshBufferDescriptor.GetIndexBufferData();
 
     // size in bytes
-    chunk << m_MeshBufferDescriptor.GetIndexBufferData().GetCount();
+    chunk << indexData.GetCount();
 
-    if (!m_MeshBufferDescriptor.GetIndexBufferData().IsEmpty())
+    // Version 2: optional meshoptimizer encoding
+    if (m_bEncodeMeshBuffer && !indexData.IsEmpty())
     {
-      chunk.WriteBytes(m_MeshBufferDescriptor.GetIndexBufferData().GetData(), m_MeshBufferDescriptor.GetIndexBufferData().GetCount()).IgnoreResult();
+      ezDynamicArray<ezUInt32> indices;
+      ReadIndices(m_MeshBufferDescriptor, indices);
+
+      ezDynamicArray<ezUInt8> encoded;
+      ezMeshBufferEncoding::Enum encoding;
+
+      if (m_MeshBufferDescriptor.GetTopology() == ezGALPrimitiveTopology::Triangles)
+      {
+        encoding = ezMeshBufferEncoding::IndexBufferCodec;
+        encoded.SetCountUninitialized(static_cast<ezUInt32>(meshopt_encodeIndexBufferBound(indices.GetCount(), m_MeshBufferDescriptor.GetVertexCount())));
+        encoded.SetCount(static_cast<ezUInt32>(meshopt_encodeIndexBuffer(encoded.GetData(), encoded.GetCount(), indices.GetData(), indices.GetCount())));
+      }
+      else
+      {
+        encoding = ezMeshBufferEncoding::IndexSequenceCodec;
+        encoded.SetCountUninitialized(static_cast<ezUInt32>(meshopt_encodeIndexSequenceBound(indices.GetCount(), m_MeshBufferDescriptor.GetVertexCount())));
+        encoded.SetCount(static_cast<ezUInt32>(meshopt_encodeIndexSequence(encoded.GetData(), encoded.GetCount(), indices.GetData(), indices.GetCount())));
+      }
+
+      chunk << (ezUInt8)encoding;
+      chunk << encoded.GetCount();
+      chunk.WriteBytes(encoded.GetData(), encoded.GetCount()).IgnoreResult();
+    }
+    else
+    {
+      chunk << (ezUInt8)ezMeshBufferEncoding::None;
+
+      if (!indexData.IsEmpty())
+      {
+        chunk.WriteBytes(indexData.GetData(), indexData.GetCount()).IgnoreResult();
+      }
     }
 
     chunk.EndChunk();
@@ -367,11 +719,49 @@ ezResult ezMeshResourceDescriptor::Load(ezStreamReader& inout_stream)
         chunk >> m_SubMeshes[idx].m_uiFirstPrimitive;
         chunk >> m_SubMeshes[idx].m_uiPrimitiveCount;
 
+        m_SubMeshes[idx].m_uiFirstCluster = 0;
+        m_SubMeshes[idx].m_uiClusterCount = 0;
+
         /// \todo load from file
         m_SubMeshes[idx].m_Bounds = ezBoundingBoxSphere::MakeInvalid();
       }
     }
 
+    if (ci.m_sChunkName == "Clusters")
+    {
+      if (ci.m_uiChunkVersion != 1)
+      {
+        ezLog::Error("Version of chunk '{0}' is invalid ({1})", ci.m_sChunkName, ci.m_uiChunkVersion);
+        return EZ_FAILURE;
+      }
+
+      chunk >> count;
+      if (count != m_SubMeshes.GetCount())
+      {
+        ezLog::Error("Cluster data doesn't match the number of sub-meshes ({0} vs {1})", count, m_SubMeshes.GetCount());
+        return EZ_FAILURE;
+      }
+
+      for (ezUInt32 i = 0; i < m_SubMeshes.GetCount(); ++i)
+      {
+        chunk >> m_SubMeshes[i].m_uiFirstCluster;
+        chunk >> m_SubMeshes[i].m_uiClusterCount;
+      }
+
+      chunk >> count;
+      m_Clusters.SetCountUninitialized(count);
+
+      for (Cluster& cluster : m_Clusters)
+      {
+        chunk >> cluster.m_uiFirstPrimitive;
+        chunk >> cluster.m_uiPrimitiveCount;
+        chunk >> cluster.m_Bounds.m_vCenter;
+        chunk >> cluster.m_Bounds.m_fRadius;
+        chunk >> cluster.m_vConeAxis;
+        chunk >> cluster.m_fConeCutoff;
+      }
+    }
+
     if (ci.m_sChunkName == "MeshInfo")
     {
       if (ci.m_uiChunkVersion != 5)
@@ -422,7 +812,7 @@ ezResult ezMeshResourceDescriptor::Load(ezStreamReader& inout_stream)
 
     if (ci.m_sChunkName == "VertexBuffer")
     {
-      if (ci.m_uiChunkVersion != 2)
+      if (ci.m_uiChunkVersion != 2 && ci.m_uiChunkVersion != 3)
       {
         ezLog::Error("Version of chunk '{0}' is invalid ({1})", ci.m_sChunkName, ci.m_uiChunkVersion);
         return EZ_FAILURE;
@@ -432,37 +822,65 @@ ezResult ezMeshResourceDescriptor::Load(ezStreamReader& inout_stream)
       for (ezUInt32 i = 0; i < uiNumBuffers; ++i)
       {
         auto type = static_cast<ezMeshVertexStreamType::Enum>(i);
-        auto& data = m_MeshBufferDescriptor.GetVertexBufferData(type);
+        const ezUInt32 uiElementSize = m_MeshBufferDescriptor.GetVertexStreamConfig().GetStreamElementSize(type);
 
-        // size in bytes
-        chunk >> count;
-        if (data.GetCount() != count)
-        {
-          ezLog::Error("Buffer data size mismatch: Expected {} but got {}", ezArgFileSize(data.GetCount()), ezArgFileSize(count));
-          return EZ_FAILURE;
-        }
-
-        if (!data.IsEmpty())
-        {
-          chunk.ReadBytes(data.GetData(), data.GetCount());
-        }
+        EZ_SUCCEED_OR_RETURN(ReadVertexStream(chunk, m_MeshBufferDescriptor.GetVertexBufferData(type), m_MeshBufferDescriptor.GetVertexCount(), uiElementSize, ci.m_uiChunkVersion));
       }
     }
 
     if (ci.m_sChunkName == "IndexBuffer")
     {
-      if (ci.m_uiChunkVersion != 1)
+      if (ci.m_uiChunkVersion != 1 && ci.m_uiChunkVersion != 2)
       {
         ezLog::Error("Version of chunk '{0}' is invalid ({1})", ci.m_sChunkName, ci.m_uiChunkVersion);
         return EZ_FAILURE;
       }
 
+      auto& indexData = m_MeshBufferDescriptor.GetIndexBufferData();
+
       // size in bytes
       chunk >> count;
-      m_MeshBufferDescriptor.GetIndexBufferData().SetCountUninitialized(count);
+      indexData.SetCountUninitialized(count);
 
-      if (!m_MeshBufferDescriptor.GetIndexBufferData().IsEmpty())
-        chunk.ReadBytes(m_MeshBufferDescriptor.GetIndexBufferData().GetData(), m_MeshBufferDescriptor.GetIndexBufferData().GetCount());
+      ezUInt8 uiEncoding = ezMeshBufferEncoding::None;
+      if (ci.m_uiChunkVersion >= 2)
+      {
+        chunk >> uiEncoding;
+      }
+
+      if (uiEncoding == ezMeshBufferEncoding::None)
+      {
+        if (!indexData.IsEmpty())
+          chunk.ReadBytes(indexData.GetData(), indexData.GetCount());
+      }
+      else
+      {
+        ezUInt32 uiEncodedSize = 0;
+        chunk >> uiEncodedSize;
+
+        ezDynamicArray<ezUInt8> encoded;
+        encoded.SetCountUninitialized(uiEncodedSize);
+        chunk.ReadBytes(encoded.GetData(), encoded.GetCount());
+
+        const ezUInt32 uiIndexSize = m_MeshBufferDescriptor.Uses32BitIndices() ? sizeof(ezUInt32) : sizeof(ezUInt16);
+        const ezUInt32 uiIndexCount = indexData.GetCount() / uiIndexSize;
+
+        int iResult = -1;
+        if (uiEncoding == ezMeshBufferEncoding::IndexBufferCodec)
+        {
+          iResult = meshopt_decodeIndexBuffer(indexData.GetData(), uiIndexCount, uiIndexSize, encoded.GetData(), encoded.GetCount());
+        }
+        else if (uiEncoding == ezMeshBufferEncoding::IndexSequenceCodec)
+        {
+          iResult = meshopt_decodeIndexSequence(indexData.GetData(), uiIndexCount, uiIndexSize, encoded.GetData(), encoded.GetCount());
+        }
+
+        if (iResult != 0)
+        {
+          ezLog::Error("Failed to decode index buffer (encoding {})", uiEncoding);
+          return EZ_FAILURE;
+        }
+      }
     }
 
     if (ci.m_sChunkName == "BindPose")
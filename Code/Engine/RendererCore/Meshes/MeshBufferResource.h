@@ -234,6 +234,12 @@ public:
   /// \brief Calculates the bounds using the data from the position stream
   ezBoundingBoxSphere ComputeBounds() const;
 
+  /// \brief Calculates how many texture coordinate units map to one unit in object space, averaged over all triangles.
+  ///
+  /// This is used to estimate which texture mip level is needed for a given on-screen size.
+  /// Returns 0, if the mesh has no triangles or no texture coordinates.
+  float ComputeTexCoord0Density() const;
+
   /// \brief Returns the primitive topology
   ezGALPrimitiveTopology::Enum GetTopology() const { return m_Topology; }
 
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <RendererCore/Meshes/MeshResourceDescriptor.h>
 #include <RendererCore/Pipeline/Renderer.h>
 
 class ezMeshRenderData;
+struct ezInstanceData;
 struct ezPerInstanceData;
 
 /// \brief Implements rendering of static meshes
@@ -25,4 +27,7 @@ protected:
   virtual void SetAdditionalData(const ezRenderViewContext& renderViewContext, const ezMeshRenderData* pRenderData) const;
   virtual void FillPerInstanceData(
     ezArrayPtr<ezPerInstanceData> instanceData, const ezRenderDataBatch& batch, ezUInt32 uiStartIndex, ezUInt32& out_uiFilteredCount) const;
+
+  /// \brief Draws every object of the batch individually with only those clusters that pass frustum, normal cone and occlusion culling.
+  void RenderClusters(const ezRenderViewContext& renderViewContext, const ezRenderPipelinePass* pPass, const ezRenderDataBatch& batch, ezInstanceData* pInstanceData, ezArrayPtr<const ezMeshResourceDescriptor::Cluster> clusters) const;
 };
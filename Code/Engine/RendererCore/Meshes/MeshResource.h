@@ -17,6 +17,9 @@ public:
   /// \brief Returns the array of sub-meshes in this mesh.
   ezArrayPtr<const ezMeshResourceDescriptor::SubMesh> GetSubMeshes() const { return m_SubMeshes; }
 
+  /// \brief Returns the clusters of all sub-meshes. Empty if the mesh was not built with clusters.
+  ezArrayPtr<const ezMeshResourceDescriptor::Cluster> GetClusters() const { return m_Clusters; }
+
   /// \brief Returns the mesh buffer that is used by this resource.
   const ezMeshBufferResourceHandle& GetMeshBuffer() const { return m_hMeshBuffer; }
 
@@ -26,6 +29,9 @@ public:
   /// \brief Returns the bounds of this mesh.
   const ezBoundingBoxSphere& GetBounds() const { return m_Bounds; }
 
+  /// \brief Returns how many texture coordinate units map to one unit in object space. 0 if unknown.
+  float GetTexCoord0Density() const { return m_fTexCoord0Density; }
+
   // TODO: clean up
   ezSkeletonResourceHandle m_hDefaultSkeleton;
   ezHashTable<ezHashedString, ezMeshResourceDescriptor::BoneData> m_Bones;
@@ -37,10 +43,12 @@ private:
   virtual void UpdateMemoryUsage(MemoryUsage& out_NewMemoryUsage) override;
 
   ezDynamicArray<ezMeshResourceDescriptor::SubMesh> m_SubMeshes;
+  ezDynamicArray<ezMeshResourceDescriptor::Cluster> m_Clusters;
   ezMeshBufferResourceHandle m_hMeshBuffer;
   ezDynamicArray<ezMaterialResourceHandle> m_Materials;
 
   ezBoundingBoxSphere m_Bounds;
+  float m_fTexCoord0Density = 0.0f;
 
   static ezUInt32 s_uiMeshBufferNameSuffix;
 };
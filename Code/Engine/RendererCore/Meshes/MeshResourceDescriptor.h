@@ -16,9 +16,31 @@ public:
     ezUInt32 m_uiFirstPrimitive;
     ezUInt32 m_uiMaterialIndex;
 
+    /// Range in the cluster array, only set after BuildClusters() was called.
+    ezUInt32 m_uiFirstCluster = 0;
+    ezUInt32 m_uiClusterCount = 0;
+
     ezBoundingBoxSphere m_Bounds;
   };
 
+  /// \brief A small, spatially coherent group of triangles (a meshlet) that can be culled individually.
+  ///
+  /// All triangles of a cluster form one contiguous primitive range within the index buffer of its sub-mesh.
+  struct Cluster
+  {
+    EZ_DECLARE_POD_TYPE();
+
+    ezUInt32 m_uiFirstPrimitive;
+    ezUInt32 m_uiPrimitiveCount;
+
+    ezBoundingSphere m_Bounds;
+
+    /// Normal cone for back-face culling. The cluster is invisible for all viewers that see it from within the cone around m_vConeAxis.
+    /// A cutoff of 1 or more means that the normals are too spread out for this test.
+    ezVec3 m_vConeAxis;
+    float m_fConeCutoff;
+  };
+
   struct Material
   {
     ezString m_sPath;
@@ -50,9 +72,23 @@ public:
 
   ezArrayPtr<const SubMesh> GetSubMeshes() const;
 
+  ezArrayPtr<const Cluster> GetClusters() const;
+
   /// \brief Merges all submeshes into just one.
   void CollapseSubMeshes();
 
+  /// \brief Reorders the triangles of every sub-mesh for better vertex cache utilization and afterwards reorders the vertices for better vertex fetch locality.
+  ///
+  /// The primitive ranges of the sub-meshes stay the same. Does nothing for meshes that do not use an indexed triangle list.
+  void OptimizeVertexOrder();
+
+  /// \brief Splits every sub-mesh into clusters of at most the given number of vertices and triangles.
+  ///
+  /// The triangles inside each sub-mesh are reordered, such that every cluster is a contiguous primitive range.
+  /// The renderer uses the cluster bounds and normal cones to skip invisible parts of large meshes.
+  /// Does nothing for meshes that do not use an indexed triangle list.
+  void BuildClusters(ezUInt32 uiMaxVertices = 64, ezUInt32 uiMaxTriangles = 124);
+
   void ComputeBounds();
   const ezBoundingBoxSphere& GetBounds() const;
   void SetBounds(const ezBoundingBoxSphere& bounds) { m_Bounds = bounds; }
@@ -70,9 +106,21 @@ public:
   ezHashTable<ezHashedString, BoneData> m_Bones;
   float m_fMaxBoneVertexOffset = 0.0f; // the maximum distance between any vertex and its influencing bones, can be used for adjusting the bounding box of a pose
 
+  /// \brief If set, Save() stores the vertex and index buffers with meshoptimizer's vertex and index codecs, which compress a lot better.
+  ///
+  /// The data is decoded again in Load(), so at runtime this happens on the resource loading thread.
+  /// Works best when OptimizeVertexOrder() was called before.
+  bool m_bEncodeMeshBuffer = false;
+
+  /// \brief If non-zero (and m_bEncodeMeshBuffer is set), positions are quantized to this many mantissa bits (1 - 23) with one shared exponent per vertex.
+  ///
+  /// This is lossy, but makes the encoded position stream much smaller. Around 14 bits are sufficient for most props.
+  ezUInt8 m_uiPositionQuantizationBits = 0;
+
 private:
   ezHybridArray<Material, 8> m_Materials;
   ezHybridArray<SubMesh, 8> m_SubMeshes;
+  ezDynamicArray<Cluster> m_Clusters;
   ezMeshBufferResourceDescriptor m_MeshBufferDescriptor;
   ezMeshBufferResourceHandle m_hMeshBuffer;
   ezBoundingBoxSphere m_Bounds;
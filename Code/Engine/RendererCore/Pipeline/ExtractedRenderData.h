@@ -6,6 +6,8 @@
 #include <RendererCore/Pipeline/RenderDataBatch.h>
 #include <RendererCore/Pipeline/ViewData.h>
 
+class ezRasterizerView;
+
 class EZ_RENDERERCORE_DLL ezExtractedRenderData
 {
 public:
@@ -20,6 +22,10 @@ public:
   EZ_ALWAYS_INLINE void SetViewData(const ezViewData& viewData) { m_ViewData = viewData; }
   EZ_ALWAYS_INLINE const ezViewData& GetViewData() const { return m_ViewData; }
 
+  /// \brief The software occlusion buffer that was used to cull this data. May be null.
+  EZ_ALWAYS_INLINE void SetOcclusionRasterizer(const ezRasterizerView* pRasterizer) { m_pOcclusionRasterizer = pRasterizer; }
+  EZ_ALWAYS_INLINE const ezRasterizerView* GetOcclusionRasterizer() const { return m_pOcclusionRasterizer; }
+
   EZ_ALWAYS_INLINE void SetWorldTime(ezTime time) { m_WorldTime = time; }
   EZ_ALWAYS_INLINE ezTime GetWorldTime() const { return m_WorldTime; }
 
@@ -58,6 +64,7 @@ private:
   ezCamera m_Camera;
   ezCamera m_LodCamera; // Temporary until we have a real LOD system
   ezViewData m_ViewData;
+  const ezRasterizerView* m_pOcclusionRasterizer = nullptr;
   ezTime m_WorldTime;
 
   ezDebugRendererContext m_WorldDebugContext;
@@ -80,6 +80,7 @@ void ezExtractedRenderData::Clear()
   }
 
   m_FrameData.Clear();
+  m_pOcclusionRasterizer = nullptr;
 }
 
 ezRenderDataBatchList ezExtractedRenderData::GetRenderDataBatchesWithCategory(ezRenderData::Category category) const
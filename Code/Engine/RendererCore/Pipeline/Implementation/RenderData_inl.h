@@ -63,7 +63,7 @@ static T* ezCreateRenderDataForThisFrame(const ezGameObject* pOwner)
 {
   static_assert(EZ_IS_DERIVED_FROM_STATIC(ezRenderData, T));
 
-  T* pRenderData = EZ_NEW(ezFrameAllocator::GetCurrentAllocator(), T);
+  T* pRenderData = EZ_NEW(ezRenderWorld::GetRenderDataAllocator(), T);
 
   if (pOwner != nullptr)
   {
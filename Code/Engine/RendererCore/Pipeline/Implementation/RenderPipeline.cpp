@@ -23,6 +23,7 @@
 #include <RendererCore/Rasterizer/RasterizerView.h>
 #include <RendererCore/RenderContext/RenderContext.h>
 #include <RendererCore/RenderWorld/RenderWorld.h>
+#include <RendererCore/Textures/Implementation/TextureStreamingManager.h>
 #include <RendererFoundation/Profiling/Profiling.h>
 #include <RendererFoundation/Resources/Texture.h>
 
@@ -49,6 +50,28 @@ ezRenderPipeline::ezRenderPipeline()
 #endif
 }
 
+ezUniquePtr<ezRasterizerViewPool> g_pRasterizerViewPool;
+
+// clang-format off
+EZ_BEGIN_SUBSYSTEM_DECLARATION(RendererCore, SwRasterizer)
+
+  BEGIN_SUBSYSTEM_DEPENDENCIES
+    "Core"
+  END_SUBSYSTEM_DEPENDENCIES
+
+  ON_CORESYSTEMS_STARTUP
+  {
+    g_pRasterizerViewPool = EZ_DEFAULT_NEW(ezRasterizerViewPool);
+  }
+
+  ON_CORESYSTEMS_SHUTDOWN
+  {
+    g_pRasterizerViewPool.Clear();
+  }
+
+EZ_END_SUBSYSTEM_DECLARATION;
+// clang-format on
+
 ezRenderPipeline::~ezRenderPipeline()
 {
   if (!m_hOcclusionDebugViewTexture.IsInvalidated())
@@ -61,6 +84,16 @@ ezRenderPipeline::~ezRenderPipeline()
   m_Data[0].Clear();
   m_Data[1].Clear();
 
+  for (ezRasterizerView*& pRasterizer : m_pOcclusionRasterizer)
+  {
+    if (pRasterizer != nullptr && g_pRasterizerViewPool != nullptr)
+    {
+      g_pRasterizerViewPool->ReturnRasterizerView(pRasterizer);
+    }
+
+    pRasterizer = nullptr;
+  }
+
   ClearRenderPassGraphTextures();
   while (!m_Passes.IsEmpty())
   {
@@ -942,6 +975,7 @@ void ezRenderPipeline::ExtractData(const ezView& view)
   data.SetCamera(*view.GetCamera());
   data.SetLodCamera(*view.GetLodCamera());
   data.SetViewData(view.GetData());
+  data.SetOcclusionRasterizer(m_pOcclusionRasterizer[ezRenderWorld::GetDataIndexForExtraction()]);
   data.SetWorldTime(view.GetWorld()->GetClock().GetAccumulatedTime());
   data.SetWorldDebugContext(view.GetWorld());
   data.SetViewDebugContext(view.GetHandle());
@@ -974,31 +1008,11 @@ void ezRenderPipeline::ExtractData(const ezView& view)
     }
   }
 
+  ezTextureStreamingManager::GatherDemand(data);
+
   m_CurrentExtractThread = (ezThreadID)0;
 }
 
-ezUniquePtr<ezRasterizerViewPool> g_pRasterizerViewPool;
-
-// clang-format off
-EZ_BEGIN_SUBSYSTEM_DECLARATION(RendererCore, SwRasterizer)
-
-  BEGIN_SUBSYSTEM_DEPENDENCIES
-    "Core"
-  END_SUBSYSTEM_DEPENDENCIES
-
-  ON_CORESYSTEMS_STARTUP
-  {
-    g_pRasterizerViewPool = EZ_DEFAULT_NEW(ezRasterizerViewPool);
-  }
-
-  ON_CORESYSTEMS_SHUTDOWN
-  {
-    g_pRasterizerViewPool.Clear();
-  }
-
-EZ_END_SUBSYSTEM_DECLARATION;
-// clang-format on
-
 void ezRenderPipeline::FindVisibleObjects(const ezView& view)
 {
   EZ_PROFILE_SCOPE("ezRenderPipeline::FindVisibleObjects");
@@ -1027,7 +1041,13 @@ void ezRenderPipeline::FindVisibleObjects(const ezView& view)
   limitedFrustum.AccessPlane(ezFrustum::PlaneType::FarPlane) = ezPlane::MakeFromNormalAndPoint(farPlane.m_vNormal, view.GetCullingCamera()->GetCenterPosition() + farPlane.m_vNormal * cvar_SpatialCullingOcclusionFarPlane.GetValue()); // only use occluders closer than this
 
   ezRasterizerView* pRasterizer = PrepareOcclusionCulling(limitedFrustum, view);
-  EZ_SCOPE_EXIT(g_pRasterizerViewPool->ReturnRasterizerView(pRasterizer));
+
+  // the previous occlusion buffer for this data index has been rendered already, the new one is passed on to the renderers
+  {
+    ezRasterizerView*& pStoredRasterizer = m_pOcclusionRasterizer[ezRenderWorld::GetDataIndexForExtraction()];
+    g_pRasterizerViewPool->ReturnRasterizerView(pStoredRasterizer);
+    pStoredRasterizer = pRasterizer;
+  }
 
   const ezVisibilityState::Enum visType = bIsMainView ? ezVisibilityState::Direct : ezVisibilityState::Indirect;
 
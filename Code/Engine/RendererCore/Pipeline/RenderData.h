@@ -6,6 +6,7 @@
 #include <Foundation/Memory/FrameAllocator.h>
 #include <Foundation/Strings/HashedString.h>
 #include <RendererCore/Pipeline/Declarations.h>
+#include <RendererCore/RenderWorld/RenderWorld.h>
 
 class ezRasterizerObject;
 
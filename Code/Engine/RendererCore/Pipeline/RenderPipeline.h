@@ -108,6 +108,9 @@ private: // Member data
   ezExtractedRenderData m_Data[2];
   ezDynamicArray<const ezGameObject*> m_VisibleObjects;
 
+  // The occlusion buffer is kept alive until the extracted data has been rendered, so that renderers can use it for finer grained culling
+  ezRasterizerView* m_pOcclusionRasterizer[2] = {nullptr, nullptr};
+
 #if EZ_ENABLED(EZ_COMPILE_FOR_DEVELOPMENT)
   ezTime m_AverageCullingTime;
 #endif
@@ -51,6 +51,12 @@ namespace
     }
     return 0;
   }
+
+  ezUInt64 HashPermutationVariable(const ezHashedString& sName, const ezHashedString& sValue)
+  {
+    const ezUInt64 hashes[2] = {sName.GetHash(), sValue.GetHash()};
+    return ezHashingUtils::xxHash64(hashes, sizeof(hashes));
+  }
 } // namespace
 
 // clang-format off
@@ -96,6 +102,8 @@ ezRenderContext::Statistics::Statistics()
 void ezRenderContext::Statistics::Reset()
 {
   m_uiFailedDrawcalls = 0;
+  m_uiShaderPermutationCacheHits = 0;
+  m_uiShaderPermutationCacheMisses = 0;
   for (ezUInt32 i = 0; i < EZ_GAL_MAX_BIND_GROUPS; ++i)
   {
     m_uiModifiedBindGroup[i] = 0;
@@ -606,6 +614,7 @@ void ezRenderContext::ResetContextState()
 
   m_hActiveShader.Invalidate();
   m_PermutationVariables.Clear();
+  m_uiPermutationVariablesKey = 0;
   m_hActiveShaderPermutation.Invalidate();
   m_sActiveShader.Clear();
   m_hActiveGALShader.Invalidate();
@@ -902,6 +911,8 @@ void ezRenderContext::GALStaticDeviceEventHandler(const ezGALDeviceEvent& e)
     if (s_pDefaultInstance)
     {
       ezRenderContext::Statistics stats = s_pDefaultInstance->GetAndResetStatistics();
+      ezStats::SetStat("RenderContext/ShaderPermutationCacheHits", stats.m_uiShaderPermutationCacheHits);
+      ezStats::SetStat("RenderContext/ShaderPermutationCacheMisses", stats.m_uiShaderPermutationCacheMisses);
       for (ezUInt32 i = 0; i < EZ_GAL_MAX_BIND_GROUPS; ++i)
       {
         ezStringBuilder groupName;
@@ -994,6 +1005,16 @@ void ezRenderContext::UploadConstants()
   s_DirtyConstantBuffers.Clear();
 }
 
+ezUInt32 ezRenderContext::ShaderPermutationCacheKeyHashHelper::Hash(const ShaderPermutationCacheKey& key)
+{
+  return ezHashingUtils::CombineHashValues32(ezHashHelper<ezShaderResourceHandle>::Hash(key.m_hShader), ezHashingUtils::StringHashTo32(key.m_uiPermutationVariablesKey));
+}
+
+bool ezRenderContext::ShaderPermutationCacheKeyHashHelper::Equal(const ShaderPermutationCacheKey& a, const ShaderPermutationCacheKey& b)
+{
+  return a.m_hShader == b.m_hShader && a.m_uiPermutationVariablesKey == b.m_uiPermutationVariablesKey;
+}
+
 void ezRenderContext::SetShaderPermutationVariableInternal(const ezHashedString& sName, const ezHashedString& sValue)
 {
   ezHashedString* pOldValue = nullptr;
@@ -1001,6 +1022,12 @@ void ezRenderContext::SetShaderPermutationVariableInternal(const ezHashedString&
 
   if (pOldValue == nullptr || *pOldValue != sValue)
   {
+    if (pOldValue != nullptr)
+    {
+      m_uiPermutationVariablesKey ^= HashPermutationVariable(sName, *pOldValue);
+    }
+    m_uiPermutationVariablesKey ^= HashPermutationVariable(sName, sValue);
+
     m_PermutationVariables.Insert(sName, sValue);
     m_StateFlags.Add(ezRenderContextFlags::ShaderStateChanged);
   }
@@ -1026,10 +1053,33 @@ ezResult ezRenderContext::ApplyShaderState()
   if (!m_hActiveShader.IsValid())
     return EZ_FAILURE;
 
-  m_hActiveShaderPermutation = ezShaderManager::PreloadSinglePermutation(m_hActiveShader, m_PermutationVariables, m_bAllowAsyncShaderLoading);
+  // a shader (or permutation variable config) was reloaded, the cached permutations may not match anymore
+  const ezUInt32 uiShaderChangeCounter = ezShaderManager::GetShaderChangeCounter();
+  if (m_uiShaderPermutationCacheChangeCounter != uiShaderChangeCounter)
+  {
+    m_ShaderPermutationCache.Clear();
+    m_uiShaderPermutationCacheChangeCounter = uiShaderChangeCounter;
+  }
 
-  if (!m_hActiveShaderPermutation.IsValid())
-    return EZ_FAILURE;
+  ShaderPermutationCacheKey cacheKey;
+  cacheKey.m_hShader = m_hActiveShader;
+  cacheKey.m_uiPermutationVariablesKey = m_uiPermutationVariablesKey;
+
+  if (m_ShaderPermutationCache.TryGetValue(cacheKey, m_hActiveShaderPermutation))
+  {
+    m_Statistics.m_uiShaderPermutationCacheHits++;
+  }
+  else
+  {
+    m_Statistics.m_uiShaderPermutationCacheMisses++;
+
+    m_hActiveShaderPermutation = ezShaderManager::PreloadSinglePermutation(m_hActiveShader, m_PermutationVariables, m_bAllowAsyncShaderLoading);
+
+    if (!m_hActiveShaderPermutation.IsValid())
+      return EZ_FAILURE;
+
+    m_ShaderPermutationCache.Insert(cacheKey, m_hActiveShaderPermutation);
+  }
 
   // Non-material shaders are always force-loaded so we don't accidentally miss to render important passes.
   const bool bAsyncShaderLoading = m_bAllowAsyncShaderLoading && m_hMaterial.IsValid();
@@ -45,6 +45,8 @@ public:
     void Reset();
 
     ezUInt32 m_uiFailedDrawcalls;
+    ezUInt32 m_uiShaderPermutationCacheHits;
+    ezUInt32 m_uiShaderPermutationCacheMisses;
     ezUInt32 m_uiModifiedBindGroup[EZ_GAL_MAX_BIND_GROUPS] = {0};
     ezUInt32 m_uiLayoutChanged[EZ_GAL_MAX_BIND_GROUPS] = {0};
   };
@@ -284,6 +286,24 @@ private:
   // Shader Resource
   ezShaderResourceHandle m_hActiveShader;
   ezHashTable<ezHashedString, ezHashedString> m_PermutationVariables;
+  ezUInt64 m_uiPermutationVariablesKey = 0; ///< Order independent combination of all name/value pairs in m_PermutationVariables, updated incrementally.
+
+  // Maps the active shader and permutation variables directly to a permutation, without going through the shader manager.
+  // Every context is only used by one thread at a time, so no locking is needed.
+  struct ShaderPermutationCacheKey
+  {
+    ezShaderResourceHandle m_hShader;
+    ezUInt64 m_uiPermutationVariablesKey = 0;
+  };
+
+  struct ShaderPermutationCacheKeyHashHelper
+  {
+    static ezUInt32 Hash(const ShaderPermutationCacheKey& key);
+    static bool Equal(const ShaderPermutationCacheKey& a, const ShaderPermutationCacheKey& b);
+  };
+
+  ezHashTable<ShaderPermutationCacheKey, ezShaderPermutationResourceHandle, ShaderPermutationCacheKeyHashHelper> m_ShaderPermutationCache;
+  ezUInt32 m_uiShaderPermutationCacheChangeCounter = 0;
 
   // Shader Permutation
   ezShaderPermutationResourceHandle m_hActiveShaderPermutation;
@@ -6,6 +6,8 @@
 #include <Foundation/Configuration/CVar.h>
 #include <Foundation/Configuration/Startup.h>
 #include <Foundation/Memory/CommonAllocators.h>
+#include <Foundation/Memory/FrameAllocator.h>
+#include <Foundation/Memory/PerThreadLinearAllocator.h>
 #include <Foundation/Utilities/DGMLWriter.h>
 #include <RendererCore/Pipeline/RenderPipeline.h>
 #include <RendererCore/Pipeline/View.h>
@@ -13,6 +15,10 @@
 #include <RendererFoundation/Device/Device.h>
 #include <RendererFoundation/Profiling/Profiling.h>
 
+#if EZ_ENABLED(EZ_COMPILE_FOR_DEVELOPMENT)
+#  include <Foundation/Utilities/Stats.h>
+#endif
+
 ezCVarBool cvar_RenderingMultithreading("Rendering.Multithreading", true, ezCVarFlags::Default, "Enables multi-threaded update and rendering");
 ezCVarBool cvar_RenderingCachingStaticObjects("Rendering.Caching.StaticObjects", true, ezCVarFlags::Default, "Enables render data caching of static objects");
 
@@ -58,6 +64,9 @@ namespace
 
   static ezProxyAllocator* s_pCacheAllocator;
 
+  // Indexed by the parity of the frame counter, the data of a frame stays alive until the end of the next frame.
+  static ezPerThreadLinearAllocator* s_pRenderDataAllocators[2];
+
   static ezMutex s_CachedRenderDataMutex;
   using CachedRenderDataPerComponent = ezHybridArray<const ezRenderData*, 4>;
   static ezHashTable<ezComponentHandle, CachedRenderDataPerComponent> s_CachedRenderData;
@@ -633,6 +642,17 @@ void ezRenderWorld::EndFrame()
 
   ++s_uiFrameCounter;
 
+  // The allocator for the new frame holds the data of the frame before the last one, which has been rendered by now.
+  if (ezPerThreadLinearAllocator* pRenderDataAllocator = s_pRenderDataAllocators[s_uiFrameCounter & 1])
+  {
+    pRenderDataAllocator->Reset();
+
+#if EZ_ENABLED(EZ_COMPILE_FOR_DEVELOPMENT)
+    ezStats::SetStat("RenderWorld/RenderDataMemory (KB)", pRenderDataAllocator->GetUsedMemoryBeforeLastReset() / 1024);
+    ezStats::SetStat("RenderWorld/RenderDataMemoryHighWaterMark (KB)", pRenderDataAllocator->GetHighWaterMark() / 1024);
+#endif
+  }
+
   for (auto it = s_Views.GetIterator(); it.IsValid(); ++it)
   {
     ezView* pView = it.Value();
@@ -659,6 +679,16 @@ bool ezRenderWorld::IsRenderingThread()
   return s_RenderingThreadID == ezThreadUtils::GetCurrentThreadID();
 }
 
+ezAllocator* ezRenderWorld::GetRenderDataAllocator()
+{
+  if (ezPerThreadLinearAllocator* pRenderDataAllocator = s_pRenderDataAllocators[s_uiFrameCounter & 1])
+  {
+    return pRenderDataAllocator;
+  }
+
+  return ezFrameAllocator::GetCurrentAllocator();
+}
+
 void ezRenderWorld::DeleteCachedRenderDataInternal(const ezGameObjectHandle& hOwnerObject)
 {
   ezUInt32 uiCacheIndex = hOwnerObject.GetInternalID().m_InstanceIndex;
@@ -812,6 +842,9 @@ void ezRenderWorld::OnEngineStartup()
   s_pCacheAllocator = EZ_DEFAULT_NEW(ezProxyAllocator, "Cached Render Data", ezFoundation::GetDefaultAllocator());
 
   s_CachedRenderData = ezHashTable<ezComponentHandle, CachedRenderDataPerComponent>(s_pCacheAllocator);
+
+  s_pRenderDataAllocators[0] = EZ_DEFAULT_NEW(ezPerThreadLinearAllocator, "Render Data 0", ezFoundation::GetAlignedAllocator());
+  s_pRenderDataAllocators[1] = EZ_DEFAULT_NEW(ezPerThreadLinearAllocator, "Render Data 1", ezFoundation::GetAlignedAllocator());
 }
 
 void ezRenderWorld::OnEngineShutdown()
@@ -844,6 +877,9 @@ void ezRenderWorld::OnEngineShutdown()
 
   s_Views.Clear();
   s_CameraConfigs.Clear();
+
+  EZ_DEFAULT_DELETE(s_pRenderDataAllocators[0]);
+  EZ_DEFAULT_DELETE(s_pRenderDataAllocators[1]);
 }
 
 void ezRenderWorld::BeginModifyCameraConfigs()
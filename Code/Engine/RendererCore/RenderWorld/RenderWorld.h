@@ -90,6 +90,12 @@ public:
 
   static bool IsRenderingThread();
 
+  /// \brief Returns the allocator for render data and other data that is created during extraction for the current frame.
+  ///
+  /// Every thread allocates from its own arena without taking a lock. All allocations are released at once when the frame
+  /// has been rendered, so they never need to be deallocated manually.
+  static ezAllocator* GetRenderDataAllocator();
+
   /// \name Render To Texture
   /// @{
 public:
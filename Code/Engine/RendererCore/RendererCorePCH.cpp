@@ -134,6 +134,7 @@ EZ_STATICLINK_LIBRARY(RendererCore)
   EZ_STATICLINK_REFERENCE(RendererCore_ShaderCompiler_Implementation_ShaderCompiler);
   EZ_STATICLINK_REFERENCE(RendererCore_Shader_Implementation_ShaderPermutationResource);
   EZ_STATICLINK_REFERENCE(RendererCore_Shader_Implementation_ShaderResource);
+  EZ_STATICLINK_REFERENCE(RendererCore_Textures_Implementation_TextureStreamingManager);
   EZ_STATICLINK_REFERENCE(RendererCore_Textures_Texture2DResource);
   EZ_STATICLINK_REFERENCE(RendererCore_Textures_Texture3DResource);
   EZ_STATICLINK_REFERENCE(RendererCore_Textures_TextureCubeResource);
@@ -1,6 +1,7 @@
 #include <RendererCore/RendererCorePCH.h>
 
 #include <RendererCore/Shader/ShaderResource.h>
+#include <RendererCore/ShaderCompiler/ShaderManager.h>
 #include <RendererCore/ShaderCompiler/ShaderParser.h>
 #include <RendererFoundation/Device/Device.h>
 
@@ -22,6 +23,8 @@ ezResourceLoadDesc ezShaderResource::UnloadData(Unload WhatToUnload)
   m_bShaderResourceIsValid = false;
   m_PermutationVarsUsed.Clear();
 
+  ezShaderManager::IncShaderChangeCounter();
+
   ezResourceLoadDesc res;
   res.m_uiQualityLevelsDiscardable = 0;
   res.m_uiQualityLevelsLoadable = 0;
@@ -72,6 +75,8 @@ ezResourceLoadDesc ezShaderResource::UpdateContent(ezStreamReader* stream)
   res.m_State = ezResourceState::Loaded;
   m_bShaderResourceIsValid = true;
 
+  ezShaderManager::IncShaderChangeCounter();
+
   return res;
 }
 
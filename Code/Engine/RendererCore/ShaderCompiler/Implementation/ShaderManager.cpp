@@ -11,6 +11,7 @@ bool ezShaderManager::s_bEnableRuntimeCompilation = false;
 ezString ezShaderManager::s_sPlatform;
 ezString ezShaderManager::s_sPermVarSubDir;
 ezString ezShaderManager::s_sShaderCacheDirectory;
+ezAtomicInteger32 ezShaderManager::s_iShaderChangeCounter;
 
 namespace
 {
@@ -161,6 +162,8 @@ void ezShaderManager::ReloadPermutationVarConfig(const char* szName, const ezTem
 
     s_PermutationVarConfigs.Insert(pConfig->m_sName, pConfig);
   }
+
+  IncShaderChangeCounter();
 }
 
 bool ezShaderManager::IsPermutationValueAllowed(const char* szName, const ezTempHashedString& sHashedName, const ezTempHashedString& sValue, ezHashedString& out_sName, ezHashedString& out_sValue)
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Foundation/Containers/HashTable.h>
+#include <Foundation/Threading/AtomicInteger.h>
 #include <RendererCore/Declarations.h>
 #include <RendererCore/ShaderCompiler/PermutationGenerator.h>
 #include <RendererCore/ShaderCompiler/ShaderParser.h>
@@ -33,7 +34,17 @@ public:
   static ezShaderPermutationResourceHandle PreloadSinglePermutation(
     ezShaderResourceHandle hShader, const ezHashTable<ezHashedString, ezHashedString>& permVars, bool bAllowFallback);
 
+  /// \brief Returns a counter that is increased whenever a shader or a permutation variable config is (re-)loaded or unloaded.
+  ///
+  /// Caches that map permutation variables to shader permutations must be discarded when this value changes,
+  /// because the used permutation variables or their default values may be different now.
+  static ezUInt32 GetShaderChangeCounter() { return static_cast<ezUInt32>(s_iShaderChangeCounter); }
+
 private:
+  friend class ezShaderResource;
+
+  static void IncShaderChangeCounter() { s_iShaderChangeCounter.Increment(); }
+
   static ezUInt32 FilterPermutationVars(ezArrayPtr<const ezHashedString> usedVars, const ezHashTable<ezHashedString, ezHashedString>& permVars,
     ezDynamicArray<ezPermutationVar>& out_FilteredPermutationVariables);
   static ezShaderPermutationResourceHandle PreloadSinglePermutationInternal(ezStringView sResourceId, ezUInt64 uiResourceIdHash, ezUInt32 uiPermutationHash, ezArrayPtr<ezPermutationVar> filteredPermutationVariables);
@@ -42,4 +53,5 @@ private:
   static ezString s_sPlatform;
   static ezString s_sPermVarSubDir;
   static ezString s_sShaderCacheDirectory;
+  static ezAtomicInteger32 s_iShaderChangeCounter;
 };
@@ -0,0 +1,388 @@
+#include <RendererCore/RendererCorePCH.h>
+
+#include <Foundation/Configuration/CVar.h>
+#include <Foundation/Configuration/Startup.h>
+#include <RendererCore/Material/MaterialResource.h>
+#include <RendererCore/Meshes/MeshComponentBase.h>
+#include <RendererCore/Meshes/MeshResource.h>
+#include <RendererCore/Pipeline/ExtractedRenderData.h>
+#include <RendererCore/RenderWorld/RenderWorld.h>
+#include <RendererCore/Textures/Implementation/TextureStreamingManager.h>
+#include <RendererCore/Textures/Texture2DResource.h>
+
+// clang-format off
+EZ_BEGIN_SUBSYSTEM_DECLARATION(RendererCore, TextureStreamingManager)
+  BEGIN_SUBSYSTEM_DEPENDENCIES
+    "Foundation",
+    "Core",
+    "RenderWorld"
+  END_SUBSYSTEM_DEPENDENCIES
+
+  ON_HIGHLEVELSYSTEMS_STARTUP
+  {
+    ezTextureStreamingManager::OnEngineStartup();
+  }
+
+  ON_HIGHLEVELSYSTEMS_SHUTDOWN
+  {
+    ezTextureStreamingManager::OnEngineShutdown();
+  }
+EZ_END_SUBSYSTEM_DECLARATION;
+// clang-format on
+
+ezCVarBool cvar_StreamingTextureMips("Streaming.TextureMips", true, ezCVarFlags::Default, "Stream texture mip levels in and out based on their on-screen size");
+ezCVarInt cvar_StreamingTextureBudget("Streaming.TextureBudget", 1024, ezCVarFlags::Save, "Memory budget in MB for textures with streamed mip levels");
+ezCVarInt cvar_StreamingTextureMipBias("Streaming.TextureMipBias", 0, ezCVarFlags::Save, "Additional mip bias for streamed textures, positive values reduce quality");
+
+namespace
+{
+  /// How often the requested mip levels are recomputed.
+  constexpr ezTime s_UpdateInterval = ezTime::MakeFromMilliseconds(100);
+
+  /// Textures that were not seen for this long only keep their low-res data.
+  constexpr ezTime s_UnusedTimeout = ezTime::MakeFromSeconds(3);
+
+  /// Textures that were not seen for this long are not tracked anymore, which releases our handle.
+  constexpr ezTime s_ForgetTimeout = ezTime::MakeFromSeconds(10);
+
+  constexpr ezUInt32 s_uiMaxMips = 16;
+
+  struct TextureInfo
+  {
+    ezTexture2DResourceHandle m_hTexture;
+
+    /// The smallest number of texture coordinate units per pixel that was seen since the last update.
+    float m_fMinTexCoordPerPixel = ezMath::MaxValue<float>();
+    ezTime m_LastSeen;
+
+    bool m_bStreamable = false;
+    ezUInt8 m_uiDesiredTopMip = 0;
+    ezUInt8 m_uiLowResTopMip = 0;
+    ezUInt32 m_uiMemoryForTopMip[s_uiMaxMips] = {};
+  };
+
+  struct TextureDemand
+  {
+    ezTexture2DResourceHandle m_hTexture;
+    float m_fTexCoordPerPixel;
+  };
+} // namespace
+
+struct ezTextureStreamingManager::Data
+{
+  ezMutex m_Mutex;
+  ezHashTable<ezTexture2DResourceHandle, TextureInfo> m_Textures;
+  ezTime m_LastUpdate;
+
+  ezUInt64 m_uiStreamedMemory = 0;
+  ezUInt32 m_uiBudgetMipBias = 0;
+};
+
+ezTextureStreamingManager::Data* ezTextureStreamingManager::s_pData;
+
+// static
+void ezTextureStreamingManager::GatherDemand(const ezExtractedRenderData& data)
+{
+  if (s_pData == nullptr || !cvar_StreamingTextureMips)
+    return;
+
+  const ezViewData& viewData = data.GetViewData();
+  if (viewData.m_CameraUsageHint != ezCameraUsageHint::MainView && viewData.m_CameraUsageHint != ezCameraUsageHint::EditorView)
+    return;
+
+  const float fViewportHeight = viewData.m_ViewPortRect.height;
+  const float fProjectionScaleY = viewData.m_ProjectionMatrix[0].Element(1, 1);
+  if (fViewportHeight <= 0.0f || fProjectionScaleY <= 0.0f)
+    return;
+
+  EZ_PROFILE_SCOPE("ezTextureStreamingManager::GatherDemand");
+
+  // For perspective projections the world space size of one pixel grows linearly with the distance,
+  // for orthographic projections it is constant.
+  const bool bPerspective = data.GetCamera().IsPerspective();
+  const float fWorldPerPixelScale = 2.0f / (fProjectionScaleY * fViewportHeight);
+  const ezVec3 vCameraPosition = data.GetCamera().GetCenterPosition();
+
+  static const ezRenderData::Category categories[] = {
+    ezDefaultRenderDataCategories::LitOpaqueStatic,
+    ezDefaultRenderDataCategories::LitOpaqueDynamic,
+    ezDefaultRenderDataCategories::LitMaskedStatic,
+    ezDefaultRenderDataCategories::LitMaskedDynamic,
+    ezDefaultRenderDataCategories::LitTransparent,
+    ezDefaultRenderDataCategories::LitForeground,
+    ezDefaultRenderDataCategories::SimpleOpaque,
+    ezDefaultRenderDataCategories::SimpleTransparent,
+    ezDefaultRenderDataCategories::SimpleForeground,
+  };
+
+  ezHybridArray<TextureDemand, 64> demands;
+
+  // the render data is sorted, so consecutive entries typically use the same mesh and material
+  ezMeshResourceHandle hLastMesh;
+  float fLastMeshDensity = 0.0f;
+
+  ezMaterialResourceHandle hLastMaterial;
+  float fMaterialMinTexCoordPerPixel = ezMath::MaxValue<float>();
+
+  auto FlushMaterial = [&]()
+  {
+    if (hLastMaterial.IsValid())
+    {
+      ezResourceLock<ezMaterialResource> pMaterial(hLastMaterial, ezResourceAcquireMode::AllowLoadingFallback_NeverFail);
+
+      if (pMaterial.GetAcquireResult() == ezResourceAcquireResult::Final)
+      {
+        for (const auto& binding : pMaterial->GetCurrentDesc().m_Texture2DBindings)
+        {
+          if (binding.m_Value.IsValid())
+          {
+            demands.PushBack({binding.m_Value, fMaterialMinTexCoordPerPixel});
+          }
+        }
+      }
+    }
+
+    fMaterialMinTexCoordPerPixel = ezMath::MaxValue<float>();
+  };
+
+  for (auto category : categories)
+  {
+    for (const auto& sortable : data.GetRawRenderDataWithCategory(category))
+    {
+      const ezMeshRenderData* pRenderData = ezDynamicCast<const ezMeshRenderData*>(sortable.m_pRenderData);
+      if (pRenderData == nullptr || !pRenderData->m_hMaterial.IsValid())
+        continue;
+
+      if (pRenderData->m_hMesh != hLastMesh)
+      {
+        hLastMesh = pRenderData->m_hMesh;
+        fLastMeshDensity = 0.0f;
+
+        ezResourceLock<ezMeshResource> pMesh(hLastMesh, ezResourceAcquireMode::PointerOnly);
+        if (pMesh.IsValid())
+        {
+          fLastMeshDensity = pMesh->GetTexCoord0Density();
+        }
+      }
+
+      if (pRenderData->m_hMaterial != hLastMaterial)
+      {
+        FlushMaterial();
+        hLastMaterial = pRenderData->m_hMaterial;
+      }
+
+      // an unknown density means we can't make any assumption, so the full resolution is requested
+      float fTexCoordPerPixel = 0.0f;
+
+      if (fLastMeshDensity > 0.0f)
+      {
+        const ezBoundingSphere& sphere = pRenderData->m_GlobalBounds.GetSphere();
+        const float fDistance = bPerspective ? ezMath::Max((sphere.m_vCenter - vCameraPosition).GetLength() - sphere.m_fRadius, 0.0f) : 1.0f;
+        const float fMaxScale = ezMath::Max(pRenderData->m_GlobalTransform.GetMaxScale(), ezMath::DefaultEpsilon<float>());
+
+        fTexCoordPerPixel = (fLastMeshDensity / fMaxScale) * fDistance * fWorldPerPixelScale;
+      }
+
+      fMaterialMinTexCoordPerPixel = ezMath::Min(fMaterialMinTexCoordPerPixel, fTexCoordPerPixel);
+    }
+  }
+
+  FlushMaterial();
+
+  if (demands.IsEmpty())
+    return;
+
+  const ezTime now = ezTime::Now();
+
+  EZ_LOCK(s_pData->m_Mutex);
+
+  for (const auto& demand : demands)
+  {
+    TextureInfo& info = s_pData->m_Textures[demand.m_hTexture];
+    info.m_hTexture = demand.m_hTexture;
+    info.m_fMinTexCoordPerPixel = ezMath::Min(info.m_fMinTexCoordPerPixel, demand.m_fTexCoordPerPixel);
+    info.m_LastSeen = now;
+  }
+}
+
+// static
+ezUInt64 ezTextureStreamingManager::GetStreamedTextureMemory()
+{
+  return s_pData != nullptr ? s_pData->m_uiStreamedMemory : 0;
+}
+
+// static
+ezUInt32 ezTextureStreamingManager::GetBudgetMipBias()
+{
+  return s_pData != nullptr ? s_pData->m_uiBudgetMipBias : 0;
+}
+
+// static
+void ezTextureStreamingManager::OnEngineStartup()
+{
+  s_pData = EZ_DEFAULT_NEW(ezTextureStreamingManager::Data);
+
+  ezRenderWorld::GetExtractionEvent().AddEventHandler(OnExtractionEvent);
+  ezResourceManager::GetResourceEvents().AddEventHandler(OnResourceEvent);
+}
+
+// static
+void ezTextureStreamingManager::OnEngineShutdown()
+{
+  ezResourceManager::GetResourceEvents().RemoveEventHandler(OnResourceEvent);
+  ezRenderWorld::GetExtractionEvent().RemoveEventHandler(OnExtractionEvent);
+
+  EZ_DEFAULT_DELETE(s_pData);
+}
+
+// static
+void ezTextureStreamingManager::OnExtractionEvent(const ezRenderWorldExtractionEvent& e)
+{
+  if (e.m_Type != ezRenderWorldExtractionEvent::Type::EndExtraction)
+    return;
+
+  const ezTime now = ezTime::Now();
+  if (now - s_pData->m_LastUpdate < s_UpdateInterval)
+    return;
+
+  s_pData->m_LastUpdate = now;
+
+  UpdateRequestedMips();
+}
+
+// static
+void ezTextureStreamingManager::OnResourceEvent(const ezResourceEvent& e)
+{
+  if (e.m_Type != ezResourceEvent::Type::ResourceContentUpdated)
+    return;
+
+  if (ezTexture2DResource* pTexture = ezDynamicCast<ezTexture2DResource*>(e.m_pResource))
+  {
+    // The loader decides whether more quality levels are loadable based on the request at the time it ran.
+    // A request that arrived in the meantime gets overwritten, when the resource manager stores the loader's result,
+    // so it has to be re-applied after the content update.
+    pTexture->SetRequestedTopMip(pTexture->GetRequestedTopMip());
+  }
+}
+
+// static
+void ezTextureStreamingManager::UpdateRequestedMips()
+{
+  EZ_PROFILE_SCOPE("ezTextureStreamingManager::UpdateRequestedMips");
+
+  EZ_LOCK(s_pData->m_Mutex);
+
+  const ezTime now = ezTime::Now();
+  const bool bEnabled = cvar_StreamingTextureMips;
+  const ezUInt32 uiMipBias = static_cast<ezUInt32>(ezMath::Max<int>(cvar_StreamingTextureMipBias, 0));
+
+  // compute the desired mip of every texture, ignoring the budget
+  for (auto it = s_pData->m_Textures.GetIterator(); it.IsValid();)
+  {
+    TextureInfo& info = it.Value();
+    const ezTime unusedTime = now - info.m_LastSeen;
+
+    if (!bEnabled)
+    {
+      // hand control back to the default behavior, ie. full resolution
+      ezResourceLock<ezTexture2DResource> pTexture(info.m_hTexture, ezResourceAcquireMode::PointerOnly);
+      if (pTexture->SetRequestedTopMip(0))
+      {
+        ezResourceManager::PreloadResource(info.m_hTexture);
+      }
+
+      it = s_pData->m_Textures.Remove(it);
+      continue;
+    }
+
+    if (unusedTime > s_ForgetTimeout)
+    {
+      // the texture keeps its low-res request, until it is seen again or unloaded by the resource manager
+      it = s_pData->m_Textures.Remove(it);
+      continue;
+    }
+
+    ezResourceLock<ezTexture2DResource> pTexture(info.m_hTexture, ezResourceAcquireMode::PointerOnly);
+    info.m_bStreamable = pTexture->IsMipStreamable();
+
+    if (info.m_bStreamable)
+    {
+      info.m_uiLowResTopMip = static_cast<ezUInt8>(ezMath::Min(pTexture->GetLowResTopMip(), s_uiMaxMips - 1));
+
+      for (ezUInt32 mip = 0; mip <= info.m_uiLowResTopMip; ++mip)
+      {
+        info.m_uiMemoryForTopMip[mip] = static_cast<ezUInt32>(ezMath::Min<ezUInt64>(pTexture->EstimateMemoryForTopMip(mip), ezMath::MaxValue<ezUInt32>()));
+      }
+
+      ezUInt32 uiTopMip = info.m_uiLowResTopMip;
+
+      if (unusedTime <= s_UnusedTimeout)
+      {
+        if (info.m_fMinTexCoordPerPixel != ezMath::MaxValue<float>())
+        {
+          // number of texels that map to a single pixel for the largest mip, clamped so that the mip index can't overflow
+          const float fTexelsPerPixel = ezMath::Min(info.m_fMinTexCoordPerPixel * ezMath::Max(pTexture->GetFileWidth(), pTexture->GetFileHeight()), static_cast<float>(1u << s_uiMaxMips));
+          const ezUInt32 uiMip = fTexelsPerPixel > 1.0f ? static_cast<ezUInt32>(ezMath::Log2(fTexelsPerPixel)) : 0;
+
+          uiTopMip = ezMath::Min(uiMip + uiMipBias, (ezUInt32)info.m_uiLowResTopMip);
+        }
+        else
+        {
+          // not drawn since the last update, but still in use, so keep the previous decision
+          uiTopMip = ezMath::Min<ezUInt32>(info.m_uiDesiredTopMip, info.m_uiLowResTopMip);
+        }
+      }
+
+      info.m_uiDesiredTopMip = static_cast<ezUInt8>(uiTopMip);
+    }
+
+    info.m_fMinTexCoordPerPixel = ezMath::MaxValue<float>();
+    it.Next();
+  }
+
+  if (!bEnabled)
+    return;
+
+  // find the smallest additional bias that keeps all textures within the budget
+  const ezUInt64 uiBudget = static_cast<ezUInt64>(ezMath::Max<int>(cvar_StreamingTextureBudget, 0)) * 1024 * 1024;
+
+  ezUInt32 uiBudgetBias = 0;
+  ezUInt64 uiTotalMemory = 0;
+
+  for (; uiBudgetBias < s_uiMaxMips; ++uiBudgetBias)
+  {
+    uiTotalMemory = 0;
+
+    for (auto it : s_pData->m_Textures)
+    {
+      const TextureInfo& info = it.Value();
+
+      if (info.m_bStreamable)
+      {
+        uiTotalMemory += info.m_uiMemoryForTopMip[ezMath::Min<ezUInt32>(info.m_uiDesiredTopMip + uiBudgetBias, info.m_uiLowResTopMip)];
+      }
+    }
+
+    if (uiTotalMemory <= uiBudget)
+      break;
+  }
+
+  s_pData->m_uiStreamedMemory = uiTotalMemory;
+  s_pData->m_uiBudgetMipBias = uiBudgetBias;
+
+  for (auto it : s_pData->m_Textures)
+  {
+    const TextureInfo& info = it.Value();
+
+    if (!info.m_bStreamable)
+      continue;
+
+    ezResourceLock<ezTexture2DResource> pTexture(info.m_hTexture, ezResourceAcquireMode::PointerOnly);
+    if (pTexture->SetRequestedTopMip(ezMath::Min<ezUInt32>(info.m_uiDesiredTopMip + uiBudgetBias, info.m_uiLowResTopMip)))
+    {
+      ezResourceManager::PreloadResource(info.m_hTexture);
+    }
+  }
+}
+
+EZ_STATICLINK_FILE(RendererCore, RendererCore_Textures_Implementation_TextureStreamingManager);
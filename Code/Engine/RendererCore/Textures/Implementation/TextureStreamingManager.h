@@ -0,0 +1,40 @@
+#pragma once
+
+#include <RendererCore/Declarations.h>
+
+struct ezRenderWorldExtractionEvent;
+struct ezResourceEvent;
+class ezExtractedRenderData;
+
+/// \brief Decides which mip levels of ezTexture2DResource need to be resident, based on how large the textures appear on screen.
+///
+/// During extraction the mesh render data of all main views is inspected. Together with the texture coordinate density of the meshes
+/// this gives an estimate for the most detailed mip level that is actually visible for each material texture.
+/// Once per extraction the requests are clamped to the texture memory budget (see the 'Streaming.TextureBudget' cvar) by increasing a global
+/// mip bias until everything fits, and the resulting mips are streamed in or out through the resource manager.
+/// Textures that haven't been seen for a while are reduced to their always resident low-res quality level.
+class EZ_RENDERERCORE_DLL ezTextureStreamingManager
+{
+public:
+  /// \brief Records the texture demand of all mesh render data in the given extracted data. Called by ezRenderPipeline after extraction.
+  static void GatherDemand(const ezExtractedRenderData& data);
+
+  /// \brief Returns the estimated GPU memory in bytes of all streamed textures, as of the last update.
+  static ezUInt64 GetStreamedTextureMemory();
+
+  /// \brief Returns the mip bias that was necessary to stay within the texture memory budget during the last update.
+  static ezUInt32 GetBudgetMipBias();
+
+private:
+  EZ_MAKE_SUBSYSTEM_STARTUP_FRIEND(RendererCore, TextureStreamingManager);
+
+  static void OnEngineStartup();
+  static void OnEngineShutdown();
+
+  static void OnExtractionEvent(const ezRenderWorldExtractionEvent& e);
+  static void OnResourceEvent(const ezResourceEvent& e);
+  static void UpdateRequestedMips();
+
+  struct Data;
+  static Data* s_pData;
+};
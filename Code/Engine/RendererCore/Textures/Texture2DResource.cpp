@@ -33,6 +33,8 @@ ezTexture2DResource::ezTexture2DResource(ezResource::DoUpdate ResourceUpdateThre
 
 ezResourceLoadDesc ezTexture2DResource::UnloadData(Unload WhatToUnload)
 {
+  EZ_LOCK(m_StreamingMutex);
+
   if (m_uiLoadedTextures > 0)
   {
     for (ezInt32 r = 0; r < 2; ++r)
@@ -52,6 +54,12 @@ ezResourceLoadDesc ezTexture2DResource::UnloadData(Unload WhatToUnload)
     }
   }
 
+  if (m_uiLoadedTextures == 0)
+  {
+    // the streaming information is recomputed once the low-res data gets loaded again
+    m_uiStreamableMipLevels = 0;
+  }
+
   if (WhatToUnload == Unload::AllQualityLevels)
   {
     if (!m_hSamplerState.IsInvalidated())
@@ -183,6 +191,7 @@ ezResourceLoadDesc ezTexture2DResource::UpdateContent(ezStreamReader* Stream)
   EZ_ASSERT_DEV(!bIsRenderTarget, "Render targets are not supported by regular 2D texture resources");
 
   {
+    EZ_LOCK(m_StreamingMutex);
 
     const ezUInt32 uiNumMipmapsLowRes = ezTextureUtils::s_bForceFullQualityAlways ? pImage->GetNumMipLevels() : ezMath::Min(pImage->GetNumMipLevels(), 6U);
     ezUInt32 uiUploadNumMipLevels = 0;
@@ -212,23 +221,48 @@ ezResourceLoadDesc ezTexture2DResource::UpdateContent(ezStreamReader* Stream)
     {
       if (m_uiLoadedTextures == 0)
       {
-        bCouldLoadMore = uiNumMipmapsLowRes < pImage->GetNumMipLevels();
+        SetupMipStreaming(pImage, texFormat.m_bSRGB, uiNumMipmapsLowRes);
+
+        bCouldLoadMore = uiNumMipmapsLowRes < pImage->GetNumMipLevels() && (!IsMipStreamable() || GetRequestedTopMip() < m_uiLowResTopMip);
         uiUploadNumMipLevels = uiNumMipmapsLowRes;
       }
-      else if (m_uiLoadedTextures == 1)
-      {
-        uiUploadNumMipLevels = pImage->GetNumMipLevels();
-      }
       else
       {
-        // ignore the texture, if we already have fully loaded data
-        ezLog::Debug("Ignoring texture data, resource is already fully loaded.");
+        const ezUInt32 uiTopMip = IsMipStreamable() ? ezMath::Min(GetRequestedTopMip(), (ezUInt32)m_uiLowResTopMip) : 0;
+
+        if (m_uiLoadedTextures == 2 && uiTopMip == m_uiResidentTopMip)
+        {
+          // ignore the texture, if we already have the requested data
+          ezLog::Debug("Ignoring texture data, resource is already fully loaded.");
+        }
+        else if (IsMipStreamable() && uiTopMip == m_uiLowResTopMip)
+        {
+          // only the low-res data is needed, drop the high-res quality level
+          if (m_uiLoadedTextures == 2)
+          {
+            --m_uiLoadedTextures;
+            ezGALDevice::GetDefaultDevice()->DestroyTexture(m_hGALTexture[1]);
+            m_hGALTexture[1].Invalidate();
+            m_uiMemoryGPU[1] = 0;
+          }
+        }
+        else
+        {
+          uiUploadNumMipLevels = pImage->GetNumMipLevels() - uiTopMip;
+          m_uiResidentTopMip = static_cast<ezUInt8>(uiTopMip);
+        }
       }
     }
 
     if (uiUploadNumMipLevels > 0)
     {
-      EZ_ASSERT_DEBUG(m_uiLoadedTextures < 2, "Invalid texture upload");
+      // when the high-res quality level is replaced with a different set of mips, only destroy the old texture once the new one exists
+      ezGALTextureHandle hReplacedTexture;
+      if (m_uiLoadedTextures == 2)
+      {
+        hReplacedTexture = m_hGALTexture[1];
+        m_uiLoadedTextures = 1;
+      }
 
       ezHybridArray<ezGALSystemMemoryDescription, 32> initData;
       FillOutDescriptor(td, pImage, texFormat.m_bSRGB, uiUploadNumMipLevels, m_uiMemoryGPU[m_uiLoadedTextures], initData);
@@ -237,6 +271,17 @@ ezResourceLoadDesc ezTexture2DResource::UpdateContent(ezStreamReader* Stream)
 
       // ignore its return value here, we build our own
       CreateResource(std::move(td));
+
+      if (!hReplacedTexture.IsInvalidated())
+      {
+        ezGALDevice::GetDefaultDevice()->DestroyTexture(hReplacedTexture);
+      }
+    }
+
+    if (!bIsFallback && m_uiLoadedTextures > 0 && IsMipStreamable())
+    {
+      // a different mip level may have been requested while we were loading
+      bCouldLoadMore = GetResidentTopMip() != ezMath::Min(GetRequestedTopMip(), (ezUInt32)m_uiLowResTopMip);
     }
 
     {
@@ -250,6 +295,87 @@ ezResourceLoadDesc ezTexture2DResource::UpdateContent(ezStreamReader* Stream)
   }
 }
 
+void ezTexture2DResource::SetupMipStreaming(const ezImage* pImage, bool bSRGB, ezUInt32 uiNumMipLevelsLowRes)
+{
+  m_uiStreamableMipLevels = 0;
+  m_uiResidentTopMip = 0;
+
+  const ezUInt32 uiNumMipLevels = pImage->GetNumMipLevels();
+
+  if (ezTextureUtils::s_bForceFullQualityAlways || uiNumMipLevels <= uiNumMipLevelsLowRes || uiNumMipLevels > MaxStreamableMips || pImage->GetDepth() > 1)
+    return;
+
+  const ezGALResourceFormat::Enum format = ezTextureUtils::ImageFormatToGalFormat(pImage->GetImageFormat(), bSRGB);
+  const bool bCompressed = ezImageFormat::GetType(pImage->GetImageFormat()) == ezImageFormatType::BLOCK_COMPRESSED;
+  const ezUInt32 uiNumSlices = pImage->GetNumArrayIndices() * pImage->GetNumFaces();
+
+  for (ezUInt32 mip = 0; mip < uiNumMipLevels; ++mip)
+  {
+    ezUInt32 uiWidth = pImage->GetWidth(mip);
+    ezUInt32 uiHeight = pImage->GetHeight(mip);
+
+    if (bCompressed)
+    {
+      uiWidth = ezMath::RoundUp(uiWidth, 4);
+      uiHeight = ezMath::RoundUp(uiHeight, 4);
+    }
+
+    m_uiMipMemorySize[mip] = uiWidth * uiHeight * ezGALResourceFormat::GetBitsPerElement(format) / 8 * uiNumSlices;
+  }
+
+  m_uiFileWidth = pImage->GetWidth();
+  m_uiFileHeight = pImage->GetHeight();
+  m_uiLowResTopMip = static_cast<ezUInt8>(uiNumMipLevels - uiNumMipLevelsLowRes);
+  m_uiStreamableMipLevels = static_cast<ezUInt8>(uiNumMipLevels);
+}
+
+ezUInt32 ezTexture2DResource::GetResidentTopMip() const
+{
+  return m_uiLoadedTextures >= 2 ? m_uiResidentTopMip : m_uiLowResTopMip;
+}
+
+bool ezTexture2DResource::SetRequestedTopMip(ezUInt32 uiTopMip)
+{
+  if (!IsMipStreamable())
+    return false;
+
+  EZ_LOCK(m_StreamingMutex);
+
+  uiTopMip = ezMath::Min(uiTopMip, (ezUInt32)m_uiLowResTopMip);
+  m_iRequestedTopMip = static_cast<ezInt32>(uiTopMip);
+
+  const bool bNeedsUpdate = GetResidentTopMip() != uiTopMip;
+  SetNumQualityLevelsLoadable(bNeedsUpdate ? 1 : 0);
+  return bNeedsUpdate;
+}
+
+ezUInt64 ezTexture2DResource::EstimateMemoryForTopMip(ezUInt32 uiTopMip) const
+{
+  if (!IsMipStreamable())
+    return (ezUInt64)m_uiMemoryGPU[0] + m_uiMemoryGPU[1];
+
+  uiTopMip = ezMath::Min(uiTopMip, (ezUInt32)m_uiLowResTopMip);
+
+  ezUInt64 uiMemory = 0;
+
+  // the low-res quality level is always resident
+  for (ezUInt32 mip = m_uiLowResTopMip; mip < m_uiStreamableMipLevels; ++mip)
+  {
+    uiMemory += m_uiMipMemorySize[mip];
+  }
+
+  // the high-res quality level contains the full remaining mip chain
+  if (uiTopMip < m_uiLowResTopMip)
+  {
+    for (ezUInt32 mip = uiTopMip; mip < m_uiStreamableMipLevels; ++mip)
+    {
+      uiMemory += m_uiMipMemorySize[mip];
+    }
+  }
+
+  return uiMemory;
+}
+
 void ezTexture2DResource::UpdateMemoryUsage(MemoryUsage& out_NewMemoryUsage)
 {
   out_NewMemoryUsage.m_uiMemoryCPU = sizeof(ezTexture2DResource);
@@ -53,6 +53,37 @@ public:
   const ezGALTextureHandle& GetGALTexture() const { return m_hGALTexture[m_uiLoadedTextures - 1]; }
   const ezGALSamplerStateHandle& GetGALSamplerState() const { return m_hSamplerState; }
 
+  /// \brief Whether individual mip levels of this texture can be streamed in and out via SetRequestedTopMip().
+  ///
+  /// Only textures loaded from file that have more mips than the always resident low-res quality level support this.
+  bool IsMipStreamable() const { return m_uiStreamableMipLevels > 0; }
+
+  /// \brief The number of mip levels of the texture file. Only valid for streamable textures.
+  ezUInt32 GetStreamableMipLevels() const { return m_uiStreamableMipLevels; }
+
+  /// \brief The largest mip index that can be requested. Requesting this mip means that only the low-res quality level stays resident.
+  ezUInt32 GetLowResTopMip() const { return m_uiLowResTopMip; }
+
+  /// \brief Width and height of mip 0 of the texture file. Only valid for streamable textures.
+  ezUInt32 GetFileWidth() const { return m_uiFileWidth; }
+  ezUInt32 GetFileHeight() const { return m_uiFileHeight; }
+
+  /// \brief Returns the index of the most detailed mip level that is currently resident on the GPU.
+  ezUInt32 GetResidentTopMip() const;
+
+  /// \brief Sets which mip level should be the most detailed one that is kept resident.
+  ///
+  /// Returns true, if this requires a different set of mips than what is currently resident.
+  /// In that case the resource is flagged as having loadable quality levels and has to be passed to ezResourceManager::PreloadResource()
+  /// to actually stream the mips in or out.
+  bool SetRequestedTopMip(ezUInt32 uiTopMip);
+
+  /// \brief Returns the mip level most recently passed to SetRequestedTopMip().
+  ezUInt32 GetRequestedTopMip() const { return static_cast<ezUInt32>(m_iRequestedTopMip); }
+
+  /// \brief Estimates how much GPU memory this texture would use, if the given mip was the most detailed one resident.
+  ezUInt64 EstimateMemoryForTopMip(ezUInt32 uiTopMip) const;
+
 protected:
   virtual ezResourceLoadDesc UnloadData(Unload WhatToUnload) override;
   virtual ezResourceLoadDesc UpdateContent(ezStreamReader* Stream) override;
@@ -60,6 +91,8 @@ protected:
 
   ezTexture2DResource(DoUpdate ResourceUpdateThread);
 
+  void SetupMipStreaming(const ezImage* pImage, bool bSRGB, ezUInt32 uiNumMipLevelsLowRes);
+
   ezUInt8 m_uiLoadedTextures = 0;
   ezGALTextureHandle m_hGALTexture[2];
   ezUInt32 m_uiMemoryGPU[2] = {0, 0};
@@ -70,6 +103,17 @@ protected:
   ezUInt32 m_uiHeight = 0;
 
   ezGALSamplerStateHandle m_hSamplerState;
+
+  // mip streaming
+  static constexpr ezUInt32 MaxStreamableMips = 16;
+  ezMutex m_StreamingMutex; ///< Synchronizes SetRequestedTopMip() with the mip selection in UpdateContent(), which may run on another thread.
+  ezAtomicInteger32 m_iRequestedTopMip = 0;
+  ezUInt8 m_uiResidentTopMip = 0;
+  ezUInt8 m_uiStreamableMipLevels = 0;
+  ezUInt8 m_uiLowResTopMip = 0;
+  ezUInt32 m_uiFileWidth = 0;
+  ezUInt32 m_uiFileHeight = 0;
+  ezUInt32 m_uiMipMemorySize[MaxStreamableMips] = {};
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -97,7 +97,7 @@ ezResourceLoadData ezTextureResourceLoader::OpenDataStream(const ezResource* pRe
   }
   else
   {
-    ezFileReader File;
+    ezFileReader& File = pData->m_File;
     if (File.Open(pResource->GetResourceID()).Failed())
       return res;
 
@@ -120,8 +120,30 @@ ezResourceLoadData ezTextureResourceLoader::OpenDataStream(const ezResource* pRe
 
     if (sAbsolutePath.HasExtension("ezBinTexture2D") || sAbsolutePath.HasExtension("ezBinTexture3D") || sAbsolutePath.HasExtension("ezBinTextureCube") || sAbsolutePath.HasExtension("ezBinRenderTarget") || sAbsolutePath.HasExtension("ezBinLUT"))
     {
-      if (LoadTexFile(File, *pData).Failed())
-        return res;
+      const ezArrayPtr<const ezUInt8> memoryView = File.GetMemoryView();
+      bool bLoadedInPlace = false;
+
+      if (!memoryView.IsEmpty() && LoadTexFileInPlace(memoryView, *pData).Succeeded())
+      {
+        // render targets have no pixel data
+        bLoadedInPlace = pData->m_TexFormat.m_iRenderTargetResolutionX == 0;
+      }
+      else
+      {
+        // reading the memory view doesn't move the file position, so a file that can't be used in place (e.g. truncated or with a bad pitch)
+        // is read again through the regular path, which reports the actual problem
+        if (LoadTexFile(File, *pData).Failed())
+        {
+          File.Close();
+          return res;
+        }
+      }
+
+      // the file only stays open while the image references the pixel data in it
+      if (!bLoadedInPlace)
+      {
+        File.Close();
+      }
     }
     else
     {
@@ -210,6 +232,38 @@ ezResult ezTextureResourceLoader::LoadTexFile(ezStreamReader& inout_stream, Load
   }
 }
 
+ezResult ezTextureResourceLoader::LoadTexFileInPlace(ezArrayPtr<const ezUInt8> fileData, LoadedData& ref_data)
+{
+  ezRawMemoryStreamReader reader(fileData.GetPtr(), fileData.GetCount());
+
+  // read the hash, ignore it
+  ezAssetFileHeader AssetHash;
+  EZ_SUCCEED_OR_RETURN(AssetHash.Read(reader));
+
+  ref_data.m_TexFormat.ReadHeader(reader);
+
+  if (ref_data.m_TexFormat.m_iRenderTargetResolutionX != 0)
+    return EZ_SUCCESS;
+
+  ezImageHeader imageHeader;
+  ezDdsFileFormat fmt;
+  EZ_SUCCEED_OR_RETURN(fmt.ReadAndValidateImageHeader(reader, imageHeader));
+
+  const ezUInt64 uiDataSize = imageHeader.ComputeDataSize();
+
+  if (uiDataSize > fileData.GetCount() - reader.GetReadPosition())
+  {
+    ezLog::Error("Failed to read image data.");
+    return EZ_FAILURE;
+  }
+
+  // The texture resources only read from the image, so it is fine to reference the read-only file memory.
+  ezUInt8* pPixelData = const_cast<ezUInt8*>(fileData.GetPtr()) + reader.GetReadPosition();
+  ref_data.m_Image.ResetAndUseExternalStorage(imageHeader, ezByteBlobPtr(pPixelData, uiDataSize));
+
+  return EZ_SUCCESS;
+}
+
 void ezTextureResourceLoader::WriteTextureLoadStream(ezStreamWriter& w, const LoadedData& data)
 {
   const ezImage* pImage = &data.m_Image;
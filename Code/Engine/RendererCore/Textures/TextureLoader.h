@@ -2,6 +2,7 @@
 
 #include <Core/ResourceManager/Resource.h>
 #include <Core/ResourceManager/ResourceTypeLoader.h>
+#include <Foundation/IO/FileSystem/FileReader.h>
 #include <RendererCore/RenderContext/Implementation/RenderContextStructs.h>
 #include <RendererCore/RendererCoreDLL.h>
 #include <RendererFoundation/RendererFoundationDLL.h>
@@ -22,6 +23,9 @@ public:
     ezMemoryStreamReader m_Reader;
     ezImage m_Image;
 
+    /// Stays open while m_Image references the file content in place, see LoadTexFileInPlace().
+    ezFileReader m_File;
+
     bool m_bIsFallback = false;
     ezTexFormat m_TexFormat;
   };
@@ -31,5 +35,10 @@ public:
   virtual bool IsResourceOutdated(const ezResource* pResource) const override;
 
   static ezResult LoadTexFile(ezStreamReader& inout_stream, LoadedData& ref_data);
+
+  /// \brief Same as LoadTexFile(), but the image references the pixel data in \a fileData instead of copying it.
+  ///
+  /// \a fileData must stay valid until the loaded data is destroyed. The image must only be read from.
+  static ezResult LoadTexFileInPlace(ezArrayPtr<const ezUInt8> fileData, LoadedData& ref_data);
   static void WriteTextureLoadStream(ezStreamWriter& inout_stream, const LoadedData& data);
 };
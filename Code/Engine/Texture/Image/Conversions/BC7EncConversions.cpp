@@ -4,7 +4,12 @@
 
 #  include <bc7enc_rdo/rdo_bc_encoder.h>
 
-#  include <Foundation/System/SystemInformation.h>
+#  ifdef _OPENMP
+#    include <omp.h>
+#  endif
+
+#  include <Foundation/Threading/TaskSystem.h>
+#  include <Foundation/Types/ScopeExit.h>
 #  include <Texture/Image/ImageConversion.h>
 
 ezImageConversionEntry g_BC7EncConversions[] = {
@@ -15,6 +20,19 @@ ezImageConversionEntry g_BC7EncConversions[] = {
   ezImageConversionEntry(ezImageFormat::R8G8B8A8_UNORM_SRGB, ezImageFormat::BC7_UNORM_SRGB, ezImageConversionFlags::Default),
 };
 
+namespace
+{
+  /// Images are split into horizontal stripes of at least this many blocks, every stripe is encoded by its own task.
+  constexpr ezUInt32 s_uiBC7EncMinBlocksPerStripe = 4096;
+
+  struct BC7EncStripe
+  {
+    utils::image_u8 m_Image;
+    rdo_bc::rdo_bc_encoder m_Encoder;
+    bool m_bSucceeded = false;
+  };
+} // namespace
+
 class ezImageConversion_CompressBC7Enc : public ezImageConversionStepCompressBlocks
 {
 public:
@@ -24,16 +42,16 @@ public:
   }
 
   virtual ezResult CompressBlocks(ezConstByteBlobPtr source, ezByteBlobPtr target, ezUInt32 numBlocksX, ezUInt32 numBlocksY,
-    ezImageFormat::Enum sourceFormat, ezImageFormat::Enum targetFormat) const override
+    ezImageFormat::Enum sourceFormat, ezImageFormat::Enum targetFormat, const ezImageCompressionSettings& settings) const override
   {
-    ezSystemInformation info = ezSystemInformation::Get();
-    const ezInt32 iCpuCores = info.GetCPUCoreCount();
-
     rdo_bc::rdo_bc_params rp;
-    rp.m_rdo_max_threads = ezMath::Clamp<ezInt32>(iCpuCores - 2, 2, 8);
     rp.m_status_output = false;
     rp.m_bc1_quality_level = 18;
 
+    // every stripe is already encoded on its own thread
+    rp.m_rdo_max_threads = 1;
+    rp.m_rdo_multithreading = false;
+
     switch (targetFormat)
     {
       case ezImageFormat::BC7_UNORM:
@@ -48,30 +66,87 @@ public:
         EZ_ASSERT_NOT_IMPLEMENTED;
     }
 
-    utils::image_u8 source_image(numBlocksX * 4, numBlocksY * 4);
-    auto& pixels = source_image.get_pixels();
-    ezMemoryUtils::Copy<ezUInt32>(reinterpret_cast<ezUInt32*>(pixels.data()), reinterpret_cast<const ezUInt32*>(source.GetPtr()), numBlocksX * 4 * numBlocksY * 4);
+    if (settings.m_Quality == ezImageCompressionQuality::Fast)
+    {
+      rp.m_bc7_uber_level = 0;
+      rp.m_bc7enc_max_partitions_to_scan = 16;
+      rp.m_bc1_quality_level = 4;
+    }
 
-    rdo_bc::rdo_bc_encoder encoder;
-    if (!encoder.init(source_image, rp))
+    if (settings.m_fRdoLambda > 0.0f)
     {
-      ezLog::Error("rdo_bc_encoder::init() failed!");
-      return EZ_FAILURE;
+      rp.m_rdo_lambda = settings.m_fRdoLambda;
+      rp.m_bc7enc_reduce_entropy = true;
     }
 
-    if (!encoder.encode())
+    const ezUInt32 uiRowsPerStripe = ezMath::Max(1u, s_uiBC7EncMinBlocksPerStripe / numBlocksX);
+    const ezUInt32 uiNumStripes = (numBlocksY + uiRowsPerStripe - 1) / uiRowsPerStripe;
+    const ezUInt32 uiSourceRowPitch = numBlocksX * 4 * 4;
+
+    ezDynamicArray<BC7EncStripe> stripes;
+    stripes.SetCount(uiNumStripes);
+
+    // init() also initializes global lookup tables of the encoder, so all encoders are set up before any of them runs
+    for (ezUInt32 uiStripe = 0; uiStripe < uiNumStripes; ++uiStripe)
     {
-      ezLog::Error("rdo_bc_encoder::encode() failed!");
-      return EZ_FAILURE;
+      const ezUInt32 uiFirstRow = uiStripe * uiRowsPerStripe;
+      const ezUInt32 uiNumRows = ezMath::Min(uiRowsPerStripe, numBlocksY - uiFirstRow);
+
+      BC7EncStripe& stripe = stripes[uiStripe];
+      stripe.m_Image.init(numBlocksX * 4, uiNumRows * 4);
+
+      ezMemoryUtils::Copy<ezUInt8>(reinterpret_cast<ezUInt8*>(stripe.m_Image.get_pixels().data()), source.GetPtr() + uiFirstRow * 4 * uiSourceRowPitch, uiNumRows * 4 * uiSourceRowPitch);
+
+      if (!stripe.m_Encoder.init(stripe.m_Image, rp))
+      {
+        ezLog::Error("rdo_bc_encoder::init() failed!");
+        return EZ_FAILURE;
+      }
+    }
+
+    ezTaskSystem::ParallelForIndexed(
+      0, uiNumStripes, [&stripes](ezUInt32 uiStartIndex, ezUInt32 uiEndIndex)
+      {
+#  ifdef _OPENMP
+        // the encoder parallelizes internally with OpenMP, which would oversubscribe the CPU when every stripe already runs in its own task
+        const int iPrevNumOmpThreads = omp_get_max_threads();
+        omp_set_num_threads(1);
+        EZ_SCOPE_EXIT(omp_set_num_threads(iPrevNumOmpThreads));
+#  endif
+
+        for (ezUInt32 uiStripe = uiStartIndex; uiStripe < uiEndIndex; ++uiStripe)
+        {
+          stripes[uiStripe].m_bSucceeded = stripes[uiStripe].m_Encoder.encode();
+        }
+      },
+      "ezImageConversion_CompressBC7Enc");
+
+    ezUInt32 uiTotalBytes = 0;
+    for (const BC7EncStripe& stripe : stripes)
+    {
+      if (!stripe.m_bSucceeded)
+      {
+        ezLog::Error("rdo_bc_encoder::encode() failed!");
+        return EZ_FAILURE;
+      }
+
+      uiTotalBytes += stripe.m_Encoder.get_total_blocks_size_in_bytes();
     }
 
-    const ezUInt32 uiTotalBytes = encoder.get_total_blocks_size_in_bytes();
     if (uiTotalBytes != target.GetCount())
     {
       ezLog::Error("Encoder output of {} byte does not match the expected size of {} bytes", uiTotalBytes, target.GetCount());
       return EZ_FAILURE;
     }
-    ezMemoryUtils::Copy<ezUInt8>(reinterpret_cast<ezUInt8*>(target.GetPtr()), reinterpret_cast<const ezUInt8*>(encoder.get_blocks()), uiTotalBytes);
+
+    ezUInt8* pTarget = target.GetPtr();
+    for (const BC7EncStripe& stripe : stripes)
+    {
+      const ezUInt32 uiStripeBytes = stripe.m_Encoder.get_total_blocks_size_in_bytes();
+      ezMemoryUtils::Copy<ezUInt8>(pTarget, reinterpret_cast<const ezUInt8*>(stripe.m_Encoder.get_blocks()), uiStripeBytes);
+      pTarget += uiStripeBytes;
+    }
+
     return EZ_SUCCESS;
   }
 };
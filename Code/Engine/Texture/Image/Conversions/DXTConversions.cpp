@@ -2,6 +2,7 @@
 
 #include <Foundation/Math/Color16f.h>
 #include <Foundation/Strings/StringBuilder.h>
+#include <Foundation/Threading/TaskSystem.h>
 #include <Texture/Image/Conversions/DXTConversions.h>
 #include <Texture/Image/Conversions/PixelConversions.h>
 #include <Texture/Image/ImageConversion.h>
@@ -2938,12 +2939,13 @@ class ezImageConversion_CompressBC4 : public ezImageConversionStepCompressBlocks
     return supportedConversions;
   }
 
-  virtual ezResult CompressBlocks(ezConstByteBlobPtr source, ezByteBlobPtr target, ezUInt32 numBlocksX, ezUInt32 numBlocksY, ezImageFormat::Enum sourceFormat, ezImageFormat::Enum targetFormat) const override
+  virtual ezResult CompressBlocks(ezConstByteBlobPtr source, ezByteBlobPtr target, ezUInt32 numBlocksX, ezUInt32 numBlocksY, ezImageFormat::Enum sourceFormat, ezImageFormat::Enum targetFormat, const ezImageCompressionSettings& settings) const override
   {
     EZ_IGNORE_UNUSED(targetFormat);
+    EZ_IGNORE_UNUSED(settings);
 
-    ezUInt32 stride = ezImageFormat::GetBitsPerPixel(sourceFormat) / 8;
-    ezUInt64 rowPitch = ezImageFormat::GetRowPitch(sourceFormat, 4 * numBlocksX);
+    const ezUInt32 stride = ezImageFormat::GetBitsPerPixel(sourceFormat) / 8;
+    const ezUInt64 rowPitch = ezImageFormat::GetRowPitch(sourceFormat, 4 * numBlocksX);
 
     // Bias to shift signed data into unsigned range so we can treat it the same as unsigned
     ezUInt8 bias = 0;
@@ -2952,32 +2954,39 @@ class ezImageConversion_CompressBC4 : public ezImageConversionStepCompressBlocks
       bias = 128;
     }
 
-    for (ezUInt32 blockY = 0; blockY < numBlocksY; ++blockY)
-    {
-      for (ezUInt32 blockX = 0; blockX < numBlocksX; ++blockX)
-      {
-        ezUInt8 sourceBlock[16];
+    const ezUInt8* pSource = source.GetPtr();
+    ezUInt8* pTarget = target.GetPtr();
 
-        for (ezUInt32 y = 0; y < 4; ++y)
+    ezTaskSystem::ParallelForIndexed(
+      0, numBlocksY, [pSource, pTarget, rowPitch, stride, numBlocksX, bias](ezUInt32 uiStartRow, ezUInt32 uiEndRow)
+      {
+        for (ezUInt32 blockY = uiStartRow; blockY < uiEndRow; ++blockY)
         {
-          const ezUInt8* sourcePointer = static_cast<const ezUInt8*>(source.GetPtr()) + (4 * blockY + y) * rowPitch;
-
-          for (ezUInt32 x = 0; x < 4; ++x)
+          for (ezUInt32 blockX = 0; blockX < numBlocksX; ++blockX)
           {
-            sourceBlock[4 * y + x] = sourcePointer[(x + 4 * blockX) * stride] + bias;
-          }
-        }
+            ezUInt8 sourceBlock[16];
 
-        ezUInt32 a0, a1;
-        findBestPaletteBC4(sourceBlock, a0, a1);
+            for (ezUInt32 y = 0; y < 4; ++y)
+            {
+              const ezUInt8* sourcePointer = pSource + (4 * blockY + y) * rowPitch;
 
-        ezUInt8* targetPointer = static_cast<ezUInt8*>(target.GetPtr()) + (blockY * numBlocksX + blockX) * 8;
-        packBlockBC4(sourceBlock, a0, a1, targetPointer);
+              for (ezUInt32 x = 0; x < 4; ++x)
+              {
+                sourceBlock[4 * y + x] = sourcePointer[(x + 4 * blockX) * stride] + bias;
+              }
+            }
 
-        targetPointer[0] -= bias;
-        targetPointer[1] -= bias;
-      }
-    }
+            ezUInt32 a0, a1;
+            findBestPaletteBC4(sourceBlock, a0, a1);
+
+            ezUInt8* targetPointer = pTarget + (blockY * numBlocksX + blockX) * 8;
+            packBlockBC4(sourceBlock, a0, a1, targetPointer);
+
+            targetPointer[0] -= bias;
+            targetPointer[1] -= bias;
+          }
+        }
+      });
 
     return EZ_SUCCESS;
   }
@@ -2996,12 +3005,13 @@ class ezImageConversion_CompressBC5 : public ezImageConversionStepCompressBlocks
     return supportedConversions;
   }
 
-  virtual ezResult CompressBlocks(ezConstByteBlobPtr source, ezByteBlobPtr target, ezUInt32 numBlocksX, ezUInt32 numBlocksY, ezImageFormat::Enum sourceFormat, ezImageFormat::Enum targetFormat) const override
+  virtual ezResult CompressBlocks(ezConstByteBlobPtr source, ezByteBlobPtr target, ezUInt32 numBlocksX, ezUInt32 numBlocksY, ezImageFormat::Enum sourceFormat, ezImageFormat::Enum targetFormat, const ezImageCompressionSettings& settings) const override
   {
     EZ_IGNORE_UNUSED(targetFormat);
+    EZ_IGNORE_UNUSED(settings);
 
-    ezUInt32 stride = ezImageFormat::GetBitsPerPixel(sourceFormat) / 8;
-    ezUInt64 rowPitch = ezImageFormat::GetRowPitch(sourceFormat, 4 * numBlocksX);
+    const ezUInt32 stride = ezImageFormat::GetBitsPerPixel(sourceFormat) / 8;
+    const ezUInt64 rowPitch = ezImageFormat::GetRowPitch(sourceFormat, 4 * numBlocksX);
 
     // Bias to shift signed data into unsigned range so we can treat it the same as unsigned
     ezUInt8 bias = 0;
@@ -3010,47 +3020,54 @@ class ezImageConversion_CompressBC5 : public ezImageConversionStepCompressBlocks
       bias = 128;
     }
 
-    for (ezUInt32 blockY = 0; blockY < numBlocksY; ++blockY)
-    {
-      for (ezUInt32 blockX = 0; blockX < numBlocksX; ++blockX)
-      {
-        ezUInt8 sourceBlockR[16];
-        ezUInt8 sourceBlockG[16];
+    const ezUInt8* pSource = source.GetPtr();
+    ezUInt8* pTarget = target.GetPtr();
 
-        for (ezUInt32 y = 0; y < 4; ++y)
+    ezTaskSystem::ParallelForIndexed(
+      0, numBlocksY, [pSource, pTarget, rowPitch, stride, numBlocksX, bias](ezUInt32 uiStartRow, ezUInt32 uiEndRow)
+      {
+        for (ezUInt32 blockY = uiStartRow; blockY < uiEndRow; ++blockY)
         {
-          const ezUInt8* sourcePointer = static_cast<const ezUInt8*>(source.GetPtr()) + (4 * blockY + y) * rowPitch;
-
-          for (ezUInt32 x = 0; x < 4; ++x)
+          for (ezUInt32 blockX = 0; blockX < numBlocksX; ++blockX)
           {
-            sourceBlockR[4 * y + x] = sourcePointer[(x + 4 * blockX) * stride + 0] + bias;
-            sourceBlockG[4 * y + x] = sourcePointer[(x + 4 * blockX) * stride + 1] + bias;
-          }
-        }
+            ezUInt8 sourceBlockR[16];
+            ezUInt8 sourceBlockG[16];
 
-        ezUInt8* targetPointer = static_cast<ezUInt8*>(target.GetPtr()) + (blockY * numBlocksX + blockX) * 16;
+            for (ezUInt32 y = 0; y < 4; ++y)
+            {
+              const ezUInt8* sourcePointer = pSource + (4 * blockY + y) * rowPitch;
 
-        {
-          ezUInt32 a0, a1;
-          findBestPaletteBC4(sourceBlockR, a0, a1);
-          packBlockBC4(sourceBlockR, a0, a1, targetPointer);
+              for (ezUInt32 x = 0; x < 4; ++x)
+              {
+                sourceBlockR[4 * y + x] = sourcePointer[(x + 4 * blockX) * stride + 0] + bias;
+                sourceBlockG[4 * y + x] = sourcePointer[(x + 4 * blockX) * stride + 1] + bias;
+              }
+            }
 
-          // Undo biasing for signed formats by shifting palette upper and lower bound back into signed range
-          targetPointer[0] -= bias;
-          targetPointer[1] -= bias;
-        }
+            ezUInt8* targetPointer = pTarget + (blockY * numBlocksX + blockX) * 16;
 
-        {
-          ezUInt32 a0, a1;
-          findBestPaletteBC4(sourceBlockG, a0, a1);
-          packBlockBC4(sourceBlockG, a0, a1, targetPointer + 8);
+            {
+              ezUInt32 a0, a1;
+              findBestPaletteBC4(sourceBlockR, a0, a1);
+              packBlockBC4(sourceBlockR, a0, a1, targetPointer);
 
-          // Undo biasing for signed formats by shifting palette upper and lower bound back into signed range
-          targetPointer[8] -= bias;
-          targetPointer[9] -= bias;
+              // Undo biasing for signed formats by shifting palette upper and lower bound back into signed range
+              targetPointer[0] -= bias;
+              targetPointer[1] -= bias;
+            }
+
+            {
+              ezUInt32 a0, a1;
+              findBestPaletteBC4(sourceBlockG, a0, a1);
+              packBlockBC4(sourceBlockG, a0, a1, targetPointer + 8);
+
+              // Undo biasing for signed formats by shifting palette upper and lower bound back into signed range
+              targetPointer[8] -= bias;
+              targetPointer[9] -= bias;
+            }
+          }
         }
-      }
-    }
+      });
 
     return EZ_SUCCESS;
   }
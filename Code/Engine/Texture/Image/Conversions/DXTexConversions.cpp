@@ -322,7 +322,7 @@ public:
   }
 
   virtual ezResult CompressBlocks(ezConstByteBlobPtr source, ezByteBlobPtr target, ezUInt32 uiNumBlocksX, ezUInt32 uiNumBlocksY,
-    ezImageFormat::Enum sourceFormat, ezImageFormat::Enum targetFormat) const override
+    ezImageFormat::Enum sourceFormat, ezImageFormat::Enum targetFormat, const ezImageCompressionSettings& settings) const override
   {
     const ezUInt32 targetWidth = uiNumBlocksX * ezImageFormat::GetBlockWidth(targetFormat);
     const ezUInt32 targetHeight = uiNumBlocksY * ezImageFormat::GetBlockHeight(targetFormat);
@@ -345,6 +345,9 @@ public:
 
     ScratchImage dxDstImage;
 
+    // the fast tier only tries BC7 mode 6, the other formats don't have quality options
+    const TEX_COMPRESS_FLAGS qualityFlags = settings.m_Quality == ezImageCompressionQuality::Fast ? TEX_COMPRESS_BC7_QUICK : TEX_COMPRESS_DEFAULT;
+
     bool bCompressionDone = false;
 
     {
@@ -353,7 +356,7 @@ public:
       if (pD3dDevice != nullptr)
       {
         if (SUCCEEDED(Compress(pD3dDevice, dxSrcImage.GetImages(), dxSrcImage.GetImageCount(), dxSrcImage.GetMetadata(), dxgiTargetFormat,
-              TEX_COMPRESS_PARALLEL, 1.0f, dxDstImage)))
+              TEX_COMPRESS_PARALLEL | qualityFlags, 1.0f, dxDstImage)))
         {
           // Not all formats can be compressed on the GPU. Fall back to CPU in case GPU compression fails.
           bCompressionDone = true;
@@ -364,7 +367,7 @@ public:
     if (!bCompressionDone)
     {
       if (SUCCEEDED(Compress(
-            dxSrcImage.GetImages(), dxSrcImage.GetImageCount(), dxSrcImage.GetMetadata(), dxgiTargetFormat, TEX_COMPRESS_PARALLEL, 1.0f, dxDstImage)))
+            dxSrcImage.GetImages(), dxSrcImage.GetImageCount(), dxSrcImage.GetMetadata(), dxgiTargetFormat, TEX_COMPRESS_PARALLEL | qualityFlags, 1.0f, dxDstImage)))
       {
         bCompressionDone = true;
       }
@@ -372,7 +375,7 @@ public:
     if (!bCompressionDone)
     {
       if (SUCCEEDED(Compress(
-            dxSrcImage.GetImages(), dxSrcImage.GetImageCount(), dxSrcImage.GetMetadata(), dxgiTargetFormat, TEX_COMPRESS_DEFAULT, 1.0f, dxDstImage)))
+            dxSrcImage.GetImages(), dxSrcImage.GetImageCount(), dxSrcImage.GetMetadata(), dxgiTargetFormat, qualityFlags, 1.0f, dxDstImage)))
       {
         bCompressionDone = true;
       }
@@ -30,14 +30,21 @@ public:
   }
 
   virtual ezResult CompressBlocks(ezConstByteBlobPtr source, ezByteBlobPtr target, ezUInt32 numBlocksX, ezUInt32 numBlocksY,
-    ezImageFormat::Enum sourceFormat, ezImageFormat::Enum targetFormat) const override
+    ezImageFormat::Enum sourceFormat, ezImageFormat::Enum targetFormat, const ezImageCompressionSettings& settings) const override
   {
+    // The time it takes to encode a block varies a lot with its content, so give the scheduler some more tasks to balance the load.
+    ezParallelForParams params;
+    params.m_uiMaxTasksPerThread = 4;
+
     if (targetFormat == ezImageFormat::BC7_UNORM || targetFormat == ezImageFormat::BC7_UNORM_SRGB)
     {
       const ezUInt32 srcStride = numBlocksX * 4 * 4;
       const ezUInt32 targetStride = numBlocksX * 16;
 
-      ezTaskSystem::ParallelForIndexed(0, numBlocksY, [srcStride, targetStride, source, target, numBlocksX](ezUInt32 startIndex, ezUInt32 endIndex)
+      // the fast tier only tries mode 6, which is good enough for previews
+      const ezUInt32 uiFlags = settings.m_Quality == ezImageCompressionQuality::Fast ? DirectX::BC_FLAGS_FORCE_BC7_MODE6 : DirectX::BC_FLAGS_NONE;
+
+      ezTaskSystem::ParallelForIndexed(0, numBlocksY, [srcStride, targetStride, source, target, numBlocksX, uiFlags](ezUInt32 startIndex, ezUInt32 endIndex)
         {
         const ezUInt8* srcIt = source.GetPtr() + srcStride * startIndex * 4;
         ezUInt8* targetIt = target.GetPtr() + targetStride * startIndex;
@@ -54,13 +61,13 @@ public:
                 temp[y * 4 + x] = DirectX::XMVectorSet(pixel[0] / 255.0f, pixel[1] / 255.0f, pixel[2] / 255.0f, pixel[3] / 255.0f);
               }
             }
-            DirectX::D3DXEncodeBC7(targetIt, temp, 0);
+            DirectX::D3DXEncodeBC7(targetIt, temp, uiFlags);
 
             srcIt += 4 * 4;
             targetIt += 16;
           }
           srcIt += 3 * srcStride;
-        } });
+        } }, "ezImageConversion_CompressDxTexCpu::BC7", ezTaskNesting::Never, params);
 
       return EZ_SUCCESS;
     }
@@ -92,7 +99,7 @@ public:
             targetIt += 8;
           }
           srcIt += 3 * srcStride;
-        } });
+        } }, "ezImageConversion_CompressDxTexCpu::BC1", ezTaskNesting::Never, params);
 
       return EZ_SUCCESS;
     }
@@ -124,7 +131,7 @@ public:
             targetIt += 16;
           }
           srcIt += 3 * srcStride;
-        } });
+        } }, "ezImageConversion_CompressDxTexCpu::BC6H", ezTaskNesting::Never, params);
 
       return EZ_SUCCESS;
     }
@@ -261,6 +261,20 @@ static ezResult ReadImageData(ezStreamReader& inout_stream, ezImageHeader& ref_i
   return EZ_SUCCESS;
 }
 
+static ezResult ValidatePitch(const ezImageHeader& imageHeader, const ezDdsHeader& ddsHeader)
+{
+  const bool bPitch = (ddsHeader.m_uiFlags & ezDdsdFlags::PITCH) != 0;
+
+  // If pitch is specified, it must match the computed value
+  if (bPitch && imageHeader.GetRowPitch(0) != ddsHeader.m_uiPitchOrLinearSize)
+  {
+    ezLog::Error("The row pitch specified in the header doesn't match the expected pitch.");
+    return EZ_FAILURE;
+  }
+
+  return EZ_SUCCESS;
+}
+
 ezResult ezDdsFileFormat::ReadImageHeader(ezStreamReader& inout_stream, ezImageHeader& ref_header, ezStringView sFileExtension) const
 {
   EZ_IGNORE_UNUSED(sFileExtension);
@@ -271,6 +285,15 @@ ezResult ezDdsFileFormat::ReadImageHeader(ezStreamReader& inout_stream, ezImageH
   return ReadImageData(inout_stream, ref_header, ddsHeader);
 }
 
+ezResult ezDdsFileFormat::ReadAndValidateImageHeader(ezStreamReader& inout_stream, ezImageHeader& ref_header) const
+{
+  EZ_PROFILE_SCOPE("ezDdsFileFormat::ReadAndValidateImageHeader");
+
+  ezDdsHeader ddsHeader;
+  EZ_SUCCEED_OR_RETURN(ReadImageData(inout_stream, ref_header, ddsHeader));
+  return ValidatePitch(ref_header, ddsHeader);
+}
+
 ezResult ezDdsFileFormat::ReadImage(ezStreamReader& inout_stream, ezImage& ref_image, ezStringView sFileExtension) const
 {
   EZ_IGNORE_UNUSED(sFileExtension);
@@ -280,18 +303,10 @@ ezResult ezDdsFileFormat::ReadImage(ezStreamReader& inout_stream, ezImage& ref_i
   ezImageHeader imageHeader;
   ezDdsHeader ddsHeader;
   EZ_SUCCEED_OR_RETURN(ReadImageData(inout_stream, imageHeader, ddsHeader));
+  EZ_SUCCEED_OR_RETURN(ValidatePitch(imageHeader, ddsHeader));
 
   ref_image.ResetAndAlloc(imageHeader);
 
-  const bool bPitch = (ddsHeader.m_uiFlags & ezDdsdFlags::PITCH) != 0;
-
-  // If pitch is specified, it must match the computed value
-  if (bPitch && ref_image.GetRowPitch(0) != ddsHeader.m_uiPitchOrLinearSize)
-  {
-    ezLog::Error("The row pitch specified in the header doesn't match the expected pitch.");
-    return EZ_FAILURE;
-  }
-
   ezUInt64 uiDataSize = ref_image.GetByteBlobPtr().GetCount();
 
   if (inout_stream.ReadBytes(ref_image.GetByteBlobPtr().GetPtr(), uiDataSize) != uiDataSize)
@@ -7,6 +7,11 @@ class EZ_TEXTURE_DLL ezDdsFileFormat : public ezImageFileFormat
 public:
   virtual ezResult ReadImageHeader(ezStreamReader& inout_stream, ezImageHeader& ref_header, ezStringView sFileExtension) const override;
   virtual ezResult ReadImage(ezStreamReader& inout_stream, ezImage& ref_image, ezStringView sFileExtension) const override;
+
+  /// \brief Reads the header and validates it just like ReadImage() does, but leaves the pixel data in the stream.
+  ///
+  /// Used to reference the pixel data that follows the header in place, instead of copying it into an ezImage.
+  ezResult ReadAndValidateImageHeader(ezStreamReader& inout_stream, ezImageHeader& ref_header) const;
   virtual ezResult WriteImage(ezStreamWriter& inout_stream, const ezImageView& image, ezStringView sFileExtension) const override;
 
   virtual bool CanReadFileType(ezStringView sExtension) const override;
@@ -2,12 +2,42 @@
 
 #include <Foundation/Containers/StaticArray.h>
 #include <Foundation/Types/Bitflags.h>
+#include <Foundation/Types/Enum.h>
 #include <Foundation/Utilities/EnumerableClass.h>
 
 #include <Texture/Image/Image.h>
 
 EZ_DECLARE_FLAGS(ezUInt8, ezImageConversionFlags, InPlace);
 
+/// \brief Selects the trade-off between encoding speed and quality for block compressed target formats.
+struct ezImageCompressionQuality
+{
+  enum Enum
+  {
+    Fast,  ///< Considerably faster, but lower quality encoding. Meant for previews and iteration builds.
+    Final, ///< The best quality that the available encoders can deliver in reasonable time.
+
+    Default = Final
+  };
+
+  using StorageType = ezUInt8;
+};
+
+/// \brief Options that are passed to the encoders when converting to a block compressed format.
+///
+/// Encoders that don't support an option ignore it. Uncompressed conversions are not affected by any of these settings.
+struct ezImageCompressionSettings
+{
+  ezEnum<ezImageCompressionQuality> m_Quality;
+
+  /// \brief Rate-distortion optimization strength. 0 disables RDO.
+  ///
+  /// Values larger than zero make the encoder pick blocks that compress better with general purpose compressors (for example when the
+  /// texture is stored in a compressed archive), at the cost of some quality. Sensible values are in the range of 0.5 to 4.
+  /// Currently only supported for BC7.
+  float m_fRdoLambda = 0.0f;
+};
+
 /// \brief Describes a single conversion step between two image formats.
 ///
 /// Used by conversion step implementations to advertise which format pairs they can handle.
@@ -76,8 +106,10 @@ class EZ_TEXTURE_DLL ezImageConversionStepCompressBlocks : public ezImageConvers
 {
 public:
   /// \brief Compresses the given number of blocks.
+  ///
+  /// Implementations should distribute the work over the task system, this function is only called once per image slice.
   virtual ezResult CompressBlocks(ezConstByteBlobPtr source, ezByteBlobPtr target, ezUInt32 uiNumBlocksX, ezUInt32 uiNumBlocksY,
-    ezImageFormat::Enum sourceFormat, ezImageFormat::Enum targetFormat) const = 0;
+    ezImageFormat::Enum sourceFormat, ezImageFormat::Enum targetFormat, const ezImageCompressionSettings& settings) const = 0;
 };
 
 /// \brief Interface for a single image conversion step from a linear to a planar format.
@@ -180,10 +212,13 @@ public:
     ezHybridArray<ConversionPathNode, 16>& out_path, ezUInt32& out_uiNumScratchBuffers);
 
   /// \brief  Converts the source image into a target image with the given format. Source and target may be the same.
-  static ezResult Convert(const ezImageView& source, ezImage& ref_target, ezImageFormat::Enum targetFormat);
+  ///
+  /// The compression settings are only used if the conversion path contains a step that compresses to a block compressed format.
+  static ezResult Convert(const ezImageView& source, ezImage& ref_target, ezImageFormat::Enum targetFormat, const ezImageCompressionSettings& settings = {});
 
   /// \brief Converts the source image into a target image using a precomputed conversion path.
-  static ezResult Convert(const ezImageView& source, ezImage& ref_target, ezArrayPtr<ConversionPathNode> path, ezUInt32 uiNumScratchBuffers);
+  static ezResult Convert(const ezImageView& source, ezImage& ref_target, ezArrayPtr<ConversionPathNode> path, ezUInt32 uiNumScratchBuffers,
+    const ezImageCompressionSettings& settings = {});
 
   /// \brief Converts the raw source data into a target data buffer with the given format. Source and target may be the same.
   static ezResult ConvertRaw(
@@ -197,13 +232,14 @@ private:
   ezImageConversion();
   ezImageConversion(const ezImageConversion&);
 
-  static ezResult ConvertSingleStep(const ezImageConversionStep* pStep, const ezImageView& source, ezImage& target, ezImageFormat::Enum targetFormat);
+  static ezResult ConvertSingleStep(const ezImageConversionStep* pStep, const ezImageView& source, ezImage& target, ezImageFormat::Enum targetFormat,
+    const ezImageCompressionSettings& settings);
 
   static ezResult ConvertSingleStepDecompress(const ezImageView& source, ezImage& target, ezImageFormat::Enum sourceFormat,
     ezImageFormat::Enum targetFormat, const ezImageConversionStep* pStep);
 
   static ezResult ConvertSingleStepCompress(const ezImageView& source, ezImage& target, ezImageFormat::Enum sourceFormat,
-    ezImageFormat::Enum targetFormat, const ezImageConversionStep* pStep);
+    ezImageFormat::Enum targetFormat, const ezImageConversionStep* pStep, const ezImageCompressionSettings& settings);
 
   static ezResult ConvertSingleStepDeplanarize(const ezImageView& source, ezImage& target, ezImageFormat::Enum sourceFormat,
     ezImageFormat::Enum targetFormat, const ezImageConversionStep* pStep);
@@ -2,6 +2,7 @@
 
 #include <Foundation/Containers/HybridArray.h>
 #include <Foundation/SimdMath/SimdFloat.h>
+#include <Foundation/SimdMath/SimdVec4f.h>
 #include <Texture/TextureDLL.h>
 
 /// \brief Base class for image filtering functions used in scaling and resampling operations.
@@ -18,6 +19,12 @@ public:
   /// Note: The distribution may not be normalized - normalization is handled by the caller.
   virtual ezSimdFloat SamplePoint(const ezSimdFloat& x) const = 0;
 
+  /// \brief Evaluates the filter function at four distances at once.
+  ///
+  /// The default implementation calls SamplePoint() for every lane. Derived filters should override this with a vectorized version,
+  /// since this is what ezImageFilterWeights uses to compute its weights.
+  virtual ezSimdVec4f SamplePoints(const ezSimdVec4f& x) const;
+
   /// \brief Returns the filter support width (radius).
   ///
   /// The filter function is guaranteed to return 0 for |x| > width.
@@ -43,6 +50,7 @@ public:
   ezImageFilterBox(float fWidth = 0.5f);
 
   virtual ezSimdFloat SamplePoint(const ezSimdFloat& x) const override;
+  virtual ezSimdVec4f SamplePoints(const ezSimdVec4f& x) const override;
 };
 
 /// \brief Triangle (bilinear) filter - good balance of speed and quality.
@@ -57,6 +65,7 @@ public:
   ezImageFilterTriangle(float fWidth = 1.0f);
 
   virtual ezSimdFloat SamplePoint(const ezSimdFloat& x) const override;
+  virtual ezSimdVec4f SamplePoints(const ezSimdVec4f& x) const override;
 };
 
 /// \brief Kaiser-windowed sinc filter - highest quality but may introduce ringing.
@@ -81,6 +90,7 @@ public:
   ezImageFilterSincWithKaiserWindow(float fWindowWidth = 3.0f, float fBeta = 4.0f);
 
   virtual ezSimdFloat SamplePoint(const ezSimdFloat& x) const override;
+  virtual ezSimdVec4f SamplePoints(const ezSimdVec4f& x) const override;
 
 private:
   ezSimdFloat m_fBeta;
@@ -377,7 +377,7 @@ void ezImageConversion::RebuildConversionTable()
   s_conversionTableValid = true;
 }
 
-ezResult ezImageConversion::Convert(const ezImageView& source, ezImage& ref_target, ezImageFormat::Enum targetFormat)
+ezResult ezImageConversion::Convert(const ezImageView& source, ezImage& ref_target, ezImageFormat::Enum targetFormat, const ezImageCompressionSettings& settings)
 {
   EZ_PROFILE_SCOPE("ezImageConversion::Convert");
 
@@ -401,10 +401,11 @@ ezResult ezImageConversion::Convert(const ezImageView& source, ezImage& ref_targ
     return EZ_FAILURE;
   }
 
-  return Convert(source, ref_target, path, numScratchBuffers);
+  return Convert(source, ref_target, path, numScratchBuffers, settings);
 }
 
-ezResult ezImageConversion::Convert(const ezImageView& source, ezImage& ref_target, ezArrayPtr<ConversionPathNode> path, ezUInt32 uiNumScratchBuffers)
+ezResult ezImageConversion::Convert(
+  const ezImageView& source, ezImage& ref_target, ezArrayPtr<ConversionPathNode> path, ezUInt32 uiNumScratchBuffers, const ezImageCompressionSettings& settings)
 {
   EZ_ASSERT_DEV(path.GetCount() > 0, "Invalid conversion path");
   EZ_ASSERT_DEV(path[0].m_sourceFormat == source.GetImageFormat(), "Invalid conversion path");
@@ -420,7 +421,7 @@ ezResult ezImageConversion::Convert(const ezImageView& source, ezImage& ref_targ
 
     ezImage* pTarget = targetIndex == 0 ? &ref_target : &intermediates[targetIndex - 1];
 
-    if (ConvertSingleStep(path[i].m_step, *pSource, *pTarget, path[i].m_targetFormat).Failed())
+    if (ConvertSingleStep(path[i].m_step, *pSource, *pTarget, path[i].m_targetFormat, settings).Failed())
     {
       return EZ_FAILURE;
     }
@@ -517,8 +518,8 @@ ezResult ezImageConversion::ConvertRaw(
   return EZ_SUCCESS;
 }
 
-ezResult ezImageConversion::ConvertSingleStep(
-  const ezImageConversionStep* pStep, const ezImageView& source, ezImage& target, ezImageFormat::Enum targetFormat)
+ezResult ezImageConversion::ConvertSingleStep(const ezImageConversionStep* pStep, const ezImageView& source, ezImage& target,
+  ezImageFormat::Enum targetFormat, const ezImageCompressionSettings& settings)
 {
   if (!pStep)
   {
@@ -543,7 +544,7 @@ ezResult ezImageConversion::ConvertSingleStep(
     }
 
     case MakeTypeKey(ezImageFormatType::LINEAR, ezImageFormatType::BLOCK_COMPRESSED):
-      return ConvertSingleStepCompress(source, target, sourceFormat, targetFormat, pStep);
+      return ConvertSingleStepCompress(source, target, sourceFormat, targetFormat, pStep, settings);
 
     case MakeTypeKey(ezImageFormatType::LINEAR, ezImageFormatType::PLANAR):
       return ConvertSingleStepPlanarize(source, target, sourceFormat, targetFormat, pStep);
@@ -623,8 +624,8 @@ ezResult ezImageConversion::ConvertSingleStepDecompress(
   return EZ_SUCCESS;
 }
 
-ezResult ezImageConversion::ConvertSingleStepCompress(
-  const ezImageView& source, ezImage& target, ezImageFormat::Enum sourceFormat, ezImageFormat::Enum targetFormat, const ezImageConversionStep* pStep)
+ezResult ezImageConversion::ConvertSingleStepCompress(const ezImageView& source, ezImage& target, ezImageFormat::Enum sourceFormat,
+  ezImageFormat::Enum targetFormat, const ezImageConversionStep* pStep, const ezImageCompressionSettings& settings)
 {
   for (ezUInt32 arrayIndex = 0; arrayIndex < source.GetNumArrayIndices(); arrayIndex++)
   {
@@ -670,7 +671,7 @@ ezResult ezImageConversion::ConvertSingleStepCompress(
           }
 
           ezResult result = static_cast<const ezImageConversionStepCompressBlocks*>(pStep)->CompressBlocks(paddedSlice.GetByteBlobPtr(),
-            target.GetSliceView(mipLevel, face, arrayIndex, slice).GetByteBlobPtr(), numBlocksX, numBlocksY, sourceFormat, targetFormat);
+            target.GetSliceView(mipLevel, face, arrayIndex, slice).GetByteBlobPtr(), numBlocksX, numBlocksY, sourceFormat, targetFormat, settings);
 
           if (result.Failed())
           {
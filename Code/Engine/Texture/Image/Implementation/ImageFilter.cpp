@@ -1,5 +1,6 @@
 #include <Texture/TexturePCH.h>
 
+#include <Foundation/SimdMath/SimdMath.h>
 #include <Texture/Image/ImageFilter.h>
 
 ezSimdFloat ezImageFilter::GetWidth() const
@@ -7,6 +8,19 @@ ezSimdFloat ezImageFilter::GetWidth() const
   return m_fWidth;
 }
 
+ezSimdVec4f ezImageFilter::SamplePoints(const ezSimdVec4f& x) const
+{
+  float result[4];
+  for (int i = 0; i < 4; ++i)
+  {
+    result[i] = SamplePoint(x.GetComponent(i));
+  }
+
+  ezSimdVec4f vResult;
+  vResult.Load<4>(result);
+  return vResult;
+}
+
 ezImageFilter::ezImageFilter(float width)
   : m_fWidth(width)
 {
@@ -31,6 +45,11 @@ ezSimdFloat ezImageFilterBox::SamplePoint(const ezSimdFloat& x) const
   }
 }
 
+ezSimdVec4f ezImageFilterBox::SamplePoints(const ezSimdVec4f& x) const
+{
+  return ezSimdVec4f::Select(x.Abs() <= ezSimdVec4f(GetWidth()), ezSimdVec4f(1.0f), ezSimdVec4f::MakeZero());
+}
+
 ezImageFilterTriangle::ezImageFilterTriangle(float fWidth)
   : ezImageFilter(fWidth)
 {
@@ -52,6 +71,14 @@ ezSimdFloat ezImageFilterTriangle::SamplePoint(const ezSimdFloat& x) const
   }
 }
 
+ezSimdVec4f ezImageFilterTriangle::SamplePoints(const ezSimdVec4f& x) const
+{
+  const ezSimdVec4f width(GetWidth());
+  const ezSimdVec4f absX = x.Abs();
+
+  return ezSimdVec4f::Select(absX <= width, width - absX, ezSimdVec4f::MakeZero());
+}
+
 static ezSimdFloat sinc(const ezSimdFloat& x)
 {
   ezSimdFloat absX = x.Abs();
@@ -88,6 +115,38 @@ static ezSimdFloat modifiedBessel0(const ezSimdFloat& x)
   return sum;
 }
 
+static ezSimdVec4f sinc(const ezSimdVec4f& x)
+{
+  // the division produces garbage for x == 0, but those lanes take the Taylor expansion anyway
+  const ezSimdVec4f taylor = ezSimdVec4f(1.0f) - x.CompMul(x) * ezSimdFloat(1.0f / 6.0f);
+  const ezSimdVec4f sinX = ezSimdMath::Sin(x).CompDiv(x);
+
+  return ezSimdVec4f::Select(x.Abs() < ezSimdVec4f(0.0001f), taylor, sinX);
+}
+
+static ezSimdVec4f modifiedBessel0(const ezSimdVec4f& x)
+{
+  // Same series as the scalar version. Once a term drops below the threshold all following terms do as well, so lanes simply stop
+  // accumulating until every lane has converged.
+  const ezSimdVec4f vThreshold(0.001f);
+
+  ezSimdVec4f sum(1.0f);
+
+  const ezSimdVec4f xSquared = x.CompMul(x) * ezSimdFloat(0.25f);
+
+  ezSimdVec4f currentTerm = xSquared;
+  ezSimdVec4b active = currentTerm > vThreshold;
+
+  for (ezUInt32 i = 2; active.AnySet(); ++i)
+  {
+    sum += ezSimdVec4f::Select(active, currentTerm, ezSimdVec4f::MakeZero());
+    currentTerm = currentTerm.CompMul(xSquared) / ezSimdFloat(i * i);
+    active = currentTerm > vThreshold;
+  }
+
+  return sum;
+}
+
 ezImageFilterSincWithKaiserWindow::ezImageFilterSincWithKaiserWindow(float fWidth, float fBeta)
   : ezImageFilter(fWidth)
   , m_fBeta(fBeta)
@@ -111,6 +170,21 @@ ezSimdFloat ezImageFilterSincWithKaiserWindow::SamplePoint(const ezSimdFloat& x)
   }
 }
 
+ezSimdVec4f ezImageFilterSincWithKaiserWindow::SamplePoints(const ezSimdVec4f& x) const
+{
+  const ezSimdVec4f scaledX = x / GetWidth();
+
+  const ezSimdVec4f xSq = ezSimdVec4f(1.0f) - scaledX.CompMul(scaledX);
+  const ezSimdVec4b inside = xSq > ezSimdVec4f::MakeZero();
+
+  // clamp the lanes outside of the window, so that the square root stays valid, their result is discarded below
+  const ezSimdVec4f windowX = ezSimdVec4f::Select(inside, xSq, ezSimdVec4f::MakeZero()).GetSqrt() * m_fBeta;
+
+  const ezSimdVec4f result = sinc(x * ezSimdFloat(ezMath::Pi<float>())).CompMul(modifiedBessel0(windowX)) * m_fInvBesselBeta;
+
+  return ezSimdVec4f::Select(inside, result, ezSimdVec4f::MakeZero());
+}
+
 ezImageFilterWeights::ezImageFilterWeights(const ezImageFilter& filter, ezUInt32 uiSrcSamples, ezUInt32 uiDstSamples)
 {
   // Filter weights repeat after the common phase
@@ -146,29 +220,50 @@ ezImageFilterWeights::ezImageFilterWeights(const ezImageFilter& filter, ezUInt32
 
   m_Weights.SetCountUninitialized(uiDstSamples * m_uiNumWeights);
 
+  // The filter is evaluated for four weights at a time, the distance to the source samples shrinks by one per weight.
+  const ezSimdVec4f vWeightOffsets = ezSimdVec4f(0.5f, 1.5f, 2.5f, 3.5f) * invFilterScale;
+
   for (ezUInt32 dstSample = 0; dstSample < uiDstSamples; ++dstSample)
   {
     ezSimdFloat dstSampleInSourceSpace = (ezSimdFloat(dstSample) + ezSimdFloat(0.5f)) * m_fDestToSourceScale;
 
     ezInt32 firstSourceIdx = GetFirstSourceSampleIndex(dstSample);
 
-    ezSimdFloat totalWeight = 0.0f;
+    float* pWeights = m_Weights.GetData() + dstSample * m_uiNumWeights;
 
-    for (ezUInt32 weightIdx = 0; weightIdx < m_uiNumWeights; ++weightIdx)
+    for (ezUInt32 weightIdx = 0; weightIdx < m_uiNumWeights; weightIdx += 4)
     {
-      ezSimdFloat sourceSample = ezSimdFloat(firstSourceIdx + ezInt32(weightIdx)) + ezSimdFloat(0.5f);
+      const ezSimdFloat distance = (dstSampleInSourceSpace - ezSimdFloat(firstSourceIdx + ezInt32(weightIdx))) * invFilterScale;
+      const ezSimdVec4f weights = filter.SamplePoints(ezSimdVec4f(distance) - vWeightOffsets);
+
+      if (weightIdx + 4 <= m_uiNumWeights)
+      {
+        weights.Store<4>(pWeights + weightIdx);
+      }
+      else
+      {
+        float tail[4];
+        weights.Store<4>(tail);
+
+        for (ezUInt32 i = weightIdx; i < m_uiNumWeights; ++i)
+        {
+          pWeights[i] = tail[i - weightIdx];
+        }
+      }
+    }
 
-      ezSimdFloat weight = filter.SamplePoint((dstSampleInSourceSpace - sourceSample) * invFilterScale);
-      totalWeight += weight;
-      m_Weights[dstSample * m_uiNumWeights + weightIdx] = weight;
+    float totalWeight = 0.0f;
+    for (ezUInt32 weightIdx = 0; weightIdx < m_uiNumWeights; ++weightIdx)
+    {
+      totalWeight += pWeights[weightIdx];
     }
 
     // Normalize weights
-    ezSimdFloat invWeight = 1.0f / totalWeight;
+    const float invWeight = 1.0f / totalWeight;
 
     for (ezUInt32 weightIdx = 0; weightIdx < m_uiNumWeights; ++weightIdx)
     {
-      m_Weights[dstSample * m_uiNumWeights + weightIdx] *= invWeight;
+      pWeights[weightIdx] *= invWeight;
     }
   }
 }
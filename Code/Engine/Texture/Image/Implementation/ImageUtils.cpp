@@ -5,6 +5,7 @@
 #include <Foundation/IO/MemoryStream.h>
 #include <Foundation/Profiling/Profiling.h>
 #include <Foundation/SimdMath/SimdVec4f.h>
+#include <Foundation/Threading/TaskSystem.h>
 #include <Foundation/Time/Timestamp.h>
 #include <Texture/Image/ImageConversion.h>
 #include <Texture/Image/ImageEnums.h>
@@ -740,6 +741,79 @@ inline static void FilterLine(
   }
 }
 
+namespace
+{
+  /// \brief One pass of the separable filter in Scale3D, which filters all lines of an image along a single axis.
+  struct FilterAxisPass
+  {
+    const ezImageView* m_pSource = nullptr;
+    ezImage* m_pTarget = nullptr;
+    const ezImageFilterWeights* m_pWeights = nullptr;
+    ezArrayPtr<const ezInt32> m_FirstSampleIndices;
+    ezImageAddressMode::Enum m_AddressMode = ezImageAddressMode::Clamp;
+    ezSimdVec4f m_vBorderColor;
+
+    /// 0 filters along X, 1 along Y and 2 along Z.
+    ezUInt32 m_uiAxis = 0;
+    ezUInt32 m_uiNumSourceElements = 0;
+    ezUInt32 m_uiStride = 0;
+
+    /// Every face of every array slice consists of m_uiNumOuter * m_uiNumInner lines, the two indices are the coordinates of the line
+    /// along the axes that are not filtered.
+    ezUInt32 m_uiNumOuter = 0;
+    ezUInt32 m_uiNumInner = 0;
+    ezUInt32 m_uiNumFaces = 0;
+    ezUInt32 m_uiNumArrayElements = 0;
+  };
+
+  /// Small lines are grouped into one task, so that scheduling doesn't cost more than the filtering itself.
+  constexpr ezUInt32 s_uiMinFilterSamplesPerTask = 64 * 1024;
+
+  void FilterAxis(const FilterAxisPass& pass)
+  {
+    const ezUInt32 uiLinesPerFace = pass.m_uiNumOuter * pass.m_uiNumInner;
+    const ezUInt32 uiNumLines = uiLinesPerFace * pass.m_uiNumFaces * pass.m_uiNumArrayElements;
+    const ezUInt32 uiSamplesPerLine = ezMath::Max(1u, pass.m_FirstSampleIndices.GetCount() * pass.m_pWeights->GetNumWeights());
+
+    ezParallelForParams params;
+    params.m_uiBinSize = ezMath::Max(1u, s_uiMinFilterSamplesPerTask / uiSamplesPerLine);
+
+    ezTaskSystem::ParallelForIndexed(
+      0, uiNumLines, [&pass, uiLinesPerFace](ezUInt32 uiStartIndex, ezUInt32 uiEndIndex)
+      {
+        for (ezUInt32 uiLine = uiStartIndex; uiLine < uiEndIndex; ++uiLine)
+        {
+          const ezUInt32 uiInner = uiLine % pass.m_uiNumInner;
+          const ezUInt32 uiOuter = (uiLine / pass.m_uiNumInner) % pass.m_uiNumOuter;
+          const ezUInt32 uiFace = (uiLine / uiLinesPerFace) % pass.m_uiNumFaces;
+          const ezUInt32 uiArrayIndex = uiLine / (uiLinesPerFace * pass.m_uiNumFaces);
+
+          ezUInt32 x = 0, y = 0, z = 0;
+          switch (pass.m_uiAxis)
+          {
+            case 0:
+              y = uiInner;
+              z = uiOuter;
+              break;
+            case 1:
+              x = uiInner;
+              z = uiOuter;
+              break;
+            default:
+              x = uiInner;
+              y = uiOuter;
+              break;
+          }
+
+          const ezSimdVec4f* filterSource = pass.m_pSource->GetPixelPointer<ezSimdVec4f>(0, uiFace, uiArrayIndex, x, y, z);
+          ezSimdVec4f* filterTarget = pass.m_pTarget->GetPixelPointer<ezSimdVec4f>(0, uiFace, uiArrayIndex, x, y, z);
+          FilterLine(pass.m_uiNumSourceElements, filterSource, filterTarget, pass.m_uiStride, *pass.m_pWeights, pass.m_FirstSampleIndices, pass.m_AddressMode, pass.m_vBorderColor);
+        }
+      },
+      "ezImageUtils::Scale3D", ezTaskNesting::Never, params);
+  }
+} // namespace
+
 static void DownScaleFastLine(ezUInt32 uiPixelStride, const ezUInt8* pSrc, ezUInt8* pDest, ezUInt32 uiLengthIn, ezUInt32 uiStrideIn, ezUInt32 uiLengthOut, ezUInt32 uiStrideOut)
 {
   const ezUInt32 downScaleFactor = uiLengthIn / uiLengthOut;
@@ -789,16 +863,22 @@ static void DownScaleFast(const ezImageView& image, ezImage& out_result, ezUInt3
   ezImage intermediate;
   intermediate.ResetAndAlloc(intermediateHeader);
 
-  for (ezUInt32 arrayIndex = 0; arrayIndex < numArrayElements; arrayIndex++)
-  {
-    for (ezUInt32 face = 0; face < numFaces; face++)
+  ezParallelForParams params;
+  params.m_uiBinSize = ezMath::Max(1u, s_uiMinFilterSamplesPerTask / (originalWidth * pixelStride));
+
+  ezTaskSystem::ParallelForIndexed(
+    0, numArrayElements * numFaces * originalHeight, [&image, &intermediate, originalWidth, originalHeight, uiWidth, numFaces, pixelStride](ezUInt32 uiStartIndex, ezUInt32 uiEndIndex)
     {
-      for (ezUInt32 row = 0; row < originalHeight; row++)
+      for (ezUInt32 uiLine = uiStartIndex; uiLine < uiEndIndex; ++uiLine)
       {
+        const ezUInt32 row = uiLine % originalHeight;
+        const ezUInt32 face = (uiLine / originalHeight) % numFaces;
+        const ezUInt32 arrayIndex = uiLine / (originalHeight * numFaces);
+
         DownScaleFastLine(pixelStride, image.GetPixelPointer<ezUInt8>(0, face, arrayIndex, 0, row), intermediate.GetPixelPointer<ezUInt8>(0, face, arrayIndex, 0, row), originalWidth, pixelStride, uiWidth, pixelStride);
       }
-    }
-  }
+    },
+    "ezImageUtils::DownScaleFast", ezTaskNesting::Never, params);
 
   // input and output images may be the same, so we can't access the original image below this point
 
@@ -806,7 +886,7 @@ static void DownScaleFast(const ezImageView& image, ezImage& out_result, ezUInt3
   outHeader.SetWidth(uiWidth);
   outHeader.SetHeight(uiHeight);
   outHeader.SetNumArrayIndices(numArrayElements);
-  outHeader.SetNumArrayIndices(numFaces);
+  outHeader.SetNumFaces(numFaces);
   outHeader.SetImageFormat(format);
 
   out_result.ResetAndAlloc(outHeader);
@@ -814,16 +894,21 @@ static void DownScaleFast(const ezImageView& image, ezImage& out_result, ezUInt3
   EZ_ASSERT_DEBUG(intermediate.GetRowPitch() < ezMath::MaxValue<ezUInt32>(), "Row pitch exceeds ezUInt32 max value.");
   EZ_ASSERT_DEBUG(out_result.GetRowPitch() < ezMath::MaxValue<ezUInt32>(), "Row pitch exceeds ezUInt32 max value.");
 
-  for (ezUInt32 arrayIndex = 0; arrayIndex < numArrayElements; arrayIndex++)
-  {
-    for (ezUInt32 face = 0; face < numFaces; face++)
+  params.m_uiBinSize = ezMath::Max(1u, s_uiMinFilterSamplesPerTask / (originalHeight * pixelStride));
+
+  ezTaskSystem::ParallelForIndexed(
+    0, numArrayElements * numFaces * uiWidth, [&intermediate, &out_result, originalHeight, uiWidth, uiHeight, numFaces, pixelStride](ezUInt32 uiStartIndex, ezUInt32 uiEndIndex)
     {
-      for (ezUInt32 col = 0; col < uiWidth; col++)
+      for (ezUInt32 uiLine = uiStartIndex; uiLine < uiEndIndex; ++uiLine)
       {
+        const ezUInt32 col = uiLine % uiWidth;
+        const ezUInt32 face = (uiLine / uiWidth) % numFaces;
+        const ezUInt32 arrayIndex = uiLine / (uiWidth * numFaces);
+
         DownScaleFastLine(pixelStride, intermediate.GetPixelPointer<ezUInt8>(0, face, arrayIndex, col), out_result.GetPixelPointer<ezUInt8>(0, face, arrayIndex, col), originalHeight, static_cast<ezUInt32>(intermediate.GetRowPitch()), uiHeight, static_cast<ezUInt32>(out_result.GetRowPitch()));
       }
-    }
-  }
+    },
+    "ezImageUtils::DownScaleFast", ezTaskNesting::Never, params);
 }
 
 static float EvaluateAverageCoverage(ezBlobPtr<const ezColor> colors, float fAlphaThreshold)
@@ -994,6 +1079,12 @@ ezResult ezImageUtils::Scale3D(const ezImageView& source, ezImage& ref_target, e
   ezHybridArray<ezInt32, 256> firstSampleIndices;
   firstSampleIndices.Reserve(ezMath::Max(uiWidth, uiHeight, uiDepth));
 
+  // Each pass filters all lines along one axis, the lines are independent of each other and are distributed across the worker threads
+  FilterAxisPass basePass;
+  basePass.m_vBorderColor = ezSimdVec4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a);
+  basePass.m_uiNumFaces = numFaces;
+  basePass.m_uiNumArrayElements = numArrayElements;
+
   if (uiWidth != originalWidth)
   {
     ezImageFilterWeights weights(*pFilter, originalWidth, uiWidth);
@@ -1017,21 +1108,18 @@ ezResult ezImageUtils::Scale3D(const ezImageView& source, ezImage& ref_target, e
     stepHeader.SetWidth(uiWidth);
     stepTarget->ResetAndAlloc(stepHeader);
 
-    for (ezUInt32 arrayIndex = 0; arrayIndex < numArrayElements; ++arrayIndex)
-    {
-      for (ezUInt32 face = 0; face < numFaces; ++face)
-      {
-        for (ezUInt32 z = 0; z < originalDepth; ++z)
-        {
-          for (ezUInt32 y = 0; y < originalHeight; ++y)
-          {
-            const ezSimdVec4f* filterSource = stepSource->GetPixelPointer<ezSimdVec4f>(0, face, arrayIndex, 0, y, z);
-            ezSimdVec4f* filterTarget = stepTarget->GetPixelPointer<ezSimdVec4f>(0, face, arrayIndex, 0, y, z);
-            FilterLine(originalWidth, filterSource, filterTarget, 1, weights, firstSampleIndices, addressModeU, ezSimdVec4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a));
-          }
-        }
-      }
-    }
+    FilterAxisPass pass = basePass;
+    pass.m_pSource = stepSource;
+    pass.m_pTarget = stepTarget;
+    pass.m_pWeights = &weights;
+    pass.m_FirstSampleIndices = firstSampleIndices;
+    pass.m_AddressMode = addressModeU;
+    pass.m_uiAxis = 0;
+    pass.m_uiNumSourceElements = originalWidth;
+    pass.m_uiStride = 1;
+    pass.m_uiNumOuter = originalDepth;
+    pass.m_uiNumInner = originalHeight;
+    FilterAxis(pass);
 
     releaseScratch(*stepSource);
     stepSource = stepTarget;
@@ -1060,21 +1148,18 @@ ezResult ezImageUtils::Scale3D(const ezImageView& source, ezImage& ref_target, e
     stepHeader.SetHeight(uiHeight);
     stepTarget->ResetAndAlloc(stepHeader);
 
-    for (ezUInt32 arrayIndex = 0; arrayIndex < numArrayElements; ++arrayIndex)
-    {
-      for (ezUInt32 face = 0; face < numFaces; ++face)
-      {
-        for (ezUInt32 z = 0; z < originalDepth; ++z)
-        {
-          for (ezUInt32 x = 0; x < uiWidth; ++x)
-          {
-            const ezSimdVec4f* filterSource = stepSource->GetPixelPointer<ezSimdVec4f>(0, face, arrayIndex, x, 0, z);
-            ezSimdVec4f* filterTarget = stepTarget->GetPixelPointer<ezSimdVec4f>(0, face, arrayIndex, x, 0, z);
-            FilterLine(originalHeight, filterSource, filterTarget, uiWidth, weights, firstSampleIndices, addressModeV, ezSimdVec4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a));
-          }
-        }
-      }
-    }
+    FilterAxisPass pass = basePass;
+    pass.m_pSource = stepSource;
+    pass.m_pTarget = stepTarget;
+    pass.m_pWeights = &weights;
+    pass.m_FirstSampleIndices = firstSampleIndices;
+    pass.m_AddressMode = addressModeV;
+    pass.m_uiAxis = 1;
+    pass.m_uiNumSourceElements = originalHeight;
+    pass.m_uiStride = uiWidth;
+    pass.m_uiNumOuter = originalDepth;
+    pass.m_uiNumInner = uiWidth;
+    FilterAxis(pass);
 
     releaseScratch(*stepSource);
     stepSource = stepTarget;
@@ -1103,21 +1188,18 @@ ezResult ezImageUtils::Scale3D(const ezImageView& source, ezImage& ref_target, e
     stepHeader.SetDepth(uiDepth);
     stepTarget->ResetAndAlloc(stepHeader);
 
-    for (ezUInt32 arrayIndex = 0; arrayIndex < numArrayElements; ++arrayIndex)
-    {
-      for (ezUInt32 face = 0; face < numFaces; ++face)
-      {
-        for (ezUInt32 y = 0; y < uiHeight; ++y)
-        {
-          for (ezUInt32 x = 0; x < uiWidth; ++x)
-          {
-            const ezSimdVec4f* filterSource = stepSource->GetPixelPointer<ezSimdVec4f>(0, face, arrayIndex, x, y, 0);
-            ezSimdVec4f* filterTarget = stepTarget->GetPixelPointer<ezSimdVec4f>(0, face, arrayIndex, x, y, 0);
-            FilterLine(originalHeight, filterSource, filterTarget, uiWidth * uiHeight, weights, firstSampleIndices, addressModeW, ezSimdVec4f(borderColor.r, borderColor.g, borderColor.b, borderColor.a));
-          }
-        }
-      }
-    }
+    FilterAxisPass pass = basePass;
+    pass.m_pSource = stepSource;
+    pass.m_pTarget = stepTarget;
+    pass.m_pWeights = &weights;
+    pass.m_FirstSampleIndices = firstSampleIndices;
+    pass.m_AddressMode = addressModeW;
+    pass.m_uiAxis = 2;
+    pass.m_uiNumSourceElements = originalDepth;
+    pass.m_uiStride = uiWidth * uiHeight;
+    pass.m_uiNumOuter = uiHeight;
+    pass.m_uiNumInner = uiWidth;
+    FilterAxis(pass);
 
     releaseScratch(*stepSource);
     stepSource = stepTarget;
@@ -1127,6 +1209,56 @@ ezResult ezImageUtils::Scale3D(const ezImageView& source, ezImage& ref_target, e
   return ezImageConversion::Convert(*stepSource, ref_target, format);
 }
 
+static void GenerateMipChain(const ezImageView& source, ezImage& ref_target, const ezImageUtils::MipMapOptions& mipMapOptions, const ezImageHeader& header, ezUInt32 numMipMaps, ezUInt32 face, ezUInt32 arrayIndex)
+{
+  ezImageHeader currentMipMapHeader = header;
+  currentMipMapHeader.SetNumMipLevels(1);
+  currentMipMapHeader.SetNumFaces(1);
+  currentMipMapHeader.SetNumArrayIndices(1);
+
+  auto sourceView = source.GetSubImageView(0, face, arrayIndex).GetByteBlobPtr();
+  auto targetView = ref_target.GetSubImageView(0, face, arrayIndex).GetByteBlobPtr();
+
+  memcpy(targetView.GetPtr(), sourceView.GetPtr(), static_cast<size_t>(targetView.GetCount()));
+
+  float targetCoverage = 0.0f;
+  if (mipMapOptions.m_preserveCoverage)
+  {
+    targetCoverage = EvaluateAverageCoverage(source.GetSubImageView(0, face, arrayIndex).GetBlobPtr<ezColor>(), mipMapOptions.m_alphaThreshold);
+  }
+
+  for (ezUInt32 mipMapLevel = 0; mipMapLevel < numMipMaps - 1; mipMapLevel++)
+  {
+    ezImageHeader nextMipMapHeader = currentMipMapHeader;
+    nextMipMapHeader.SetWidth(ezMath::Max(1u, nextMipMapHeader.GetWidth() / 2));
+    nextMipMapHeader.SetHeight(ezMath::Max(1u, nextMipMapHeader.GetHeight() / 2));
+    nextMipMapHeader.SetDepth(ezMath::Max(1u, nextMipMapHeader.GetDepth() / 2));
+
+    auto sourceData = ref_target.GetSubImageView(mipMapLevel, face, arrayIndex).GetByteBlobPtr();
+    ezImage currentMipMap;
+    currentMipMap.ResetAndUseExternalStorage(currentMipMapHeader, sourceData);
+
+    auto dstData = ref_target.GetSubImageView(mipMapLevel + 1, face, arrayIndex).GetByteBlobPtr();
+    ezImage nextMipMap;
+    nextMipMap.ResetAndUseExternalStorage(nextMipMapHeader, dstData);
+
+    ezImageUtils::Scale3D(currentMipMap, nextMipMap, nextMipMapHeader.GetWidth(), nextMipMapHeader.GetHeight(), nextMipMapHeader.GetDepth(), mipMapOptions.m_filter, mipMapOptions.m_addressModeU, mipMapOptions.m_addressModeV, mipMapOptions.m_addressModeW, mipMapOptions.m_borderColor)
+      .IgnoreResult();
+
+    if (mipMapOptions.m_preserveCoverage)
+    {
+      NormalizeCoverage(nextMipMap, header, mipMapOptions, targetCoverage);
+    }
+
+    if (mipMapOptions.m_renormalizeNormals)
+    {
+      ezImageUtils::RenormalizeNormalMap(nextMipMap);
+    }
+
+    currentMipMapHeader = nextMipMapHeader;
+  }
+}
+
 void ezImageUtils::GenerateMipMaps(const ezImageView& source, ezImage& ref_target, const MipMapOptions& options)
 {
   EZ_PROFILE_SCOPE("ezImageUtils::GenerateMipMaps");
@@ -1157,58 +1289,21 @@ void ezImageUtils::GenerateMipMaps(const ezImageView& source, ezImage& ref_targe
 
   ref_target.ResetAndAlloc(header);
 
-  for (ezUInt32 arrayIndex = 0; arrayIndex < source.GetNumArrayIndices(); arrayIndex++)
-  {
-    for (ezUInt32 face = 0; face < source.GetNumFaces(); face++)
-    {
-      ezImageHeader currentMipMapHeader = header;
-      currentMipMapHeader.SetNumMipLevels(1);
-      currentMipMapHeader.SetNumFaces(1);
-      currentMipMapHeader.SetNumArrayIndices(1);
-
-      auto sourceView = source.GetSubImageView(0, face, arrayIndex).GetByteBlobPtr();
-      auto targetView = ref_target.GetSubImageView(0, face, arrayIndex).GetByteBlobPtr();
+  // Every mip level is computed from the previous one, but the mip chains of the individual faces and array slices are independent.
+  const ezUInt32 numFaces = source.GetNumFaces();
 
-      memcpy(targetView.GetPtr(), sourceView.GetPtr(), static_cast<size_t>(targetView.GetCount()));
+  ezParallelForParams params;
+  params.m_NestingMode = ezTaskNesting::Maybe;
 
-      float targetCoverage = 0.0f;
-      if (mipMapOptions.m_preserveCoverage)
+  ezTaskSystem::ParallelForIndexed(
+    0, source.GetNumArrayIndices() * numFaces, [&source, &ref_target, &mipMapOptions, &header, numMipMaps, numFaces](ezUInt32 uiStartIndex, ezUInt32 uiEndIndex)
+    {
+      for (ezUInt32 uiChain = uiStartIndex; uiChain < uiEndIndex; ++uiChain)
       {
-        targetCoverage = EvaluateAverageCoverage(source.GetSubImageView(0, face, arrayIndex).GetBlobPtr<ezColor>(), mipMapOptions.m_alphaThreshold);
+        GenerateMipChain(source, ref_target, mipMapOptions, header, numMipMaps, uiChain % numFaces, uiChain / numFaces);
       }
-
-      for (ezUInt32 mipMapLevel = 0; mipMapLevel < numMipMaps - 1; mipMapLevel++)
-      {
-        ezImageHeader nextMipMapHeader = currentMipMapHeader;
-        nextMipMapHeader.SetWidth(ezMath::Max(1u, nextMipMapHeader.GetWidth() / 2));
-        nextMipMapHeader.SetHeight(ezMath::Max(1u, nextMipMapHeader.GetHeight() / 2));
-        nextMipMapHeader.SetDepth(ezMath::Max(1u, nextMipMapHeader.GetDepth() / 2));
-
-        auto sourceData = ref_target.GetSubImageView(mipMapLevel, face, arrayIndex).GetByteBlobPtr();
-        ezImage currentMipMap;
-        currentMipMap.ResetAndUseExternalStorage(currentMipMapHeader, sourceData);
-
-        auto dstData = ref_target.GetSubImageView(mipMapLevel + 1, face, arrayIndex).GetByteBlobPtr();
-        ezImage nextMipMap;
-        nextMipMap.ResetAndUseExternalStorage(nextMipMapHeader, dstData);
-
-        ezImageUtils::Scale3D(currentMipMap, nextMipMap, nextMipMapHeader.GetWidth(), nextMipMapHeader.GetHeight(), nextMipMapHeader.GetDepth(), mipMapOptions.m_filter, mipMapOptions.m_addressModeU, mipMapOptions.m_addressModeV, mipMapOptions.m_addressModeW, mipMapOptions.m_borderColor)
-          .IgnoreResult();
-
-        if (mipMapOptions.m_preserveCoverage)
-        {
-          NormalizeCoverage(nextMipMap, header, mipMapOptions, targetCoverage);
-        }
-
-        if (mipMapOptions.m_renormalizeNormals)
-        {
-          RenormalizeNormalMap(nextMipMap);
-        }
-
-        currentMipMapHeader = nextMipMapHeader;
-      }
-    }
-  }
+    },
+    "ezImageUtils::GenerateMipMaps", ezTaskNesting::Maybe, params);
 }
 
 void ezImageUtils::ReconstructNormalZ(ezImage& ref_image)
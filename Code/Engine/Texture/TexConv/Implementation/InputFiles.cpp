@@ -1,6 +1,8 @@
 #include <Texture/TexturePCH.h>
 
+#include <Foundation/Logging/LogEntry.h>
 #include <Foundation/Profiling/Profiling.h>
+#include <Foundation/Threading/TaskSystem.h>
 #include <Texture/Image/ImageUtils.h>
 #include <Texture/TexConv/TexConvProcessor.h>
 
@@ -95,12 +97,61 @@ ezResult ezTexConvProcessor::ConvertAndScaleInputImages(ezUInt32 uiResolutionX,
 {
   EZ_PROFILE_SCOPE("ConvertAndScaleInputImages");
 
-  for (ezUInt32 idx = 0; idx < m_Descriptor.m_InputImages.GetCount(); ++idx)
+  // Cubemap faces and array slices usually come from separate input images, which are independent of each other.
+  // Scaling an image distributes its lines across the worker threads as well, therefore the tasks must be allowed to wait.
+  const ezUInt32 uiNumImages = m_Descriptor.m_InputImages.GetCount();
+
+  ezDynamicArray<ezResult> results;
+  results.SetCount(uiNumImages, EZ_SUCCESS);
+
+  // messages are logged on the worker threads, collect them to pass them to the log of the calling thread afterwards
+  ezDynamicArray<ezDynamicArray<ezLogEntry>> messages;
+  messages.SetCount(uiNumImages);
+
+  struct ConvertData
   {
-    auto& img = m_Descriptor.m_InputImages[idx];
-    ezStringView sName = m_Descriptor.m_InputFiles[idx];
+    ezTexConvProcessor* m_pProcessor;
+    ezResult* m_pResults;
+    ezDynamicArray<ezLogEntry>* m_pMessages;
+    ezUInt32 m_uiResolutionX;
+    ezUInt32 m_uiResolutionY;
+    ezEnum<ezTexConvUsage> m_Usage;
+  };
+
+  const ConvertData data = {this, results.GetData(), messages.GetData(), uiResolutionX, uiResolutionY, usage};
+
+  ezParallelForParams params;
+  params.m_NestingMode = ezTaskNesting::Maybe;
+
+  ezTaskSystem::ParallelForIndexed(
+    0, uiNumImages, [&data](ezUInt32 uiStartIndex, ezUInt32 uiEndIndex)
+    {
+      for (ezUInt32 idx = uiStartIndex; idx < uiEndIndex; ++idx)
+      {
+        ezDynamicArray<ezLogEntry>& imageMessages = data.m_pMessages[idx];
+        ezLogEntryDelegate logger([&imageMessages](ezLogEntry& ref_entry)
+          { imageMessages.PushBack(std::move(ref_entry)); });
+        ezLogSystemScope logScope(&logger);
+
+        auto& img = data.m_pProcessor->m_Descriptor.m_InputImages[idx];
+        ezStringView sName = data.m_pProcessor->m_Descriptor.m_InputFiles[idx];
 
-    EZ_SUCCEED_OR_RETURN(ConvertAndScaleImage(sName, img, uiResolutionX, uiResolutionY, usage));
+        data.m_pResults[idx] = ConvertAndScaleImage(sName, img, data.m_uiResolutionX, data.m_uiResolutionY, data.m_Usage);
+      }
+    },
+    "ConvertAndScaleInputImages", ezTaskNesting::Maybe, params);
+
+  for (ezUInt32 idx = 0; idx < uiNumImages; ++idx)
+  {
+    for (const ezLogEntry& entry : messages[idx])
+    {
+      ezLog::BroadcastLoggingEvent(ezLog::GetThreadLocalLogSystem(), entry.m_Type, entry.m_sMsg);
+    }
+  }
+
+  for (ezResult res : results)
+  {
+    EZ_SUCCEED_OR_RETURN(res);
   }
 
   return EZ_SUCCESS;
@@ -95,7 +95,7 @@ ezResult ezTexConvProcessor::Process()
 
     EZ_SUCCEED_OR_RETURN(PremultiplyAlpha(assembledImg));
 
-    EZ_SUCCEED_OR_RETURN(GenerateOutput(std::move(assembledImg), m_OutputImage, OutputImageFormat));
+    EZ_SUCCEED_OR_RETURN(GenerateOutput(std::move(assembledImg), m_OutputImage, OutputImageFormat, m_Descriptor.m_CompressionSettings));
 
     EZ_SUCCEED_OR_RETURN(GenerateThumbnailOutput(m_OutputImage, m_ThumbnailOutputImage, m_Descriptor.m_uiThumbnailOutputResolution));
 
@@ -188,13 +188,13 @@ ezResult ezTexConvProcessor::DetectNumChannels(ezArrayPtr<const ezTexConvSliceCh
   return EZ_SUCCESS;
 }
 
-ezResult ezTexConvProcessor::GenerateOutput(ezImage&& src, ezImage& dst, ezEnum<ezImageFormat> format)
+ezResult ezTexConvProcessor::GenerateOutput(ezImage&& src, ezImage& dst, ezEnum<ezImageFormat> format, const ezImageCompressionSettings& settings)
 {
   EZ_PROFILE_SCOPE("GenerateOutput");
 
   dst.ResetAndMove(std::move(src));
 
-  if (dst.Convert(format).Failed())
+  if (ezImageConversion::Convert(dst, dst, format, settings).Failed())
   {
     ezLog::Error("Failed to convert result image to output format '{}'", ezImageFormat::GetName(format));
     return EZ_FAILURE;
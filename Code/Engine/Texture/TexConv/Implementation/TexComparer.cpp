@@ -104,6 +104,26 @@ ezResult ezTexComparer::ComputeMSE()
 
   m_OutputMSE = ezImageUtils::ComputeMeanSquareError(m_OutputImageDiff, 32);
 
+  // the MSE above is the worst block, the PSNR is computed over the whole image to make results of different encoders comparable
+  {
+    const ezUInt32 uiNumChannels = ezImageFormat::GetNumChannels(m_OutputImageDiff.GetImageFormat());
+    const ezUInt32 uiRowElements = m_OutputImageDiff.GetWidth() * uiNumChannels;
+
+    ezUInt64 uiSumSquared = 0;
+    for (ezUInt32 y = 0; y < m_OutputImageDiff.GetHeight(); ++y)
+    {
+      const ezUInt8* pRow = m_OutputImageDiff.GetPixelPointer<ezUInt8>(0, 0, 0, 0, y);
+
+      for (ezUInt32 x = 0; x < uiRowElements; ++x)
+      {
+        uiSumSquared += ezUInt64(pRow[x]) * pRow[x];
+      }
+    }
+
+    const double fMSE = static_cast<double>(uiSumSquared) / (ezUInt64(uiRowElements) * m_OutputImageDiff.GetHeight());
+    m_fOutputPSNR = fMSE > 0.0 ? 10.0f * ezMath::Log10(static_cast<float>(255.0 * 255.0 / fMSE)) : ezMath::Infinity<float>();
+  }
+
   return EZ_SUCCESS;
 }
 
@@ -1,6 +1,7 @@
 #include <Texture/TexturePCH.h>
 
 #include <Foundation/Profiling/Profiling.h>
+#include <Foundation/Threading/TaskSystem.h>
 #include <Texture/TexConv/TexConvProcessor.h>
 
 ezResult ezTexConvProcessor::Assemble2DTexture(const ezImageHeader& refImg, ezImage& dst) const
@@ -94,21 +95,50 @@ ezResult ezTexConvProcessor::Assemble2DSlice(const ezTexConvSliceChannelMapping&
   {
     EZ_PROFILE_SCOPE("Assemble2DSlice(gather)");
 
-    for (ezUInt32 y = 0; y < uiResolutionY; ++y)
+    struct GatherData
     {
-      const ezUInt32 pixelWriteRowOffset = uiResolutionX * (bFlip ? (uiResolutionY - y - 1) : y);
+      const float* m_pSourceValues[4];
+      ezUInt32 m_uiSourceStrides[4];
+      ezColor* m_pPixelOut;
+      ezUInt32 m_uiResolutionX;
+      ezUInt32 m_uiResolutionY;
+      bool m_bFlip;
+    };
 
-      for (ezUInt32 x = 0; x < uiResolutionX; ++x)
+    const GatherData gather = {{pSourceValues[0], pSourceValues[1], pSourceValues[2], pSourceValues[3]}, {uiSourceStrides[0], uiSourceStrides[1], uiSourceStrides[2], uiSourceStrides[3]}, pPixelOut, uiResolutionX, uiResolutionY, bFlip};
+
+    ezParallelForParams params;
+    params.m_uiBinSize = ezMath::Max(1u, 16384u / ezMath::Max(1u, uiResolutionX));
+
+    ezTaskSystem::ParallelForIndexed(
+      0, uiResolutionY, [&gather](ezUInt32 uiStartIndex, ezUInt32 uiEndIndex)
       {
-        float* dst = &pPixelOut[pixelWriteRowOffset + x].r;
+        const ezUInt32 uiWidth = gather.m_uiResolutionX;
+        const ezUInt32 uiHeight = gather.m_uiResolutionY;
 
-        for (ezUInt32 c = 0; c < 4; ++c)
+        for (ezUInt32 y = uiStartIndex; y < uiEndIndex; ++y)
         {
-          dst[c] = *pSourceValues[c];
-          pSourceValues[c] += uiSourceStrides[c];
+          const ezUInt32 pixelWriteRowOffset = uiWidth * (gather.m_bFlip ? (uiHeight - y - 1) : y);
+
+          const float* pRowSource[4];
+          for (ezUInt32 c = 0; c < 4; ++c)
+          {
+            pRowSource[c] = gather.m_pSourceValues[c] + static_cast<size_t>(y) * uiWidth * gather.m_uiSourceStrides[c];
+          }
+
+          for (ezUInt32 x = 0; x < uiWidth; ++x)
+          {
+            float* dst = &gather.m_pPixelOut[pixelWriteRowOffset + x].r;
+
+            for (ezUInt32 c = 0; c < 4; ++c)
+            {
+              dst[c] = *pRowSource[c];
+              pRowSource[c] += gather.m_uiSourceStrides[c];
+            }
+          }
         }
-      }
-    }
+      },
+      "Assemble2DSlice(gather)", ezTaskNesting::Never, params);
   }
 
   return EZ_SUCCESS;
@@ -46,6 +46,8 @@ public:
   bool m_bExceededMSE = false;
   /// The MSE of the difference image.
   ezUInt32 m_OutputMSE = 0;
+  /// The peak signal-to-noise ratio in dB over all pixels and channels. Infinity if both images are identical.
+  float m_fOutputPSNR = 0.0f;
 
   /// The (normalized) difference image.
   ezImage m_OutputImageDiff;
@@ -7,6 +7,7 @@
 #include <Foundation/Strings/String.h>
 #include <Foundation/Types/UniquePtr.h>
 #include <Texture/Image/Image.h>
+#include <Texture/Image/ImageConversion.h>
 #include <Texture/Image/ImageEnums.h>
 
 struct ezTexConvChannelMapping
@@ -67,6 +68,7 @@ public:
   // Format and compression
   ezEnum<ezTexConvUsage> m_Usage;                     ///< Intended usage (Color, Normal, Linear, etc.) affects format selection
   ezEnum<ezTexConvCompressionMode> m_CompressionMode; ///< Quality vs file size trade-off
+  ezImageCompressionSettings m_CompressionSettings;   ///< Encoder speed vs quality and rate-distortion optimization for compressed formats
 
   // Resolution control
   ezUInt32 m_uiMinResolution = 16;       ///< Minimum texture dimension (prevents over-downscaling)
@@ -65,7 +65,7 @@ private:
   //////////////////////////////////////////////////////////////////////////
   // Output Generation
 
-  static ezResult GenerateOutput(ezImage&& src, ezImage& dst, ezEnum<ezImageFormat> format);
+  static ezResult GenerateOutput(ezImage&& src, ezImage& dst, ezEnum<ezImageFormat> format, const ezImageCompressionSettings& settings);
   static ezResult GenerateThumbnailOutput(const ezImage& srcImg, ezImage& dstImg, ezUInt32 uiTargetRes);
   static ezResult GenerateLowResOutput(const ezImage& srcImg, ezImage& dstImg, ezUInt32 uiLowResMip);
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <Foundation/Containers/Deque.h>
+#include <Foundation/Containers/DynamicArray.h>
 #include <Foundation/Math/Math.h>
 #include <Utilities/PathFinding/PathState.h>
 #include <Utilities/UtilitiesDLL.h>
@@ -11,6 +13,12 @@
 ///
 /// PathStateType must be derived from ezPathState and can be used for keeping track of certain state along a path and to modify
 /// the path search dynamically.
+///
+/// The nodes that still need to be expanded are kept in a binary heap (ordered by ezPathState::m_fEstimatedCostToTarget), which supports
+/// lowering the costs of nodes that are already queued. For graphs whose node indices are all in a known range, such as grid cells,
+/// call SetDenseNodeCount() to look up the per-node data through a flat array instead of a hash table.
+///
+/// For uniform-cost grids, ezGridJumpPointSearch is usually much faster.
 template <typename PathStateType>
 class ezPathSearch
 {
@@ -33,6 +41,13 @@ public:
   /// \brief Sets the ezPathStateGenerator that should be used by this ezPathSearch object.
   void SetPathStateGenerator(ezPathStateGenerator<PathStateType>* pStateGenerator) { m_pStateGenerator = pStateGenerator; }
 
+  /// \brief If all node indices of the searched graph are in the range [0; uiNumNodes), the per-node data is looked up through a flat array
+  /// of that size, instead of a hash table.
+  ///
+  /// This is much faster for dense graphs such as grids, where the node index is the cell index.
+  /// The array is kept between searches, so the ezPathSearch object should be reused. Pass 0 to switch back to the hash table.
+  void SetDenseNodeCount(ezUInt32 uiNumNodes);
+
   /// \brief Searches for a path that starts at the graph node \a iStartNodeIndex with the start state \a StartState and shall terminate
   /// when the graph node \a iTargetNodeIndex was reached.
   ///
@@ -57,15 +72,46 @@ public:
   void AddPathNode(ezInt64 iNodeIndex, const PathStateType& NewState);
 
 private:
+  struct NodeData
+  {
+    PathStateType m_State;
+    ezInt64 m_iNodeIndex;
+    ezUInt32 m_uiOpenListIndex; // ezInvalidIndex, if the node is not in the open list
+  };
+
+  struct DenseLookup
+  {
+    EZ_DECLARE_POD_TYPE();
+
+    ezUInt32 m_uiSearchID;
+    ezUInt32 m_uiNode;
+  };
+
   void ClearPathStates();
+  ezUInt32 FindNode(ezInt64 iNodeIndex) const;
+  NodeData& AddNode(ezInt64 iNodeIndex);
   ezInt64 FindBestNodeToExpand(PathStateType*& out_pPathState);
   void FillOutPathResult(ezInt64 iEndNodeIndex, ezDeque<PathResultData>& out_Path);
 
-  ezPathStateGenerator<PathStateType>* m_pStateGenerator;
+  bool IsBetter(ezUInt32 uiNode1, ezUInt32 uiNode2) const;
+  void PushOpenList(ezUInt32 uiNode);
+  void SiftUp(ezUInt32 uiOpenListIndex);
+  void SiftDown(ezUInt32 uiOpenListIndex);
+
+  ezPathStateGenerator<PathStateType>* m_pStateGenerator = nullptr;
+
+  /// All nodes that have been reached in the current search. A deque, so that pointers to the path states stay valid.
+  ezDeque<NodeData> m_Nodes;
+
+  /// Maps node indices to m_Nodes, if no dense node count is set.
+  ezHashTable<ezInt64, ezUInt32> m_NodeLookup;
 
-  ezHashTable<ezInt64, PathStateType> m_PathStates;
+  /// Maps node indices to m_Nodes, if a dense node count is set. Entries with an outdated search ID are unused.
+  ezDynamicArray<DenseLookup> m_DenseNodeLookup;
+  ezUInt32 m_uiSearchID = 0;
 
-  ezDeque<ezInt64> m_StateQueue;
+  /// Binary min-heap of indices into m_Nodes.
+  ezDynamicArray<ezUInt32> m_OpenList;
 
   ezInt64 m_iCurNodeIndex;
   PathStateType m_CurState;
@@ -1,39 +1,168 @@
 #pragma once
 
+template <typename PathStateType>
+void ezPathSearch<PathStateType>::SetDenseNodeCount(ezUInt32 uiNumNodes)
+{
+  m_DenseNodeLookup.Clear();
+  m_DenseNodeLookup.SetCount(uiNumNodes);
+  m_DenseNodeLookup.Compact();
+  m_uiSearchID = 0;
+}
+
 template <typename PathStateType>
 void ezPathSearch<PathStateType>::ClearPathStates()
 {
-  m_PathStates.Clear();
-  m_StateQueue.Clear();
+  m_Nodes.Clear();
+  m_NodeLookup.Clear();
+  m_OpenList.Clear();
+
+  ++m_uiSearchID;
+
+  if (m_uiSearchID == 0)
+  {
+    // the search ID wrapped around, entries from a very old search would appear valid again
+    for (auto& entry : m_DenseNodeLookup)
+    {
+      entry.m_uiSearchID = 0;
+    }
+
+    m_uiSearchID = 1;
+  }
+}
+
+template <typename PathStateType>
+ezUInt32 ezPathSearch<PathStateType>::FindNode(ezInt64 iNodeIndex) const
+{
+  if (!m_DenseNodeLookup.IsEmpty())
+  {
+    EZ_ASSERT_DEBUG(iNodeIndex >= 0 && iNodeIndex < (ezInt64)m_DenseNodeLookup.GetCount(), "Node index {} is outside the dense node range", iNodeIndex);
+
+    const DenseLookup& entry = m_DenseNodeLookup[static_cast<ezUInt32>(iNodeIndex)];
+    return (entry.m_uiSearchID == m_uiSearchID) ? entry.m_uiNode : ezInvalidIndex;
+  }
+
+  ezUInt32 uiNode = ezInvalidIndex;
+  m_NodeLookup.TryGetValue(iNodeIndex, uiNode);
+  return uiNode;
 }
 
 template <typename PathStateType>
-ezInt64 ezPathSearch<PathStateType>::FindBestNodeToExpand(PathStateType*& out_pPathState)
+typename ezPathSearch<PathStateType>::NodeData& ezPathSearch<PathStateType>::AddNode(ezInt64 iNodeIndex)
 {
-  float fLowestEstimation = ezMath::Infinity<float>();
-  out_pPathState = nullptr;
-  ezUInt32 iBestInQueue = 0;
+  const ezUInt32 uiNode = m_Nodes.GetCount();
 
-  for (ezUInt32 i = 0; i < m_StateQueue.GetCount(); ++i)
+  if (!m_DenseNodeLookup.IsEmpty())
   {
-    const ezInt64 iNodeIndex = m_StateQueue[i];
+    EZ_ASSERT_DEBUG(iNodeIndex >= 0 && iNodeIndex < (ezInt64)m_DenseNodeLookup.GetCount(), "Node index {} is outside the dense node range", iNodeIndex);
 
-    PathStateType* pState = &m_PathStates[iNodeIndex];
+    DenseLookup& entry = m_DenseNodeLookup[static_cast<ezUInt32>(iNodeIndex)];
+    entry.m_uiSearchID = m_uiSearchID;
+    entry.m_uiNode = uiNode;
+  }
+  else
+  {
+    m_NodeLookup.Insert(iNodeIndex, uiNode);
+  }
 
-    if (pState->m_fEstimatedCostToTarget < fLowestEstimation)
-    {
-      fLowestEstimation = pState->m_fEstimatedCostToTarget;
-      out_pPathState = pState;
-      iBestInQueue = i;
-    }
+  NodeData& node = m_Nodes.ExpandAndGetRef();
+  node.m_iNodeIndex = iNodeIndex;
+  node.m_uiOpenListIndex = ezInvalidIndex;
+  return node;
+}
+
+template <typename PathStateType>
+bool ezPathSearch<PathStateType>::IsBetter(ezUInt32 uiNode1, ezUInt32 uiNode2) const
+{
+  const PathStateType& s1 = m_Nodes[uiNode1].m_State;
+  const PathStateType& s2 = m_Nodes[uiNode2].m_State;
+
+  if (s1.m_fEstimatedCostToTarget != s2.m_fEstimatedCostToTarget)
+    return s1.m_fEstimatedCostToTarget < s2.m_fEstimatedCostToTarget;
+
+  // on ties prefer the node that got further already, it is most likely closer to the target
+  return s1.m_fCostToNode > s2.m_fCostToNode;
+}
+
+template <typename PathStateType>
+void ezPathSearch<PathStateType>::PushOpenList(ezUInt32 uiNode)
+{
+  const ezUInt32 uiIndex = m_OpenList.GetCount();
+  m_OpenList.PushBack(uiNode);
+  m_Nodes[uiNode].m_uiOpenListIndex = uiIndex;
+
+  SiftUp(uiIndex);
+}
+
+template <typename PathStateType>
+void ezPathSearch<PathStateType>::SiftUp(ezUInt32 uiOpenListIndex)
+{
+  const ezUInt32 uiNode = m_OpenList[uiOpenListIndex];
+
+  while (uiOpenListIndex > 0)
+  {
+    const ezUInt32 uiParentIndex = (uiOpenListIndex - 1) / 2;
+    const ezUInt32 uiParentNode = m_OpenList[uiParentIndex];
+
+    if (!IsBetter(uiNode, uiParentNode))
+      break;
+
+    m_OpenList[uiOpenListIndex] = uiParentNode;
+    m_Nodes[uiParentNode].m_uiOpenListIndex = uiOpenListIndex;
+    uiOpenListIndex = uiParentIndex;
   }
 
-  EZ_ASSERT_DEV(out_pPathState != nullptr, "Implementation Error");
+  m_OpenList[uiOpenListIndex] = uiNode;
+  m_Nodes[uiNode].m_uiOpenListIndex = uiOpenListIndex;
+}
+
+template <typename PathStateType>
+void ezPathSearch<PathStateType>::SiftDown(ezUInt32 uiOpenListIndex)
+{
+  const ezUInt32 uiCount = m_OpenList.GetCount();
+  const ezUInt32 uiNode = m_OpenList[uiOpenListIndex];
+
+  while (true)
+  {
+    ezUInt32 uiChildIndex = uiOpenListIndex * 2 + 1;
+    if (uiChildIndex >= uiCount)
+      break;
+
+    if (uiChildIndex + 1 < uiCount && IsBetter(m_OpenList[uiChildIndex + 1], m_OpenList[uiChildIndex]))
+      ++uiChildIndex;
+
+    const ezUInt32 uiChildNode = m_OpenList[uiChildIndex];
 
-  const ezInt64 iBestNodeIndex = m_StateQueue[iBestInQueue];
-  m_StateQueue.RemoveAtAndSwap(iBestInQueue);
+    if (!IsBetter(uiChildNode, uiNode))
+      break;
+
+    m_OpenList[uiOpenListIndex] = uiChildNode;
+    m_Nodes[uiChildNode].m_uiOpenListIndex = uiOpenListIndex;
+    uiOpenListIndex = uiChildIndex;
+  }
 
-  return iBestNodeIndex;
+  m_OpenList[uiOpenListIndex] = uiNode;
+  m_Nodes[uiNode].m_uiOpenListIndex = uiOpenListIndex;
+}
+
+template <typename PathStateType>
+ezInt64 ezPathSearch<PathStateType>::FindBestNodeToExpand(PathStateType*& out_pPathState)
+{
+  EZ_ASSERT_DEV(!m_OpenList.IsEmpty(), "Implementation Error");
+
+  const ezUInt32 uiBestNode = m_OpenList[0];
+  m_Nodes[uiBestNode].m_uiOpenListIndex = ezInvalidIndex;
+
+  const ezUInt32 uiLastNode = m_OpenList.PeekBack();
+  m_OpenList.PopBack();
+
+  if (!m_OpenList.IsEmpty())
+  {
+    m_OpenList[0] = uiLastNode;
+    SiftDown(0);
+  }
+
+  out_pPathState = &m_Nodes[uiBestNode].m_State;
+  return m_Nodes[uiBestNode].m_iNodeIndex;
 }
 
 template <typename PathStateType>
@@ -43,7 +172,7 @@ void ezPathSearch<PathStateType>::FillOutPathResult(ezInt64 iEndNodeIndex, ezDeq
 
   while (true)
   {
-    const PathStateType* pCurState = &m_PathStates[iEndNodeIndex];
+    const PathStateType* pCurState = &m_Nodes[FindNode(iEndNodeIndex)].m_State;
 
     PathResultData r;
     r.m_iNodeIndex = iEndNodeIndex;
@@ -69,28 +198,41 @@ void ezPathSearch<PathStateType>::AddPathNode(ezInt64 iNodeIndex, const PathStat
   // ezArgF(m_pCurPathState->m_fEstimatedCostToTarget, 2), ezArgF(NewState.m_fEstimatedCostToTarget, 2));
   EZ_ASSERT_DEV(NewState.m_fEstimatedCostToTarget >= NewState.m_fCostToNode, "Unrealistic expectations will get you nowhere.");
 
-  PathStateType* pExistingState;
+  const ezUInt32 uiExistingNode = FindNode(iNodeIndex);
 
-  if (m_PathStates.TryGetValue(iNodeIndex, pExistingState))
+  if (uiExistingNode != ezInvalidIndex)
   {
-    // state already exists in the hash table, and has a lower cost -> ignore the new state
-    if (pExistingState->m_fCostToNode <= NewState.m_fCostToNode)
+    NodeData* pExistingNode = &m_Nodes[uiExistingNode];
+
+    // state has been reached before, and has a lower cost -> ignore the new state
+    if (pExistingNode->m_State.m_fCostToNode <= NewState.m_fCostToNode)
       return;
 
     // incoming state is better than the existing state -> update existing state
-    *pExistingState = NewState;
-    pExistingState->m_iReachedThroughNode = m_iCurNodeIndex;
+    pExistingNode->m_State = NewState;
+    pExistingNode->m_State.m_iReachedThroughNode = m_iCurNodeIndex;
+
+    if (pExistingNode->m_uiOpenListIndex != ezInvalidIndex)
+    {
+      // still queued, the costs went down, so it can only move up in the heap
+      SiftUp(pExistingNode->m_uiOpenListIndex);
+    }
+    else
+    {
+      // was already expanded (only possible with an inconsistent heuristic) -> expand it again with the better costs
+      PushOpenList(uiExistingNode);
+    }
+
     return;
   }
 
   // the state has not been reached before -> insert it
-  pExistingState = &m_PathStates[iNodeIndex];
-
-  *pExistingState = NewState;
-  pExistingState->m_iReachedThroughNode = m_iCurNodeIndex;
+  NodeData& node = AddNode(iNodeIndex);
+  node.m_State = NewState;
+  node.m_State.m_iReachedThroughNode = m_iCurNodeIndex;
 
   // put it into the queue of states that still need to be expanded
-  m_StateQueue.PushBack(iNodeIndex);
+  PushOpenList(m_Nodes.GetCount() - 1);
 }
 
 template <typename PathStateType>
@@ -103,13 +245,12 @@ ezResult ezPathSearch<PathStateType>::FindPath(ezInt64 iStartNodeIndex, const Pa
 
   if (iStartNodeIndex == iTargetNodeIndex)
   {
-    m_PathStates.Reserve(1);
-
-    m_PathStates[iTargetNodeIndex] = StartState;
+    NodeData& node = AddNode(iTargetNodeIndex);
+    node.m_State = StartState;
 
     PathResultData r;
     r.m_iNodeIndex = iTargetNodeIndex;
-    r.m_pPathState = &m_PathStates[iTargetNodeIndex];
+    r.m_pPathState = &node.m_State;
 
     out_Path.Clear();
     out_Path.PushBack(r);
@@ -117,9 +258,12 @@ ezResult ezPathSearch<PathStateType>::FindPath(ezInt64 iStartNodeIndex, const Pa
     return EZ_SUCCESS;
   }
 
-  m_PathStates.Reserve(10000);
+  if (m_DenseNodeLookup.IsEmpty())
+  {
+    m_NodeLookup.Reserve(10000);
+  }
 
-  PathStateType& FirstState = m_PathStates[iStartNodeIndex];
+  PathStateType& FirstState = AddNode(iStartNodeIndex).m_State;
 
   m_pStateGenerator->StartSearch(iStartNodeIndex, &FirstState, iTargetNodeIndex);
 
@@ -128,10 +272,10 @@ ezResult ezPathSearch<PathStateType>::FindPath(ezInt64 iStartNodeIndex, const Pa
   FirstState.m_iReachedThroughNode = iStartNodeIndex;
 
   // put the start state into the to-be-expanded queue
-  m_StateQueue.PushBack(iStartNodeIndex);
+  PushOpenList(0);
 
   // while the queue is not empty, expand the next node and see where that gets us
-  while (!m_StateQueue.IsEmpty())
+  while (!m_OpenList.IsEmpty())
   {
     PathStateType* pCurState;
     m_iCurNodeIndex = FindBestNodeToExpand(pCurState);
@@ -172,9 +316,12 @@ ezResult ezPathSearch<PathStateType>::FindClosest(
 
   ClearPathStates();
 
-  m_PathStates.Reserve(10000);
+  if (m_DenseNodeLookup.IsEmpty())
+  {
+    m_NodeLookup.Reserve(10000);
+  }
 
-  PathStateType& FirstState = m_PathStates[iStartNodeIndex];
+  PathStateType& FirstState = AddNode(iStartNodeIndex).m_State;
 
   m_pStateGenerator->StartSearchForClosest(iStartNodeIndex, &FirstState);
 
@@ -183,10 +330,10 @@ ezResult ezPathSearch<PathStateType>::FindClosest(
   FirstState.m_iReachedThroughNode = iStartNodeIndex;
 
   // put the start state into the to-be-expanded queue
-  m_StateQueue.PushBack(iStartNodeIndex);
+  PushOpenList(0);
 
   // while the queue is not empty, expand the next node and see where that gets us
-  while (!m_StateQueue.IsEmpty())
+  while (!m_OpenList.IsEmpty())
   {
     PathStateType* pCurState;
     m_iCurNodeIndex = FindBestNodeToExpand(pCurState);
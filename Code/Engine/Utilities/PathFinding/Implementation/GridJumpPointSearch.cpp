@@ -0,0 +1,336 @@
+#include <Utilities/UtilitiesPCH.h>
+
+#include <Utilities/PathFinding/GridJumpPointSearch.h>
+
+static float OctileDistance(const ezVec2I32& a, const ezVec2I32& b)
+{
+  const ezInt32 dx = ezMath::Abs(a.x - b.x);
+  const ezInt32 dy = ezMath::Abs(a.y - b.y);
+
+  return (float)ezMath::Max(dx, dy) + (ezMath::Sqrt(2.0f) - 1.0f) * (float)ezMath::Min(dx, dy);
+}
+
+void ezGridJumpPointSearch::CreateGrid(ezUInt32 uiSizeX, ezUInt32 uiSizeY)
+{
+  m_uiSizeX = uiSizeX;
+  m_uiSizeY = uiSizeY;
+
+  m_BlockedCells.Clear();
+  m_BlockedCells.SetCount(uiSizeX * uiSizeY, false);
+}
+
+void ezGridJumpPointSearch::UpdateRegion(const ezRectU32& region, CellBlocked isCellBlocked, void* pPassThrough)
+{
+  EZ_ASSERT_DEV(region.x + region.width <= m_uiSizeX && region.y + region.height <= m_uiSizeY, "Region is outside the grid");
+
+  for (ezUInt32 y = region.y; y < region.y + region.height; ++y)
+  {
+    for (ezUInt32 x = region.x; x < region.x + region.width; ++x)
+    {
+      const ezUInt32 uiCell = y * m_uiSizeX + x;
+      m_BlockedCells.SetBitValue(uiCell, isCellBlocked(uiCell, pPassThrough));
+    }
+  }
+}
+
+void ezGridJumpPointSearch::SetCellBlocked(const ezVec2I32& vCoord, bool bBlocked)
+{
+  EZ_ASSERT_DEV(static_cast<ezUInt32>(vCoord.x) < m_uiSizeX && static_cast<ezUInt32>(vCoord.y) < m_uiSizeY, "Cell is outside the grid");
+
+  m_BlockedCells.SetBitValue(ToCell(vCoord.x, vCoord.y), bBlocked);
+}
+
+ezResult ezGridJumpPointSearch::FindPath(const ezVec2I32& vStart, const ezVec2I32& vTarget, ezDynamicArray<ezVec2I32>& out_Path, float* out_pPathCost)
+{
+  out_Path.Clear();
+
+  if (IsBlocked(vStart.x, vStart.y) || IsBlocked(vTarget.x, vTarget.y))
+    return EZ_FAILURE;
+
+  m_vTarget = vTarget;
+  m_Nodes.Clear();
+  m_OpenList.Clear();
+
+  const ezUInt32 uiStartCell = ToCell(vStart.x, vStart.y);
+  const ezUInt32 uiTargetCell = ToCell(vTarget.x, vTarget.y);
+
+  {
+    Node& start = m_Nodes[uiStartCell];
+    start.m_fCost = 0.0f;
+    start.m_uiParentCell = uiStartCell;
+    start.m_bClosed = false;
+
+    PushOpenList({OctileDistance(vStart, vTarget), 0.0f, uiStartCell});
+  }
+
+  while (!m_OpenList.IsEmpty())
+  {
+    const OpenEntry entry = PopOpenList();
+
+    Node* pNode = nullptr;
+    m_Nodes.TryGetValue(entry.m_uiCell, pNode);
+
+    // the open list may contain outdated entries for nodes that were reached more cheaply later on
+    if (pNode->m_bClosed || entry.m_fCost > pNode->m_fCost)
+      continue;
+
+    pNode->m_bClosed = true;
+
+    if (entry.m_uiCell == uiTargetCell)
+    {
+      if (out_pPathCost)
+      {
+        *out_pPathCost = pNode->m_fCost;
+      }
+
+      ezUInt32 uiCell = uiTargetCell;
+      while (true)
+      {
+        out_Path.PushBack(ToCoord(uiCell));
+
+        const ezUInt32 uiParent = m_Nodes[uiCell].m_uiParentCell;
+        if (uiParent == uiCell)
+          break;
+
+        uiCell = uiParent;
+      }
+
+      // the path was gathered from the target back to the start
+      for (ezUInt32 i = 0; i < out_Path.GetCount() / 2; ++i)
+      {
+        ezMath::Swap(out_Path[i], out_Path[out_Path.GetCount() - 1 - i]);
+      }
+
+      return EZ_SUCCESS;
+    }
+
+    // work on a copy, the hash table may get reallocated while new jump points are added
+    const Node node = *pNode;
+    ExpandNode(entry.m_uiCell, node);
+  }
+
+  return EZ_FAILURE;
+}
+
+void ezGridJumpPointSearch::ExpandNode(ezUInt32 uiCell, const Node& node)
+{
+  const ezVec2I32 vCoord = ToCoord(uiCell);
+  const ezInt32 x = vCoord.x;
+  const ezInt32 y = vCoord.y;
+
+  ezHybridArray<ezVec2I32, 8> directions;
+
+  if (node.m_uiParentCell == uiCell)
+  {
+    // the start node expands into all directions
+    for (ezInt32 dy = -1; dy <= 1; ++dy)
+    {
+      for (ezInt32 dx = -1; dx <= 1; ++dx)
+      {
+        if (dx == 0 && dy == 0)
+          continue;
+
+        if (dx != 0 && dy != 0 && (IsBlocked(x + dx, y) || IsBlocked(x, y + dy)))
+          continue;
+
+        directions.PushBack(ezVec2I32(dx, dy));
+      }
+    }
+  }
+  else
+  {
+    // only the 'natural' and 'forced' neighbors need to be looked at, everything else is reached more cheaply through the parent
+    const ezVec2I32 vParent = ToCoord(node.m_uiParentCell);
+    const ezInt32 dx = ezMath::Sign(x - vParent.x);
+    const ezInt32 dy = ezMath::Sign(y - vParent.y);
+
+    if (dx != 0 && dy != 0)
+    {
+      const bool bFreeX = !IsBlocked(x + dx, y);
+      const bool bFreeY = !IsBlocked(x, y + dy);
+
+      if (bFreeY)
+        directions.PushBack(ezVec2I32(0, dy));
+      if (bFreeX)
+        directions.PushBack(ezVec2I32(dx, 0));
+      if (bFreeX && bFreeY)
+        directions.PushBack(ezVec2I32(dx, dy));
+    }
+    else if (dx != 0)
+    {
+      const bool bFreeAhead = !IsBlocked(x + dx, y);
+      const bool bFreeUp = !IsBlocked(x, y + 1);
+      const bool bFreeDown = !IsBlocked(x, y - 1);
+
+      if (bFreeAhead)
+      {
+        directions.PushBack(ezVec2I32(dx, 0));
+
+        if (bFreeUp)
+          directions.PushBack(ezVec2I32(dx, 1));
+        if (bFreeDown)
+          directions.PushBack(ezVec2I32(dx, -1));
+      }
+
+      if (bFreeUp)
+        directions.PushBack(ezVec2I32(0, 1));
+      if (bFreeDown)
+        directions.PushBack(ezVec2I32(0, -1));
+    }
+    else
+    {
+      const bool bFreeAhead = !IsBlocked(x, y + dy);
+      const bool bFreeRight = !IsBlocked(x + 1, y);
+      const bool bFreeLeft = !IsBlocked(x - 1, y);
+
+      if (bFreeAhead)
+      {
+        directions.PushBack(ezVec2I32(0, dy));
+
+        if (bFreeRight)
+          directions.PushBack(ezVec2I32(1, dy));
+        if (bFreeLeft)
+          directions.PushBack(ezVec2I32(-1, dy));
+      }
+
+      if (bFreeRight)
+        directions.PushBack(ezVec2I32(1, 0));
+      if (bFreeLeft)
+        directions.PushBack(ezVec2I32(-1, 0));
+    }
+  }
+
+  for (const ezVec2I32& dir : directions)
+  {
+    ezVec2I32 vJumpPoint;
+    if (Jump(x + dir.x, y + dir.y, dir.x, dir.y, vJumpPoint))
+    {
+      AddJumpPoint(uiCell, node.m_fCost, vJumpPoint);
+    }
+  }
+}
+
+void ezGridJumpPointSearch::AddJumpPoint(ezUInt32 uiFromCell, float fFromCost, const ezVec2I32& vJumpPoint)
+{
+  const ezUInt32 uiCell = ToCell(vJumpPoint.x, vJumpPoint.y);
+  const float fCost = fFromCost + OctileDistance(ToCoord(uiFromCell), vJumpPoint);
+
+  bool bExisted = false;
+  Node& node = m_Nodes.FindOrAdd(uiCell, &bExisted);
+
+  if (bExisted && (node.m_bClosed || node.m_fCost <= fCost))
+    return;
+
+  node.m_fCost = fCost;
+  node.m_uiParentCell = uiFromCell;
+  node.m_bClosed = false;
+
+  // instead of updating an existing entry, a new one is added, the old one gets skipped when it comes up
+  PushOpenList({fCost + OctileDistance(vJumpPoint, m_vTarget), fCost, uiCell});
+}
+
+bool ezGridJumpPointSearch::Jump(ezInt32 x, ezInt32 y, ezInt32 dx, ezInt32 dy, ezVec2I32& out_vJumpPoint) const
+{
+  if (dx == 0 || dy == 0)
+    return JumpStraight(x, y, dx, dy, out_vJumpPoint);
+
+  while (!IsBlocked(x, y))
+  {
+    // a cell on a diagonal is a jump point, if one of the two straight scans from there finds something
+    if ((x == m_vTarget.x && y == m_vTarget.y) || JumpStraight(x + dx, y, dx, 0, out_vJumpPoint) || JumpStraight(x, y + dy, 0, dy, out_vJumpPoint))
+    {
+      out_vJumpPoint.Set(x, y);
+      return true;
+    }
+
+    // no corner cutting
+    if (IsBlocked(x + dx, y) || IsBlocked(x, y + dy))
+      return false;
+
+    x += dx;
+    y += dy;
+  }
+
+  return false;
+}
+
+bool ezGridJumpPointSearch::JumpStraight(ezInt32 x, ezInt32 y, ezInt32 dx, ezInt32 dy, ezVec2I32& out_vJumpPoint) const
+{
+  while (!IsBlocked(x, y))
+  {
+    bool bJumpPoint = (x == m_vTarget.x && y == m_vTarget.y);
+
+    // a cell has a 'forced' neighbor, if that neighbor can't be reached diagonally from the previous cell, because of an obstacle
+    if (dx != 0)
+    {
+      bJumpPoint = bJumpPoint || (!IsBlocked(x, y + 1) && IsBlocked(x - dx, y + 1)) || (!IsBlocked(x, y - 1) && IsBlocked(x - dx, y - 1));
+    }
+    else
+    {
+      bJumpPoint = bJumpPoint || (!IsBlocked(x + 1, y) && IsBlocked(x + 1, y - dy)) || (!IsBlocked(x - 1, y) && IsBlocked(x - 1, y - dy));
+    }
+
+    if (bJumpPoint)
+    {
+      out_vJumpPoint.Set(x, y);
+      return true;
+    }
+
+    x += dx;
+    y += dy;
+  }
+
+  return false;
+}
+
+void ezGridJumpPointSearch::PushOpenList(const OpenEntry& entry)
+{
+  // binary min-heap, ordered by the estimated costs
+  ezUInt32 uiIndex = m_OpenList.GetCount();
+  m_OpenList.PushBack(entry);
+
+  while (uiIndex > 0)
+  {
+    const ezUInt32 uiParent = (uiIndex - 1) / 2;
+
+    if (m_OpenList[uiParent].m_fEstimatedCost <= entry.m_fEstimatedCost)
+      break;
+
+    m_OpenList[uiIndex] = m_OpenList[uiParent];
+    uiIndex = uiParent;
+  }
+
+  m_OpenList[uiIndex] = entry;
+}
+
+ezGridJumpPointSearch::OpenEntry ezGridJumpPointSearch::PopOpenList()
+{
+  const OpenEntry result = m_OpenList[0];
+  const OpenEntry last = m_OpenList.PeekBack();
+  m_OpenList.PopBack();
+
+  const ezUInt32 uiCount = m_OpenList.GetCount();
+  if (uiCount == 0)
+    return result;
+
+  ezUInt32 uiIndex = 0;
+
+  while (true)
+  {
+    ezUInt32 uiChild = uiIndex * 2 + 1;
+    if (uiChild >= uiCount)
+      break;
+
+    if (uiChild + 1 < uiCount && m_OpenList[uiChild + 1].m_fEstimatedCost < m_OpenList[uiChild].m_fEstimatedCost)
+      ++uiChild;
+
+    if (last.m_fEstimatedCost <= m_OpenList[uiChild].m_fEstimatedCost)
+      break;
+
+    m_OpenList[uiIndex] = m_OpenList[uiChild];
+    uiIndex = uiChild;
+  }
+
+  m_OpenList[uiIndex] = last;
+  return result;
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+template <class CellData>
+void ezGridJumpPointSearch::SetupFromGrid(const ezGameGrid<CellData>& grid, CellBlocked isCellBlocked, void* pPassThrough)
+{
+  CreateGrid(grid.GetGridSizeX(), grid.GetGridSizeY());
+
+  UpdateRegion(ezRectU32(grid.GetGridSizeX(), grid.GetGridSizeY()), isCellBlocked, pPassThrough);
+}
@@ -13,6 +13,7 @@ ezAiNavMeshSector::ezAiNavMeshSector()
   m_FlagInvalidate = 0;
   m_FlagUpdateAvailable = 0;
   m_FlagUsable = 0;
+  m_FlagBuilding = 0;
 }
 
 ezAiNavMeshSector::~ezAiNavMeshSector() = default;
@@ -71,16 +72,19 @@ const ezAiNavMeshSector* ezAiNavMesh::GetSector(SectorID sectorID) const
   return nullptr;
 }
 
-bool ezAiNavMesh::RequestSector(SectorID sectorID)
+bool ezAiNavMesh::RequestSector(SectorID sectorID, float fPriority)
 {
   auto& sector = m_Sectors.FindOrAdd(sectorID).Value();
 
+  // also tracked for usable sectors, so that rebuilds after an invalidation are ordered by who needs them
+  sector.m_fRequestPriority = ezMath::Min(sector.m_fRequestPriority, fPriority);
+
   if (sector.m_FlagUsable == 0)
   {
     if (sector.m_FlagRequested == 0)
     {
       sector.m_FlagRequested = 1;
-      m_RequestedSectors.PushBack(sectorID);
+      QueueSectorBuild(sectorID);
     }
 
     return false;
@@ -90,6 +94,11 @@ bool ezAiNavMesh::RequestSector(SectorID sectorID)
 }
 
 bool ezAiNavMesh::RequestSector(const ezVec2& vCenter, const ezVec2& vHalfExtents)
+{
+  return RequestSector(vCenter, vHalfExtents, vCenter);
+}
+
+bool ezAiNavMesh::RequestSector(const ezVec2& vCenter, const ezVec2& vHalfExtents, const ezVec2& vRequesterPosition)
 {
   ezVec2I32 coordMin = CalculateSectorCoord(vCenter.x - vHalfExtents.x, vCenter.y - vHalfExtents.y);
   ezVec2I32 coordMax = CalculateSectorCoord(vCenter.x + vHalfExtents.x, vCenter.y + vHalfExtents.y);
@@ -105,7 +114,10 @@ bool ezAiNavMesh::RequestSector(const ezVec2& vCenter, const ezVec2& vHalfExtent
   {
     for (ezInt32 x = coordMin.x; x <= coordMax.x; ++x)
     {
-      if (!RequestSector(CalculateSectorID(ezVec2I32(x, y))))
+      const ezVec2I32 coord(x, y);
+      const ezVec2 vSectorCenter = GetSectorPositionOffset(coord) + ezVec2(m_fSectorMetersXY * 0.5f);
+
+      if (!RequestSector(CalculateSectorID(coord), (vSectorCenter - vRequesterPosition).GetLengthSquared()))
       {
         res = false;
       }
@@ -142,12 +154,32 @@ void ezAiNavMesh::InvalidateSector(SectorID sectorID, bool bRebuildAsSoonAsPossi
 
   auto& sector = it.Value();
 
+  // a build that is currently running uses the old geometry, its result gets discarded in FinishSectorBuild()
+  ++sector.m_uiBuildGeneration;
+
+  if (sector.m_FlagBuilding == 1)
+  {
+    if (bRebuildAsSoonAsPossible)
+    {
+      // gets queued again, once the stale build has returned
+      sector.m_FlagInvalidate = 1;
+      return;
+    }
+
+    if (sector.m_FlagUsable == 0)
+    {
+      // nothing to unload yet, just don't queue it again after the stale build has returned
+      sector.m_FlagRequested = 0;
+      return;
+    }
+  }
+
   if (sector.m_FlagInvalidate == 0 && (sector.m_FlagUsable == 1 || sector.m_FlagUpdateAvailable == 1))
   {
     if (bRebuildAsSoonAsPossible)
     {
       sector.m_FlagInvalidate = 1;
-      m_RequestedSectors.PushBack(sectorID);
+      QueueSectorBuild(sectorID);
     }
     else
     {
@@ -207,6 +239,7 @@ void ezAiNavMesh::FinalizeSectorUpdates()
 
     sector.m_FlagInvalidate = 0;
     sector.m_FlagUpdateAvailable = 0;
+    sector.m_fRequestPriority = ezMath::MaxValue<float>();
     // sector.m_FlagRequested = 0; // do not reset the requested flag
   }
 
@@ -247,12 +280,36 @@ ezAiNavMesh::SectorID ezAiNavMesh::RetrieveRequestedSector()
   if (m_RequestedSectors.IsEmpty())
     return ezInvalidIndex;
 
-  ezAiNavMesh::SectorID id = m_RequestedSectors.PeekFront();
-  m_RequestedSectors.PopFront();
+  // the queue only contains the sectors that are waiting to be built, so a linear search for the closest one is cheap enough
+  ezUInt32 uiBestIdx = 0;
+  float fBestPriority = ezMath::MaxValue<float>();
+
+  for (ezUInt32 i = 0; i < m_RequestedSectors.GetCount(); ++i)
+  {
+    const float fPriority = m_Sectors[m_RequestedSectors[i]].m_fRequestPriority;
+
+    if (fPriority < fBestPriority)
+    {
+      fBestPriority = fPriority;
+      uiBestIdx = i;
+    }
+  }
+
+  const ezAiNavMesh::SectorID id = m_RequestedSectors[uiBestIdx];
+  m_RequestedSectors.RemoveAtAndSwap(uiBestIdx);
 
   return id;
 }
 
+void ezAiNavMesh::QueueSectorBuild(SectorID sectorID)
+{
+  // sectors that are currently being built are queued again by FinishSectorBuild(), if necessary
+  if (m_Sectors[sectorID].m_FlagBuilding == 1)
+    return;
+
+  m_RequestedSectors.PushBack(sectorID);
+}
+
 ezVec2 ezAiNavMesh::GetSectorPositionOffset(ezVec2I32 vCoord) const
 {
   return ezVec2((vCoord.x - m_uiNumSectorsX * 0.5f) * m_fSectorMetersXY, (vCoord.y - m_uiNumSectorsY * 0.5f) * m_fSectorMetersXY);
@@ -217,7 +217,10 @@ ezResult BuildDetourNavMeshData(const ezAiNavmeshConfig& config, const rcPolyMes
 
 void ezNavMeshSectorGenerationTask::Execute()
 {
-  m_pWorldNavMesh->BuildSector(m_SectorID, m_pNavGeo);
+  if (HasBeenCanceled())
+    return;
+
+  m_pWorldNavMesh->BuildSectorData(m_SectorID, m_InputGeo, m_NavmeshData);
 }
 
 static ezInt8 GetSurfaceGroundType(const ezSurfaceResource* pSurf)
@@ -306,44 +309,83 @@ static void QueryInputGeo(const ezNavmeshGeoWorldModuleInterface* pGeo, ezUInt32
   }
 }
 
-void ezAiNavMesh::BuildSector(SectorID sectorID, const ezNavmeshGeoWorldModuleInterface* pGeo)
+ezUInt32 ezAiNavMesh::BeginSectorBuild(SectorID sectorID, const ezNavmeshGeoWorldModuleInterface* pGeo, ezAiNavMeshInputGeo& out_inputGeo)
 {
-  const ezVec2I32 sectorCoord = CalculateSectorCoord(sectorID);
   auto& sector = m_Sectors[sectorID];
 
+  EZ_ASSERT_DEV(sector.m_FlagBuilding == 0, "Sector is already being built");
   EZ_ASSERT_DEV(sector.m_FlagUpdateAvailable == 0, "Shouldn't update a sector that is already being updated");
 
+  sector.m_FlagBuilding = 1;
+
+  ezBoundingBox boundsWithBorder = GetSectorBounds(CalculateSectorCoord(sectorID), -1000, +1000);
+  const float cs = m_NavmeshConfig.m_fCellSize;
+  const float borderSize = ceilf(m_NavmeshConfig.m_fAgentRadius / cs) + 3;
+  boundsWithBorder.m_vMin.x -= borderSize * cs;
+  boundsWithBorder.m_vMin.y -= borderSize * cs;
+  boundsWithBorder.m_vMax.x += borderSize * cs;
+  boundsWithBorder.m_vMax.y += borderSize * cs;
+  QueryInputGeo(pGeo, m_NavmeshConfig.m_uiCollisionLayer, boundsWithBorder, out_inputGeo);
+
+  return sector.m_uiBuildGeneration;
+}
+
+void ezAiNavMesh::BuildSectorData(SectorID sectorID, ezAiNavMeshInputGeo& inout_inputGeo, ezDataBuffer& out_navmeshData) const
+{
+  out_navmeshData.Clear();
+
+  if (inout_inputGeo.m_Vertices.IsEmpty())
+    return;
+
+  const ezVec2I32 sectorCoord = CalculateSectorCoord(sectorID);
   const ezBoundingBox bounds = GetSectorBounds(sectorCoord, -1000, +1000);
 
-  ezAiNavMeshInputGeo inputGeo;
+  rcContext recastContext;
+  rcPolyMesh polyMesh;
+
+  BuildRecastPolyMesh(m_NavmeshConfig, bounds, polyMesh, &recastContext, inout_inputGeo.m_Vertices, inout_inputGeo.m_Triangles, inout_inputGeo.m_TriangleAreaIDs).AssertSuccess();
+
+  if (polyMesh.nverts > 0 && polyMesh.npolys > 0)
   {
-    ezBoundingBox boundsWithBorder = bounds;
-    const float cs = m_NavmeshConfig.m_fCellSize;
-    const float borderSize = ceilf(m_NavmeshConfig.m_fAgentRadius / cs) + 3;
-    boundsWithBorder.m_vMin.x -= borderSize * cs;
-    boundsWithBorder.m_vMin.y -= borderSize * cs;
-    boundsWithBorder.m_vMax.x += borderSize * cs;
-    boundsWithBorder.m_vMax.y += borderSize * cs;
-    QueryInputGeo(pGeo, m_NavmeshConfig.m_uiCollisionLayer, boundsWithBorder, inputGeo);
+    BuildDetourNavMeshData(m_NavmeshConfig, polyMesh, out_navmeshData, sectorCoord).AssertSuccess();
   }
-  if (!inputGeo.m_Vertices.IsEmpty())
-  {
-    rcContext recastContext;
-    rcPolyMesh polyMesh;
+}
 
-    BuildRecastPolyMesh(m_NavmeshConfig, bounds, polyMesh, &recastContext, inputGeo.m_Vertices, inputGeo.m_Triangles, inputGeo.m_TriangleAreaIDs).AssertSuccess();
+void ezAiNavMesh::FinishSectorBuild(SectorID sectorID, ezUInt32 uiBuildGeneration, ezDataBuffer& inout_navmeshData)
+{
+  auto& sector = m_Sectors[sectorID];
+
+  EZ_ASSERT_DEV(sector.m_FlagBuilding == 1, "Sector is not being built");
+  sector.m_FlagBuilding = 0;
+
+  if (sector.m_uiBuildGeneration != uiBuildGeneration)
+  {
+    // the sector was invalidated while it was being built
+    inout_navmeshData.Clear();
 
-    if (polyMesh.nverts > 0 && polyMesh.npolys > 0)
+    if (sector.m_FlagRequested == 1 || sector.m_FlagInvalidate == 1)
     {
-      BuildDetourNavMeshData(m_NavmeshConfig, polyMesh, sector.m_NavmeshDataNew, sectorCoord).AssertSuccess();
+      QueueSectorBuild(sectorID);
     }
+
+    return;
   }
 
-  {
-    EZ_ASSERT_DEV(sector.m_FlagUpdateAvailable == 0, "Race condition in navmesh sector update");
-    sector.m_FlagUpdateAvailable = 1;
+  EZ_ASSERT_DEV(sector.m_FlagUpdateAvailable == 0, "Race condition in navmesh sector update");
+  sector.m_NavmeshDataNew.Swap(inout_navmeshData);
+  sector.m_FlagUpdateAvailable = 1;
 
-    EZ_LOCK(m_Mutex);
-    m_UpdatingSectors.PushBack(sectorID);
-  }
+  EZ_LOCK(m_Mutex);
+  m_UpdatingSectors.PushBack(sectorID);
+}
+
+void ezAiNavMesh::BuildSector(SectorID sectorID, const ezNavmeshGeoWorldModuleInterface* pGeo)
+{
+  ezAiNavMeshInputGeo inputGeo;
+  const ezUInt32 uiBuildGeneration = BeginSectorBuild(sectorID, pGeo, inputGeo);
+
+  ezDataBuffer navmeshData;
+  BuildSectorData(sectorID, inputGeo, navmeshData);
+
+  FinishSectorBuild(sectorID, uiBuildGeneration, navmeshData);
 }
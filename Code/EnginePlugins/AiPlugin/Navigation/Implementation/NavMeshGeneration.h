@@ -3,14 +3,17 @@
 #include <AiPlugin/Navigation/NavMesh.h>
 #include <Foundation/Threading/TaskSystem.h>
 
-class ezNavmeshGeoWorldModuleInterface;
-
+/// \brief Builds the Detour data for a single navmesh sector from input geometry that was gathered on the main thread.
+///
+/// The result is handed back through ezAiNavMesh::FinishSectorBuild() by whoever started the task.
 class ezNavMeshSectorGenerationTask : public ezTask
 {
 public:
   ezAiNavMesh::SectorID m_SectorID = ezInvalidIndex;
+  ezUInt32 m_uiBuildGeneration = 0;
   ezAiNavMesh* m_pWorldNavMesh = nullptr;
-  const ezNavmeshGeoWorldModuleInterface* m_pNavGeo = nullptr;
+  ezAiNavMeshInputGeo m_InputGeo;
+  ezDataBuffer m_NavmeshData;
 
 protected:
   virtual void Execute() override;
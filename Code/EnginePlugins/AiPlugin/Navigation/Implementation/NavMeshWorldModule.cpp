@@ -4,8 +4,11 @@
 #include <Core/World/World.h>
 #include <DetourNavMesh.h>
 #include <Foundation/Configuration/CVar.h>
+#include <Foundation/Time/Time.h>
 
 ezCVarInt cvar_NavMeshVisualize("AI.Navmesh.Visualize", -1, ezCVarFlags::None, "Visualize the n-th navmesh.");
+ezCVarInt cvar_NavMeshMaxConcurrentBuilds("AI.Navmesh.MaxConcurrentBuilds", 4, ezCVarFlags::Default, "How many navmesh sectors may be built in parallel.");
+ezCVarFloat cvar_NavMeshGeoGatherBudget("AI.Navmesh.GeoGatherBudget", 2.0f, ezCVarFlags::Default, "Milliseconds per frame that may be spent gathering input geometry for navmesh sectors.");
 
 // clang-format off
 EZ_IMPLEMENT_WORLD_MODULE(ezAiNavMeshWorldModule);
@@ -73,16 +76,21 @@ void ezAiNavMeshWorldModule::Initialize()
     // TODO: make tile size etc configurable
     m_WorldNavMeshes[cfg.m_sName] = EZ_DEFAULT_NEW(ezAiNavMesh, cfg);
   }
-
-  m_pGenerateSectorTask = EZ_DEFAULT_NEW(ezNavMeshSectorGenerationTask);
-  m_pGenerateSectorTask->ConfigureTask("Generate Navmesh Sector", ezTaskNesting::Maybe);
 }
 
 void ezAiNavMeshWorldModule::Deinitialize()
 {
-  m_pGenerateSectorTask = nullptr;
-  ezTaskSystem::CancelGroup(m_GenerateSectorTaskID).IgnoreResult();
-  ezTaskSystem::WaitForGroup(m_GenerateSectorTaskID);
+  for (auto& build : m_SectorBuilds)
+  {
+    ezTaskSystem::CancelGroup(build.m_TaskID).IgnoreResult();
+  }
+
+  for (auto& build : m_SectorBuilds)
+  {
+    ezTaskSystem::WaitForGroup(build.m_TaskID);
+  }
+
+  m_SectorBuilds.Clear();
 }
 
 ezAiNavMesh* ezAiNavMeshWorldModule::GetNavMesh(ezStringView sName)
@@ -111,6 +119,8 @@ void ezAiNavMeshWorldModule::Update(const UpdateContext& ctxt)
     return;
   }
 
+  FinishSectorBuilds();
+
   for (auto& nm : m_WorldNavMeshes)
   {
     nm.Value()->FinalizeSectorUpdates();
@@ -129,26 +139,73 @@ void ezAiNavMeshWorldModule::Update(const UpdateContext& ctxt)
     }
   }
 
-  if (!ezTaskSystem::IsTaskGroupFinished(m_GenerateSectorTaskID))
+  StartSectorBuilds();
+}
+
+void ezAiNavMeshWorldModule::FinishSectorBuilds()
+{
+  for (ezUInt32 i = m_SectorBuilds.GetCount(); i > 0; --i)
+  {
+    auto& build = m_SectorBuilds[i - 1];
+    ezNavMeshSectorGenerationTask* pTask = build.m_pTask.Borrow();
+
+    if (!ezTaskSystem::IsTaskGroupFinished(build.m_TaskID))
+    {
+      // the sector was invalidated in the mean time, no need to finish a build that gets discarded anyway
+      if (pTask->m_pWorldNavMesh->GetSector(pTask->m_SectorID)->m_uiBuildGeneration != pTask->m_uiBuildGeneration)
+      {
+        ezTaskSystem::CancelGroup(build.m_TaskID, ezOnTaskRunning::ReturnWithoutBlocking).IgnoreResult();
+      }
+
+      continue;
+    }
+
+    pTask->m_pWorldNavMesh->FinishSectorBuild(pTask->m_SectorID, pTask->m_uiBuildGeneration, pTask->m_NavmeshData);
+
+    m_SectorBuilds.RemoveAtAndSwap(i - 1);
+  }
+}
+
+void ezAiNavMeshWorldModule::StartSectorBuilds()
+{
+  const ezUInt32 uiMaxBuilds = static_cast<ezUInt32>(ezMath::Max<int>(cvar_NavMeshMaxConcurrentBuilds, 1));
+
+  if (m_SectorBuilds.GetCount() >= uiMaxBuilds)
     return;
 
   auto pNavGeo = GetWorld()->GetOrCreateModule<ezNavmeshGeoWorldModuleInterface>();
   if (pNavGeo == nullptr)
     return;
 
-  for (auto& nm : m_WorldNavMeshes)
+  const ezTime tStart = ezTime::Now();
+  const ezTime tBudget = ezTime::MakeFromMilliseconds(cvar_NavMeshGeoGatherBudget);
+
+  // take turns between the navmeshes, so that one with many requests doesn't starve the others
+  bool bStartedAny = true;
+  while (bStartedAny)
   {
-    auto sectorID = nm.Value()->RetrieveRequestedSector();
-    if (sectorID == ezInvalidIndex)
-      continue;
+    bStartedAny = false;
 
-    m_pGenerateSectorTask->m_pWorldNavMesh = nm.Value();
-    m_pGenerateSectorTask->m_SectorID = sectorID;
-    m_pGenerateSectorTask->m_pNavGeo = pNavGeo;
+    for (auto& nm : m_WorldNavMeshes)
+    {
+      if (m_SectorBuilds.GetCount() >= uiMaxBuilds || ezTime::Now() - tStart > tBudget)
+        return;
+
+      const auto sectorID = nm.Value()->RetrieveRequestedSector();
+      if (sectorID == ezInvalidIndex)
+        continue;
 
-    m_GenerateSectorTaskID = ezTaskSystem::StartSingleTask(m_pGenerateSectorTask, ezTaskPriority::LongRunning);
+      auto& build = m_SectorBuilds.ExpandAndGetRef();
+      build.m_pTask = EZ_DEFAULT_NEW(ezNavMeshSectorGenerationTask);
+      build.m_pTask->ConfigureTask("Generate Navmesh Sector", ezTaskNesting::Maybe);
+      build.m_pTask->m_pWorldNavMesh = nm.Value();
+      build.m_pTask->m_SectorID = sectorID;
+      build.m_pTask->m_uiBuildGeneration = nm.Value()->BeginSectorBuild(sectorID, pNavGeo, build.m_pTask->m_InputGeo);
 
-    break;
+      build.m_TaskID = ezTaskSystem::StartSingleTask(build.m_pTask, ezTaskPriority::LongRunning);
+
+      bStartedAny = true;
+    }
   }
 }
 
@@ -279,7 +279,7 @@ bool ezAiNavigation::UpdatePathSearch()
     r.ExpandToInclude(m_vTargetPosition.GetAsVec2());
     r.Grow(c_fPathSearchBoundary);
 
-    if (!m_pNavmesh->RequestSector(r.GetCenter(), r.GetHalfExtents()))
+    if (!m_pNavmesh->RequestSector(r.GetCenter(), r.GetHalfExtents(), m_vCurrentPosition.GetAsVec2()))
     {
       // navmesh sectors aren't loaded yet
       return false;
@@ -3,7 +3,6 @@
 #include <AiPlugin/Navigation/NavigationConfig.h>
 #include <DetourNavMesh.h>
 #include <DetourNavMeshQuery.h>
-#include <Foundation/Containers/Deque.h>
 #include <Foundation/Containers/DynamicArray.h>
 #include <Foundation/Containers/Map.h>
 #include <Foundation/Math/Vec2.h>
@@ -51,6 +50,13 @@ struct ezAiNavMeshSector final
   ezUInt8 m_FlagInvalidate : 1;
   ezUInt8 m_FlagUpdateAvailable : 1;
   ezUInt8 m_FlagUsable : 1;
+  ezUInt8 m_FlagBuilding : 1;
+
+  /// Incremented every time the sector gets invalidated. Builds that were started with an older generation are discarded.
+  ezUInt32 m_uiBuildGeneration = 0;
+
+  /// Squared distance of the closest requester since the last build was started. Sectors with lower values are built first.
+  float m_fRequestPriority = ezMath::MaxValue<float>();
 
   ezDataBuffer m_NavmeshDataCur;
   ezDataBuffer m_NavmeshDataNew;
@@ -87,19 +93,28 @@ public:
 
   /// \brief Marks the sector as requested.
   ///
+  /// fPriority determines the order in which requested sectors are built, lower values are built first.
   /// Returns true, if the sector is already available, false when it needs to be built first.
-  bool RequestSector(SectorID sectorID);
+  bool RequestSector(SectorID sectorID, float fPriority = 0.0f);
 
   /// \brief Marks all sectors within the given rectangle as requested.
   ///
+  /// Sectors closer to the center of the rectangle are built first.
   /// Returns true, if all the sectors are already available, false when any of them needs to be built first.
   bool RequestSector(const ezVec2& vCenter, const ezVec2& vHalfExtents);
 
+  /// \brief Marks all sectors within the given rectangle as requested.
+  ///
+  /// Sectors closer to vRequesterPosition (typically the position of the agent that needs them) are built first.
+  /// Returns true, if all the sectors are already available, false when any of them needs to be built first.
+  bool RequestSector(const ezVec2& vCenter, const ezVec2& vHalfExtents, const ezVec2& vRequesterPosition);
+
   /// \brief Marks the sector as invalidated.
   ///
   /// Invalidated sectors are considered out of date and must be rebuilt before they can be used again.
   /// If bRebuildAsSoonAsPossible is true, the sector is queued to be rebuilt as soon as possible.
   /// Otherwise, it will be unloaded and will not be rebuilt until it is requested again.
+  /// If the sector is currently being built, the result of that build is discarded.
   void InvalidateSector(SectorID sectorID, bool bRebuildAsSoonAsPossible);
 
   /// \brief Marks all sectors within the given rectangle as invalidated.
@@ -111,7 +126,29 @@ public:
 
   void FinalizeSectorUpdates();
 
+  /// \brief Removes the requested sector with the highest priority from the queue and returns it.
+  ///
+  /// Returns ezInvalidIndex if no sector needs to be built.
   SectorID RetrieveRequestedSector();
+
+  /// \brief Gathers the input geometry for the sector and marks it as being built.
+  ///
+  /// The geometry is queried from the physics world, so this has to be called on the main thread.
+  /// Returns the build generation that has to be passed to FinishSectorBuild().
+  ezUInt32 BeginSectorBuild(SectorID sectorID, const ezNavmeshGeoWorldModuleInterface* pGeo, ezAiNavMeshInputGeo& out_inputGeo);
+
+  /// \brief Generates the Detour tile data for the sector from the geometry gathered by BeginSectorBuild().
+  ///
+  /// This only reads the navmesh configuration and can therefore run on any thread.
+  /// The triangle area IDs of the input geometry are modified during the build.
+  void BuildSectorData(SectorID sectorID, ezAiNavMeshInputGeo& inout_inputGeo, ezDataBuffer& out_navmeshData) const;
+
+  /// \brief Hands the result of a sector build back to the navmesh. It gets applied in the next FinalizeSectorUpdates().
+  ///
+  /// If the sector was invalidated after BeginSectorBuild(), the result is discarded and the sector is queued again, if it is still needed.
+  void FinishSectorBuild(SectorID sectorID, ezUInt32 uiBuildGeneration, ezDataBuffer& inout_navmeshData);
+
+  /// \brief Builds the sector synchronously on the calling thread (main thread only).
   void BuildSector(SectorID sectorID, const ezNavmeshGeoWorldModuleInterface* pGeo);
 
   const dtNavMesh* GetDetourNavMesh() const { return m_pNavMesh; }
@@ -122,6 +159,7 @@ public:
 
 private:
   void DebugDrawSector(ezDebugRendererContext context, const ezAiNavigationConfig& config, int iTileIdx);
+  void QueueSectorBuild(SectorID sectorID);
 
   ezAiNavmeshConfig m_NavmeshConfig;
 
@@ -132,7 +170,7 @@ private:
 
   dtNavMesh* m_pNavMesh = nullptr;
   ezMap<SectorID, ezAiNavMeshSector> m_Sectors;
-  ezDeque<SectorID> m_RequestedSectors;
+  ezDynamicArray<SectorID> m_RequestedSectors;
 
   ezMutex m_Mutex;
   ezDynamicArray<SectorID> m_UpdatingSectors;
@@ -10,6 +10,9 @@ class dtNavMesh;
 /// This world module keeps track of all the configured navmeshes (for different character types)
 /// and makes sure to build their sectors in the background.
 ///
+/// Multiple sectors are built in parallel (see the 'AI.Navmesh.MaxConcurrentBuilds' cvar), the ones closest to the agents that requested them first.
+/// The input geometry is gathered on the main thread, limited by a per-frame time budget ('AI.Navmesh.GeoGatherBudget').
+///
 /// Through this you can get access to one of the available navmeshes.
 /// Additionally, it also provides access to the different path search filters.
 class EZ_AIPLUGIN_DLL ezAiNavMeshWorldModule final : public ezWorldModule
@@ -33,13 +36,21 @@ public:
 
 private:
   void Update(const UpdateContext& ctxt);
+  void FinishSectorBuilds();
+  void StartSectorBuilds();
 
   ezMap<ezString, ezAiNavMesh*> m_WorldNavMeshes;
 
   // TODO: this is a hacky solution to delay the navmesh generation until after Physics has been set up.
   ezUInt32 m_uiUpdateDelay = 10;
-  ezTaskGroupID m_GenerateSectorTaskID;
-  ezSharedPtr<ezNavMeshSectorGenerationTask> m_pGenerateSectorTask;
+
+  struct SectorBuild
+  {
+    ezSharedPtr<ezNavMeshSectorGenerationTask> m_pTask;
+    ezTaskGroupID m_TaskID;
+  };
+
+  ezDynamicArray<SectorBuild> m_SectorBuilds;
 
   ezAiNavigationConfig m_Config;
 
@@ -53,7 +64,6 @@ Navmesh Generation
 
 * fix navmesh on hills
 * collision group filtering
-* invalidate sectors, re-generate
 * Invalidate path searches after sector changes
 * sector usage tracking
 * unload unused sectors
@@ -3,6 +3,7 @@
 #include <BakingPlugin/BakingScene.h>
 #include <BakingPlugin/Tasks/PlaceProbesTask.h>
 #include <BakingPlugin/Tasks/SkyVisibilityTask.h>
+#include <BakingPlugin/Tracer/TracerBVH.h>
 #include <BakingPlugin/Tracer/TracerEmbree.h>
 #include <Foundation/IO/FileSystem/FileWriter.h>
 #include <Foundation/Utilities/AssetFileHeader.h>
@@ -98,7 +99,11 @@ ezResult ezBakingScene::Bake(const ezStringView& sOutputPath, ezProgress& progre
 
   if (m_pTracer == nullptr)
   {
+#ifdef BUILDSYSTEM_ENABLE_EMBREE_SUPPORT
     m_pTracer = EZ_DEFAULT_NEW(ezTracerEmbree);
+#else
+    m_pTracer = EZ_DEFAULT_NEW(ezTracerBVH);
+#endif
   }
 
   ezProgressRange pgRange("Baking Scene", 2, true, &progress);
@@ -28,16 +28,27 @@ void PlaceProbesTask::Execute()
   m_vProbeCount.y = static_cast<ezUInt32>(ezMath::Ceil((vMax.y - m_vGridOrigin.y) / probeSpacing.y));
   m_vProbeCount.z = static_cast<ezUInt32>(ezMath::Ceil((vMax.z - m_vGridOrigin.z) / probeSpacing.z));
 
-  for (float z = m_vGridOrigin.z; z < vMax.z; z += probeSpacing.z)
-  {
-    for (float y = m_vGridOrigin.y; y < vMax.y; y += probeSpacing.y)
+  const ezUInt32 uiProbesPerSlice = m_vProbeCount.x * m_vProbeCount.y;
+  m_ProbePositions.SetCountUninitialized(uiProbesPerSlice * m_vProbeCount.z);
+
+  // positions are computed from the grid index instead of accumulating the spacing, so every slice can be filled independently
+  ezTaskSystem::ParallelForIndexed(
+    0, m_vProbeCount.z,
+    [&](ezUInt32 uiStartZ, ezUInt32 uiEndZ)
     {
-      for (float x = m_vGridOrigin.x; x < vMax.x; x += probeSpacing.x)
+      for (ezUInt32 z = uiStartZ; z < uiEndZ; ++z)
       {
-        m_ProbePositions.PushBack(ezVec3(x, y, z));
+        ezVec3* pPositions = m_ProbePositions.GetData() + z * uiProbesPerSlice;
+
+        for (ezUInt32 y = 0; y < m_vProbeCount.y; ++y)
+        {
+          for (ezUInt32 x = 0; x < m_vProbeCount.x; ++x)
+          {
+            *pPositions = m_vGridOrigin + ezVec3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)).CompMul(probeSpacing);
+            ++pPositions;
+          }
+        }
       }
-    }
-  }
-
-  EZ_ASSERT_DEBUG(m_ProbePositions.GetCount() == m_vProbeCount.x * m_vProbeCount.y * m_vProbeCount.z, "Implementation error");
+    },
+    "PlaceProbes");
 }
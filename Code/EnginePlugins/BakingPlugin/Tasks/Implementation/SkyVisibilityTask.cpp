@@ -20,17 +20,16 @@ void SkyVisibilityTask::Execute()
   m_SkyVisibility.SetCountUninitialized(m_ProbePositions.GetCount());
 
   const ezUInt32 uiNumSamples = m_Settings.m_uiNumSamplesPerProbe;
-  ezHybridArray<ezTracerInterface::Ray, 128> rays(ezFrameAllocator::GetCurrentAllocator());
-  rays.SetCountUninitialized(uiNumSamples);
+
+  ezDynamicArray<ezVec3> sampleDirs;
+  sampleDirs.SetCountUninitialized(uiNumSamples);
 
   ezAmbientCube<float> weightNormalization;
   for (ezUInt32 uiSampleIndex = 0; uiSampleIndex < uiNumSamples; ++uiSampleIndex)
   {
-    auto& ray = rays[uiSampleIndex];
-    ray.m_vDir = ezBakingUtils::FibonacciSphere(uiSampleIndex, uiNumSamples);
-    ray.m_fDistance = m_Settings.m_fMaxRayDistance;
+    sampleDirs[uiSampleIndex] = ezBakingUtils::FibonacciSphere(uiSampleIndex, uiNumSamples);
 
-    weightNormalization.AddSample(ray.m_vDir, 1.0f);
+    weightNormalization.AddSample(sampleDirs[uiSampleIndex], 1.0f);
   }
 
   for (ezUInt32 i = 0; i < ezAmbientCubeBasis::NumDirs; ++i)
@@ -38,34 +37,56 @@ void SkyVisibilityTask::Execute()
     weightNormalization.m_Values[i] = 1.0f / weightNormalization.m_Values[i];
   }
 
-  ezHybridArray<ezTracerInterface::Hit, 128> hits(ezFrameAllocator::GetCurrentAllocator());
-  hits.SetCountUninitialized(uiNumSamples);
+  // probes are independent of each other, so they are distributed across all workers,
+  // the tracer has to support concurrent calls to TraceRays for this
+  ezParallelForParams params;
+  params.m_uiBinSize = 16;
+  params.m_uiMaxTasksPerThread = 8;
 
-  for (ezUInt32 uiProbeIndex = 0; uiProbeIndex < m_ProbePositions.GetCount(); ++uiProbeIndex)
-  {
-    ezVec3 probePos = m_ProbePositions[uiProbeIndex];
-    for (ezUInt32 uiSampleIndex = 0; uiSampleIndex < uiNumSamples; ++uiSampleIndex)
+  ezTaskSystem::ParallelForIndexed(
+    0, m_ProbePositions.GetCount(),
+    [&](ezUInt32 uiStartIndex, ezUInt32 uiEndIndex)
     {
-      rays[uiSampleIndex].m_vStartPos = probePos;
-    }
+      ezHybridArray<ezTracerInterface::Ray, 128> rays;
+      rays.SetCountUninitialized(uiNumSamples);
 
-    m_Tracer.TraceRays(rays, hits);
+      ezHybridArray<ezTracerInterface::Hit, 128> hits;
+      hits.SetCountUninitialized(uiNumSamples);
 
-    ezAmbientCube<float> skyVisibility;
-    for (ezUInt32 uiSampleIndex = 0; uiSampleIndex < uiNumSamples; ++uiSampleIndex)
-    {
-      const auto& ray = rays[uiSampleIndex];
-      const auto& hit = hits[uiSampleIndex];
-      const float value = hit.m_fDistance < 0.0f ? 1.0f : 0.0f;
+      for (ezUInt32 uiSampleIndex = 0; uiSampleIndex < uiNumSamples; ++uiSampleIndex)
+      {
+        auto& ray = rays[uiSampleIndex];
+        ray.m_vDir = sampleDirs[uiSampleIndex];
+        ray.m_fDistance = m_Settings.m_fMaxRayDistance;
+      }
 
-      skyVisibility.AddSample(ray.m_vDir, value);
-    }
+      for (ezUInt32 uiProbeIndex = uiStartIndex; uiProbeIndex < uiEndIndex; ++uiProbeIndex)
+      {
+        ezVec3 probePos = m_ProbePositions[uiProbeIndex];
+        for (ezUInt32 uiSampleIndex = 0; uiSampleIndex < uiNumSamples; ++uiSampleIndex)
+        {
+          rays[uiSampleIndex].m_vStartPos = probePos;
+        }
 
-    for (ezUInt32 i = 0; i < ezAmbientCubeBasis::NumDirs; ++i)
-    {
-      skyVisibility.m_Values[i] *= weightNormalization.m_Values[i];
-    }
-    auto& compressedSkyVisibility = m_SkyVisibility[uiProbeIndex];
-    compressedSkyVisibility = ezBakingUtils::CompressSkyVisibility(skyVisibility);
-  }
+        m_Tracer.TraceRays(rays, hits);
+
+        ezAmbientCube<float> skyVisibility;
+        for (ezUInt32 uiSampleIndex = 0; uiSampleIndex < uiNumSamples; ++uiSampleIndex)
+        {
+          const auto& ray = rays[uiSampleIndex];
+          const auto& hit = hits[uiSampleIndex];
+          const float value = hit.m_fDistance < 0.0f ? 1.0f : 0.0f;
+
+          skyVisibility.AddSample(ray.m_vDir, value);
+        }
+
+        for (ezUInt32 i = 0; i < ezAmbientCubeBasis::NumDirs; ++i)
+        {
+          skyVisibility.m_Values[i] *= weightNormalization.m_Values[i];
+        }
+        auto& compressedSkyVisibility = m_SkyVisibility[uiProbeIndex];
+        compressedSkyVisibility = ezBakingUtils::CompressSkyVisibility(skyVisibility);
+      }
+    },
+    "SkyVisibility", ezTaskNesting::Never, params);
 }
@@ -0,0 +1,592 @@
+#include <BakingPlugin/BakingPluginPCH.h>
+
+#include <BakingPlugin/BakingScene.h>
+#include <BakingPlugin/Tracer/TracerBVH.h>
+#include <RendererCore/Meshes/CpuMeshResource.h>
+#include <RendererCore/Meshes/MeshBufferUtils.h>
+
+namespace
+{
+  constexpr ezUInt32 MaxLeafTriangles = 8;
+  constexpr ezUInt32 NumBins = 16;
+  constexpr ezUInt32 MaxStackSize = 256;
+
+  // every level of the tree adds at most three entries to the traversal stack (four children pushed, the parent popped)
+  constexpr ezUInt32 MaxTreeDepth = 64;
+  static_assert(MaxTreeDepth * 3 + 1 <= MaxStackSize, "The traversal stack is too small for the maximum tree depth");
+
+  float GetSurfaceArea(const ezBoundingBox& box)
+  {
+    if (!box.IsValid())
+      return 0.0f;
+
+    const ezVec3 e = box.GetExtents();
+    return 2.0f * (e.x * e.y + e.y * e.z + e.z * e.x);
+  }
+} // namespace
+
+struct ezTracerBVH::Data
+{
+  /// Bounds and centroid of one triangle, only needed while building the tree.
+  struct PrimRef
+  {
+    ezBoundingBox m_Bounds;
+    ezVec3 m_vCentroid;
+    ezUInt32 m_uiTriangle;
+  };
+
+  /// Bounds of four children in SoA layout.
+  struct Node
+  {
+    ezSimdVec4f m_vMinX, m_vMinY, m_vMinZ;
+    ezSimdVec4f m_vMaxX, m_vMaxY, m_vMaxZ;
+
+    /// Index of the child node, or of the first triangle block, if m_uiNumBlocks is not zero. ezInvalidIndex for unused children.
+    ezUInt32 m_uiChild[4];
+    ezUInt32 m_uiNumBlocks[4];
+  };
+
+  /// Four triangles in SoA layout. Unused lanes are degenerate and never hit.
+  struct TriangleBlock
+  {
+    ezSimdVec4f m_vV0[3];
+    ezSimdVec4f m_vE1[3];
+    ezSimdVec4f m_vE2[3];
+    ezUInt32 m_uiTriangle[4];
+  };
+
+  void Clear()
+  {
+    m_Nodes.Clear();
+    m_Blocks.Clear();
+    m_Positions.Clear();
+    m_Normals.Clear();
+    m_PrimRefs.Clear();
+  }
+
+  void AddMesh(const ezWorldGeoExtractionUtil::MeshObject& meshObject);
+  ezUInt32 BuildNode(ezUInt32 uiFirst, ezUInt32 uiCount, ezUInt32 uiDepth);
+  bool SplitRange(ezUInt32 uiFirst, ezUInt32 uiCount, ezUInt32& out_uiSplit);
+  ezBoundingBox GetRangeBounds(ezUInt32 uiFirst, ezUInt32 uiCount) const;
+  ezUInt32 CreateLeafBlocks(ezUInt32 uiFirst, ezUInt32 uiCount);
+
+  void TraceRay(const Ray& ray, Hit& out_hit) const;
+
+  ezDynamicArray<Node, ezAlignedAllocatorWrapper> m_Nodes;
+  ezDynamicArray<TriangleBlock, ezAlignedAllocatorWrapper> m_Blocks;
+
+  /// Three world-space positions and normals per triangle.
+  ezDynamicArray<ezVec3> m_Positions;
+  ezDynamicArray<ezVec3> m_Normals;
+
+  ezDynamicArray<PrimRef> m_PrimRefs;
+};
+
+void ezTracerBVH::Data::AddMesh(const ezWorldGeoExtractionUtil::MeshObject& meshObject)
+{
+  ezResourceLock<ezCpuMeshResource> pCpuMesh(meshObject.m_hMeshResource, ezResourceAcquireMode::BlockTillLoaded_NeverFail);
+  if (pCpuMesh.GetAcquireResult() != ezResourceAcquireResult::Final)
+  {
+    ezLog::Warning("Failed to retrieve CPU mesh '{}'", meshObject.m_hMeshResource.GetResourceID());
+    return;
+  }
+
+  const auto& mbDesc = pCpuMesh->GetDescriptor().MeshBufferDesc();
+  if (mbDesc.GetTopology() != ezGALPrimitiveTopology::Triangles)
+    return;
+
+  const ezMat4 transform = meshObject.m_GlobalTransform.GetAsMat4();
+  const ezMat3 normalTransform = transform.GetRotationalPart().GetInverse(0.0f).GetTranspose();
+
+  const ezVec3* pPositions = mbDesc.GetPositionData().GetPtr();
+
+  ezUInt32 uiNormalStride = 0;
+  const ezUInt8* pNormals = mbDesc.GetNormalData(&uiNormalStride).GetPtr();
+  const ezGALResourceFormat::Enum normalFormat = mbDesc.GetVertexStreamConfig().GetNormalFormat();
+
+  const ezUInt32 uiFirstTriangle = m_Positions.GetCount() / 3;
+  const ezUInt32 uiNumTriangles = mbDesc.GetPrimitiveCount();
+
+  m_Positions.Reserve(m_Positions.GetCount() + uiNumTriangles * 3);
+  m_Normals.Reserve(m_Normals.GetCount() + uiNumTriangles * 3);
+
+  for (ezUInt32 p = 0; p < uiNumTriangles; ++p)
+  {
+    ezUInt32 uiIndices[3];
+    if (mbDesc.Uses32BitIndices())
+    {
+      const ezUInt32* pTypedIndices = reinterpret_cast<const ezUInt32*>(mbDesc.GetIndexBufferData().GetPtr());
+      uiIndices[0] = pTypedIndices[p * 3 + 0];
+      uiIndices[1] = pTypedIndices[p * 3 + 1];
+      uiIndices[2] = pTypedIndices[p * 3 + 2];
+    }
+    else
+    {
+      const ezUInt16* pTypedIndices = reinterpret_cast<const ezUInt16*>(mbDesc.GetIndexBufferData().GetPtr());
+      uiIndices[0] = pTypedIndices[p * 3 + 0];
+      uiIndices[1] = pTypedIndices[p * 3 + 1];
+      uiIndices[2] = pTypedIndices[p * 3 + 2];
+    }
+
+    PrimRef& primRef = m_PrimRefs.ExpandAndGetRef();
+    primRef.m_Bounds = ezBoundingBox::MakeInvalid();
+    primRef.m_uiTriangle = uiFirstTriangle + p;
+
+    for (ezUInt32 v = 0; v < 3; ++v)
+    {
+      const ezVec3 vPosition = transform.TransformPosition(pPositions[uiIndices[v]]);
+
+      ezVec3 vNormal;
+      ezMeshBufferUtils::DecodeNormal(ezMakeArrayPtr(pNormals + uiIndices[v] * uiNormalStride, sizeof(ezVec3)), normalFormat, vNormal).IgnoreResult();
+      vNormal = normalTransform * vNormal;
+      vNormal.NormalizeIfNotZero(ezVec3::MakeAxisZ()).IgnoreResult();
+
+      m_Positions.PushBack(vPosition);
+      m_Normals.PushBack(vNormal);
+
+      primRef.m_Bounds.ExpandToInclude(vPosition);
+    }
+
+    primRef.m_vCentroid = primRef.m_Bounds.GetCenter();
+  }
+}
+
+ezBoundingBox ezTracerBVH::Data::GetRangeBounds(ezUInt32 uiFirst, ezUInt32 uiCount) const
+{
+  ezBoundingBox bounds = ezBoundingBox::MakeInvalid();
+
+  for (ezUInt32 i = uiFirst; i < uiFirst + uiCount; ++i)
+  {
+    bounds.ExpandToInclude(m_PrimRefs[i].m_Bounds);
+  }
+
+  return bounds;
+}
+
+bool ezTracerBVH::Data::SplitRange(ezUInt32 uiFirst, ezUInt32 uiCount, ezUInt32& out_uiSplit)
+{
+  ezBoundingBox centroidBounds = ezBoundingBox::MakeInvalid();
+  for (ezUInt32 i = uiFirst; i < uiFirst + uiCount; ++i)
+  {
+    centroidBounds.ExpandToInclude(m_PrimRefs[i].m_vCentroid);
+  }
+
+  const ezVec3 vExtents = centroidBounds.GetExtents();
+  ezUInt32 uiAxis = 0;
+  if (vExtents.y > vExtents.GetData()[uiAxis])
+    uiAxis = 1;
+  if (vExtents.z > vExtents.GetData()[uiAxis])
+    uiAxis = 2;
+
+  const float fMin = centroidBounds.m_vMin.GetData()[uiAxis];
+  const float fExtent = vExtents.GetData()[uiAxis];
+
+  // all centroids are in the same spot, can't be split
+  if (fExtent <= 0.0f)
+    return false;
+
+  const float fScale = (NumBins * (1.0f - 1e-5f)) / fExtent;
+  auto GetBin = [&](const PrimRef& primRef) -> ezUInt32
+  { return ezMath::Min(static_cast<ezUInt32>((primRef.m_vCentroid.GetData()[uiAxis] - fMin) * fScale), NumBins - 1); };
+
+  ezBoundingBox binBounds[NumBins];
+  ezUInt32 uiBinCounts[NumBins] = {};
+  for (ezUInt32 b = 0; b < NumBins; ++b)
+  {
+    binBounds[b] = ezBoundingBox::MakeInvalid();
+  }
+
+  for (ezUInt32 i = uiFirst; i < uiFirst + uiCount; ++i)
+  {
+    const ezUInt32 b = GetBin(m_PrimRefs[i]);
+    binBounds[b].ExpandToInclude(m_PrimRefs[i].m_Bounds);
+    ++uiBinCounts[b];
+  }
+
+  // sweep from the right to get the costs of all the right sides, then from the left to find the cheapest split
+  float fRightCost[NumBins];
+  {
+    ezBoundingBox bounds = ezBoundingBox::MakeInvalid();
+    ezUInt32 uiNum = 0;
+    for (ezUInt32 b = NumBins - 1; b > 0; --b)
+    {
+      if (uiBinCounts[b] > 0)
+        bounds.ExpandToInclude(binBounds[b]);
+      uiNum += uiBinCounts[b];
+      fRightCost[b] = GetSurfaceArea(bounds) * uiNum;
+    }
+  }
+
+  ezUInt32 uiBestSplit = 1;
+  float fBestCost = ezMath::MaxValue<float>();
+  {
+    ezBoundingBox bounds = ezBoundingBox::MakeInvalid();
+    ezUInt32 uiNum = 0;
+    for (ezUInt32 b = 1; b < NumBins; ++b)
+    {
+      if (uiBinCounts[b - 1] > 0)
+        bounds.ExpandToInclude(binBounds[b - 1]);
+      uiNum += uiBinCounts[b - 1];
+
+      const float fCost = GetSurfaceArea(bounds) * uiNum + fRightCost[b];
+      if (uiNum > 0 && uiNum < uiCount && fCost < fBestCost)
+      {
+        fBestCost = fCost;
+        uiBestSplit = b;
+      }
+    }
+  }
+
+  // partition in place, everything in bins left of the split goes first
+  ezUInt32 i = uiFirst;
+  ezUInt32 j = uiFirst + uiCount;
+  while (i < j)
+  {
+    if (GetBin(m_PrimRefs[i]) < uiBestSplit)
+    {
+      ++i;
+    }
+    else
+    {
+      --j;
+      ezMath::Swap(m_PrimRefs[i], m_PrimRefs[j]);
+    }
+  }
+
+  out_uiSplit = i;
+  return i > uiFirst && i < uiFirst + uiCount;
+}
+
+ezUInt32 ezTracerBVH::Data::CreateLeafBlocks(ezUInt32 uiFirst, ezUInt32 uiCount)
+{
+  const ezUInt32 uiFirstBlock = m_Blocks.GetCount();
+
+  for (ezUInt32 i = 0; i < uiCount; i += 4)
+  {
+    float v0[3][4] = {};
+    float e1[3][4] = {};
+    float e2[3][4] = {};
+
+    TriangleBlock& block = m_Blocks.ExpandAndGetRef();
+
+    for (ezUInt32 lane = 0; lane < 4; ++lane)
+    {
+      block.m_uiTriangle[lane] = ezInvalidIndex;
+
+      if (i + lane >= uiCount)
+        continue;
+
+      const ezUInt32 uiTriangle = m_PrimRefs[uiFirst + i + lane].m_uiTriangle;
+      block.m_uiTriangle[lane] = uiTriangle;
+
+      const ezVec3& p0 = m_Positions[uiTriangle * 3 + 0];
+      const ezVec3 vE1 = m_Positions[uiTriangle * 3 + 1] - p0;
+      const ezVec3 vE2 = m_Positions[uiTriangle * 3 + 2] - p0;
+
+      for (ezUInt32 c = 0; c < 3; ++c)
+      {
+        v0[c][lane] = p0.GetData()[c];
+        e1[c][lane] = vE1.GetData()[c];
+        e2[c][lane] = vE2.GetData()[c];
+      }
+    }
+
+    for (ezUInt32 c = 0; c < 3; ++c)
+    {
+      block.m_vV0[c].Load<4>(v0[c]);
+      block.m_vE1[c].Load<4>(e1[c]);
+      block.m_vE2[c].Load<4>(e2[c]);
+    }
+  }
+
+  return uiFirstBlock;
+}
+
+ezUInt32 ezTracerBVH::Data::BuildNode(ezUInt32 uiFirst, ezUInt32 uiCount, ezUInt32 uiDepth)
+{
+  struct Range
+  {
+    EZ_DECLARE_POD_TYPE();
+
+    ezUInt32 m_uiFirst;
+    ezUInt32 m_uiCount;
+    bool m_bSplittable;
+  };
+
+  // split the range in two, then split the larger halves again, until there are four children
+  ezHybridArray<Range, 4> ranges;
+  ranges.PushBack({uiFirst, uiCount, uiCount > MaxLeafTriangles});
+
+  while (ranges.GetCount() < 4)
+  {
+    ezUInt32 uiBest = ezInvalidIndex;
+    for (ezUInt32 r = 0; r < ranges.GetCount(); ++r)
+    {
+      if (ranges[r].m_bSplittable && (uiBest == ezInvalidIndex || ranges[r].m_uiCount > ranges[uiBest].m_uiCount))
+        uiBest = r;
+    }
+
+    if (uiBest == ezInvalidIndex)
+      break;
+
+    Range& range = ranges[uiBest];
+
+    ezUInt32 uiSplit;
+    if (!SplitRange(range.m_uiFirst, range.m_uiCount, uiSplit))
+    {
+      range.m_bSplittable = false;
+      continue;
+    }
+
+    const Range right = {uiSplit, range.m_uiFirst + range.m_uiCount - uiSplit, range.m_uiFirst + range.m_uiCount - uiSplit > MaxLeafTriangles};
+    range.m_uiCount = uiSplit - range.m_uiFirst;
+    range.m_bSplittable = range.m_uiCount > MaxLeafTriangles;
+    ranges.PushBack(right);
+  }
+
+  const ezUInt32 uiNodeIndex = m_Nodes.GetCount();
+  m_Nodes.ExpandAndGetRef();
+
+  float fMin[3][4] = {};
+  float fMax[3][4] = {};
+  ezUInt32 uiChild[4] = {ezInvalidIndex, ezInvalidIndex, ezInvalidIndex, ezInvalidIndex};
+  ezUInt32 uiNumBlocks[4] = {};
+
+  for (ezUInt32 r = 0; r < ranges.GetCount(); ++r)
+  {
+    const Range& range = ranges[r];
+    const ezBoundingBox bounds = GetRangeBounds(range.m_uiFirst, range.m_uiCount);
+
+    for (ezUInt32 c = 0; c < 3; ++c)
+    {
+      fMin[c][r] = bounds.m_vMin.GetData()[c];
+      fMax[c][r] = bounds.m_vMax.GetData()[c];
+    }
+
+    // ranges that could not be split (all centroids in one spot) become leaves, even if they are large,
+    // and so does everything below the maximum depth, which degenerate or strongly clustered geometry can reach
+    if (range.m_uiCount <= MaxLeafTriangles || !range.m_bSplittable || uiDepth + 1 >= MaxTreeDepth)
+    {
+      uiChild[r] = CreateLeafBlocks(range.m_uiFirst, range.m_uiCount);
+      uiNumBlocks[r] = (range.m_uiCount + 3) / 4;
+    }
+    else
+    {
+      uiChild[r] = BuildNode(range.m_uiFirst, range.m_uiCount, uiDepth + 1);
+    }
+  }
+
+  // m_Nodes may have been reallocated by the recursion
+  Node& node = m_Nodes[uiNodeIndex];
+  node.m_vMinX.Load<4>(fMin[0]);
+  node.m_vMinY.Load<4>(fMin[1]);
+  node.m_vMinZ.Load<4>(fMin[2]);
+  node.m_vMaxX.Load<4>(fMax[0]);
+  node.m_vMaxY.Load<4>(fMax[1]);
+  node.m_vMaxZ.Load<4>(fMax[2]);
+
+  for (ezUInt32 i = 0; i < 4; ++i)
+  {
+    node.m_uiChild[i] = uiChild[i];
+    node.m_uiNumBlocks[i] = uiNumBlocks[i];
+  }
+
+  return uiNodeIndex;
+}
+
+void ezTracerBVH::Data::TraceRay(const Ray& ray, Hit& out_hit) const
+{
+  out_hit.m_vPosition.SetZero();
+  out_hit.m_vNormal.SetZero();
+  out_hit.m_fDistance = -1.0f;
+
+  if (m_Nodes.IsEmpty())
+    return;
+
+  // avoid infinities in the slab test, which turn into NaNs when the origin lies exactly on a slab
+  auto SafeInverse = [](float f)
+  { return 1.0f / (ezMath::Abs(f) > 1e-12f ? f : ezMath::Sign(f) >= 0.0f ? 1e-12f : -1e-12f); };
+
+  const ezSimdVec4f vOrgX(ray.m_vStartPos.x), vOrgY(ray.m_vStartPos.y), vOrgZ(ray.m_vStartPos.z);
+  const ezSimdVec4f vDirX(ray.m_vDir.x), vDirY(ray.m_vDir.y), vDirZ(ray.m_vDir.z);
+  const ezSimdVec4f vInvDirX(SafeInverse(ray.m_vDir.x)), vInvDirY(SafeInverse(ray.m_vDir.y)), vInvDirZ(SafeInverse(ray.m_vDir.z));
+  const ezSimdVec4f vZero = ezSimdVec4f::MakeZero();
+  const ezSimdVec4f vOne(1.0f);
+  const ezSimdVec4f vDetEpsilon(1e-20f);
+
+  float fClosest = ray.m_fDistance;
+  ezUInt32 uiHitTriangle = ezInvalidIndex;
+  float fHitU = 0.0f;
+  float fHitV = 0.0f;
+
+  auto IntersectBlock = [&](const TriangleBlock& block)
+  {
+    // Moeller-Trumbore for four triangles at once, two-sided
+    const ezSimdVec4f px = vDirY.CompMul(block.m_vE2[2]) - vDirZ.CompMul(block.m_vE2[1]);
+    const ezSimdVec4f py = vDirZ.CompMul(block.m_vE2[0]) - vDirX.CompMul(block.m_vE2[2]);
+    const ezSimdVec4f pz = vDirX.CompMul(block.m_vE2[1]) - vDirY.CompMul(block.m_vE2[0]);
+
+    const ezSimdVec4f det = block.m_vE1[0].CompMul(px) + block.m_vE1[1].CompMul(py) + block.m_vE1[2].CompMul(pz);
+    const ezSimdVec4f invDet = det.GetReciprocal();
+
+    const ezSimdVec4f tx = vOrgX - block.m_vV0[0];
+    const ezSimdVec4f ty = vOrgY - block.m_vV0[1];
+    const ezSimdVec4f tz = vOrgZ - block.m_vV0[2];
+
+    const ezSimdVec4f u = (tx.CompMul(px) + ty.CompMul(py) + tz.CompMul(pz)).CompMul(invDet);
+
+    const ezSimdVec4f qx = ty.CompMul(block.m_vE1[2]) - tz.CompMul(block.m_vE1[1]);
+    const ezSimdVec4f qy = tz.CompMul(block.m_vE1[0]) - tx.CompMul(block.m_vE1[2]);
+    const ezSimdVec4f qz = tx.CompMul(block.m_vE1[1]) - ty.CompMul(block.m_vE1[0]);
+
+    const ezSimdVec4f v = (vDirX.CompMul(qx) + vDirY.CompMul(qy) + vDirZ.CompMul(qz)).CompMul(invDet);
+    const ezSimdVec4f t = (block.m_vE2[0].CompMul(qx) + block.m_vE2[1].CompMul(qy) + block.m_vE2[2].CompMul(qz)).CompMul(invDet);
+
+    const ezSimdVec4b valid = (det.Abs() > vDetEpsilon) && (u >= vZero) && (v >= vZero) && ((u + v) <= vOne) && (t >= vZero) && (t < ezSimdVec4f(fClosest));
+
+    if (valid.NoneSet())
+      return;
+
+    float fT[4], fU[4], fV[4];
+    t.Store<4>(fT);
+    u.Store<4>(fU);
+    v.Store<4>(fV);
+
+    const bool bValid[4] = {valid.x(), valid.y(), valid.z(), valid.w()};
+    for (ezUInt32 lane = 0; lane < 4; ++lane)
+    {
+      if (bValid[lane] && fT[lane] < fClosest)
+      {
+        fClosest = fT[lane];
+        uiHitTriangle = block.m_uiTriangle[lane];
+        fHitU = fU[lane];
+        fHitV = fV[lane];
+      }
+    }
+  };
+
+  ezUInt32 uiStack[MaxStackSize];
+  ezUInt32 uiStackSize = 0;
+  uiStack[uiStackSize++] = 0;
+
+  while (uiStackSize > 0)
+  {
+    const Node& node = m_Nodes[uiStack[--uiStackSize]];
+
+    // slab test against all four children at once
+    const ezSimdVec4f t0x = (node.m_vMinX - vOrgX).CompMul(vInvDirX);
+    const ezSimdVec4f t1x = (node.m_vMaxX - vOrgX).CompMul(vInvDirX);
+    const ezSimdVec4f t0y = (node.m_vMinY - vOrgY).CompMul(vInvDirY);
+    const ezSimdVec4f t1y = (node.m_vMaxY - vOrgY).CompMul(vInvDirY);
+    const ezSimdVec4f t0z = (node.m_vMinZ - vOrgZ).CompMul(vInvDirZ);
+    const ezSimdVec4f t1z = (node.m_vMaxZ - vOrgZ).CompMul(vInvDirZ);
+
+    const ezSimdVec4f tNear = t0x.CompMin(t1x).CompMax(t0y.CompMin(t1y)).CompMax(t0z.CompMin(t1z).CompMax(vZero));
+    const ezSimdVec4f tFar = t0x.CompMax(t1x).CompMin(t0y.CompMax(t1y)).CompMin(t0z.CompMax(t1z).CompMin(ezSimdVec4f(fClosest)));
+    const ezSimdVec4b hitMask = tNear <= tFar;
+
+    if (hitMask.NoneSet())
+      continue;
+
+    float fNear[4];
+    tNear.Store<4>(fNear);
+
+    const bool bHit[4] = {hitMask.x(), hitMask.y(), hitMask.z(), hitMask.w()};
+
+    // inner nodes are pushed far to near, so that the nearest one gets processed next
+    ezUInt32 uiInner[4];
+    ezUInt32 uiNumInner = 0;
+
+    for (ezUInt32 i = 0; i < 4; ++i)
+    {
+      if (!bHit[i] || node.m_uiChild[i] == ezInvalidIndex)
+        continue;
+
+      if (node.m_uiNumBlocks[i] > 0)
+      {
+        for (ezUInt32 b = 0; b < node.m_uiNumBlocks[i]; ++b)
+        {
+          IntersectBlock(m_Blocks[node.m_uiChild[i] + b]);
+        }
+
+        continue;
+      }
+
+      ezUInt32 uiPos = uiNumInner++;
+      while (uiPos > 0 && fNear[uiInner[uiPos - 1]] < fNear[i])
+      {
+        uiInner[uiPos] = uiInner[uiPos - 1];
+        --uiPos;
+      }
+      uiInner[uiPos] = i;
+    }
+
+    // the depth limit in BuildNode guarantees enough space, but never write past the stack in release builds either
+    EZ_ASSERT_DEBUG(uiStackSize + uiNumInner <= MaxStackSize, "BVH traversal stack overflow");
+    uiNumInner = ezMath::Min(uiNumInner, MaxStackSize - uiStackSize);
+
+    for (ezUInt32 i = 0; i < uiNumInner; ++i)
+    {
+      uiStack[uiStackSize++] = node.m_uiChild[uiInner[i]];
+    }
+  }
+
+  if (uiHitTriangle == ezInvalidIndex)
+    return;
+
+  const ezVec3* pNormals = &m_Normals[uiHitTriangle * 3];
+  ezVec3 vNormal = pNormals[0] * (1.0f - fHitU - fHitV) + pNormals[1] * fHitU + pNormals[2] * fHitV;
+
+  if (vNormal.NormalizeIfNotZero(ezVec3::MakeZero()).Failed())
+  {
+    // fall back to the face normal
+    const ezVec3* pPositions = &m_Positions[uiHitTriangle * 3];
+    vNormal = (pPositions[1] - pPositions[0]).CrossRH(pPositions[2] - pPositions[0]);
+    vNormal.NormalizeIfNotZero(ezVec3::MakeAxisZ()).IgnoreResult();
+  }
+
+  out_hit.m_vNormal = vNormal;
+  out_hit.m_fDistance = fClosest;
+  out_hit.m_vPosition = ray.m_vStartPos + ray.m_vDir * fClosest;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+ezTracerBVH::ezTracerBVH()
+{
+  m_pData = EZ_DEFAULT_NEW(Data);
+}
+
+ezTracerBVH::~ezTracerBVH() = default;
+
+ezResult ezTracerBVH::BuildScene(const ezBakingScene& scene)
+{
+  m_pData->Clear();
+
+  for (auto& meshObject : scene.GetMeshObjects())
+  {
+    m_pData->AddMesh(meshObject);
+  }
+
+  if (m_pData->m_PrimRefs.IsEmpty())
+    return EZ_SUCCESS;
+
+  m_pData->BuildNode(0, m_pData->m_PrimRefs.GetCount(), 0);
+
+  ezLog::Dev("Built BVH with {} nodes for {} triangles", m_pData->m_Nodes.GetCount(), m_pData->m_PrimRefs.GetCount());
+
+  m_pData->m_PrimRefs.Clear();
+  m_pData->m_PrimRefs.Compact();
+
+  return EZ_SUCCESS;
+}
+
+void ezTracerBVH::TraceRays(ezArrayPtr<const Ray> rays, ezArrayPtr<Hit> hits)
+{
+  EZ_ASSERT_DEV(rays.GetCount() <= hits.GetCount(), "Not enough space for all hits");
+
+  for (ezUInt32 i = 0; i < rays.GetCount(); ++i)
+  {
+    m_pData->TraceRay(rays[i], hits[i]);
+  }
+}
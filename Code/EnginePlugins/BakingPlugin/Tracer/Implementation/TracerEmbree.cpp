@@ -1,13 +1,15 @@
 #include <BakingPlugin/BakingPluginPCH.h>
 
-#include <BakingPlugin/BakingScene.h>
-#include <BakingPlugin/Tracer/TracerEmbree.h>
-#include <Foundation/Configuration/Startup.h>
-#include <Foundation/SimdMath/SimdConversion.h>
-#include <RendererCore/Meshes/CpuMeshResource.h>
-#include <RendererCore/Meshes/MeshBufferUtils.h>
+#ifdef BUILDSYSTEM_ENABLE_EMBREE_SUPPORT
 
-#include <embree3/rtcore.h>
+#  include <BakingPlugin/BakingScene.h>
+#  include <BakingPlugin/Tracer/TracerEmbree.h>
+#  include <Foundation/Configuration/Startup.h>
+#  include <Foundation/SimdMath/SimdConversion.h>
+#  include <RendererCore/Meshes/CpuMeshResource.h>
+#  include <RendererCore/Meshes/MeshBufferUtils.h>
+
+#  include <embree3/rtcore.h>
 
 namespace
 {
@@ -308,3 +310,5 @@ void ezTracerEmbree::TraceRays(ezArrayPtr<const Ray> rays, ezArrayPtr<Hit> hits)
     }
   }
 }
+
+#endif
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <BakingPlugin/Tracer/TracerInterface.h>
+#include <Foundation/Types/UniquePtr.h>
+
+/// \brief Built-in, platform independent ray tracer.
+///
+/// All mesh instances of the baking scene are flattened into one world-space triangle soup, from which a 4-wide bounding volume hierarchy
+/// is built using a binned SAH. Traversal tests all four child boxes of a node and all four triangles of a leaf block at once,
+/// using ezSimdVec4f, so it works with whatever SIMD implementation is available on the target platform.
+///
+/// TraceRays() only reads the BVH and can be called from multiple threads at the same time.
+class EZ_BAKINGPLUGIN_DLL ezTracerBVH : public ezTracerInterface
+{
+public:
+  ezTracerBVH();
+  ~ezTracerBVH();
+
+  virtual ezResult BuildScene(const ezBakingScene& scene) override;
+
+  virtual void TraceRays(ezArrayPtr<const Ray> rays, ezArrayPtr<Hit> hits) override;
+
+private:
+  struct Data;
+
+  ezUniquePtr<Data> m_pData;
+};
@@ -3,6 +3,8 @@
 #include <BakingPlugin/Tracer/TracerInterface.h>
 #include <Foundation/Types/UniquePtr.h>
 
+#ifdef BUILDSYSTEM_ENABLE_EMBREE_SUPPORT
+
 class EZ_BAKINGPLUGIN_DLL ezTracerEmbree : public ezTracerInterface
 {
 public:
@@ -18,3 +20,5 @@ private:
 
   ezUniquePtr<Data> m_pData;
 };
+
+#endif
@@ -27,5 +27,8 @@ public:
     float m_fDistance;
   };
 
+  /// \brief Traces all rays against the scene. Misses are reported with a negative hit distance.
+  ///
+  /// Must be safe to call from multiple threads at the same time, once BuildScene() has finished.
   virtual void TraceRays(ezArrayPtr<const Ray> rays, ezArrayPtr<Hit> hits) = 0;
 };
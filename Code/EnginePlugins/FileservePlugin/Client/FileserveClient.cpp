@@ -6,9 +6,11 @@
 #include <Foundation/Communication/RemoteInterfaceEnet.h>
 #include <Foundation/IO/FileSystem/FileWriter.h>
 #include <Foundation/IO/FileSystem/Implementation/DataDirType.h>
+#include <Foundation/IO/MemoryStream.h>
 #include <Foundation/Logging/Log.h>
 #include <Foundation/Types/ScopeExit.h>
 #include <Foundation/Utilities/CommandLineUtils.h>
+#include <Foundation/Utilities/Compression.h>
 
 EZ_IMPLEMENT_SINGLETON(ezFileserveClient);
 
@@ -71,9 +73,35 @@ void ezFileserveClient::ClearState()
 {
   m_bDownloading = false;
   m_bWaitingForUploadFinished = false;
-  m_CurFileRequestGuid = ezUuid();
-  m_sCurFileRequest.Clear();
-  m_Download.Clear();
+  m_FileRequestGuid = ezUuid::MakeUuid();
+  m_Downloads.Clear();
+}
+
+ezResult ezFileserveClient::WaitForServerHello(ezTime timeout)
+{
+  m_uiServerProtocolVersion = 0;
+
+  // the messages would be misinterpreted with a server that uses a different protocol, so don't even try
+  const ezTime tEnd = ezTime::Now() + timeout;
+  while (m_uiServerProtocolVersion == 0 && m_pNetwork->IsConnectedToServer() && (timeout.IsZero() || ezTime::Now() < tEnd))
+  {
+    m_pNetwork->UpdateRemoteInterface();
+    m_pNetwork->ExecuteAllMessageHandlers();
+  }
+
+  if (m_uiServerProtocolVersion == 0)
+  {
+    ezLog::Error("ezFileserver did not report its protocol version, it is probably outdated. Client protocol version is {}.", ezFileserveProtocolVersion);
+    return EZ_FAILURE;
+  }
+
+  if (m_uiServerProtocolVersion != ezFileserveProtocolVersion)
+  {
+    ezLog::Error("ezFileserver uses protocol version {}, but this client uses version {}. Client and server have to be built from the same version.", m_uiServerProtocolVersion, ezFileserveProtocolVersion);
+    return EZ_FAILURE;
+  }
+
+  return EZ_SUCCESS;
 }
 
 ezResult ezFileserveClient::EnsureConnected(ezTime timeout)
@@ -126,7 +154,15 @@ ezResult ezFileserveClient::EnsureConnected(ezTime timeout)
       ezLog::Success("Connected to ezFileserver '{0}", m_sServerConnectionAddress);
       m_pNetwork->SetMessageHandler('FSRV', ezMakeDelegate(&ezFileserveClient::NetworkMsgHandler, this));
 
-      m_pNetwork->Send('FSRV', 'HELO'); // be friendly
+      ezRemoteMessage msg('FSRV', 'HELO');
+      msg.GetWriter() << ezFileserveProtocolVersion;
+      m_pNetwork->Send(ezRemoteTransmitMode::Reliable, msg);
+
+      if (WaitForServerHello(timeout).Failed())
+      {
+        m_pNetwork->ShutdownConnection();
+        return EZ_FAILURE;
+      }
     }
 
     m_bFailedToConnect = false;
@@ -143,6 +179,10 @@ void ezFileserveClient::UpdateClient()
 
   if (!m_pNetwork->IsConnectedToServer())
   {
+    // PrefetchFiles() stops by itself once the connection is gone, reconnecting would discard its requests underneath it
+    if (m_bPrefetching)
+      return;
+
     if (EnsureConnected().Failed())
     {
       ezLog::Error("Fileserve connection was lost and could not be re-established.");
@@ -335,6 +375,12 @@ void ezFileserveClient::GetFullDataDirCachePath(const char* szDataDir, ezStringB
 void ezFileserveClient::NetworkMsgHandler(ezRemoteMessage& msg)
 {
   EZ_LOCK(m_Mutex);
+  if (msg.GetMessageID() == 'HELO')
+  {
+    msg.GetReader() >> m_uiServerProtocolVersion;
+    return;
+  }
+
   if (msg.GetMessageID() == 'DWNL')
   {
     HandleFileTransferMsg(msg);
@@ -354,7 +400,7 @@ void ezFileserveClient::NetworkMsgHandler(ezRemoteMessage& msg)
     s_bReloadResources = true;
   }
 
-  if (!m_bDownloading && s_bReloadResources)
+  if (!m_bDownloading && !m_bPrefetching && s_bReloadResources)
   {
     EZ_BROADCAST_EVENT(ezResourceManager_ReloadAllResources);
     s_bReloadResources = false;
@@ -457,47 +503,85 @@ void ezFileserveClient::HandleFileTransferMsg(ezRemoteMessage& msg)
     ezUuid fileRequestGuid;
     msg.GetReader() >> fileRequestGuid;
 
-    if (fileRequestGuid != m_CurFileRequestGuid)
+    if (fileRequestGuid != m_FileRequestGuid)
     {
       // ezLog::Debug("Fileserver is answering someone else");
       return;
     }
   }
 
-  ezUInt16 uiChunkSize = 0;
-  msg.GetReader() >> uiChunkSize;
+  ezUInt32 uiRequestID = 0;
+  msg.GetReader() >> uiRequestID;
+
+  Download* pDownload = nullptr;
+  if (!m_Downloads.TryGetValue(uiRequestID, pDownload) || pDownload->m_bFailed)
+    return;
 
   ezUInt32 uiFileSize = 0;
   msg.GetReader() >> uiFileSize;
 
+  ezUInt32 uiChunkSize = 0;
+  msg.GetReader() >> uiChunkSize;
+
+  bool bCompressed = false;
+  msg.GetReader() >> bCompressed;
+
+  ezUInt32 uiTransferSize = 0;
+  msg.GetReader() >> uiTransferSize;
+
   // make sure we don't need to reallocate
-  m_Download.Reserve(uiFileSize);
+  pDownload->m_Data.Reserve(uiFileSize);
+
+  if (uiChunkSize == 0)
+    return;
 
-  if (uiChunkSize > 0)
+  const ezUInt32 uiStartPos = pDownload->m_Data.GetCount();
+
+  if (!bCompressed)
   {
-    const ezUInt32 uiStartPos = m_Download.GetCount();
-    m_Download.SetCountUninitialized(uiStartPos + uiChunkSize);
-    msg.GetReader().ReadBytes(&m_Download[uiStartPos], uiChunkSize);
+    pDownload->m_Data.SetCountUninitialized(uiStartPos + uiChunkSize);
+    msg.GetReader().ReadBytes(&pDownload->m_Data[uiStartPos], uiChunkSize);
+    return;
   }
+
+  const ezArrayPtr<const ezUInt8> compressed = msg.GetMessageData().GetSubArray(static_cast<ezUInt32>(msg.GetMessageData().GetCount() - uiTransferSize), uiTransferSize);
+
+  if (ezCompressionUtils::Decompress(compressed, ezCompressionMethod::ZStd, m_DecompressedChunk).Failed() || m_DecompressedChunk.GetCount() != uiChunkSize)
+  {
+    ezLog::Error("Failed to decompress fileserve download of '{}'", pDownload->m_sFile);
+
+    // the remaining chunks are ignored, the finish message then drops the download instead of caching it
+    pDownload->m_bFailed = true;
+    pDownload->m_Data.Clear();
+    return;
+  }
+
+  pDownload->m_Data.PushBackRange(m_DecompressedChunk);
 }
 
 
 void ezFileserveClient::HandleFileTransferFinishedMsg(ezRemoteMessage& msg)
 {
   EZ_LOCK(m_Mutex);
-  EZ_SCOPE_EXIT(m_bDownloading = false);
 
   {
     ezUuid fileRequestGuid;
     msg.GetReader() >> fileRequestGuid;
 
-    if (fileRequestGuid != m_CurFileRequestGuid)
+    if (fileRequestGuid != m_FileRequestGuid)
     {
       // ezLog::Debug("Fileserver is answering someone else");
       return;
     }
   }
 
+  ezUInt32 uiRequestID = 0;
+  msg.GetReader() >> uiRequestID;
+
+  Download download;
+  if (!m_Downloads.Remove(uiRequestID, &download))
+    return;
+
   ezFileserveFileState fileState;
   {
     ezInt8 iFileStatus = 0;
@@ -516,11 +600,11 @@ void ezFileserveClient::HandleFileTransferFinishedMsg(ezRemoteMessage& msg)
 
   if (uiFoundInDataDir == 0xffff)         // file does not exist on server in any data dir
   {
-    m_FileDataDir[m_sCurFileRequest] = 0; // placeholder
+    m_FileDataDir[download.m_sFile] = 0; // placeholder
 
     for (ezUInt32 i = 0; i < m_MountedDataDirs.GetCount(); ++i)
     {
-      auto& ref = m_MountedDataDirs[i].m_CacheStatus[m_sCurFileRequest];
+      auto& ref = m_MountedDataDirs[i].m_CacheStatus[download.m_sFile];
       ref.m_FileHash = 0;
       ref.m_TimeStamp = 0;
       ref.m_LastCheck = m_CurrentTime;
@@ -530,12 +614,21 @@ void ezFileserveClient::HandleFileTransferFinishedMsg(ezRemoteMessage& msg)
   }
   else
   {
-    m_FileDataDir[m_sCurFileRequest] = uiFoundInDataDir;
+    m_FileDataDir[download.m_sFile] = uiFoundInDataDir;
 
-    auto& ref = m_MountedDataDirs[uiFoundInDataDir].m_CacheStatus[m_sCurFileRequest];
-    ref.m_FileHash = uiFileHash;
-    ref.m_TimeStamp = iFileTimeStamp;
-    ref.m_LastCheck = m_CurrentTime;
+    auto& ref = m_MountedDataDirs[uiFoundInDataDir].m_CacheStatus[download.m_sFile];
+
+    if (download.m_bFailed)
+    {
+      // forget everything about the file, so that the next access requests it again in full
+      ref = FileCacheStatus();
+    }
+    else
+    {
+      ref.m_FileHash = uiFileHash;
+      ref.m_TimeStamp = iFileTimeStamp;
+      ref.m_LastCheck = m_CurrentTime;
+    }
   }
 
   // nothing changed
@@ -544,11 +637,12 @@ void ezFileserveClient::HandleFileTransferFinishedMsg(ezRemoteMessage& msg)
 
   const ezString& sMountPoint = m_MountedDataDirs[uiFoundInDataDir].m_sMountPoint;
   ezStringBuilder sCachedFile, sCachedMetaFile;
-  BuildPathInCache(m_sCurFileRequest, sMountPoint, &sCachedFile, &sCachedMetaFile);
+  BuildPathInCache(download.m_sFile, sMountPoint, &sCachedFile, &sCachedMetaFile);
 
-  if (fileState == ezFileserveFileState::NonExistant)
+  if (fileState == ezFileserveFileState::NonExistant || download.m_bFailed)
   {
     // remove them from the cache as well, if they still exist there
+    // for failed downloads this makes sure that an outdated meta file does not vouch for the old data
     ezOSFile::DeleteFile(sCachedFile).IgnoreResult();
     ezOSFile::DeleteFile(sCachedMetaFile).IgnoreResult();
     return;
@@ -562,7 +656,7 @@ void ezFileserveClient::HandleFileTransferFinishedMsg(ezRemoteMessage& msg)
 
   if (fileState == ezFileserveFileState::Different)
   {
-    WriteDownloadToDisk(sCachedFile);
+    WriteDownloadToDisk(sCachedFile, download.m_Data);
     WriteMetaFile(sCachedMetaFile, iFileTimeStamp, uiFileHash);
   }
 }
@@ -584,14 +678,13 @@ void ezFileserveClient::WriteMetaFile(ezStringBuilder sCachedMetaFile, ezInt64 i
   }
 }
 
-void ezFileserveClient::WriteDownloadToDisk(ezStringBuilder sCachedFile)
+void ezFileserveClient::WriteDownloadToDisk(ezStringBuilder sCachedFile, const ezDynamicArray<ezUInt8>& download)
 {
-  EZ_LOCK(m_Mutex);
   ezOSFile file;
   if (file.Open(sCachedFile, ezFileOpenMode::Write).Succeeded())
   {
-    if (!m_Download.IsEmpty())
-      file.Write(m_Download.GetData(), m_Download.GetCount()).IgnoreResult();
+    if (!download.IsEmpty())
+      file.Write(download.GetData(), download.GetCount()).IgnoreResult();
 
     file.Close();
   }
@@ -601,6 +694,60 @@ void ezFileserveClient::WriteDownloadToDisk(ezStringBuilder sCachedFile)
   }
 }
 
+bool ezFileserveClient::IsCacheUpToDate(ezUInt16 uiDataDirID, const char* szFile, bool bForceThisDataDir, ezUInt16& out_uiUseDataDirCache)
+{
+  EZ_LOCK(m_Mutex);
+  bool bCachedYet = false;
+  auto itFileDataDir = m_FileDataDir.FindOrAdd(szFile, &bCachedYet);
+  if (!bCachedYet)
+  {
+    FillFileStatusCache(szFile);
+  }
+
+  out_uiUseDataDirCache = bForceThisDataDir ? uiDataDirID : itFileDataDir.Value();
+  const FileCacheStatus& CacheStatus = m_MountedDataDirs[out_uiUseDataDirCache].m_CacheStatus[szFile];
+
+  return m_CurrentTime - CacheStatus.m_LastCheck < ezTime::MakeFromSeconds(5.0f);
+}
+
+ezUInt32 ezFileserveClient::AddFileRequest(ezStreamWriter& inout_requests, ezUInt16 uiUseDataDirCache, const char* szFile, bool bForceThisDataDir)
+{
+  EZ_LOCK(m_Mutex);
+  const FileCacheStatus& CacheStatus = m_MountedDataDirs[uiUseDataDirCache].m_CacheStatus[szFile];
+
+  const ezUInt32 uiRequestID = m_uiNextFileRequestID++;
+  m_Downloads[uiRequestID].m_sFile = szFile;
+
+  // the server only sends the file data, if neither the timestamp nor the hash match
+  inout_requests << uiRequestID;
+  inout_requests << uiUseDataDirCache;
+  inout_requests << bForceThisDataDir;
+  inout_requests << szFile;
+  inout_requests << CacheStatus.m_TimeStamp;
+  inout_requests << CacheStatus.m_FileHash;
+
+  return uiRequestID;
+}
+
+void ezFileserveClient::SendFileRequests(const ezMemoryStreamStorageInterface& requests, ezUInt16 uiNumRequests)
+{
+  EZ_LOCK(m_Mutex);
+
+#ifdef BUILDSYSTEM_ENABLE_ZSTD_SUPPORT
+  const bool bAcceptsCompression = true;
+#else
+  const bool bAcceptsCompression = false;
+#endif
+
+  ezRemoteMessage msg('FSRV', 'READ');
+  msg.GetWriter() << m_FileRequestGuid;
+  msg.GetWriter() << bAcceptsCompression;
+  msg.GetWriter() << uiNumRequests;
+  requests.CopyToStream(msg.GetWriter()).IgnoreResult();
+
+  m_pNetwork->Send(ezRemoteTransmitMode::Reliable, msg);
+}
+
 ezResult ezFileserveClient::DownloadFile(ezUInt16 uiDataDirID, const char* szFile, bool bForceThisDataDir, ezStringBuilder* out_pFullPath)
 {
   // bForceThisDataDir = true;
@@ -618,18 +765,11 @@ ezResult ezFileserveClient::DownloadFile(ezUInt16 uiDataDirID, const char* szFil
   if (!m_pNetwork->IsConnectedToServer())
     return EZ_FAILURE;
 
-  bool bCachedYet = false;
-  auto itFileDataDir = m_FileDataDir.FindOrAdd(szFile, &bCachedYet);
-  if (!bCachedYet)
+  ezUInt16 uiUseDataDirCache = 0;
+  if (IsCacheUpToDate(uiDataDirID, szFile, bForceThisDataDir, uiUseDataDirCache))
   {
-    FillFileStatusCache(szFile);
-  }
-
-  const ezUInt16 uiUseDataDirCache = bForceThisDataDir ? uiDataDirID : itFileDataDir.Value();
-  const FileCacheStatus& CacheStatus = m_MountedDataDirs[uiUseDataDirCache].m_CacheStatus[szFile];
+    const FileCacheStatus& CacheStatus = m_MountedDataDirs[uiUseDataDirCache].m_CacheStatus[szFile];
 
-  if (m_CurrentTime - CacheStatus.m_LastCheck < ezTime::MakeFromSeconds(5.0f))
-  {
     if (CacheStatus.m_FileHash == 0) // file does not exist
       return EZ_FAILURE;
 
@@ -639,30 +779,26 @@ ezResult ezFileserveClient::DownloadFile(ezUInt16 uiDataDirID, const char* szFil
     return EZ_SUCCESS;
   }
 
-  m_Download.Clear();
-  m_sCurFileRequest = szFile;
-  m_CurFileRequestGuid = ezUuid::MakeUuid();
-  m_bDownloading = true;
-
-  ezRemoteMessage msg('FSRV', 'READ');
-  msg.GetWriter() << uiUseDataDirCache;
-  msg.GetWriter() << bForceThisDataDir;
-  msg.GetWriter() << szFile;
-  msg.GetWriter() << m_CurFileRequestGuid;
-  msg.GetWriter() << CacheStatus.m_TimeStamp;
-  msg.GetWriter() << CacheStatus.m_FileHash;
+  {
+    m_bDownloading = true;
+    EZ_SCOPE_EXIT(m_bDownloading = false);
 
-  m_pNetwork->Send(ezRemoteTransmitMode::Reliable, msg);
+    // if PrefetchFiles() runs on another thread, its downloads are processed here as well, until this one is finished
+    ezDefaultMemoryStreamStorage requests;
+    ezMemoryStreamWriter writer(&requests);
+    const ezUInt32 uiRequestID = AddFileRequest(writer, uiUseDataDirCache, szFile, bForceThisDataDir);
+    SendFileRequests(requests, 1);
 
-  while (m_bDownloading)
-  {
-    m_pNetwork->UpdateRemoteInterface();
-    m_pNetwork->ExecuteAllMessageHandlers();
+    while (m_Downloads.Contains(uiRequestID) && m_pNetwork->IsConnectedToServer())
+    {
+      m_pNetwork->UpdateRemoteInterface();
+      m_pNetwork->ExecuteAllMessageHandlers();
+    }
   }
 
   if (bForceThisDataDir)
   {
-    if (m_MountedDataDirs[uiDataDirID].m_CacheStatus[m_sCurFileRequest].m_FileHash == 0)
+    if (m_MountedDataDirs[uiDataDirID].m_CacheStatus[szFile].m_FileHash == 0)
       return EZ_FAILURE;
 
     if (out_pFullPath)
@@ -672,11 +808,11 @@ ezResult ezFileserveClient::DownloadFile(ezUInt16 uiDataDirID, const char* szFil
   }
   else
   {
-    const ezUInt16 uiBestDir = itFileDataDir.Value();
+    const ezUInt16 uiBestDir = m_FileDataDir[szFile];
     if (uiBestDir == uiDataDirID) // best match is still this? -> success
     {
       // file does not exist
-      if (m_MountedDataDirs[uiBestDir].m_CacheStatus[m_sCurFileRequest].m_FileHash == 0)
+      if (m_MountedDataDirs[uiBestDir].m_CacheStatus[szFile].m_FileHash == 0)
         return EZ_FAILURE;
 
       if (out_pFullPath)
@@ -689,6 +825,74 @@ ezResult ezFileserveClient::DownloadFile(ezUInt16 uiDataDirID, const char* szFil
   }
 }
 
+void ezFileserveClient::PrefetchFiles(ezArrayPtr<const ezString> files)
+{
+  {
+    EZ_LOCK(m_Mutex);
+    if (m_bDownloading || m_bPrefetching || m_pNetwork == nullptr || !m_pNetwork->IsConnectedToServer() || m_MountedDataDirs.IsEmpty())
+      return;
+
+    m_bPrefetching = true;
+  }
+
+  EZ_SCOPE_EXIT(EZ_LOCK(m_Mutex); m_bPrefetching = false;);
+
+  // how many files are requested with one message, and how many requests may be unanswered at any time
+  // the server answers requests in order, so while it works on one batch, the next one is already on its way
+  constexpr ezUInt16 uiMaxBatchSize = 32;
+  constexpr ezUInt32 uiMaxRequestsInFlight = 256;
+
+  ezUInt32 uiNextFile = 0;
+
+  while (true)
+  {
+    {
+      EZ_LOCK(m_Mutex);
+
+      if (!m_pNetwork->IsConnectedToServer())
+        break;
+
+      while (uiNextFile < files.GetCount() && m_Downloads.GetCount() + uiMaxBatchSize <= uiMaxRequestsInFlight)
+      {
+        ezDefaultMemoryStreamStorage requests;
+        ezMemoryStreamWriter writer(&requests);
+        ezUInt16 uiNumRequests = 0;
+
+        for (; uiNextFile < files.GetCount() && uiNumRequests < uiMaxBatchSize; ++uiNextFile)
+        {
+          const char* szFile = files[uiNextFile];
+
+          // the best matching data dir is used, just like regular file accesses do
+          ezUInt16 uiUseDataDirCache = 0;
+          if (IsCacheUpToDate(0, szFile, false, uiUseDataDirCache))
+            continue;
+
+          AddFileRequest(writer, uiUseDataDirCache, szFile, false);
+          ++uiNumRequests;
+        }
+
+        if (uiNumRequests > 0)
+        {
+          SendFileRequests(requests, uiNumRequests);
+        }
+      }
+
+      if (uiNextFile >= files.GetCount() && m_Downloads.IsEmpty())
+        break;
+
+      // the network is only pumped while holding the mutex, just like DownloadFile() does, otherwise the locks could be taken in opposite order
+      m_bDownloading = true;
+      EZ_SCOPE_EXIT(m_bDownloading = false);
+
+      m_pNetwork->UpdateRemoteInterface();
+      m_pNetwork->ExecuteAllMessageHandlers();
+    }
+
+    // give other threads the chance to download files in between, they also process the answers to our requests while they wait
+    ezThreadUtils::YieldTimeSlice();
+  }
+}
+
 void ezFileserveClient::DetermineCacheStatus(ezUInt16 uiDataDirID, const char* szFile, FileCacheStatus& out_Status) const
 {
   EZ_LOCK(m_Mutex);
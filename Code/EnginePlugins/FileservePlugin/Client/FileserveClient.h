@@ -5,9 +5,12 @@
 #include <Core/Interfaces/RemoteToolingInterface.h>
 #include <Foundation/Communication/RemoteInterface.h>
 #include <Foundation/Configuration/Singleton.h>
+#include <Foundation/Containers/HashTable.h>
 #include <Foundation/Types/UniquePtr.h>
 #include <Foundation/Types/Uuid.h>
 
+class ezMemoryStreamStorageInterface;
+
 namespace ezDataDirectory
 {
   class FileserveType;
@@ -85,6 +88,17 @@ public:
   /// \brief Adds an address that should be tried for connecting with the server.
   void AddServerAddressToTry(ezStringView sAddress);
 
+  /// \brief Makes sure that all the given files are up to date in the local cache, with as few round trips to the server as possible.
+  ///
+  /// Opening a file through fileserve requires one round trip to the server per file. When many files are needed,
+  /// e.g. when a level gets loaded, it is much faster to request them all up front. The requests are sent in batches and many of them
+  /// are kept in flight at the same time, while the server streams back the (compressed) file data. Files that are already cached and
+  /// did not change are only validated through their timestamp and hash, but not transferred again.
+  ///
+  /// The paths are relative to the mounted data directories, the best matching data directory is looked up for each file.
+  /// Subsequent reads of these files are served from the cache, as long as the cache entries are considered fresh.
+  void PrefetchFiles(ezArrayPtr<const ezString> files);
+
 private:
   friend class ezDataDirectory::FileserveType;
 
@@ -118,8 +132,11 @@ private:
   void HandleFileTransferMsg(ezRemoteMessage& msg);
   void HandleFileTransferFinishedMsg(ezRemoteMessage& msg);
   static void WriteMetaFile(ezStringBuilder sCachedMetaFile, ezInt64 iFileTimeStamp, ezUInt64 uiFileHash);
-  void WriteDownloadToDisk(ezStringBuilder sCachedFile);
+  static void WriteDownloadToDisk(ezStringBuilder sCachedFile, const ezDynamicArray<ezUInt8>& download);
   ezResult DownloadFile(ezUInt16 uiDataDirID, const char* szFile, bool bForceThisDataDir, ezStringBuilder* out_pFullPath);
+  bool IsCacheUpToDate(ezUInt16 uiDataDirID, const char* szFile, bool bForceThisDataDir, ezUInt16& out_uiUseDataDirCache);
+  ezUInt32 AddFileRequest(ezStreamWriter& inout_requests, ezUInt16 uiUseDataDirCache, const char* szFile, bool bForceThisDataDir);
+  void SendFileRequests(const ezMemoryStreamStorageInterface& requests, ezUInt16 uiNumRequests);
   void DetermineCacheStatus(ezUInt16 uiDataDirID, const char* szFile, FileCacheStatus& out_Status) const;
   void UploadFile(ezUInt16 uiDataDirID, const char* szFile, const ezDynamicArray<ezUInt8>& fileContent);
   void InvalidateFileCache(ezUInt16 uiDataDirID, ezStringView sFile, ezUInt64 uiHash);
@@ -128,18 +145,30 @@ private:
   void FillFileStatusCache(const char* szFile);
   void ShutdownConnection();
   void ClearState();
+  ezResult WaitForServerHello(ezTime timeout);
 
   mutable ezMutex m_Mutex;
   mutable ezString m_sServerConnectionAddress;
   ezString m_sFileserveCacheFolder;
   ezString m_sFileserveCacheMetaFolder;
-  bool m_bDownloading = false;
+  /// \brief A file request that was sent to the server, but not answered yet.
+  struct Download
+  {
+    ezString m_sFile;
+    ezDynamicArray<ezUInt8> m_Data;
+    bool m_bFailed = false; ///< Set when a chunk could not be decompressed. The data is discarded and the file is not cached.
+  };
+
+  bool m_bDownloading = false; ///< Set while the thread that holds the mutex pumps the network, to detect recursive downloads.
+  bool m_bPrefetching = false; ///< Set while PrefetchFiles() runs. Other threads can still download files in the meantime.
   bool m_bFailedToConnect = false;
   bool m_bWaitingForUploadFinished = false;
-  ezUuid m_CurFileRequestGuid;
-  ezStringBuilder m_sCurFileRequest;
+  ezUuid m_FileRequestGuid; // the server broadcasts its answers, this identifies the ones that are meant for us
+  ezUInt32 m_uiNextFileRequestID = 0;
+  ezUInt16 m_uiServerProtocolVersion = 0; ///< Reported by the server in its answer to our 'HELO'.
+  ezHashTable<ezUInt32, Download> m_Downloads;
+  ezDynamicArray<ezUInt8> m_DecompressedChunk;
   ezUniquePtr<ezRemoteInterface> m_pNetwork;
-  ezDynamicArray<ezUInt8> m_Download;
   ezTime m_CurrentTime;
   ezHybridArray<ezString, 4> m_TryServerAddresses;
 
@@ -4,6 +4,12 @@
 #include <Foundation/Containers/HybridArray.h>
 #include <Foundation/Strings/String.h>
 
+/// \brief Increased whenever the layout of the messages between client and server changes.
+///
+/// Both sides send it with their 'HELO' message. The client refuses to use a server that reports a different version (or none),
+/// the server ignores file requests of clients with a different version.
+constexpr ezUInt16 ezFileserveProtocolVersion = 2;
+
 enum class ezFileserveFileState
 {
   None = 0,
@@ -38,5 +44,6 @@ public:
 
   bool m_bLostConnection = false;
   ezUInt32 m_uiApplicationID = 0;
+  ezUInt16 m_uiProtocolVersion = 0; ///< Sent by the client with its 'HELO' message, 0 for clients that predate versioning.
   ezHybridArray<DataDir, 8> m_MountedDataDirs;
 };
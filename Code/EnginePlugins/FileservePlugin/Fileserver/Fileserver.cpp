@@ -6,6 +6,7 @@
 #include <Foundation/Communication/RemoteInterfaceEnet.h>
 #include <Foundation/IO/FileSystem/FileReader.h>
 #include <Foundation/Utilities/CommandLineUtils.h>
+#include <Foundation/Utilities/Compression.h>
 
 EZ_IMPLEMENT_SINGLETON(ezFileserver);
 
@@ -84,7 +85,20 @@ void ezFileserver::NetworkMsgHandler(ezRemoteMessage& msg)
   auto& client = DetermineClient(msg);
 
   if (msg.GetMessageID() == 'HELO')
+  {
+    // clients that predate versioning send no payload and end up with version 0
+    msg.GetReader() >> client.m_uiProtocolVersion;
+
+    if (client.m_uiProtocolVersion != ezFileserveProtocolVersion)
+    {
+      ezLog::Error("Fileserve client {} uses protocol version {}, but the server uses version {}. Its file requests are ignored.", client.m_uiApplicationID, client.m_uiProtocolVersion, ezFileserveProtocolVersion);
+    }
+
+    ezRemoteMessage ret('FSRV', 'HELO');
+    ret.GetWriter() << ezFileserveProtocolVersion;
+    m_pNetwork->Send(ezRemoteTransmitMode::Reliable, ret);
     return;
+  }
 
   if (msg.GetMessageID() == 'RUTR')
   {
@@ -263,28 +277,52 @@ void ezFileserver::HandleUnmountRequest(ezFileserveClientContext& client, ezRemo
 
 void ezFileserver::HandleFileRequest(ezFileserveClientContext& client, ezRemoteMessage& msg)
 {
-  ezUInt16 uiDataDirID = 0;
-  bool bForceThisDataDir = false;
+  // the request layout differs between protocol versions
+  if (client.m_uiProtocolVersion != ezFileserveProtocolVersion)
+    return;
 
-  msg.GetReader() >> uiDataDirID;
-  msg.GetReader() >> bForceThisDataDir;
+  // a single request message may contain many files, the client keeps several of these in flight,
+  // so that it doesn't have to wait for one round trip per file
+  ezUuid downloadGuid;
+  msg.GetReader() >> downloadGuid;
+
+  bool bAcceptsCompression = false;
+  msg.GetReader() >> bAcceptsCompression;
+
+  ezUInt16 uiNumRequests = 0;
+  msg.GetReader() >> uiNumRequests;
 
   ezStringBuilder sRequestedFile;
-  msg.GetReader() >> sRequestedFile;
 
-  ezUuid downloadGuid;
-  msg.GetReader() >> downloadGuid;
+  for (ezUInt16 i = 0; i < uiNumRequests; ++i)
+  {
+    ezUInt32 uiRequestID = 0;
+    msg.GetReader() >> uiRequestID;
+
+    ezUInt16 uiDataDirID = 0;
+    bool bForceThisDataDir = false;
+
+    msg.GetReader() >> uiDataDirID;
+    msg.GetReader() >> bForceThisDataDir;
+    msg.GetReader() >> sRequestedFile;
 
-  ezFileserveClientContext::FileStatus status;
-  msg.GetReader() >> status.m_iTimestamp;
-  msg.GetReader() >> status.m_uiHash;
+    ezFileserveClientContext::FileStatus status;
+    msg.GetReader() >> status.m_iTimestamp;
+    msg.GetReader() >> status.m_uiHash;
+
+    SendFile(client, downloadGuid, uiRequestID, bAcceptsCompression, uiDataDirID, bForceThisDataDir, sRequestedFile, status);
+  }
+}
 
+void ezFileserver::SendFile(ezFileserveClientContext& client, const ezUuid& downloadGuid, ezUInt32 uiRequestID, bool bCompress, ezUInt16 uiDataDirID,
+  bool bForceThisDataDir, const char* szRequestedFile, ezFileserveClientContext::FileStatus& status)
+{
   ezFileserverEvent e;
   e.m_uiClientID = client.m_uiApplicationID;
-  e.m_szPath = sRequestedFile;
+  e.m_szPath = szRequestedFile;
   e.m_uiSentTotal = 0;
 
-  const ezFileserveFileState filestate = client.GetFileStatus(uiDataDirID, sRequestedFile, status, m_SendToClient, bForceThisDataDir);
+  const ezFileserveFileState filestate = client.GetFileStatus(uiDataDirID, szRequestedFile, status, m_SendToClient, bForceThisDataDir);
 
   {
     e.m_Type = ezFileserverEvent::Type::FileDownloadRequest;
@@ -298,19 +336,33 @@ void ezFileserver::HandleFileRequest(ezFileserveClientContext& client, ezRemoteM
     ezUInt32 uiNextByte = 0;
     const ezUInt32 uiFileSize = m_SendToClient.GetCount();
 
-    // send the file over in multiple packages of 1KB each
+    // send the file over in multiple packages
+    // every package is compressed on its own, so that the client can decompress it right away
     // send at least one package, even for empty files
     do
     {
-      const ezUInt16 uiChunkSize = (ezUInt16)ezMath::Min<ezUInt32>(1024, m_SendToClient.GetCount() - uiNextByte);
+      const ezUInt32 uiChunkSize = ezMath::Min<ezUInt32>(TransferChunkSize, uiFileSize - uiNextByte);
+      const ezArrayPtr<const ezUInt8> chunk = m_SendToClient.GetArrayPtr().GetSubArray(uiNextByte, uiChunkSize);
+
+      // only use the compressed data, if it actually saves something
+      bool bCompressed = false;
+      if (bCompress && uiChunkSize > 0 && ezCompressionUtils::Compress(chunk, ezCompressionMethod::ZStd, m_CompressedChunk).Succeeded())
+      {
+        bCompressed = m_CompressedChunk.GetCount() < uiChunkSize;
+      }
+
+      const ezArrayPtr<const ezUInt8> transfer = bCompressed ? ezArrayPtr<const ezUInt8>(m_CompressedChunk) : chunk;
 
       ezRemoteMessage ret;
       ret.GetWriter() << downloadGuid;
-      ret.GetWriter() << uiChunkSize;
+      ret.GetWriter() << uiRequestID;
       ret.GetWriter() << uiFileSize;
+      ret.GetWriter() << uiChunkSize;
+      ret.GetWriter() << bCompressed;
+      ret.GetWriter() << transfer.GetCount();
 
-      if (!m_SendToClient.IsEmpty())
-        ret.GetWriter().WriteBytes(&m_SendToClient[uiNextByte], uiChunkSize).IgnoreResult();
+      if (!transfer.IsEmpty())
+        ret.GetWriter().WriteBytes(transfer.GetPtr(), transfer.GetCount()).IgnoreResult();
 
       ret.SetMessageID('FSRV', 'DWNL');
       m_pNetwork->Send(ezRemoteTransmitMode::Reliable, ret);
@@ -323,13 +375,14 @@ void ezFileserver::HandleFileRequest(ezFileserveClientContext& client, ezRemoteM
         e.m_uiSentTotal = uiNextByte;
         m_Events.Broadcast(e);
       }
-    } while (uiNextByte < m_SendToClient.GetCount());
+    } while (uiNextByte < uiFileSize);
   }
 
   // final answer to client
   {
     ezRemoteMessage ret('FSRV', 'DWNF');
     ret.GetWriter() << downloadGuid;
+    ret.GetWriter() << uiRequestID;
     ret.GetWriter() << (ezInt8)filestate;
     ret.GetWriter() << status.m_iTimestamp;
     ret.GetWriter() << status.m_uiHash;
@@ -102,6 +102,8 @@ private:
   void HandleMountRequest(ezFileserveClientContext& client, ezRemoteMessage& msg);
   void HandleUnmountRequest(ezFileserveClientContext& client, ezRemoteMessage& msg);
   void HandleFileRequest(ezFileserveClientContext& client, ezRemoteMessage& msg);
+  void SendFile(ezFileserveClientContext& client, const ezUuid& downloadGuid, ezUInt32 uiRequestID, bool bCompress, ezUInt16 uiDataDirID,
+    bool bForceThisDataDir, const char* szRequestedFile, ezFileserveClientContext::FileStatus& status);
   void HandleDeleteFileRequest(ezFileserveClientContext& client, ezRemoteMessage& msg);
   void HandleUploadFileHeader(ezFileserveClientContext& client, ezRemoteMessage& msg);
   void HandleUploadFileTransfer(ezFileserveClientContext& client, ezRemoteMessage& msg);
@@ -110,7 +112,10 @@ private:
 
   ezHashTable<ezUInt32, ezFileserveClientContext> m_Clients;
   ezUniquePtr<ezRemoteInterface> m_pNetwork;
+  static constexpr ezUInt32 TransferChunkSize = 64 * 1024;
+
   ezDynamicArray<ezUInt8> m_SendToClient;   // ie. 'downloads' from server to client
+  ezDynamicArray<ezUInt8> m_CompressedChunk;
   ezDynamicArray<ezUInt8> m_SentFromClient; // ie. 'uploads' from client to server
   ezStringBuilder m_sCurFileUpload;
   ezUuid m_FileUploadGuid;
@@ -69,7 +69,7 @@ void ezMiniAudioSoundComponentManager::UpdateEvents(const ezWorldModule::UpdateC
 //////////////////////////////////////////////////////////////////////////
 
 // clang-format off
-EZ_BEGIN_COMPONENT_TYPE(ezMiniAudioSoundComponent, 1, ezComponentMode::Static)
+EZ_BEGIN_COMPONENT_TYPE(ezMiniAudioSoundComponent, 2, ezComponentMode::Static)
 {
   EZ_BEGIN_PROPERTIES
   {
@@ -78,6 +78,7 @@ EZ_BEGIN_COMPONENT_TYPE(ezMiniAudioSoundComponent, 1, ezComponentMode::Static)
     EZ_ACCESSOR_PROPERTY("Volume", GetVolume, SetVolume)->AddAttributes(new ezDefaultValueAttribute(1.0f), new ezClampValueAttribute(0.0f, 1.0f)),
     EZ_ACCESSOR_PROPERTY("Pitch", GetPitch, SetPitch)->AddAttributes(new ezDefaultValueAttribute(1.0f), new ezClampValueAttribute(0.1f, 10.0f)),
     EZ_ACCESSOR_PROPERTY("NoGlobalPitch", GetNoGlobalPitch, SetNoGlobalPitch),
+    EZ_ACCESSOR_PROPERTY("Priority", GetPriority, SetPriority)->AddAttributes(new ezDefaultValueAttribute(1.0f), new ezClampValueAttribute(0.0f, 100.0f)),
     EZ_ENUM_MEMBER_PROPERTY("OnFinishedAction", ezOnComponentFinishedAction2, m_OnFinishedAction),
   }
   EZ_END_PROPERTIES;
@@ -125,6 +126,8 @@ void ezMiniAudioSoundComponent::SerializeComponent(ezWorldWriter& inout_stream)
 
   ezOnComponentFinishedAction2::StorageType type = m_OnFinishedAction;
   s << type;
+
+  s << m_fPriority;
 }
 
 void ezMiniAudioSoundComponent::DeserializeComponent(ezWorldReader& inout_stream)
@@ -142,6 +145,11 @@ void ezMiniAudioSoundComponent::DeserializeComponent(ezWorldReader& inout_stream
   ezOnComponentFinishedAction2::StorageType type;
   s >> type;
   m_OnFinishedAction = (ezOnComponentFinishedAction2::Enum)type;
+
+  if (uiVersion >= 2)
+  {
+    s >> m_fPriority;
+  }
 }
 
 void ezMiniAudioSoundComponent::SetPaused(bool b)
@@ -177,6 +185,16 @@ void ezMiniAudioSoundComponent::SetVolume(float f)
   m_fComponentVolume = f;
 }
 
+void ezMiniAudioSoundComponent::SetPriority(float f)
+{
+  m_fPriority = f;
+
+  if (m_pInstance)
+  {
+    m_pInstance->m_fPriority = m_fPriority;
+  }
+}
+
 void ezMiniAudioSoundComponent::SetNoGlobalPitch(bool bEnable)
 {
   SetUserFlag(NoGlobalPitch, bEnable);
@@ -221,13 +239,18 @@ void ezMiniAudioSoundComponent::Play()
     ezRandom& rng = GetWorld()->GetRandomNumberGenerator();
     m_pInstance = pResource->InstantiateSound(&rng, GetWorld(), GetHandle());
 
+    if (m_pInstance == nullptr)
+      return;
+
+    m_pInstance->m_fPriority = m_fPriority;
+
     m_fResourceVolume = pResource->GetVolume(rng);
     m_fResourcePitch = pResource->GetPitch(rng);
 
     Update();
   }
 
-  EZ_MA_CHECK(ma_sound_start(&m_pInstance->m_Sound));
+  ezMiniAudioSingleton::GetSingleton()->StartSoundInstance(m_pInstance);
   m_bPaused = false;
 }
 
@@ -235,7 +258,7 @@ void ezMiniAudioSoundComponent::Pause()
 {
   if (m_pInstance)
   {
-    EZ_MA_CHECK(ma_sound_stop(&m_pInstance->m_Sound));
+    ezMiniAudioSingleton::GetSingleton()->PauseSoundInstance(m_pInstance);
   }
 }
 
@@ -271,13 +294,18 @@ void ezMiniAudioSoundComponent::StartOneShot()
   ezRandom& rng = GetWorld()->GetRandomNumberGenerator();
   auto pInstance = pResource->InstantiateSound(&rng, GetWorld(), {});
 
+  if (pInstance == nullptr)
+    return;
+
+  pInstance->m_fPriority = m_fPriority;
+
   const float fResourceVolume = pResource->GetVolume(rng);
   const float fResourcePitch = pResource->GetPitch(rng);
 
   UpdateParameters(pInstance, m_fComponentVolume * fResourceVolume, m_fPitch * fResourcePitch);
 
   // the sound will play until it ends and then get cleaned up automatically
-  EZ_MA_CHECK(ma_sound_start(&pInstance->m_Sound));
+  ezMiniAudioSingleton::GetSingleton()->StartSoundInstance(pInstance);
 }
 
 void ezMiniAudioSoundComponent::OnMsgDeleteGameObject(ezMsgDeleteGameObject& msg)
@@ -71,6 +71,12 @@ public:
   void SetNoGlobalPitch(bool bEnable);                     // [ property ]
   bool GetNoGlobalPitch() const;                           // [ property ]
 
+  /// \brief Scales how important the sound is, when more sounds play than there are voices available.
+  ///
+  /// The least audible sounds get virtualized first, a higher priority makes this sound count as more audible than it is.
+  void SetPriority(float f);                               // [ property ]
+  float GetPriority() const { return m_fPriority; }        // [ property ]
+
   ezEnum<ezOnComponentFinishedAction2> m_OnFinishedAction; // [ property ]
 
   /// \brief Makes the sound play.
@@ -112,6 +118,7 @@ protected:
   float m_fPitch = 1.0f;
   float m_fResourceVolume = 1.0f;
   float m_fResourcePitch = 1.0f;
+  float m_fPriority = 1.0f;
   bool m_bPaused = false;
 
   ezMiniAudioSoundInstance* m_pInstance = nullptr;
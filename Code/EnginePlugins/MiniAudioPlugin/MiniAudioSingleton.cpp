@@ -5,6 +5,7 @@
 #include <Core/World/World.h>
 #include <Foundation/Configuration/CVar.h>
 #include <Foundation/IO/FileSystem/FileSystem.h>
+#include <Foundation/Utilities/Stats.h>
 #include <MiniAudioPlugin/Components/MiniAudioSoundComponent.h>
 #include <MiniAudioPlugin/MiniAudioSingleton.h>
 #include <MiniAudioPlugin/Resources/MiniAudioSoundResource.h>
@@ -12,6 +13,9 @@
 ezCVarFloat cvar_MiniAudioMasterVolume("MiniAudio.Volume", 1.0f, ezCVarFlags::Save, "Overall volume for all MiniAudio output");
 ezCVarBool cvar_MiniAudioMute("MiniAudio.Mute", false, ezCVarFlags::Default, "Whether MiniAudio output is muted");
 ezCVarBool cvar_MiniAudioPause("MiniAudio.Pause", false, ezCVarFlags::Default, "Whether MiniAudio output is paused");
+ezCVarInt cvar_MiniAudioMaxVoices("MiniAudio.MaxVoices", 64, ezCVarFlags::Save, "How many sounds are mixed at the same time, the least audible sounds above this limit become virtual");
+ezCVarInt cvar_MiniAudioMaxVoicesPerGroup("MiniAudio.MaxVoicesPerGroup", 32, ezCVarFlags::Save, "How many sounds of the same sound group are mixed at the same time");
+ezCVarFloat cvar_MiniAudioMinAudibility("MiniAudio.MinAudibility", 0.001f, ezCVarFlags::Default, "Sounds that are quieter than this become virtual, even if there are voices left");
 
 EZ_IMPLEMENT_SINGLETON(ezMiniAudioSingleton);
 
@@ -124,6 +128,8 @@ void ezMiniAudioSingleton::UpdateSound()
     }
   }
 
+  UpdateVoices();
+
   if (!m_pData->m_FinishedInstances.IsEmpty())
   {
     for (ezUInt32 idx : m_pData->m_FinishedInstances)
@@ -167,6 +173,22 @@ void ezMiniAudioSingleton::UpdateSound()
       }
     }
   }
+
+  ezUInt32 uiNumStreamingSounds = 0;
+
+  for (auto& inst : m_pData->m_SoundInstancesStorage)
+  {
+    if (inst.m_bInUse && !inst.m_bVirtual && inst.m_pStreamingSource != nullptr)
+    {
+      inst.m_pStreamingSource->ScheduleDecoding();
+      ++uiNumStreamingSounds;
+    }
+  }
+
+  ezStats::SetStat("MiniAudio/StreamingSounds", uiNumStreamingSounds);
+  ezStats::SetStat("MiniAudio/DecodedMemory", ezMiniAudioSoundData::GetTotalDecodedMemory());
+  ezStats::SetStat("MiniAudio/DecodeTime", ezMiniAudioSoundData::GetAndResetDecodeTime());
+  ezStats::SetStat("MiniAudio/StreamingUnderruns", ezMiniAudioStreamingDataSource::GetTotalUnderruns());
 }
 
 void ezMiniAudioSingleton::SetMasterChannelVolume(float fVolume)
@@ -301,13 +323,16 @@ ezResult ezMiniAudioSingleton::OneShotSound(ezWorld* pWorld, ezStringView sResou
 
   auto pInstance = pResource->InstantiateSound(pRng, pWorld, {});
 
+  if (pInstance == nullptr)
+    return EZ_FAILURE;
+
   const ezVec3 pos = globalPosition.m_vPosition;
   ma_sound_set_position(&pInstance->m_Sound, pos.x, pos.y, pos.z);
   ma_sound_set_pitch(&pInstance->m_Sound, fPitch);
   ma_sound_set_volume(&pInstance->m_Sound, fVolume);
 
   // the sound will play until it ends and then get cleaned up automatically
-  EZ_MA_CHECK(ma_sound_start(&pInstance->m_Sound));
+  StartSoundInstance(pInstance);
 
   return EZ_SUCCESS;
 }
@@ -317,9 +342,9 @@ static void SoundEndedCallback(void* pUserData, ma_sound* pSound)
   ezMiniAudioSingleton::GetSingleton()->SoundEnded((ezMiniAudioSoundInstance*)pUserData);
 }
 
-ezMiniAudioSoundInstance* ezMiniAudioSingleton::AllocateSoundInstance(const ezDataBuffer& audioData, ezWorld* pWorld, ezComponentHandle hComponent, ma_sound_group* pGroup)
+ezMiniAudioSoundInstance* ezMiniAudioSingleton::AllocateSoundInstance(const ezSharedPtr<ezMiniAudioSoundData>& pSoundData, ezWorld* pWorld, ezComponentHandle hComponent, ma_sound_group* pGroup)
 {
-  if (!m_bInitialized)
+  if (!m_bInitialized || pSoundData == nullptr)
     return nullptr;
 
   EZ_LOCK(m_pData->m_Mutex);
@@ -342,19 +367,50 @@ ezMiniAudioSoundInstance* ezMiniAudioSingleton::AllocateSoundInstance(const ezDa
   pInstance->m_bInUse = true;
   pInstance->pWorld = pWorld;
   pInstance->m_hComponent = hComponent;
+  pInstance->m_pGroup = pGroup;
+  pInstance->m_pSoundData = pSoundData;
 
-  if (ma_decoder_init_memory(audioData.GetData(), audioData.GetCount(), nullptr, &pInstance->m_Decoder) != MA_SUCCESS)
+  ma_data_source* pDataSource = nullptr;
+
+  if (pSoundData->IsStreamed())
   {
-    FreeSoundInstance(pInstance);
-    return nullptr;
+    pInstance->m_pStreamingSource = EZ_DEFAULT_NEW(ezMiniAudioStreamingDataSource);
+
+    if (pInstance->m_pStreamingSource->Initialize(pSoundData).Failed())
+    {
+      FreeSoundInstance(pInstance);
+      return nullptr;
+    }
+
+    pDataSource = pInstance->m_pStreamingSource->GetDataSource();
+  }
+  else
+  {
+    // all instances read from the same decoded frames, each one only has its own cursor
+    if (ma_audio_buffer_ref_init(ma_format_f32, pSoundData->GetNumChannels(), pSoundData->GetDecodedFrames(), pSoundData->GetNumDecodedFrames(), &pInstance->m_BufferRef) != MA_SUCCESS)
+    {
+      FreeSoundInstance(pInstance);
+      return nullptr;
+    }
+
+    // ma_audio_buffer_ref_init() doesn't take a sample rate
+    pInstance->m_BufferRef.sampleRate = pSoundData->GetSampleRate();
+    pDataSource = &pInstance->m_BufferRef;
   }
 
-  if (ma_sound_init_from_data_source(GetEngine(), &pInstance->m_Decoder, MA_SOUND_FLAG_DECODE, pGroup, &pInstance->m_Sound) != MA_SUCCESS)
+  if (ma_sound_init_from_data_source(GetEngine(), pDataSource, 0, pGroup, &pInstance->m_Sound) != MA_SUCCESS)
   {
     FreeSoundInstance(pInstance);
     return nullptr;
   }
 
+  pInstance->m_bSoundInitialized = true;
+
+  if (ma_sound_get_length_in_pcm_frames(&pInstance->m_Sound, &pInstance->m_uiLengthInFrames) != MA_SUCCESS)
+  {
+    pInstance->m_uiLengthInFrames = 0;
+  }
+
   // make sure to be notified when the sound ends
   EZ_MA_CHECK(ma_sound_set_end_callback(&pInstance->m_Sound, SoundEndedCallback, pInstance));
 
@@ -380,10 +436,30 @@ void ezMiniAudioSingleton::FreeSoundInstance(ezMiniAudioSoundInstance*& ref_pIns
   auto& inst = m_pData->m_SoundInstancesStorage[uiIndex];
   inst.m_hComponent.Invalidate();
   inst.pWorld = nullptr;
+  inst.m_pGroup = nullptr;
+  inst.m_bPlaying = false;
+  inst.m_bFadingOut = false;
+  inst.m_bVirtual = false;
+  inst.m_fPriority = 1.0f;
+
+  if (inst.m_bSoundInitialized)
+  {
+    EZ_MA_CHECK(ma_sound_stop(&inst.m_Sound));
+    ma_sound_uninit(&inst.m_Sound);
+    inst.m_bSoundInitialized = false;
+  }
+
+  // the sound doesn't read from its data source anymore, so it can be released now
+  if (inst.m_pStreamingSource != nullptr)
+  {
+    inst.m_pStreamingSource.Clear();
+  }
+  else if (inst.m_pSoundData != nullptr)
+  {
+    ma_audio_buffer_ref_uninit(&inst.m_BufferRef);
+  }
 
-  EZ_MA_CHECK(ma_sound_stop(&inst.m_Sound));
-  EZ_MA_CHECK(ma_decoder_uninit(&inst.m_Decoder));
-  ma_sound_uninit(&inst.m_Sound);
+  inst.m_pSoundData.Clear();
 
   m_pData->m_SoundInstanceFreeList.PushBack(uiIndex);
 
@@ -396,7 +472,7 @@ void ezMiniAudioSingleton::DetachSoundInstance(ezMiniAudioSoundInstance*& ref_pI
     return;
 
   // deactivate looping
-  EZ_MA_CHECK(ma_data_source_set_looping(&ref_pInstance->m_Decoder, false));
+  ma_sound_set_looping(&ref_pInstance->m_Sound, false);
 
   ref_pInstance->m_hComponent.Invalidate(); // owner doesn't want to be notified anymore
   // pInstance->pWorld = nullptr; // but keep the world reference for shutdown behavior
@@ -412,7 +488,16 @@ void ezMiniAudioSingleton::DetachAndFadeOutSoundInstance(ezMiniAudioSoundInstanc
     return;
 
   EZ_LOCK(m_pData->m_Mutex);
+
+  if (ref_pInstance->m_bVirtual)
+  {
+    // nothing to hear, no need to fade out
+    FreeSoundInstance(ref_pInstance);
+    return;
+  }
+
   m_pData->m_FadingInstances.PushBack(ref_pInstance->m_uiOwnIndex);
+  ref_pInstance->m_bFadingOut = true;
 
   ref_pInstance->m_hComponent.Invalidate(); // owner doesn't want to be notified anymore
   // pInstance->pWorld = nullptr; // but keep the world reference for shutdown behavior
@@ -423,6 +508,198 @@ void ezMiniAudioSingleton::DetachAndFadeOutSoundInstance(ezMiniAudioSoundInstanc
   ref_pInstance = nullptr;
 }
 
+void ezMiniAudioSingleton::StartSoundInstance(ezMiniAudioSoundInstance* pInstance)
+{
+  if (pInstance == nullptr)
+    return;
+
+  EZ_LOCK(m_pData->m_Mutex);
+
+  pInstance->m_bPlaying = true;
+
+  // a virtual sound gets started by UpdateVoices(), once it is audible enough
+  if (!pInstance->m_bVirtual)
+  {
+    EZ_MA_CHECK(ma_sound_start(&pInstance->m_Sound));
+  }
+}
+
+void ezMiniAudioSingleton::PauseSoundInstance(ezMiniAudioSoundInstance* pInstance)
+{
+  if (pInstance == nullptr)
+    return;
+
+  EZ_LOCK(m_pData->m_Mutex);
+
+  pInstance->m_bPlaying = false;
+
+  if (pInstance->m_bVirtual)
+  {
+    // the sound is already stopped, it only needs to resume at the position it virtually reached
+    pInstance->m_bVirtual = false;
+    EZ_MA_CHECK(ma_sound_seek_to_pcm_frame(&pInstance->m_Sound, static_cast<ma_uint64>(pInstance->m_fVirtualCursor)));
+  }
+  else
+  {
+    EZ_MA_CHECK(ma_sound_stop(&pInstance->m_Sound));
+  }
+}
+
+void ezMiniAudioSingleton::SetSoundGroupMaxVoices(ezStringView sGroupName, ezUInt32 uiMaxVoices)
+{
+  GetSoundGroup(sGroupName).m_uiMaxVoices = uiMaxVoices;
+}
+
+static float ComputeAudibility(const ezMiniAudioSoundInstance& inst, const ezVec3& vListenerPosition)
+{
+  float fAudibility = ma_sound_get_volume(&inst.m_Sound);
+
+  if (inst.m_pGroup != nullptr)
+  {
+    fAudibility *= ma_sound_group_get_volume(inst.m_pGroup);
+  }
+
+  if (ma_sound_is_spatialization_enabled(&inst.m_Sound))
+  {
+    const ma_vec3f pos = ma_sound_get_position(&inst.m_Sound);
+    const float fDistance = (ezVec3(pos.x, pos.y, pos.z) - vListenerPosition).GetLength();
+    const float fMinDistance = ezMath::Max(ma_sound_get_min_distance(&inst.m_Sound), 0.01f);
+
+    if (fDistance > fMinDistance)
+    {
+      // same as MiniAudio's default (inverse) attenuation model
+      fAudibility *= fMinDistance / (fMinDistance + ma_sound_get_rolloff(&inst.m_Sound) * (fDistance - fMinDistance));
+    }
+  }
+
+  return fAudibility;
+}
+
+void ezMiniAudioSingleton::UpdateVoices()
+{
+  const ezTime tNow = ezTime::Now();
+  double fElapsedSeconds = m_pData->m_LastVoiceUpdate.IsPositive() ? (tNow - m_pData->m_LastVoiceUpdate).GetSeconds() : 0.0;
+  m_pData->m_LastVoiceUpdate = tNow;
+
+  if (cvar_MiniAudioPause)
+  {
+    // the engine is stopped, so virtual sounds must not advance either
+    fElapsedSeconds = 0.0;
+  }
+
+  auto& candidates = m_pData->m_VoiceCandidates;
+  candidates.Clear();
+
+  for (auto& inst : m_pData->m_SoundInstancesStorage)
+  {
+    if (!inst.m_bInUse || !inst.m_bPlaying || inst.m_bFadingOut)
+      continue;
+
+    if (inst.m_bVirtual)
+    {
+      // advance the playback position as if the sound was still playing
+      inst.m_fVirtualCursor += fElapsedSeconds * inst.m_pSoundData->GetSampleRate() * ma_sound_get_pitch(&inst.m_Sound);
+
+      if (inst.m_uiLengthInFrames > 0 && inst.m_fVirtualCursor >= static_cast<double>(inst.m_uiLengthInFrames))
+      {
+        if (ma_sound_is_looping(&inst.m_Sound))
+        {
+          inst.m_fVirtualCursor = ezMath::Mod(inst.m_fVirtualCursor, static_cast<double>(inst.m_uiLengthInFrames));
+        }
+        else
+        {
+          // the sound would have ended by now
+          inst.m_bPlaying = false;
+          m_pData->m_FinishedInstances.PushBack(inst.m_uiOwnIndex);
+          continue;
+        }
+      }
+    }
+
+    inst.m_fAudibility = ComputeAudibility(inst, m_vListenerPosition) * inst.m_fPriority;
+    candidates.PushBack(&inst);
+  }
+
+  // sounds that are currently mixed get a small bonus, so that sounds with similar audibility don't keep swapping their voices
+  candidates.Sort([](const ezMiniAudioSoundInstance* a, const ezMiniAudioSoundInstance* b)
+    { return a->m_fAudibility * (a->m_bVirtual ? 1.0f : 1.1f) > b->m_fAudibility * (b->m_bVirtual ? 1.0f : 1.1f); });
+
+  const ezUInt32 uiMaxVoices = static_cast<ezUInt32>(ezMath::Max(cvar_MiniAudioMaxVoices.GetValue(), 0));
+  const ezUInt32 uiMaxVoicesPerGroup = static_cast<ezUInt32>(ezMath::Max(cvar_MiniAudioMaxVoicesPerGroup.GetValue(), 0));
+
+  ezHybridArray<ezUInt32, 4> groupVoices;
+  groupVoices.SetCount(m_pData->m_SoundGroups.GetCount());
+
+  ezUInt32 uiNumRealVoices = 0;
+
+  for (ezMiniAudioSoundInstance* pInstance : candidates)
+  {
+    bool bReal = pInstance->m_fAudibility >= cvar_MiniAudioMinAudibility && uiNumRealVoices < uiMaxVoices;
+
+    ezUInt32 uiGroup = ezInvalidIndex;
+    if (pInstance->m_pGroup != nullptr)
+    {
+      for (ezUInt32 g = 0; g < m_pData->m_SoundGroups.GetCount(); ++g)
+      {
+        if (m_pData->m_SoundGroups[g].m_pGroup.Borrow() == pInstance->m_pGroup)
+        {
+          uiGroup = g;
+          break;
+        }
+      }
+    }
+
+    if (bReal && uiGroup != ezInvalidIndex)
+    {
+      const ezUInt32 uiGroupMax = m_pData->m_SoundGroups[uiGroup].m_uiMaxVoices > 0 ? m_pData->m_SoundGroups[uiGroup].m_uiMaxVoices : uiMaxVoicesPerGroup;
+      bReal = groupVoices[uiGroup] < uiGroupMax;
+    }
+
+    if (bReal)
+    {
+      ++uiNumRealVoices;
+
+      if (uiGroup != ezInvalidIndex)
+      {
+        ++groupVoices[uiGroup];
+      }
+
+      if (pInstance->m_bVirtual)
+      {
+        MakeReal(pInstance);
+      }
+    }
+    else if (!pInstance->m_bVirtual)
+    {
+      MakeVirtual(pInstance);
+    }
+  }
+
+  ezStats::SetStat("MiniAudio/RealVoices", uiNumRealVoices);
+  ezStats::SetStat("MiniAudio/VirtualVoices", candidates.GetCount() - uiNumRealVoices);
+}
+
+void ezMiniAudioSingleton::MakeVirtual(ezMiniAudioSoundInstance* pInstance)
+{
+  ma_uint64 uiCursor = 0;
+  EZ_MA_CHECK(ma_sound_get_cursor_in_pcm_frames(&pInstance->m_Sound, &uiCursor));
+  EZ_MA_CHECK(ma_sound_stop(&pInstance->m_Sound));
+
+  pInstance->m_fVirtualCursor = static_cast<double>(uiCursor);
+  pInstance->m_bVirtual = true;
+}
+
+void ezMiniAudioSingleton::MakeReal(ezMiniAudioSoundInstance* pInstance)
+{
+  EZ_MA_CHECK(ma_sound_seek_to_pcm_frame(&pInstance->m_Sound, static_cast<ma_uint64>(pInstance->m_fVirtualCursor)));
+
+  // fade in briefly, so that the sound doesn't pop in in the middle of a waveform
+  ma_sound_set_fade_in_milliseconds(&pInstance->m_Sound, 0.0f, 1.0f, 50);
+  EZ_MA_CHECK(ma_sound_start(&pInstance->m_Sound));
+
+  pInstance->m_bVirtual = false;
+}
+
 void ezMiniAudioSingleton::SoundEnded(ezMiniAudioSoundInstance* pInstance)
 {
   if (pInstance == nullptr)
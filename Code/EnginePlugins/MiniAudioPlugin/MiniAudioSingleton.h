@@ -7,25 +7,52 @@
 #include <Foundation/Types/UniquePtr.h>
 #include <MiniAudio/miniaudio.h>
 #include <MiniAudioPlugin/MiniAudioPluginDLL.h>
+#include <MiniAudioPlugin/Resources/MiniAudioSoundData.h>
 
 // TODO MiniAudio: Future Work
 //
 // * in MiniAudioResource Load sounds through the MA resource manager (redirect file hooks to our resource manager)
-// * then decode one sound right away and use that as a template to copy from for future sound playback
 // * Add preview playback to sound asset
 // * Add max sound size, check whether MA adds FMOD-like attenuation models
-// * skip sounds that are too far away
 
 struct ezGameApplicationExecutionEvent;
 
 struct ezMiniAudioSoundInstance
 {
   ma_sound m_Sound;
-  ma_decoder m_Decoder;
+  bool m_bSoundInitialized = false;
+
+  /// Keeps the (decoded or compressed) audio data alive while the sound plays.
+  ezSharedPtr<ezMiniAudioSoundData> m_pSoundData;
+
+  /// Reads from the shared decoded frames, used when the sound data isn't streamed.
+  ma_audio_buffer_ref m_BufferRef;
+
+  /// Only used for streamed sound data.
+  ezUniquePtr<ezMiniAudioStreamingDataSource> m_pStreamingSource;
+
   ezWorld* pWorld = nullptr;
   ezComponentHandle m_hComponent;
+  ma_sound_group* m_pGroup = nullptr;
   ezUInt16 m_uiOwnIndex;
   bool m_bInUse = false;
+
+  /// Whether the owner wants the sound to play. Only those sounds take part in voice limiting.
+  bool m_bPlaying = false;
+
+  /// Set while the sound fades out, those are left alone by the voice limiting.
+  bool m_bFadingOut = false;
+
+  /// A virtual sound is stopped to save mixing time, but its playback position keeps advancing,
+  /// so that it can continue at the right position, once it becomes audible again.
+  bool m_bVirtual = false;
+
+  /// Higher priority sounds keep their voice, when too many sounds are playing at once.
+  float m_fPriority = 1.0f;
+
+  float m_fAudibility = 0.0f;
+  double m_fVirtualCursor = 0.0;
+  ezUInt64 m_uiLengthInFrames = 0;
 };
 
 
@@ -76,6 +103,7 @@ public:
   {
     ezString m_sName;
     float m_fVolume = 1.0f;
+    ezUInt32 m_uiMaxVoices = 0;
     ezUniquePtr<ma_sound_group> m_pGroup;
   };
 
@@ -93,17 +121,35 @@ public:
 
   virtual ezResult OneShotSound(ezWorld* pWorld, ezStringView sResourceID, const ezTransform& globalPosition, float fPitch = 1.0f, float fVolume = 1.0f, bool bBlockIfNotLoaded = true) override;
 
-  ezMiniAudioSoundInstance* AllocateSoundInstance(const ezDataBuffer& audioData, ezWorld* pWorld, ezComponentHandle hComponent, ma_sound_group* pGroup);
+  ezMiniAudioSoundInstance* AllocateSoundInstance(const ezSharedPtr<ezMiniAudioSoundData>& pSoundData, ezWorld* pWorld, ezComponentHandle hComponent, ma_sound_group* pGroup);
   void FreeSoundInstance(ezMiniAudioSoundInstance*& ref_pInstance);
   void DetachSoundInstance(ezMiniAudioSoundInstance*& ref_pInstance);
 
   void DetachAndFadeOutSoundInstance(ezMiniAudioSoundInstance*& ref_pInstance, ezTime fadeDuration);
 
+  /// \brief Starts or resumes playback of the sound.
+  ///
+  /// Always use this instead of ma_sound_start(), so that the voice limiting knows which sounds are supposed to be heard.
+  /// If too many sounds are playing, the sound may be virtualized during the next UpdateSound().
+  void StartSoundInstance(ezMiniAudioSoundInstance* pInstance);
+
+  /// \brief Pauses the sound at its current playback position. Use this instead of ma_sound_stop().
+  void PauseSoundInstance(ezMiniAudioSoundInstance* pInstance);
+
+  /// \brief Sets how many sounds in this group may be mixed at the same time.
+  ///
+  /// Zero means the group only uses the 'MiniAudio.MaxVoicesPerGroup' limit. The global 'MiniAudio.MaxVoices' limit always applies.
+  void SetSoundGroupMaxVoices(ezStringView sGroupName, ezUInt32 uiMaxVoices);
+
   void SoundEnded(ezMiniAudioSoundInstance* pInstance);
 
   void StopWorldSounds(ezWorld* pWorld);
 
 private:
+  void UpdateVoices();
+  void MakeVirtual(ezMiniAudioSoundInstance* pInstance);
+  void MakeReal(ezMiniAudioSoundInstance* pInstance);
+
   bool m_bInitialized = false;
   bool m_bListenerOverrideMode = false;
   ezVec3 m_vListenerPosition;
@@ -120,6 +166,9 @@ private:
     ezDeque<ezUInt32> m_FinishedInstances;
 
     ezHybridArray<SoundGroup, 4> m_SoundGroups;
+
+    ezTime m_LastVoiceUpdate;
+    ezDynamicArray<ezMiniAudioSoundInstance*> m_VoiceCandidates;
   };
 
   ezUniquePtr<Data> m_pData;
@@ -0,0 +1,420 @@
+#include <MiniAudioPlugin/MiniAudioPluginPCH.h>
+
+#include <Foundation/Configuration/CVar.h>
+#include <Foundation/Threading/AtomicInteger.h>
+#include <Foundation/Threading/DelegateTask.h>
+#include <MiniAudioPlugin/Resources/MiniAudioSoundData.h>
+
+ezCVarFloat cvar_MiniAudioStreamingThreshold("MiniAudio.StreamingThreshold", 10.0f, ezCVarFlags::Default, "Sounds longer than this (in seconds) are streamed instead of being decoded when they are loaded");
+
+namespace
+{
+  ezAtomicInteger64 s_iTotalDecodedMemory;
+  ezAtomicInteger64 s_iDecodeTimeMicroseconds;
+  ezAtomicInteger32 s_iTotalUnderruns;
+
+  /// How many seconds of audio a streamed sound keeps decoded ahead of the playback position.
+  constexpr double s_fStreamingBufferDuration = 1.0;
+
+  // layout of ezMiniAudioStreamingDataSource::m_uiWriteState
+  constexpr ezUInt64 s_uiWrittenFramesMask = (1ull << 48) - 1;
+  constexpr ezUInt64 s_uiEndOfDataBit = 1ull << 48;
+  constexpr ezUInt64 s_uiGenerationStep = 1ull << 49;
+  constexpr ezUInt64 s_uiGenerationMask = ~(s_uiGenerationStep - 1);
+} // namespace
+
+ezMiniAudioSoundData::ezMiniAudioSoundData() = default;
+
+ezMiniAudioSoundData::~ezMiniAudioSoundData()
+{
+  if (m_pDecodedFrames != nullptr)
+  {
+    s_iTotalDecodedMemory.Add(-static_cast<ezInt64>(m_uiNumDecodedFrames * m_uiNumChannels * sizeof(float)));
+
+    ma_free(m_pDecodedFrames, nullptr);
+    m_pDecodedFrames = nullptr;
+  }
+}
+
+ezResult ezMiniAudioSoundData::Initialize(ezDataBuffer&& encodedData)
+{
+  EZ_ASSERT_DEV(m_EncodedData.IsEmpty() && m_pDecodedFrames == nullptr, "Sound data is already initialized");
+
+  m_EncodedData = std::move(encodedData);
+
+  const ezTime tStart = ezTime::Now();
+
+  ma_decoder_config cfg = ma_decoder_config_init(ma_format_f32, 0, 0);
+
+  ma_decoder decoder;
+  if (ma_decoder_init_memory(m_EncodedData.GetData(), m_EncodedData.GetCount(), &cfg, &decoder) != MA_SUCCESS)
+    return EZ_FAILURE;
+
+  m_uiNumChannels = decoder.outputChannels;
+  m_uiSampleRate = decoder.outputSampleRate;
+
+  ma_uint64 uiLength = 0;
+  const bool bKnownLength = ma_decoder_get_length_in_pcm_frames(&decoder, &uiLength) == MA_SUCCESS && uiLength > 0;
+
+  EZ_MA_CHECK(ma_decoder_uninit(&decoder));
+
+  // sounds of unknown length are streamed as well, they might be arbitrarily long
+  if (!bKnownLength || uiLength > cvar_MiniAudioStreamingThreshold * m_uiSampleRate)
+    return EZ_SUCCESS;
+
+  ma_uint64 uiNumFrames = 0;
+  void* pFrames = nullptr;
+  if (ma_decode_memory(m_EncodedData.GetData(), m_EncodedData.GetCount(), &cfg, &uiNumFrames, &pFrames) != MA_SUCCESS)
+    return EZ_FAILURE;
+
+  m_pDecodedFrames = static_cast<float*>(pFrames);
+  m_uiNumDecodedFrames = uiNumFrames;
+
+  s_iTotalDecodedMemory.Add(static_cast<ezInt64>(m_uiNumDecodedFrames * m_uiNumChannels * sizeof(float)));
+  AddDecodeTime(ezTime::Now() - tStart);
+
+  // the compressed data isn't needed anymore
+  m_EncodedData.Clear();
+  m_EncodedData.Compact();
+
+  return EZ_SUCCESS;
+}
+
+ezUInt64 ezMiniAudioSoundData::GetHeapMemoryUsage() const
+{
+  return m_EncodedData.GetHeapMemoryUsage() + m_uiNumDecodedFrames * m_uiNumChannels * sizeof(float);
+}
+
+ezUInt64 ezMiniAudioSoundData::GetTotalDecodedMemory()
+{
+  return static_cast<ezUInt64>(static_cast<ezInt64>(s_iTotalDecodedMemory));
+}
+
+ezTime ezMiniAudioSoundData::GetAndResetDecodeTime()
+{
+  return ezTime::MakeFromMicroseconds(static_cast<double>(s_iDecodeTimeMicroseconds.Set(0)));
+}
+
+void ezMiniAudioSoundData::AddDecodeTime(ezTime duration)
+{
+  s_iDecodeTimeMicroseconds.Add(static_cast<ezInt64>(duration.GetMicroseconds()));
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+static ma_data_source_vtable s_StreamingDataSourceVTable;
+
+ezMiniAudioStreamingDataSource::ezMiniAudioStreamingDataSource() = default;
+
+ezMiniAudioStreamingDataSource::~ezMiniAudioStreamingDataSource()
+{
+  Deinitialize();
+}
+
+ezResult ezMiniAudioStreamingDataSource::Initialize(const ezSharedPtr<ezMiniAudioSoundData>& pSoundData)
+{
+  EZ_ASSERT_DEV(!m_bInitialized, "Streaming data source is already initialized");
+  EZ_ASSERT_DEV(pSoundData->IsStreamed(), "Sound data is not meant to be streamed");
+
+  m_pSoundData = pSoundData;
+
+  const ezDataBuffer& encodedData = m_pSoundData->GetEncodedData();
+
+  ma_decoder_config cfg = ma_decoder_config_init(ma_format_f32, 0, 0);
+  if (ma_decoder_init_memory(encodedData.GetData(), encodedData.GetCount(), &cfg, &m_Decoder) != MA_SUCCESS)
+  {
+    m_pSoundData.Clear();
+    return EZ_FAILURE;
+  }
+
+  m_uiNumChannels = m_Decoder.outputChannels;
+  m_uiSampleRate = m_Decoder.outputSampleRate;
+
+  if (ma_decoder_get_length_in_pcm_frames(&m_Decoder, &m_uiLength) != MA_SUCCESS)
+  {
+    m_uiLength = 0;
+  }
+
+  m_uiBufferFrames = static_cast<ezUInt32>(m_uiSampleRate * s_fStreamingBufferDuration);
+  m_Buffer.SetCountUninitialized(m_uiBufferFrames * m_uiNumChannels);
+
+  m_uiWriteState = 0;
+  m_uiReadFrames = 0;
+  m_uiSeekTarget = 0;
+  m_uiCursor = 0;
+  m_uiDecoderGeneration = 0;
+
+  if (s_StreamingDataSourceVTable.onRead == nullptr)
+  {
+    s_StreamingDataSourceVTable.onRead = &ezMiniAudioStreamingDataSource::OnRead;
+    s_StreamingDataSourceVTable.onSeek = &ezMiniAudioStreamingDataSource::OnSeek;
+    s_StreamingDataSourceVTable.onGetDataFormat = &ezMiniAudioStreamingDataSource::OnGetDataFormat;
+    s_StreamingDataSourceVTable.onGetCursor = &ezMiniAudioStreamingDataSource::OnGetCursor;
+    s_StreamingDataSourceVTable.onGetLength = &ezMiniAudioStreamingDataSource::OnGetLength;
+    s_StreamingDataSourceVTable.onSetLooping = &ezMiniAudioStreamingDataSource::OnSetLooping;
+    s_StreamingDataSourceVTable.flags = MA_DATA_SOURCE_SELF_MANAGED_RANGE_AND_LOOP_POINT;
+  }
+
+  ma_data_source_config dataSourceConfig = ma_data_source_config_init();
+  dataSourceConfig.vtable = &s_StreamingDataSourceVTable;
+
+  if (ma_data_source_init(&dataSourceConfig, &m_Base.m_Base) != MA_SUCCESS)
+  {
+    EZ_MA_CHECK(ma_decoder_uninit(&m_Decoder));
+    m_pSoundData.Clear();
+    return EZ_FAILURE;
+  }
+
+  m_Base.m_pOwner = this;
+  m_bInitialized = true;
+
+  m_pDecodeTask = EZ_DEFAULT_NEW(ezDelegateTask<void>, "MiniAudio Stream Decoding", ezTaskNesting::Never, ezMakeDelegate(&ezMiniAudioStreamingDataSource::DecodeChunk, this));
+
+  // fill the buffer, so that the sound can start playing right away
+  DecodeChunk();
+
+  return EZ_SUCCESS;
+}
+
+void ezMiniAudioStreamingDataSource::Deinitialize()
+{
+  if (!m_bInitialized)
+    return;
+
+  WaitForDecoding();
+  m_pDecodeTask.Clear();
+
+  ma_data_source_uninit(&m_Base.m_Base);
+  EZ_MA_CHECK(ma_decoder_uninit(&m_Decoder));
+
+  m_pSoundData.Clear();
+  m_bInitialized = false;
+}
+
+void ezMiniAudioStreamingDataSource::ScheduleDecoding()
+{
+  if (!m_bInitialized || !ezTaskSystem::IsTaskGroupFinished(m_DecodeTaskGroup))
+    return;
+
+  // no task is running, so the decoder state can be inspected safely
+  const ezUInt64 uiWriteState = m_uiWriteState;
+  const bool bNeedsSeek = (uiWriteState & s_uiGenerationMask) != m_uiDecoderGeneration;
+
+  if (!bNeedsSeek && ((uiWriteState & s_uiEndOfDataBit) != 0 || GetNumBufferedFrames(uiWriteState) > m_uiBufferFrames / 2))
+    return;
+
+  m_DecodeTaskGroup = ezTaskSystem::StartSingleTask(m_pDecodeTask, ezTaskPriority::EarlyThisFrame);
+}
+
+void ezMiniAudioStreamingDataSource::WaitForDecoding()
+{
+  ezTaskSystem::WaitForGroup(m_DecodeTaskGroup);
+}
+
+ezUInt32 ezMiniAudioStreamingDataSource::GetTotalUnderruns()
+{
+  return static_cast<ezUInt32>(s_iTotalUnderruns);
+}
+
+ezUInt32 ezMiniAudioStreamingDataSource::GetNumBufferedFrames(ezUInt64 uiWriteState) const
+{
+  // the audio thread resets the read position to the write position on a seek, so it can never be ahead
+  return static_cast<ezUInt32>((uiWriteState & s_uiWrittenFramesMask) - m_uiReadFrames);
+}
+
+void ezMiniAudioStreamingDataSource::DecodeChunk()
+{
+  const ezTime tStart = ezTime::Now();
+
+  ezUInt64 uiWriteState = m_uiWriteState;
+  const ezUInt64 uiGeneration = uiWriteState & s_uiGenerationMask;
+
+  if (uiGeneration != m_uiDecoderGeneration)
+  {
+    // the seek target is always stored before the generation is increased
+    EZ_MA_CHECK(ma_decoder_seek_to_pcm_frame(&m_Decoder, m_uiSeekTarget));
+    m_uiDecoderGeneration = uiGeneration;
+  }
+
+  const ezUInt32 uiFramesToDecode = m_uiBufferFrames - GetNumBufferedFrames(uiWriteState);
+  if (uiFramesToDecode == 0)
+    return;
+
+  const bool bLooping = m_bLooping;
+  EZ_MA_CHECK(ma_data_source_set_looping(&m_Decoder, bLooping));
+
+  // decode straight into the free part of the ring buffer, the audio thread doesn't touch it until the frames are published below
+  const ezUInt32 uiNumChannels = m_uiNumChannels;
+  const ezUInt32 uiWriteFrame = static_cast<ezUInt32>((uiWriteState & s_uiWrittenFramesMask) % m_uiBufferFrames);
+
+  ezUInt32 uiDecodedFrames = 0;
+  ma_result result = MA_SUCCESS;
+
+  while (uiDecodedFrames < uiFramesToDecode && result == MA_SUCCESS)
+  {
+    const ezUInt32 uiFrame = (uiWriteFrame + uiDecodedFrames) % m_uiBufferFrames;
+    const ezUInt32 uiNum = ezMath::Min(uiFramesToDecode - uiDecodedFrames, m_uiBufferFrames - uiFrame);
+
+    ma_uint64 uiRead = 0;
+    result = ma_data_source_read_pcm_frames(&m_Decoder, m_Buffer.GetData() + uiFrame * uiNumChannels, uiNum, &uiRead);
+    uiDecodedFrames += static_cast<ezUInt32>(uiRead);
+
+    // a looping decoder only comes up short on errors, so stop in either case
+    if (uiRead < uiNum)
+    {
+      result = MA_AT_END;
+    }
+  }
+
+  ezMiniAudioSoundData::AddDecodeTime(ezTime::Now() - tStart);
+
+  const bool bEndOfData = result != MA_SUCCESS && !m_bLooping;
+
+  // publish the frames, unless the sound was seeked in the meantime, then the next task decodes from the new position
+  // OnSetLooping() may clear the end of data flag concurrently, so retry as long as the generation matches
+  while ((uiWriteState & s_uiGenerationMask) == uiGeneration)
+  {
+    ezUInt64 uiNewState = uiWriteState + uiDecodedFrames;
+    if (bEndOfData)
+    {
+      uiNewState |= s_uiEndOfDataBit;
+    }
+
+    const ezUInt64 uiPrevState = m_uiWriteState.CompareAndSwap(uiWriteState, uiNewState);
+    if (uiPrevState == uiWriteState)
+      break;
+
+    uiWriteState = uiPrevState;
+  }
+}
+
+ma_result ezMiniAudioStreamingDataSource::OnRead(ma_data_source* pDataSource, void* pFramesOut, ma_uint64 uiFrameCount, ma_uint64* pFramesRead)
+{
+  ezMiniAudioStreamingDataSource* pThis = GetOwner(pDataSource);
+  float* pOut = static_cast<float*>(pFramesOut);
+  const ezUInt32 uiNumChannels = pThis->m_uiNumChannels;
+
+  const ezUInt64 uiWriteState = pThis->m_uiWriteState;
+  const ezUInt32 uiAvailable = pThis->GetNumBufferedFrames(uiWriteState);
+  const bool bEndOfData = (uiWriteState & s_uiEndOfDataBit) != 0;
+
+  if (uiAvailable == 0 && bEndOfData)
+  {
+    *pFramesRead = 0;
+    return MA_AT_END;
+  }
+
+  const ezUInt32 uiToCopy = static_cast<ezUInt32>(ezMath::Min<ezUInt64>(uiFrameCount, uiAvailable));
+  const ezUInt64 uiReadFrames = pThis->m_uiReadFrames;
+
+  for (ezUInt32 uiCopied = 0; uiCopied < uiToCopy;)
+  {
+    const ezUInt32 uiReadFrame = static_cast<ezUInt32>((uiReadFrames + uiCopied) % pThis->m_uiBufferFrames);
+    const ezUInt32 uiNum = ezMath::Min(uiToCopy - uiCopied, pThis->m_uiBufferFrames - uiReadFrame);
+    ezMemoryUtils::Copy(pOut + uiCopied * uiNumChannels, pThis->m_Buffer.GetData() + uiReadFrame * uiNumChannels, uiNum * uiNumChannels);
+
+    uiCopied += uiNum;
+  }
+
+  // hands the frames back to the decode task
+  pThis->m_uiReadFrames = uiReadFrames + uiToCopy;
+
+  ezUInt64 uiCursor = pThis->m_uiCursor + uiToCopy;
+  if (pThis->m_bLooping && pThis->m_uiLength > 0)
+  {
+    uiCursor %= pThis->m_uiLength;
+  }
+  pThis->m_uiCursor = uiCursor;
+
+  if (bEndOfData || uiToCopy == uiFrameCount)
+  {
+    *pFramesRead = uiToCopy;
+    return MA_SUCCESS;
+  }
+
+  // the decoder couldn't keep up, fill the rest with silence instead of ending the sound
+  pThis->m_iNumUnderruns.Increment();
+  s_iTotalUnderruns.Increment();
+
+  ezMemoryUtils::ZeroFill(pOut + uiToCopy * uiNumChannels, static_cast<size_t>((uiFrameCount - uiToCopy) * uiNumChannels));
+  *pFramesRead = uiFrameCount;
+  return MA_SUCCESS;
+}
+
+ma_result ezMiniAudioStreamingDataSource::OnSeek(ma_data_source* pDataSource, ma_uint64 uiFrameIndex)
+{
+  ezMiniAudioStreamingDataSource* pThis = GetOwner(pDataSource);
+
+  // MiniAudio seeks on the audio thread, so this never runs concurrently with OnRead()
+  pThis->m_uiSeekTarget = uiFrameIndex;
+
+  // a new generation discards whatever the decode task is currently working on
+  ezUInt64 uiWriteState = pThis->m_uiWriteState;
+  while (true)
+  {
+    const ezUInt64 uiNewState = ((uiWriteState & s_uiGenerationMask) + s_uiGenerationStep) | (uiWriteState & s_uiWrittenFramesMask);
+
+    const ezUInt64 uiPrevState = pThis->m_uiWriteState.CompareAndSwap(uiWriteState, uiNewState);
+    if (uiPrevState == uiWriteState)
+      break;
+
+    uiWriteState = uiPrevState;
+  }
+
+  // drop all buffered frames
+  pThis->m_uiReadFrames = uiWriteState & s_uiWrittenFramesMask;
+  pThis->m_uiCursor = uiFrameIndex;
+
+  return MA_SUCCESS;
+}
+
+ma_result ezMiniAudioStreamingDataSource::OnGetDataFormat(ma_data_source* pDataSource, ma_format* pFormat, ma_uint32* pChannels, ma_uint32* pSampleRate, ma_channel* pChannelMap, size_t channelMapCap)
+{
+  ezMiniAudioStreamingDataSource* pThis = GetOwner(pDataSource);
+
+  *pFormat = ma_format_f32;
+  *pChannels = pThis->m_uiNumChannels;
+  *pSampleRate = pThis->m_uiSampleRate;
+  ma_channel_map_init_standard(ma_standard_channel_map_default, pChannelMap, channelMapCap, pThis->m_uiNumChannels);
+
+  return MA_SUCCESS;
+}
+
+ma_result ezMiniAudioStreamingDataSource::OnGetCursor(ma_data_source* pDataSource, ma_uint64* pCursor)
+{
+  ezMiniAudioStreamingDataSource* pThis = GetOwner(pDataSource);
+
+  *pCursor = pThis->m_uiCursor;
+  return MA_SUCCESS;
+}
+
+ma_result ezMiniAudioStreamingDataSource::OnGetLength(ma_data_source* pDataSource, ma_uint64* pLength)
+{
+  ezMiniAudioStreamingDataSource* pThis = GetOwner(pDataSource);
+
+  *pLength = pThis->m_uiLength;
+  return pThis->m_uiLength > 0 ? MA_SUCCESS : MA_NOT_IMPLEMENTED;
+}
+
+ma_result ezMiniAudioStreamingDataSource::OnSetLooping(ma_data_source* pDataSource, ma_bool32 bIsLooping)
+{
+  ezMiniAudioStreamingDataSource* pThis = GetOwner(pDataSource);
+
+  pThis->m_bLooping = bIsLooping != MA_FALSE;
+
+  // a non-looping sound may have already decoded up to its end
+  if (pThis->m_bLooping)
+  {
+    ezUInt64 uiWriteState = pThis->m_uiWriteState;
+    while ((uiWriteState & s_uiEndOfDataBit) != 0)
+    {
+      const ezUInt64 uiPrevState = pThis->m_uiWriteState.CompareAndSwap(uiWriteState, uiWriteState & ~s_uiEndOfDataBit);
+      if (uiPrevState == uiWriteState)
+        break;
+
+      uiWriteState = uiPrevState;
+    }
+  }
+
+  return MA_SUCCESS;
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <Foundation/Threading/AtomicInteger.h>
+#include <Foundation/Threading/TaskSystem.h>
+#include <Foundation/Types/RefCounted.h>
+#include <Foundation/Types/SharedPtr.h>
+#include <Foundation/Types/VariantType.h>
+#include <MiniAudio/miniaudio.h>
+#include <MiniAudioPlugin/MiniAudioPluginDLL.h>
+
+/// \brief The audio data of one variation of an ezMiniAudioSoundResource.
+///
+/// Short sounds are decoded once when the resource is loaded and all sound instances read from the same PCM data.
+/// Sounds that are longer than 'MiniAudio.StreamingThreshold' only keep their compressed data, every instance
+/// decodes it in chunks on a worker thread through an ezMiniAudioStreamingDataSource.
+///
+/// Sound instances hold a reference, so the data stays alive until they are done playing, even if the resource gets unloaded.
+class EZ_MINIAUDIOPLUGIN_DLL ezMiniAudioSoundData : public ezRefCounted
+{
+  EZ_DISALLOW_COPY_AND_ASSIGN(ezMiniAudioSoundData);
+
+public:
+  ezMiniAudioSoundData();
+  ~ezMiniAudioSoundData();
+
+  /// \brief Takes over the compressed data and decodes it right away, unless the sound is long enough to be streamed.
+  ezResult Initialize(ezDataBuffer&& encodedData);
+
+  /// \brief Whether instances have to stream the compressed data, instead of reading the decoded frames.
+  bool IsStreamed() const { return m_pDecodedFrames == nullptr; }
+
+  /// \brief The compressed data. Only kept for streamed sounds.
+  const ezDataBuffer& GetEncodedData() const { return m_EncodedData; }
+
+  /// \brief The decoded frames in ma_format_f32. Only available for sounds that are not streamed.
+  const float* GetDecodedFrames() const { return m_pDecodedFrames; }
+  ezUInt64 GetNumDecodedFrames() const { return m_uiNumDecodedFrames; }
+  ezUInt32 GetNumChannels() const { return m_uiNumChannels; }
+  ezUInt32 GetSampleRate() const { return m_uiSampleRate; }
+
+  ezUInt64 GetHeapMemoryUsage() const;
+
+  /// \brief Returns the amount of decoded PCM data of all sounds in bytes.
+  static ezUInt64 GetTotalDecodedMemory();
+
+  /// \brief Returns how much time was spent decoding since the last call, both for decoding whole sounds and for streaming.
+  static ezTime GetAndResetDecodeTime();
+
+  static void AddDecodeTime(ezTime duration);
+
+private:
+  ezDataBuffer m_EncodedData;
+  float* m_pDecodedFrames = nullptr;
+  ezUInt64 m_uiNumDecodedFrames = 0;
+  ezUInt32 m_uiNumChannels = 0;
+  ezUInt32 m_uiSampleRate = 0;
+};
+
+/// \brief A MiniAudio data source that decodes a streamed ezMiniAudioSoundData in chunks on a worker thread.
+///
+/// The audio thread only copies already decoded frames out of a small ring buffer. ezMiniAudioSingleton::UpdateSound() calls
+/// ScheduleDecoding() every frame, which refills the buffer through a task once it runs low. Should the buffer run empty anyway,
+/// silence is played instead of stalling the mixer and the underrun is counted.
+///
+/// The ring buffer has exactly one writer (the decode task) and one reader (the audio thread) and uses no locks, so neither side ever waits for the other.
+///
+/// Looping is handled by the decoder itself, so loops are seamless.
+class EZ_MINIAUDIOPLUGIN_DLL ezMiniAudioStreamingDataSource
+{
+  EZ_DISALLOW_COPY_AND_ASSIGN(ezMiniAudioStreamingDataSource);
+
+public:
+  ezMiniAudioStreamingDataSource();
+  ~ezMiniAudioStreamingDataSource();
+
+  /// \brief Creates the decoder and decodes the first chunk right away, so that playback can start immediately.
+  ezResult Initialize(const ezSharedPtr<ezMiniAudioSoundData>& pSoundData);
+
+  /// \brief Waits for a running decode task and releases the decoder.
+  void Deinitialize();
+
+  /// \brief The data source to pass to ma_sound_init_from_data_source().
+  ma_data_source* GetDataSource() { return &m_Base.m_Base; }
+
+  /// \brief Starts a decode task, if the buffer is less than half full and no task is running yet.
+  void ScheduleDecoding();
+
+  /// \brief Blocks until a running decode task has finished.
+  void WaitForDecoding();
+
+  /// \brief How often the audio thread found fewer decoded frames than it needed and had to play silence.
+  ezUInt32 GetNumUnderruns() const { return static_cast<ezUInt32>(m_iNumUnderruns); }
+
+  /// \brief Returns the number of underruns of all streamed sounds so far.
+  static ezUInt32 GetTotalUnderruns();
+
+private:
+  static ma_result OnRead(ma_data_source* pDataSource, void* pFramesOut, ma_uint64 uiFrameCount, ma_uint64* pFramesRead);
+  static ma_result OnSeek(ma_data_source* pDataSource, ma_uint64 uiFrameIndex);
+  static ma_result OnGetDataFormat(ma_data_source* pDataSource, ma_format* pFormat, ma_uint32* pChannels, ma_uint32* pSampleRate, ma_channel* pChannelMap, size_t channelMapCap);
+  static ma_result OnGetCursor(ma_data_source* pDataSource, ma_uint64* pCursor);
+  static ma_result OnGetLength(ma_data_source* pDataSource, ma_uint64* pLength);
+  static ma_result OnSetLooping(ma_data_source* pDataSource, ma_bool32 bIsLooping);
+
+  static ezMiniAudioStreamingDataSource* GetOwner(ma_data_source* pDataSource) { return static_cast<Base*>(pDataSource)->m_pOwner; }
+
+  void DecodeChunk();
+  ezUInt32 GetNumBufferedFrames(ezUInt64 uiWriteState) const;
+
+  struct Base
+  {
+    ma_data_source_base m_Base; // must be the first member
+    ezMiniAudioStreamingDataSource* m_pOwner = nullptr;
+  };
+
+  Base m_Base;
+  bool m_bInitialized = false;
+
+  ezSharedPtr<ezMiniAudioSoundData> m_pSoundData;
+  ma_decoder m_Decoder;
+  ezUInt32 m_uiNumChannels = 0;
+  ezUInt32 m_uiSampleRate = 0;
+  ezUInt64 m_uiLength = 0;
+
+  ezSharedPtr<ezTask> m_pDecodeTask;
+  ezTaskGroupID m_DecodeTaskGroup;
+  ezUInt64 m_uiDecoderGeneration = 0; ///< The generation that the decoder position belongs to. Only accessed by the decode task.
+
+  ezDynamicArray<float> m_Buffer;
+  ezUInt32 m_uiBufferFrames = 0;
+
+  // Packs everything that the decode task publishes, so that a seek can invalidate it with one atomic operation:
+  // the total number of frames written to the buffer, whether the end of the data was reached, and a generation that every seek increases.
+  ezAtomicInteger<ezUInt64> m_uiWriteState;
+  ezAtomicInteger<ezUInt64> m_uiReadFrames; ///< The total number of frames that the audio thread took out of the buffer.
+  ezAtomicInteger<ezUInt64> m_uiSeekTarget; ///< Written before the generation is increased, so the decode task always sees the latest target.
+  ezAtomicInteger<ezUInt64> m_uiCursor;
+  ezAtomicBool m_bLooping;
+  ezAtomicInteger32 m_iNumUnderruns;
+};
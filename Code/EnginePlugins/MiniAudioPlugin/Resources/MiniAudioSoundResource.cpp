@@ -18,12 +18,12 @@ ezMiniAudioSoundResource::ezMiniAudioSoundResource()
 
 ezMiniAudioSoundResource::~ezMiniAudioSoundResource() = default;
 
-const ezDataBuffer& ezMiniAudioSoundResource::GetAudioData() const
+const ezSharedPtr<ezMiniAudioSoundData>& ezMiniAudioSoundResource::GetAudioData() const
 {
   return m_AudioData[0];
 }
 
-const ezDataBuffer& ezMiniAudioSoundResource::GetAudioData(ezRandom& ref_rng) const
+const ezSharedPtr<ezMiniAudioSoundData>& ezMiniAudioSoundResource::GetAudioData(ezRandom& ref_rng) const
 {
   return m_AudioData[ref_rng.UInt32Index(m_AudioData.GetCount())];
 }
@@ -66,9 +66,10 @@ ezMiniAudioSoundInstance* ezMiniAudioSoundResource::InstantiateSound(ezRandom* p
     pInstance = pMA->AllocateSoundInstance(GetAudioData(), pWorld, hComponent, pGroup);
   }
 
+  if (pInstance == nullptr)
+    return nullptr;
 
-
-  EZ_MA_CHECK(ma_data_source_set_looping(&pInstance->m_Decoder, GetLoop()));
+  ma_sound_set_looping(&pInstance->m_Sound, GetLoop());
 
   ma_sound_set_min_distance(&pInstance->m_Sound, GetMinDistance());
   // ma_sound_set_max_distance(&pInstance->m_Sound, GetMaxDistance());
@@ -150,12 +151,23 @@ ezResourceLoadDesc ezMiniAudioSoundResource::UpdateContent(ezStreamReader* pStre
     ezUInt32 uiFileSize = 0;
     *pStream >> uiFileSize;
 
-    m_AudioData[i].SetCountUninitialized(uiFileSize);
-    if (pStream->ReadBytes(m_AudioData[i].GetData(), uiFileSize) != uiFileSize)
+    ezDataBuffer encodedData;
+    encodedData.SetCountUninitialized(uiFileSize);
+    if (pStream->ReadBytes(encodedData.GetData(), uiFileSize) != uiFileSize)
     {
       res.m_State = ezResourceState::LoadedResourceMissing;
       return res;
     }
+
+    // short sounds get decoded here once, on the loading thread, instead of every time they are played
+    m_AudioData[i] = EZ_DEFAULT_NEW(ezMiniAudioSoundData);
+    if (m_AudioData[i]->Initialize(std::move(encodedData)).Failed())
+    {
+      ezLog::Error("Failed to decode audio file {} of '{}'", i, sAbsFilePath);
+
+      res.m_State = ezResourceState::LoadedResourceMissing;
+      return res;
+    }
   }
 
   if (uiVersion >= 2)
@@ -175,7 +187,10 @@ void ezMiniAudioSoundResource::UpdateMemoryUsage(MemoryUsage& out_NewMemoryUsage
 
   for (const auto& data : m_AudioData)
   {
-    out_NewMemoryUsage.m_uiMemoryCPU += data.GetHeapMemoryUsage();
+    if (data != nullptr)
+    {
+      out_NewMemoryUsage.m_uiMemoryCPU += data->GetHeapMemoryUsage();
+    }
   }
 
   out_NewMemoryUsage.m_uiMemoryGPU = 0;
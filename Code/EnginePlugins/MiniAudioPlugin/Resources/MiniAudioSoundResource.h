@@ -2,6 +2,7 @@
 
 #include <Core/ResourceManager/Resource.h>
 #include <MiniAudioPlugin/MiniAudioPluginDLL.h>
+#include <MiniAudioPlugin/Resources/MiniAudioSoundData.h>
 
 class ezRandom;
 
@@ -21,8 +22,8 @@ public:
   ezMiniAudioSoundResource();
   ~ezMiniAudioSoundResource();
 
-  const ezDataBuffer& GetAudioData() const;
-  const ezDataBuffer& GetAudioData(ezRandom& ref_rng) const;
+  const ezSharedPtr<ezMiniAudioSoundData>& GetAudioData() const;
+  const ezSharedPtr<ezMiniAudioSoundData>& GetAudioData(ezRandom& ref_rng) const;
 
   bool GetLoop() const { return m_bLoop; }
   float GetVolume(ezRandom& ref_rng) const;
@@ -42,7 +43,7 @@ private:
   virtual void UpdateMemoryUsage(MemoryUsage& out_NewMemoryUsage) override;
 
 private:
-  ezHybridArray<ezDataBuffer, 1> m_AudioData;
+  ezHybridArray<ezSharedPtr<ezMiniAudioSoundData>, 1> m_AudioData;
 
   ezString m_sSoundGroup;
   bool m_bLoop = false;
@@ -0,0 +1,250 @@
+#include <FileservePlugin/Client/FileserveClient.h>
+#include <FileservePlugin/Fileserver/Fileserver.h>
+#include <Foundation/Application/Application.h>
+#include <Foundation/Configuration/Startup.h>
+#include <Foundation/IO/FileSystem/FileReader.h>
+#include <Foundation/IO/FileSystem/FileSystem.h>
+#include <Foundation/IO/OSFile.h>
+#include <Foundation/Logging/ConsoleWriter.h>
+#include <Foundation/Logging/Log.h>
+#include <Foundation/Logging/VisualStudioWriter.h>
+#include <Foundation/System/Process.h>
+#include <Foundation/Threading/ThreadUtils.h>
+#include <Foundation/Time/Stopwatch.h>
+#include <Foundation/Utilities/CommandLineOptions.h>
+
+/* FileserveBenchmark command line options:
+
+-dir <path>
+    The folder whose files are transferred. All files in it (recursively) are requested by the client.
+
+-port <number>
+    The port that the local file server uses. Defaults to 1043, to not interfere with a running Fileserve instance.
+
+Description:
+    Measures how long it takes to transfer a folder through fileserve over the loopback interface.
+    The tool starts a second instance of itself as the file server and then transfers all files three times:
+      1. with an empty cache, one file at a time, the way regular file accesses request them
+      2. with an empty cache, all files prefetched through ezFileserveClient::PrefetchFiles()
+      3. with a filled cache, all files prefetched, so only timestamps and hashes are compared
+
+Example:
+    ezFileserveBenchmark.exe -dir "C:/ez/Data/Base"
+*/
+
+ezCommandLineOptionPath opt_Dir("_FileserveBenchmark", "-dir", "The folder whose files are transferred.", "");
+
+ezCommandLineOptionInt opt_Port("_FileserveBenchmark", "-port", "The port that the local file server uses.", 1043, 1, 0xFFFF);
+
+ezCommandLineOptionBool opt_Server("_FileserveBenchmark", "-server", "[internal] Runs as the file server for the benchmark.", false);
+
+class ezFileserveBenchmark : public ezApplication
+{
+public:
+  using SUPER = ezApplication;
+
+  ezFileserveBenchmark()
+    : ezApplication("FileserveBenchmark")
+  {
+  }
+
+  virtual ezResult BeforeCoreSystemsStartup() override
+  {
+    // prevents the fileserve plugin from creating and connecting a client on its own
+    ezStartup::AddApplicationTag("tool");
+
+    return SUPER::BeforeCoreSystemsStartup();
+  }
+
+  virtual void AfterCoreSystemsStartup() override
+  {
+    ezGlobalLog::AddLogWriter(ezLogWriter::Console::LogMessageHandler);
+    ezGlobalLog::AddLogWriter(ezLogWriter::VisualStudio::LogMessageHandler);
+  }
+
+  virtual void BeforeCoreSystemsShutdown() override
+  {
+    // prevent further output during shutdown
+    ezGlobalLog::RemoveLogWriter(ezLogWriter::Console::LogMessageHandler);
+    ezGlobalLog::RemoveLogWriter(ezLogWriter::VisualStudio::LogMessageHandler);
+
+    SUPER::BeforeCoreSystemsShutdown();
+  }
+
+  void RunServer()
+  {
+    // the server reads the requested files through absolute paths
+    ezFileSystem::AddDataDirectory("", "App", ":", ezDataDirUsage::AllowWrites).IgnoreResult();
+    ezFileSystem::SetSpecialDirectory("benchmark", m_sDirectory);
+
+    ezFileserver server;
+    server.SetPort(static_cast<ezUInt16>(opt_Port.GetOptionValue(ezCommandLineOption::LogMode::Never)));
+    server.StartServer();
+
+    // the client process terminates us, once it is done
+    while (true)
+    {
+      if (!server.UpdateServer())
+      {
+        ezThreadUtils::Sleep(ezTime::MakeFromMilliseconds(1));
+      }
+    }
+  }
+
+  ezResult GatherFiles()
+  {
+    ezFileSystemIterator it;
+    it.StartSearch(m_sDirectory, ezFileSystemIteratorFlags::ReportFilesRecursive);
+
+    ezStringBuilder sPath;
+    for (; it.IsValid(); it.Next())
+    {
+      it.GetStats().GetFullPath(sPath);
+      sPath.MakeRelativeTo(m_sDirectory).IgnoreResult();
+
+      m_Files.PushBack(sPath);
+      m_uiTotalSize += it.GetStats().m_uiFileSize;
+    }
+
+    if (m_Files.IsEmpty())
+    {
+      ezLog::Error("No files found in '{}'", m_sDirectory);
+      return EZ_FAILURE;
+    }
+
+    ezLog::Info("Transferring {} files, {}", m_Files.GetCount(), ezArgFileSize(m_uiTotalSize));
+    return EZ_SUCCESS;
+  }
+
+  ezResult RunPass(const char* szName, bool bClearCache, bool bPrefetch)
+  {
+    // the application ID of a connection is based on the current time in seconds,
+    // a new client must not get the same ID as the previous one, otherwise the server treats it as a reconnect of the old one
+    ezThreadUtils::Sleep(ezTime::MakeFromSeconds(1.1));
+
+    ezFileserveClient client;
+    client.AddServerAddressToTry(m_sServerAddress);
+
+    if (client.EnsureConnected(ezTime::MakeFromSeconds(10)).Failed())
+      return EZ_FAILURE;
+
+    EZ_SUCCEED_OR_RETURN(ezFileSystem::AddDataDirectory(">benchmark/", "Benchmark", "bench"));
+
+    if (bClearCache)
+    {
+      // without the cached data, the meta files are ignored and every file is transferred completely
+      ezOSFile::DeleteFolder(ezFileSystem::FindDataDirectoryWithRoot("bench")->m_pDataDirType->GetRedirectedDataDirectoryPath()).IgnoreResult();
+    }
+
+    ezStopwatch sw;
+
+    if (bPrefetch)
+    {
+      client.PrefetchFiles(m_Files);
+    }
+
+    const ezTime tRequests = sw.Checkpoint();
+
+    ezUInt64 uiBytesRead = 0;
+    ezUInt32 uiFilesFailed = 0;
+    ezDynamicArray<ezUInt8> content;
+
+    for (const ezString& sFile : m_Files)
+    {
+      ezFileReader file;
+      if (file.Open(sFile).Failed())
+      {
+        ++uiFilesFailed;
+        continue;
+      }
+
+      content.SetCountUninitialized(static_cast<ezUInt32>(file.GetFileSize()));
+      uiBytesRead += file.ReadBytes(content.GetData(), content.GetCount());
+    }
+
+    const ezTime tReads = sw.Checkpoint();
+
+    ezFileSystem::RemoveDataDirectoryGroup("Benchmark");
+
+    ezLog::Info("{}: {} total (prefetch {}, reads {}), {} / s, {} files failed", szName, tRequests + tReads, tRequests, tReads,
+      ezArgFileSize(static_cast<ezUInt64>(uiBytesRead / ezMath::Max((tRequests + tReads).GetSeconds(), 0.001))), uiFilesFailed);
+
+    return uiFilesFailed == 0 ? EZ_SUCCESS : EZ_FAILURE;
+  }
+
+  ezResult RunClient()
+  {
+    EZ_SUCCEED_OR_RETURN(GatherFiles());
+
+    const ezInt32 iPort = opt_Port.GetOptionValue(ezCommandLineOption::LogMode::Always);
+    m_sServerAddress.SetFormat("localhost:{}", iPort);
+
+    ezProcessOptions opt;
+    opt.m_sProcess = ezOSFile::GetApplicationPath();
+    opt.AddArgument("-server");
+    opt.AddArgument("-dir");
+    opt.AddArgument(m_sDirectory);
+    opt.AddArgument("-port");
+    opt.AddArgument("{}", iPort);
+
+    ezProcess server;
+    EZ_SUCCEED_OR_RETURN(server.Launch(opt));
+
+    ezResult res = EZ_SUCCESS;
+
+    if (RunPass("Cold cache, one file at a time", true, false).Failed() ||
+        RunPass("Cold cache, pipelined", true, true).Failed() ||
+        RunPass("Warm cache, pipelined", false, true).Failed())
+    {
+      res = EZ_FAILURE;
+    }
+
+    server.Terminate().IgnoreResult();
+    return res;
+  }
+
+  virtual void Run() override
+  {
+    {
+      ezStringBuilder cmdHelp;
+      if (ezCommandLineOption::LogAvailableOptionsToBuffer(cmdHelp, ezCommandLineOption::LogAvailableModes::IfHelpRequested, "_FileserveBenchmark"))
+      {
+        ezLog::Print(cmdHelp);
+        RequestApplicationQuit();
+        return;
+      }
+    }
+
+    m_sDirectory = opt_Dir.GetOptionValue(ezCommandLineOption::LogMode::Never);
+
+    if (!ezOSFile::ExistsDirectory(m_sDirectory))
+    {
+      ezLog::Error("-dir is not a valid directory: '{}'", m_sDirectory);
+      SetReturnCode(1);
+      RequestApplicationQuit();
+      return;
+    }
+
+    if (opt_Server.GetOptionValue(ezCommandLineOption::LogMode::Never))
+    {
+      RunServer();
+      return;
+    }
+
+    if (RunClient().Failed())
+    {
+      ezLog::Error("Fileserve benchmark failed");
+      SetReturnCode(2);
+    }
+
+    RequestApplicationQuit();
+  }
+
+private:
+  ezString m_sDirectory;
+  ezStringBuilder m_sServerAddress;
+  ezDynamicArray<ezString> m_Files;
+  ezUInt64 m_uiTotalSize = 0;
+};
+
+EZ_APPLICATION_ENTRY_POINT(ezFileserveBenchmark);
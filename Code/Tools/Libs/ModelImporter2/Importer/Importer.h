@@ -52,6 +52,9 @@ namespace ezModelImporter2
     ezUInt8 m_uiMaxSimplificationError = 5;
     bool m_bAggressiveSimplification = false;
 
+    // splits the mesh into small clusters that the renderer can cull individually
+    bool m_bBuildClusters = false;
+
     // Adjustments to deal with bad data:
     float m_fAnimationPositionScale = 1.0f;
   };
@@ -130,6 +130,11 @@ namespace ezModelImporter2
           // do not return failure here, because we can still continue
         }
       }
+
+      if (m_Options.m_bBuildClusters)
+      {
+        m_Options.m_pMeshOutput->BuildClusters();
+      }
     }
 
     if (m_pScene->mNumTextures > 0 && m_pScene->mTextures)
@@ -148,6 +148,11 @@ namespace ezModelImporter2
     m_Options.m_pMeshOutput->AddSubMesh(indices.GetCount() / 3, 0, 0);
     m_Options.m_pMeshOutput->ComputeBounds();
 
+    if (m_Options.m_bBuildClusters)
+    {
+      m_Options.m_pMeshOutput->BuildClusters();
+    }
+
     return EZ_SUCCESS;
   }
 } // namespace ezModelImporter2
@@ -92,6 +92,14 @@ ezCommandLineOptionEnum opt_Type("_TexConv", "-type", "The type of output to gen
 
 ezCommandLineOptionEnum opt_Compression("_TexConv", "-compression", "Compression strength for output format.", "Medium = 1 | High = 2 | None = 0", 1);
 
+ezCommandLineOptionEnum opt_Encoding("_TexConv", "-encoding", "Speed vs. quality trade-off of the encoder for compressed output formats.\n\
+Fast is meant for previews and iteration builds.",
+  "Final = 1 | Fast = 0", 1);
+
+ezCommandLineOptionFloat opt_RdoLambda("_TexConv", "-rdoLambda", "Rate-distortion optimization strength for compressed output formats. 0 disables RDO.\n\
+Larger values trade quality for better compressibility of the output, e.g. in compressed archives. Currently only used for BC7.",
+  0.0f, 0.0f, 10.0f);
+
 ezCommandLineOptionEnum opt_Usage("_TexConv", "-usage", "What type of data the image contains. Affects which final output format is used and how mipmaps are generated.", "Auto = 0 | Color = 1 | Linear = 2 | HDR = 3 | NormalMap = 4 | NormalMap_Inverted = 5 | BumpMap = 6", 0);
 
 ezCommandLineOptionEnum opt_Mipmaps("_TexConv", "-mipmaps", "Whether to generate mipmaps and with which algorithm.", "None = 0 |Linear = 1 | Kaiser = 2", 1);
@@ -419,6 +427,15 @@ ezResult ezTexConv::ParseCompressionMode()
   const ezInt32 value = opt_Compression.GetOptionValue(ezCommandLineOption::LogMode::Always);
 
   m_Processor.m_Descriptor.m_CompressionMode = static_cast<ezTexConvCompressionMode::Enum>(value);
+
+  if (m_Processor.m_Descriptor.m_CompressionMode != ezTexConvCompressionMode::None)
+  {
+    const ezInt32 encoding = opt_Encoding.GetOptionValue(ezCommandLineOption::LogMode::AlwaysIfSpecified);
+    m_Processor.m_Descriptor.m_CompressionSettings.m_Quality = static_cast<ezImageCompressionQuality::Enum>(encoding);
+
+    m_Processor.m_Descriptor.m_CompressionSettings.m_fRdoLambda = opt_RdoLambda.GetOptionValue(ezCommandLineOption::LogMode::AlwaysIfSpecified);
+  }
+
   return EZ_SUCCESS;
 }
 
@@ -229,6 +229,8 @@ void ezTexConv::Run()
 
     SetReturnCode(0);
 
+    ezLog::Info("MSE: {}, PSNR: {} dB", m_Comparer.m_OutputMSE, ezArgF(m_Comparer.m_fOutputPSNR, 2));
+
     if (m_Comparer.m_bExceededMSE)
     {
       SetReturnCode(m_Comparer.m_OutputMSE);
@@ -0,0 +1,152 @@
+#include <CoreTest/CoreTestPCH.h>
+
+#include <Core/Collection/CollectionUtils.h>
+#include <Foundation/IO/MemoryStream.h>
+
+EZ_CREATE_SIMPLE_TEST_GROUP(Collection);
+
+namespace
+{
+  void AddEntry(ezCollectionResourceDescriptor& ref_desc, ezStringView sID, std::initializer_list<ezUInt32> dependencies)
+  {
+    ezCollectionEntry& entry = ref_desc.m_Resources.ExpandAndGetRef();
+    entry.m_sResourceID = sID;
+    entry.m_sAssetTypeName.Assign("Test");
+    entry.m_uiFileSize = 16;
+
+    for (ezUInt32 uiDependency : dependencies)
+    {
+      entry.m_Dependencies.PushBack(uiDependency);
+    }
+  }
+
+  ezUInt32 FindEntry(const ezCollectionResourceDescriptor& desc, ezStringView sID)
+  {
+    for (ezUInt32 i = 0; i < desc.m_Resources.GetCount(); ++i)
+    {
+      if (desc.m_Resources[i].m_sResourceID == sID)
+        return i;
+    }
+
+    return ezInvalidIndex;
+  }
+
+  bool IsSorted(const ezCollectionResourceDescriptor& desc)
+  {
+    for (ezUInt32 i = 0; i < desc.m_Resources.GetCount(); ++i)
+    {
+      for (ezUInt32 uiDependency : desc.m_Resources[i].m_Dependencies)
+      {
+        if (uiDependency >= i)
+          return false;
+      }
+    }
+
+    return true;
+  }
+} // namespace
+
+EZ_CREATE_SIMPLE_TEST(Collection, CollectionUtils)
+{
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "SortByDependencies")
+  {
+    // Mesh -> Material -> Texture, Mesh -> Texture
+    ezCollectionResourceDescriptor desc;
+    AddEntry(desc, "Mesh", {1, 2});
+    AddEntry(desc, "Material", {2});
+    AddEntry(desc, "Texture", {});
+    AddEntry(desc, "Sound", {});
+
+    ezCollectionUtils::SortByDependencies(desc);
+
+    EZ_TEST_BOOL(IsSorted(desc));
+    EZ_TEST_STRING(desc.m_Resources[0].m_sResourceID, "Texture");
+    EZ_TEST_STRING(desc.m_Resources[1].m_sResourceID, "Sound");
+    EZ_TEST_STRING(desc.m_Resources[2].m_sResourceID, "Material");
+    EZ_TEST_STRING(desc.m_Resources[3].m_sResourceID, "Mesh");
+
+    EZ_TEST_INT(desc.m_Resources[3].m_Dependencies.GetCount(), 2);
+    EZ_TEST_INT(desc.m_Resources[3].m_Dependencies[0], 0);
+    EZ_TEST_INT(desc.m_Resources[3].m_Dependencies[1], 2);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "SortByDependencies - Cycle")
+  {
+    ezCollectionResourceDescriptor desc;
+    AddEntry(desc, "A", {1});
+    AddEntry(desc, "B", {2});
+    AddEntry(desc, "C", {0});
+
+    ezCollectionUtils::SortByDependencies(desc);
+
+    EZ_TEST_INT(desc.m_Resources.GetCount(), 3);
+    EZ_TEST_BOOL(IsSorted(desc));
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "MergeCollections")
+  {
+    ezCollectionResourceDescriptor desc1;
+    AddEntry(desc1, "Material", {1});
+    AddEntry(desc1, "Texture", {});
+
+    ezCollectionResourceDescriptor desc2;
+    AddEntry(desc2, "Mesh", {1});
+    AddEntry(desc2, "Material", {});
+
+    const ezCollectionResourceDescriptor* inputs[] = {&desc1, &desc2};
+
+    ezCollectionResourceDescriptor result;
+    ezCollectionUtils::MergeCollections(result, inputs);
+
+    EZ_TEST_INT(result.m_Resources.GetCount(), 3);
+    EZ_TEST_BOOL(IsSorted(result));
+
+    const ezUInt32 uiMesh = FindEntry(result, "Mesh");
+    const ezUInt32 uiMaterial = FindEntry(result, "Material");
+    const ezUInt32 uiTexture = FindEntry(result, "Texture");
+
+    EZ_TEST_BOOL(uiTexture < uiMaterial && uiMaterial < uiMesh);
+    EZ_TEST_INT(result.m_Resources[uiMesh].m_Dependencies.GetCount(), 1);
+    EZ_TEST_INT(result.m_Resources[uiMesh].m_Dependencies[0], uiMaterial);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "MergeCollections - Invalid Dependency")
+  {
+    ezCollectionResourceDescriptor desc;
+    AddEntry(desc, "Material", {5, 1});
+    AddEntry(desc, "Texture", {});
+
+    const ezCollectionResourceDescriptor* inputs[] = {&desc};
+
+    ezCollectionResourceDescriptor result;
+    ezCollectionUtils::MergeCollections(result, inputs);
+
+    EZ_TEST_INT(result.m_Resources.GetCount(), 2);
+    EZ_TEST_BOOL(IsSorted(result));
+
+    const ezUInt32 uiMaterial = FindEntry(result, "Material");
+    EZ_TEST_INT(result.m_Resources[uiMaterial].m_Dependencies.GetCount(), 1);
+    EZ_TEST_INT(result.m_Resources[uiMaterial].m_Dependencies[0], FindEntry(result, "Texture"));
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Save / Load")
+  {
+    ezCollectionResourceDescriptor desc;
+    AddEntry(desc, "Texture", {});
+    AddEntry(desc, "Material", {0});
+
+    ezDefaultMemoryStreamStorage storage;
+    ezMemoryStreamWriter writer(&storage);
+    desc.Save(writer);
+
+    ezMemoryStreamReader reader(&storage);
+    ezCollectionResourceDescriptor loaded;
+    loaded.Load(reader);
+
+    EZ_TEST_INT(loaded.m_Resources.GetCount(), 2);
+    EZ_TEST_STRING(loaded.m_Resources[1].m_sResourceID, "Material");
+    EZ_TEST_INT(loaded.m_Resources[1].m_uiFileSize, 16);
+    EZ_TEST_INT(loaded.m_Resources[1].m_Dependencies.GetCount(), 1);
+    EZ_TEST_INT(loaded.m_Resources[1].m_Dependencies[0], 0);
+  }
+}
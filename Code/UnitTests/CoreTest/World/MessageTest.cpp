@@ -43,6 +43,18 @@ namespace
   EZ_END_DYNAMIC_REFLECTED_TYPE;
   // clang-format on
 
+  // no component type has a dedicated handler for this message
+  struct TestMessage3 : public ezMsgTest
+  {
+    EZ_DECLARE_MESSAGE_TYPE(TestMessage3, ezMsgTest);
+  };
+
+  // clang-format off
+  EZ_IMPLEMENT_MESSAGE_TYPE(TestMessage3);
+  EZ_BEGIN_DYNAMIC_REFLECTED_TYPE(TestMessage3, 1, ezRTTIDefaultAllocator<TestMessage3>)
+  EZ_END_DYNAMIC_REFLECTED_TYPE;
+  // clang-format on
+
   class TestComponentMsg;
   using TestComponentMsgManager = ezComponentManager<TestComponentMsg, ezBlockStorageType::FreeList>;
 
@@ -80,6 +92,35 @@ namespace
   EZ_END_COMPONENT_TYPE;
   // clang-format on
 
+  class TestComponentUnhandledMsg;
+  using TestComponentUnhandledMsgManager = ezComponentManager<TestComponentUnhandledMsg, ezBlockStorageType::FreeList>;
+
+  class TestComponentUnhandledMsg : public ezComponent
+  {
+    EZ_DECLARE_COMPONENT_TYPE(TestComponentUnhandledMsg, ezComponent, TestComponentUnhandledMsgManager);
+
+  public:
+    virtual void Initialize() override { EnableUnhandledMessageHandler(true); }
+
+    virtual bool OnUnhandledMessage(ezMessage& msg, bool bWasPostedMsg) override
+    {
+      if (bWasPostedMsg && msg.IsInstanceOf<TestMessage3>())
+      {
+        ++m_uiNumUnhandledMessages;
+        return true;
+      }
+
+      return false;
+    }
+
+    ezUInt32 m_uiNumUnhandledMessages = 0;
+  };
+
+  // clang-format off
+  EZ_BEGIN_COMPONENT_TYPE(TestComponentUnhandledMsg, 1, ezComponentMode::Static)
+  EZ_END_COMPONENT_TYPE;
+  // clang-format on
+
   void ResetComponents(ezGameObject& ref_object)
   {
     TestComponentMsg* pComponent = nullptr;
@@ -198,6 +239,68 @@ EZ_CREATE_SIMPLE_TEST(World, Messaging)
     ezFrameAllocator::Reset();
   }
 
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Queuing to components")
+  {
+    ResetComponents(*pRoot);
+
+    // nobody handles this message yet, it is dropped without being delivered
+    {
+      TestMessage3 msg;
+      pRoot->PostMessageRecursive(msg, ezTime::MakeZero(), ezObjectMsgQueueType::NextFrame);
+    }
+
+    ezDynamicArray<TestComponentMsg*> components;
+    for (auto it = pManager->GetComponents(); it.IsValid(); ++it)
+    {
+      components.PushBack(it);
+    }
+
+    // interleave the message types, the world delivers them grouped by message and component type
+    for (ezUInt32 i = 0; i < 3; ++i)
+    {
+      for (TestComponentMsg* pComp : components)
+      {
+        TestMessage1 msg;
+        msg.m_iValue = i;
+        pComp->PostMessage(msg, ezTime::MakeZero(), ezObjectMsgQueueType::NextFrame);
+
+        TestMessage2 msg2;
+        msg2.m_iValue = i;
+        pComp->PostMessage(msg2, ezTime::MakeZero(), ezObjectMsgQueueType::NextFrame);
+      }
+    }
+
+    world.Update();
+
+    bool bAllReceived = true;
+    for (TestComponentMsg* pComp : components)
+    {
+      bAllReceived &= pComp->m_iSomeData == 4;
+      bAllReceived &= pComp->m_iSomeData2 == 8;
+    }
+    EZ_TEST_BOOL(bAllReceived);
+
+    // a component with an unhandled message handler still receives messages its type has no handler for
+    TestComponentUnhandledMsg* pUnhandledComponent = nullptr;
+    TestComponentUnhandledMsg::CreateComponent(pParents[1], pUnhandledComponent);
+
+    world.Update();
+
+    {
+      TestMessage3 msg;
+      pRoot->PostMessageRecursive(msg, ezTime::MakeZero(), ezObjectMsgQueueType::NextFrame);
+      pUnhandledComponent->PostMessage(msg, ezTime::MakeZero(), ezObjectMsgQueueType::NextFrame);
+    }
+
+    world.Update();
+
+    EZ_TEST_INT(pUnhandledComponent->m_uiNumUnhandledMessages, 2);
+
+    pUnhandledComponent->GetOwningManager()->DeleteComponent(pUnhandledComponent);
+
+    ezFrameAllocator::Reset();
+  }
+
   EZ_TEST_BLOCK(ezTestBlock::Enabled, "Queuing with delay")
   {
     ResetComponents(*pRoot);
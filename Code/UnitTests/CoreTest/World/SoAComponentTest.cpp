@@ -0,0 +1,151 @@
+#include <CoreTest/CoreTestPCH.h>
+
+#include <Core/World/World.h>
+
+namespace
+{
+  class TestSoAComponent;
+
+  // hot fields: speed, angle, active flag
+  class TestSoAComponentManager : public ezComponentManagerSoA<TestSoAComponent, float, float, ezUInt8>
+  {
+  public:
+    TestSoAComponentManager(ezWorld* pWorld)
+      : ezComponentManagerSoA<TestSoAComponent, float, float, ezUInt8>(pWorld)
+    {
+    }
+
+    virtual void Initialize() override
+    {
+      auto desc = EZ_CREATE_MODULE_UPDATE_FUNCTION_DESC(TestSoAComponentManager::Update, this);
+      this->RegisterUpdateFunction(desc);
+    }
+
+    void Update(const ezWorldModule::UpdateContext& context)
+    {
+      ForEachBatch(context, [&](const Batch& batch)
+        {
+          ++m_uiNumBatches;
+
+          ezArrayPtr<float> speeds = batch.GetHotFields<0>();
+          ezArrayPtr<float> angles = batch.GetHotFields<1>();
+          ezArrayPtr<ezUInt8> active = batch.GetHotFields<2>();
+
+          for (ezUInt32 i = 0; i < batch.GetCount(); ++i)
+          {
+            angles[i] += speeds[i] * active[i];
+          }
+        });
+    }
+
+    ezUInt32 m_uiNumBatches = 0;
+  };
+
+  class TestSoAComponent : public ezComponent
+  {
+    EZ_DECLARE_COMPONENT_TYPE(TestSoAComponent, ezComponent, TestSoAComponentManager);
+
+  public:
+    virtual void OnActivated() override { static_cast<TestSoAComponentManager*>(GetOwningManager())->GetHotField<2>(this) = 1; }
+    virtual void OnDeactivated() override { static_cast<TestSoAComponentManager*>(GetOwningManager())->GetHotField<2>(this) = 0; }
+
+    float m_fExpectedSpeed = 0.0f;
+  };
+
+  EZ_BEGIN_COMPONENT_TYPE(TestSoAComponent, 1, ezComponentMode::Static)
+  EZ_END_COMPONENT_TYPE
+} // namespace
+
+
+EZ_CREATE_SIMPLE_TEST(World, SoAComponents)
+{
+  ezWorldDesc worldDesc("Test");
+  ezWorld world(worldDesc);
+  EZ_LOCK(world.GetWriteMarker());
+
+  TestSoAComponentManager* pManager = world.GetOrCreateComponentManager<TestSoAComponentManager>();
+
+  const ezUInt32 uiNumComponents = 3000;
+
+  ezDynamicArray<ezComponentHandle> handles;
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Create")
+  {
+    for (ezUInt32 i = 0; i < uiNumComponents; ++i)
+    {
+      ezGameObjectDesc desc;
+      ezGameObject* pObject = nullptr;
+      world.CreateObject(desc, pObject);
+
+      TestSoAComponent* pComponent = nullptr;
+      handles.PushBack(TestSoAComponent::CreateComponent(pObject, pComponent));
+
+      pComponent->m_fExpectedSpeed = static_cast<float>(i);
+      pManager->GetHotField<0>(pComponent) = static_cast<float>(i);
+    }
+
+    EZ_TEST_INT(pManager->GetHotFieldArray<0>().GetCount(), uiNumComponents);
+    EZ_TEST_INT(pManager->GetHotFieldArray<1>().GetCount(), uiNumComponents);
+    EZ_TEST_INT(pManager->GetHotFieldArray<2>().GetCount(), uiNumComponents);
+
+    bool bAllActive = true;
+    for (ezUInt8 uiActive : pManager->GetHotFieldArray<2>())
+    {
+      bAllActive &= uiActive == 1;
+    }
+    EZ_TEST_BOOL(bAllActive);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Delete / Deactivate")
+  {
+    for (ezUInt32 i = 0; i < uiNumComponents; i += 3)
+    {
+      pManager->DeleteComponent(handles[i]);
+    }
+
+    for (ezUInt32 i = 1; i < uiNumComponents; i += 3)
+    {
+      TestSoAComponent* pComponent = nullptr;
+      EZ_TEST_BOOL(world.TryGetComponent(handles[i], pComponent));
+      pComponent->SetActiveFlag(false);
+    }
+
+    // deleted components are only removed from the storage during the update
+    world.Update();
+
+    EZ_TEST_INT(pManager->GetComponentCount(), uiNumComponents / 3 * 2);
+    EZ_TEST_INT(pManager->GetHotFieldArray<0>().GetCount(), uiNumComponents / 3 * 2);
+
+    bool bAllMatching = true;
+    for (auto it = pManager->GetComponents(); it.IsValid(); ++it)
+    {
+      bAllMatching &= pManager->GetHotField<0>(it) == it->m_fExpectedSpeed;
+      bAllMatching &= pManager->GetHotField<2>(it) == (it->IsActive() ? 1 : 0);
+    }
+    EZ_TEST_BOOL(bAllMatching);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Batch Update")
+  {
+    for (float& fAngle : pManager->GetHotFieldArray<1>())
+    {
+      fAngle = 0.0f;
+    }
+
+    pManager->m_uiNumBatches = 0;
+
+    world.Update();
+    world.Update();
+
+    // every batch covers at most one data block of the component storage
+    EZ_TEST_BOOL(pManager->m_uiNumBatches >= 2);
+
+    bool bAllUpdated = true;
+    for (auto it = pManager->GetComponents(); it.IsValid(); ++it)
+    {
+      const float fExpectedAngle = it->IsActive() ? it->m_fExpectedSpeed * 2.0f : 0.0f;
+      bAllUpdated &= pManager->GetHotField<1>(it) == fExpectedAngle;
+    }
+    EZ_TEST_BOOL(bAllUpdated);
+  }
+}
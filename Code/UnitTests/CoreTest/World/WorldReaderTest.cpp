@@ -0,0 +1,294 @@
+#include <CoreTest/CoreTestPCH.h>
+
+#include <Core/World/World.h>
+#include <Core/WorldSerializer/WorldReader.h>
+#include <Core/WorldSerializer/WorldWriter.h>
+#include <Foundation/IO/MemoryStream.h>
+
+namespace
+{
+  class TestReaderIntComponent;
+  using TestReaderIntComponentManager = ezComponentManager<TestReaderIntComponent, ezBlockStorageType::Compact>;
+
+  class TestReaderIntComponent : public ezComponent
+  {
+    EZ_DECLARE_COMPONENT_TYPE(TestReaderIntComponent, ezComponent, TestReaderIntComponentManager);
+
+  public:
+    virtual void SerializeComponent(ezWorldWriter& inout_stream) const override
+    {
+      inout_stream.GetStream() << m_iValue;
+      inout_stream.GetStream() << m_sText;
+    }
+
+    virtual void DeserializeComponent(ezWorldReader& inout_stream) override
+    {
+      inout_stream.GetStream() >> m_iValue;
+      inout_stream.GetStream() >> m_sText;
+    }
+
+    ezInt32 m_iValue = 0;
+    ezString m_sText;
+  };
+
+  class TestReaderArrayComponent;
+  using TestReaderArrayComponentManager = ezComponentManager<TestReaderArrayComponent, ezBlockStorageType::Compact>;
+
+  class TestReaderArrayComponent : public ezComponent
+  {
+    EZ_DECLARE_COMPONENT_TYPE(TestReaderArrayComponent, ezComponent, TestReaderArrayComponentManager);
+
+  public:
+    virtual void SerializeComponent(ezWorldWriter& inout_stream) const override
+    {
+      inout_stream.GetStream() << m_vValue;
+      inout_stream.GetStream().WriteArray(m_Values).AssertSuccess();
+    }
+
+    virtual void DeserializeComponent(ezWorldReader& inout_stream) override
+    {
+      inout_stream.GetStream() >> m_vValue;
+      inout_stream.GetStream().ReadArray(m_Values).AssertSuccess();
+    }
+
+    ezVec3 m_vValue = ezVec3::MakeZero();
+    ezDynamicArray<float> m_Values;
+  };
+
+  class TestReaderRefComponent;
+  using TestReaderRefComponentManager = ezComponentManager<TestReaderRefComponent, ezBlockStorageType::Compact>;
+
+  class TestReaderRefComponent : public ezComponent
+  {
+    EZ_DECLARE_COMPONENT_TYPE(TestReaderRefComponent, ezComponent, TestReaderRefComponentManager);
+
+  public:
+    virtual void SerializeComponent(ezWorldWriter& inout_stream) const override
+    {
+      inout_stream.WriteGameObjectHandle(m_hTarget);
+      inout_stream.WriteComponentHandle(m_hTargetComponent);
+    }
+
+    virtual void DeserializeComponent(ezWorldReader& inout_stream) override
+    {
+      m_hTarget = inout_stream.ReadGameObjectHandle();
+      inout_stream.ReadComponentHandle(m_hTargetComponent);
+    }
+
+    ezGameObjectHandle m_hTarget;
+    ezComponentHandle m_hTargetComponent;
+  };
+
+  // clang-format off
+  EZ_BEGIN_COMPONENT_TYPE(TestReaderIntComponent, 1, ezComponentMode::Static)
+  EZ_END_COMPONENT_TYPE;
+
+  EZ_BEGIN_COMPONENT_TYPE(TestReaderArrayComponent, 1, ezComponentMode::Static)
+  EZ_END_COMPONENT_TYPE;
+
+  EZ_BEGIN_COMPONENT_TYPE(TestReaderRefComponent, 1, ezComponentMode::Static)
+  EZ_END_COMPONENT_TYPE;
+  // clang-format on
+
+  void FillWorld(ezWorld& ref_world, ezUInt32 uiNumObjects)
+  {
+    ezDynamicArray<ezGameObject*> objects;
+
+    for (ezUInt32 i = 0; i < uiNumObjects; ++i)
+    {
+      ezStringBuilder sName;
+      sName.SetFormat("Object{}", i);
+
+      ezGameObjectDesc desc;
+      desc.m_sName.Assign(sName);
+      desc.m_LocalPosition.Set(static_cast<float>(i), 0, 0);
+
+      ezGameObject* pObject = nullptr;
+      ref_world.CreateObject(desc, pObject);
+      objects.PushBack(pObject);
+
+      TestReaderIntComponent* pInt = nullptr;
+      TestReaderIntComponent::CreateComponent(pObject, pInt);
+      pInt->m_iValue = i * 7;
+      pInt->m_sText = sName;
+
+      if (i % 2 == 0)
+      {
+        TestReaderArrayComponent* pArray = nullptr;
+        TestReaderArrayComponent::CreateComponent(pObject, pArray);
+        pArray->m_vValue.Set(static_cast<float>(i), 1.0f, 2.0f);
+
+        // different sizes, so that the per type read positions don't line up by accident
+        for (ezUInt32 v = 0; v < i % 13; ++v)
+        {
+          pArray->m_Values.PushBack(static_cast<float>(i + v));
+        }
+      }
+
+      if (i % 3 == 0 && i > 0)
+      {
+        TestReaderRefComponent* pRef = nullptr;
+        TestReaderRefComponent::CreateComponent(pObject, pRef);
+        pRef->m_hTarget = objects[i / 2]->GetHandle();
+
+        TestReaderIntComponent* pTargetInt = nullptr;
+        if (objects[i - 1]->TryGetComponentOfBaseType(pTargetInt))
+        {
+          pRef->m_hTargetComponent = pTargetInt->GetHandle();
+        }
+      }
+    }
+  }
+
+  /// Builds a textual description of all objects and their components, ordered by object name.
+  void DescribeWorld(ezWorld& ref_world, ezStringBuilder& out_sDescription)
+  {
+    ezMap<ezString, ezString> objects;
+
+    ezStringBuilder sObject;
+    for (auto it = ref_world.GetObjects(); it.IsValid(); ++it)
+    {
+      ezGameObject* pObject = it;
+      sObject.SetFormat("{} pos={}:", pObject->GetName(), pObject->GetLocalPosition().x);
+
+      TestReaderIntComponent* pInt = nullptr;
+      if (pObject->TryGetComponentOfBaseType(pInt))
+      {
+        sObject.AppendFormat(" int={},{}", pInt->m_iValue, pInt->m_sText);
+      }
+
+      TestReaderArrayComponent* pArray = nullptr;
+      if (pObject->TryGetComponentOfBaseType(pArray))
+      {
+        sObject.AppendFormat(" vec={},{},{} [", pArray->m_vValue.x, pArray->m_vValue.y, pArray->m_vValue.z);
+        for (float f : pArray->m_Values)
+        {
+          sObject.AppendFormat(" {}", f);
+        }
+        sObject.Append(" ]");
+      }
+
+      TestReaderRefComponent* pRef = nullptr;
+      if (pObject->TryGetComponentOfBaseType(pRef))
+      {
+        ezGameObject* pTarget = nullptr;
+        ezComponent* pTargetComponent = nullptr;
+        const bool bHasTarget = ref_world.TryGetObject(pRef->m_hTarget, pTarget);
+        const bool bHasTargetComponent = ref_world.TryGetComponent(pRef->m_hTargetComponent, pTargetComponent);
+
+        sObject.AppendFormat(" ref={},{}", bHasTarget ? pTarget->GetName() : ezStringView("<none>"), bHasTargetComponent ? pTargetComponent->GetOwner()->GetName() : ezStringView("<none>"));
+      }
+
+      objects[pObject->GetName()] = sObject;
+    }
+
+    out_sDescription.Clear();
+    for (auto it : objects)
+    {
+      out_sDescription.Append(it.Value(), "\n");
+    }
+  }
+
+  void InstantiateAndDescribe(ezWorldReader& ref_reader, const ezPrefabInstantiationOptions& options, ezStringBuilder& out_sDescription)
+  {
+    ezWorldDesc worldDesc("Read");
+    ezWorld world(worldDesc);
+    EZ_LOCK(world.GetWriteMarker());
+
+    ezUniquePtr<ezWorldReader::InstantiationContextBase> pContext = ref_reader.InstantiateWorld(world, options);
+
+    if (pContext != nullptr)
+    {
+      while (true)
+      {
+        const auto result = pContext->Step();
+
+        if (result == ezWorldReader::InstantiationContextBase::StepResult::Finished)
+          break;
+
+        if (result == ezWorldReader::InstantiationContextBase::StepResult::ContinueNextFrame)
+        {
+          world.Update();
+        }
+      }
+    }
+
+    world.Update();
+
+    DescribeWorld(world, out_sDescription);
+  }
+} // namespace
+
+EZ_CREATE_SIMPLE_TEST(World, WorldReader)
+{
+  const ezUInt32 uiNumObjects = 500;
+
+  ezDefaultMemoryStreamStorage storage;
+  ezStringBuilder sExpected;
+
+  {
+    ezWorldDesc worldDesc("Write");
+    ezWorld world(worldDesc);
+    EZ_LOCK(world.GetWriteMarker());
+
+    FillWorld(world, uiNumObjects);
+    world.Update();
+
+    DescribeWorld(world, sExpected);
+
+    ezMemoryStreamWriter writer(&storage);
+    ezWorldWriter worldWriter;
+    worldWriter.WriteWorld(writer, world);
+  }
+
+  ezWorldReader worldReader;
+  {
+    ezMemoryStreamReader reader(&storage);
+    EZ_TEST_BOOL(worldReader.ReadWorldDescription(reader).Succeeded());
+  }
+
+  ezPrefabInstantiationOptions options;
+  options.m_RandomSeedMode = ezPrefabInstantiationOptions::RandomSeedMode::FixedFromSerialization;
+
+  ezStringBuilder sSerial;
+  ezStringBuilder sParallel;
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Serial")
+  {
+    options.m_bDeserializeComponentsInParallel = false;
+    InstantiateAndDescribe(worldReader, options, sSerial);
+
+    EZ_TEST_STRING(sSerial, sExpected);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Parallel")
+  {
+    options.m_bDeserializeComponentsInParallel = true;
+    InstantiateAndDescribe(worldReader, options, sParallel);
+
+    EZ_TEST_STRING(sParallel, sSerial);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Parallel - Time Sliced")
+  {
+    // a tiny step time makes the parallel path stop and resume in the middle of the component data
+    options.m_bDeserializeComponentsInParallel = true;
+    options.m_MaxStepTime = ezTime::MakeFromMicroseconds(10);
+
+    ezStringBuilder sSliced;
+    InstantiateAndDescribe(worldReader, options, sSliced);
+
+    EZ_TEST_STRING(sSliced, sSerial);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Serial - Time Sliced")
+  {
+    options.m_bDeserializeComponentsInParallel = false;
+    options.m_MaxStepTime = ezTime::MakeFromMicroseconds(10);
+
+    ezStringBuilder sSliced;
+    InstantiateAndDescribe(worldReader, options, sSliced);
+
+    EZ_TEST_STRING(sSliced, sSerial);
+  }
+}
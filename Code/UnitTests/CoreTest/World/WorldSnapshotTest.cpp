@@ -0,0 +1,319 @@
+#include <CoreTest/CoreTestPCH.h>
+
+#include <Core/Collection/CollectionComponent.h>
+#include <Core/Messages/CommonMessages.h>
+#include <Core/World/World.h>
+#include <Core/WorldSerializer/WorldSnapshot.h>
+
+namespace
+{
+  class TestSnapshotComponent;
+  using TestSnapshotComponentManager = ezComponentManager<TestSnapshotComponent, ezBlockStorageType::Compact>;
+
+  class TestSnapshotComponent : public ezComponent
+  {
+    EZ_DECLARE_COMPONENT_TYPE(TestSnapshotComponent, ezComponent, TestSnapshotComponentManager);
+
+  public:
+    virtual void SerializeComponent(ezWorldWriter& inout_stream) const override
+    {
+      inout_stream.GetStream() << m_iValue;
+      inout_stream.WriteGameObjectHandle(m_hTarget);
+    }
+
+    virtual void DeserializeComponent(ezWorldReader& inout_stream) override
+    {
+      inout_stream.GetStream() >> m_iValue;
+      m_hTarget = inout_stream.ReadGameObjectHandle();
+    }
+
+    ezInt32 m_iValue = 0;
+    ezGameObjectHandle m_hTarget;
+  };
+
+  class TestTrackedSnapshotComponent;
+  using TestTrackedSnapshotComponentManager = ezComponentManager<TestTrackedSnapshotComponent, ezBlockStorageType::Compact>;
+
+  class TestTrackedSnapshotComponent : public ezComponent
+  {
+    EZ_DECLARE_COMPONENT_TYPE(TestTrackedSnapshotComponent, ezComponent, TestTrackedSnapshotComponentManager);
+
+  public:
+    TestTrackedSnapshotComponent() { EnableStateVersionTracking(); }
+
+    virtual void SerializeComponent(ezWorldWriter& inout_stream) const override { inout_stream.GetStream() << m_iValue; }
+    virtual void DeserializeComponent(ezWorldReader& inout_stream) override { inout_stream.GetStream() >> m_iValue; }
+
+    void SetValue(ezInt32 iValue)
+    {
+      m_iValue = iValue;
+      MarkStateChanged();
+    }
+
+    void OnMsgComponentStateRestored(ezMsgComponentStateRestored& msg)
+    {
+      EZ_IGNORE_UNUSED(msg);
+      ++m_uiNumRestored;
+    }
+
+    ezInt32 m_iValue = 0;
+    ezUInt32 m_uiNumRestored = 0;
+  };
+
+  // clang-format off
+  EZ_BEGIN_COMPONENT_TYPE(TestSnapshotComponent, 1, ezComponentMode::Static)
+  EZ_END_COMPONENT_TYPE;
+
+  EZ_BEGIN_COMPONENT_TYPE(TestTrackedSnapshotComponent, 1, ezComponentMode::Static)
+  {
+    EZ_BEGIN_MESSAGEHANDLERS
+    {
+      EZ_MESSAGE_HANDLER(ezMsgComponentStateRestored, OnMsgComponentStateRestored)
+    }
+    EZ_END_MESSAGEHANDLERS;
+  }
+  EZ_END_COMPONENT_TYPE;
+  // clang-format on
+} // namespace
+
+EZ_CREATE_SIMPLE_TEST(World, Snapshot)
+{
+  ezWorldDesc worldDesc("Test");
+  ezWorld world(worldDesc);
+  EZ_LOCK(world.GetWriteMarker());
+
+  const ezUInt32 uiNumObjects = 100;
+
+  ezDynamicArray<ezGameObject*> objects;
+  ezDynamicArray<TestSnapshotComponent*> components;
+
+  for (ezUInt32 i = 0; i < uiNumObjects; ++i)
+  {
+    ezGameObjectDesc desc;
+    desc.m_LocalPosition.Set(static_cast<float>(i), 0, 0);
+
+    ezGameObject* pObject = nullptr;
+    world.CreateObject(desc, pObject);
+
+    TestSnapshotComponent* pComponent = nullptr;
+    TestSnapshotComponent::CreateComponent(pObject, pComponent);
+    pComponent->m_iValue = i;
+
+    components.PushBack(pComponent);
+  }
+
+  world.Update();
+
+  ezGameObjectHandle hFirstObject = components[0]->GetOwner()->GetHandle();
+
+  ezWorldSnapshot snapshot;
+  snapshot.Capture(world);
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Unchanged")
+  {
+    ezDefaultMemoryStreamStorage storage;
+    ezMemoryStreamWriter writer(&storage);
+
+    EZ_TEST_BOOL(snapshot.WriteDelta(writer).Succeeded());
+    EZ_TEST_INT(snapshot.GetNumChangesInLastDelta(), 0);
+
+    // without version tracking every component has to be serialized to find out whether it changed
+    EZ_TEST_INT(snapshot.GetNumSerializedInLastDelta(), uiNumObjects);
+  }
+
+  ezDefaultMemoryStreamStorage deltaStorage;
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "WriteDelta")
+  {
+    components[3]->m_iValue = 1000;
+    components[7]->m_hTarget = hFirstObject;
+    components[9]->GetOwner()->SetLocalPosition(ezVec3(0, 5, 0));
+
+    ezMemoryStreamWriter writer(&deltaStorage);
+    EZ_TEST_BOOL(snapshot.WriteDelta(writer).Succeeded());
+    EZ_TEST_INT(snapshot.GetNumChangesInLastDelta(), 3);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "RestoreBase")
+  {
+    components[5]->m_iValue = -1;
+
+    EZ_TEST_BOOL(snapshot.RestoreBase().Succeeded());
+    EZ_TEST_INT(snapshot.GetNumRestoredInLastApply(), 4);
+
+    EZ_TEST_INT(components[3]->m_iValue, 3);
+    EZ_TEST_INT(components[5]->m_iValue, 5);
+    EZ_TEST_BOOL(components[7]->m_hTarget.IsInvalidated());
+    EZ_TEST_VEC3(components[9]->GetOwner()->GetLocalPosition(), ezVec3(9, 0, 0), 0.0f);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "ApplyDelta")
+  {
+    components[5]->m_iValue = -1;
+
+    ezMemoryStreamReader reader(&deltaStorage);
+    EZ_TEST_BOOL(snapshot.ApplyDelta(reader).Succeeded());
+    EZ_TEST_INT(snapshot.GetNumRestoredInLastApply(), 4);
+
+    EZ_TEST_INT(components[3]->m_iValue, 1000);
+    EZ_TEST_INT(components[5]->m_iValue, 5);
+    EZ_TEST_BOOL(components[7]->m_hTarget == hFirstObject);
+    EZ_TEST_VEC3(components[9]->GetOwner()->GetLocalPosition(), ezVec3(0, 5, 0), 0.0f);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Structural Changes")
+  {
+    ezGameObjectDesc desc;
+    ezGameObject* pObject = nullptr;
+    world.CreateObject(desc, pObject);
+
+    ezDefaultMemoryStreamStorage storage;
+    ezMemoryStreamWriter writer(&storage);
+
+    EZ_TEST_BOOL(snapshot.WriteDelta(writer).Failed());
+    EZ_TEST_INT(storage.GetStorageSize64(), 0);
+
+    // a new capture includes the new object
+    snapshot.Capture(world);
+    EZ_TEST_BOOL(snapshot.WriteDelta(writer).Succeeded());
+    EZ_TEST_INT(snapshot.GetNumChangesInLastDelta(), 0);
+  }
+}
+
+EZ_CREATE_SIMPLE_TEST(World, SnapshotStateVersions)
+{
+  ezWorldDesc worldDesc("Test");
+  ezWorld world(worldDesc);
+  EZ_LOCK(world.GetWriteMarker());
+
+  ezDynamicArray<TestTrackedSnapshotComponent*> components;
+
+  for (ezUInt32 i = 0; i < 10; ++i)
+  {
+    ezGameObjectDesc desc;
+    ezGameObject* pObject = nullptr;
+    world.CreateObject(desc, pObject);
+
+    TestTrackedSnapshotComponent* pComponent = nullptr;
+    TestTrackedSnapshotComponent::CreateComponent(pObject, pComponent);
+    pComponent->SetValue(i);
+
+    components.PushBack(pComponent);
+  }
+
+  world.Update();
+
+  ezWorldSnapshot snapshot;
+  snapshot.Capture(world);
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Unchanged Version")
+  {
+    // without a new state version the component is not serialized, so the change goes unnoticed
+    components[2]->m_iValue = 100;
+
+    ezDefaultMemoryStreamStorage storage;
+    ezMemoryStreamWriter writer(&storage);
+    EZ_TEST_BOOL(snapshot.WriteDelta(writer).Succeeded());
+    EZ_TEST_INT(snapshot.GetNumChangesInLastDelta(), 0);
+
+    components[2]->m_iValue = 2;
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Changed Version")
+  {
+    const ezUInt32 uiVersion = components[4]->GetStateVersion();
+    components[4]->SetValue(40);
+    components[6]->SetActiveFlag(false);
+    EZ_TEST_BOOL(components[4]->GetStateVersion() != uiVersion);
+
+    ezDefaultMemoryStreamStorage storage;
+    ezMemoryStreamWriter writer(&storage);
+    EZ_TEST_BOOL(snapshot.WriteDelta(writer).Succeeded());
+    EZ_TEST_INT(snapshot.GetNumChangesInLastDelta(), 2);
+
+    // a second delta finds the same changes without new versions
+    EZ_TEST_BOOL(snapshot.WriteDelta(writer).Succeeded());
+    EZ_TEST_INT(snapshot.GetNumChangesInLastDelta(), 2);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "RestoreBase")
+  {
+    const ezUInt32 uiVersion = components[4]->GetStateVersion();
+
+    EZ_TEST_BOOL(snapshot.RestoreBase().Succeeded());
+    EZ_TEST_INT(snapshot.GetNumRestoredInLastApply(), 2);
+
+    EZ_TEST_INT(components[4]->m_iValue, 4);
+    EZ_TEST_BOOL(components[6]->GetActiveFlag());
+    EZ_TEST_BOOL(components[4]->GetStateVersion() != uiVersion);
+
+    // only the restored components are notified
+    EZ_TEST_INT(components[3]->m_uiNumRestored, 0);
+    EZ_TEST_INT(components[4]->m_uiNumRestored, 1);
+    EZ_TEST_INT(components[6]->m_uiNumRestored, 1);
+
+    ezDefaultMemoryStreamStorage storage;
+    ezMemoryStreamWriter writer(&storage);
+    EZ_TEST_BOOL(snapshot.WriteDelta(writer).Succeeded());
+    EZ_TEST_INT(snapshot.GetNumChangesInLastDelta(), 0);
+  }
+}
+
+EZ_CREATE_SIMPLE_TEST(World, SnapshotCollectionComponent)
+{
+  ezWorldDesc worldDesc("Test");
+  ezWorld world(worldDesc);
+  EZ_LOCK(world.GetWriteMarker());
+
+  ezDynamicArray<ezCollectionComponent*> components;
+
+  for (ezUInt32 i = 0; i < 10; ++i)
+  {
+    ezGameObjectDesc desc;
+    ezGameObject* pObject = nullptr;
+    world.CreateObject(desc, pObject);
+
+    ezCollectionComponent* pComponent = nullptr;
+    ezCollectionComponent::CreateComponent(pObject, pComponent);
+    EZ_TEST_BOOL(pComponent->HasStateVersionTracking());
+
+    components.PushBack(pComponent);
+  }
+
+  world.Update();
+
+  ezWorldSnapshot snapshot;
+  snapshot.Capture(world);
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Unchanged")
+  {
+    ezDefaultMemoryStreamStorage storage;
+    ezMemoryStreamWriter writer(&storage);
+    EZ_TEST_BOOL(snapshot.WriteDelta(writer).Succeeded());
+    EZ_TEST_INT(snapshot.GetNumChangesInLastDelta(), 0);
+    EZ_TEST_INT(snapshot.GetNumSerializedInLastDelta(), 0);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Changed")
+  {
+    components[3]->SetRegisterNames(true);
+
+    ezDefaultMemoryStreamStorage storage;
+    ezMemoryStreamWriter writer(&storage);
+    EZ_TEST_BOOL(snapshot.WriteDelta(writer).Succeeded());
+    EZ_TEST_INT(snapshot.GetNumChangesInLastDelta(), 1);
+    EZ_TEST_INT(snapshot.GetNumSerializedInLastDelta(), 1);
+
+    // the change is still there, but the component doesn't need to be serialized again
+    EZ_TEST_BOOL(snapshot.WriteDelta(writer).Succeeded());
+    EZ_TEST_INT(snapshot.GetNumChangesInLastDelta(), 1);
+    EZ_TEST_INT(snapshot.GetNumSerializedInLastDelta(), 0);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "RestoreBase")
+  {
+    EZ_TEST_BOOL(snapshot.RestoreBase().Succeeded());
+    EZ_TEST_INT(snapshot.GetNumRestoredInLastApply(), 1);
+    EZ_TEST_BOOL(!components[3]->GetRegisterNames());
+  }
+}
@@ -0,0 +1,127 @@
+#include <EditorTest/EditorTestPCH.h>
+
+#include <EditorFramework/Assets/AssetTransformCache.h>
+#include <Foundation/IO/OSFile.h>
+
+EZ_CREATE_SIMPLE_TEST_GROUP(AssetTransformCache);
+
+namespace
+{
+  ezResult WriteTestFile(ezStringView sPath, ezStringView sContent)
+  {
+    ezOSFile file;
+    EZ_SUCCEED_OR_RETURN(file.Open(sPath, ezFileOpenMode::Write));
+    return file.Write(sContent.GetStartPointer(), sContent.GetElementCount());
+  }
+
+  ezString ReadTestFile(ezStringView sPath)
+  {
+    ezOSFile file;
+    if (file.Open(sPath, ezFileOpenMode::Read).Failed())
+      return "<missing>";
+
+    ezDynamicArray<ezUInt8> content;
+    file.ReadAll(content);
+
+    return ezStringView(reinterpret_cast<const char*>(content.GetData()), content.GetCount());
+  }
+
+  ezUInt32 CountFiles(ezStringView sDirectory)
+  {
+    ezUInt32 uiNumFiles = 0;
+
+#if EZ_ENABLED(EZ_SUPPORTS_FILE_ITERATORS)
+    ezFileSystemIterator it;
+    for (it.StartSearch(sDirectory, ezFileSystemIteratorFlags::ReportFilesRecursive); it.IsValid(); it.Next())
+    {
+      ++uiNumFiles;
+    }
+#endif
+
+    return uiNumFiles;
+  }
+} // namespace
+
+EZ_CREATE_SIMPLE_TEST(AssetTransformCache, DirectoryBackend)
+{
+  ezStringBuilder sRoot = ezTestFramework::GetInstance()->GetAbsOutputPath();
+  sRoot.AppendPath("AssetTransformCache");
+  ezOSFile::DeleteFolder(sRoot).IgnoreResult();
+
+  ezStringBuilder sCache = sRoot;
+  sCache.AppendPath("Cache");
+
+  ezStringBuilder sSource = sRoot;
+  sSource.AppendPath("Source.ezBinTexture2D");
+
+  ezStringBuilder sTarget = sRoot;
+  sTarget.AppendPath("Target/Output.ezBinTexture2D");
+
+  const ezStringView sKey = "ab/ab0123456789abcd/Output.ezBinTexture2D";
+
+  EZ_TEST_BOOL(ezOSFile::CreateDirectoryStructure(sRoot).Succeeded());
+  EZ_TEST_BOOL(WriteTestFile(sSource, "First Output").Succeeded());
+
+  ezAssetTransformCacheDirectoryBackend backend(sCache);
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Contains / Fetch Missing")
+  {
+    EZ_TEST_BOOL(!backend.Contains(sKey));
+    EZ_TEST_BOOL(backend.Fetch(sKey, sTarget).Failed());
+    EZ_TEST_BOOL(!ezOSFile::ExistsFile(sTarget));
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Store")
+  {
+    EZ_TEST_BOOL(backend.Store(sKey, sSource).Succeeded());
+    EZ_TEST_BOOL(backend.Contains(sKey));
+
+    ezStringBuilder sEntry = sCache;
+    sEntry.AppendPath(sKey);
+    EZ_TEST_STRING(ReadTestFile(sEntry), "First Output");
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Fetch")
+  {
+    EZ_TEST_BOOL(backend.Fetch(sKey, sTarget).Succeeded());
+    EZ_TEST_STRING(ReadTestFile(sTarget), "First Output");
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Existing Entry")
+  {
+    // entries never change, storing the same key again keeps the first file
+    EZ_TEST_BOOL(WriteTestFile(sSource, "Second Output").Succeeded());
+    EZ_TEST_BOOL(backend.Store(sKey, sSource).Succeeded());
+
+    EZ_TEST_BOOL(backend.Fetch(sKey, sTarget).Succeeded());
+    EZ_TEST_STRING(ReadTestFile(sTarget), "First Output");
+  }
+
+#if EZ_ENABLED(EZ_SUPPORTS_FILE_ITERATORS)
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Temp File Move")
+  {
+    // the temporary copy is moved into place, nothing else is left behind
+    EZ_TEST_INT(CountFiles(sCache), 1);
+
+    // a temp file of another process that is still copying is not an entry
+    const ezStringView sOtherKey = "cd/cd0123456789abcd/Output.ezBinTexture2D";
+
+    ezStringBuilder sForeignTemp = sCache;
+    sForeignTemp.AppendPath(sOtherKey);
+    sForeignTemp.Append(".{12345678-1234-1234-1234-123456789abc}.tmp");
+    EZ_TEST_BOOL(WriteTestFile(sForeignTemp, "Partial").Succeeded());
+
+    EZ_TEST_BOOL(!backend.Contains(sOtherKey));
+    EZ_TEST_BOOL(backend.Fetch(sOtherKey, sTarget).Failed());
+
+    EZ_TEST_BOOL(backend.Store(sOtherKey, sSource).Succeeded());
+    EZ_TEST_BOOL(backend.Contains(sOtherKey));
+    EZ_TEST_INT(CountFiles(sCache), 3);
+
+    EZ_TEST_BOOL(backend.Fetch(sOtherKey, sTarget).Succeeded());
+    EZ_TEST_STRING(ReadTestFile(sTarget), "Second Output");
+  }
+#endif
+
+  ezOSFile::DeleteFolder(sRoot).IgnoreResult();
+}
@@ -0,0 +1,495 @@
+#include <FoundationTest/FoundationTestPCH.h>
+
+#include <Foundation/Containers/BTreeMap.h>
+#include <Foundation/Containers/Map.h>
+#include <Foundation/Math/Random.h>
+#include <Foundation/Strings/String.h>
+#include <algorithm>
+
+EZ_CREATE_SIMPLE_TEST(Containers, BTreeMap)
+{
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Iterator")
+  {
+    ezBTreeMap<ezUInt32, ezUInt32> m;
+    for (ezUInt32 i = 0; i < 1000; ++i)
+      m[i] = i + 1;
+
+    auto itFound = std::find_if(begin(m), end(m), [](ezBTreeMap<ezUInt32, ezUInt32>::ConstIterator val)
+      { return val.Value() == 500; });
+
+    EZ_TEST_BOOL(itFound.IsValid());
+    EZ_TEST_INT(itFound.Key(), 499);
+
+    ezUInt32 prev = begin(m).Key();
+    ezUInt32 uiCount = 0;
+    for (auto it : m)
+    {
+      EZ_TEST_BOOL(it.Value() >= prev);
+      prev = it.Value();
+      ++uiCount;
+    }
+
+    EZ_TEST_INT(uiCount, 1000);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Constructor")
+  {
+    ezBTreeMap<ezUInt32, ezUInt32> m;
+    ezBTreeMap<ezConstructionCounter, ezUInt32> m2;
+    ezBTreeMap<ezConstructionCounter, ezConstructionCounter> m3;
+
+    EZ_TEST_BOOL(m.IsEmpty());
+    EZ_TEST_INT(m.GetHeapMemoryUsage(), 0);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "IsEmpty / GetCount / Clear")
+  {
+    ezBTreeMap<ezUInt32, ezUInt32> m;
+    EZ_TEST_BOOL(m.IsEmpty());
+    EZ_TEST_INT(m.GetCount(), 0);
+
+    for (ezUInt32 i = 0; i < 1000; ++i)
+    {
+      m[i] = i;
+      EZ_TEST_INT(m.GetCount(), i + 1);
+    }
+
+    EZ_TEST_BOOL(!m.IsEmpty());
+    EZ_TEST_BOOL(m.GetHeapMemoryUsage() > 0);
+
+    m.Clear();
+    EZ_TEST_BOOL(m.IsEmpty());
+    EZ_TEST_INT(m.GetCount(), 0);
+    EZ_TEST_INT(m.GetHeapMemoryUsage(), 0);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Construction / Destruction")
+  {
+    EZ_TEST_BOOL(ezConstructionCounter::HasAllDestructed());
+
+    {
+      ezBTreeMap<ezConstructionCounter, ezConstructionCounter> m;
+
+      // enough elements for a couple of levels, so that splits and merges of inner nodes happen as well
+      for (ezInt32 i = 0; i < 2000; ++i)
+        m[ezConstructionCounter(i)] = ezConstructionCounter(i * 2);
+
+      for (ezInt32 i = 0; i < 2000; i += 3)
+        EZ_TEST_BOOL(m.Remove(ezConstructionCounter(i)));
+
+      ezBTreeMap<ezConstructionCounter, ezConstructionCounter> m2(m);
+      EZ_TEST_BOOL(m2 == m);
+
+      m.Clear();
+      EZ_TEST_BOOL(ezConstructionCounter::HasAllDestructed() == false);
+    }
+
+    EZ_TEST_BOOL(ezConstructionCounter::HasAllDestructed());
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Insert")
+  {
+    ezBTreeMap<ezUInt32, ezUInt32> m;
+
+    for (ezUInt32 i = 0; i < 1000; ++i)
+    {
+      auto it = m.Insert(i, i * 10);
+      EZ_TEST_INT(it.Key(), i);
+      EZ_TEST_INT(it.Value(), i * 10);
+    }
+
+    // overwrite existing
+    for (ezUInt32 i = 0; i < 1000; ++i)
+      m.Insert(i, i * 20);
+
+    EZ_TEST_INT(m.GetCount(), 1000);
+
+    for (ezUInt32 i = 0; i < 1000; ++i)
+      EZ_TEST_INT(m[i], i * 20);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Find / Contains")
+  {
+    ezBTreeMap<ezUInt32, ezUInt32> m;
+
+    for (ezUInt32 i = 0; i < 1000; ++i)
+      m[i * 2] = i * 10;
+
+    for (ezUInt32 i = 0; i < 1000; ++i)
+    {
+      EZ_TEST_INT(m.Find(i * 2).Value(), i * 10);
+      EZ_TEST_BOOL(!m.Find(i * 2 + 1).IsValid());
+
+      EZ_TEST_BOOL(m.Contains(i * 2));
+      EZ_TEST_BOOL(!m.Contains(i * 2 + 1));
+    }
+
+    const ezBTreeMap<ezUInt32, ezUInt32>& cm = m;
+    EZ_TEST_INT(cm.Find(100).Value(), 500);
+    EZ_TEST_BOOL(!cm.Find(101).IsValid());
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "GetValue/TryGetValue/GetValueOrDefault")
+  {
+    ezBTreeMap<ezString, ezInt32> m;
+    m.Insert("a", 1);
+    m.Insert("b", 2);
+
+    EZ_TEST_INT(*m.GetValue("a"), 1);
+    EZ_TEST_BOOL(m.GetValue("c") == nullptr);
+
+    *m.GetValue("a") = 3;
+
+    ezInt32 iValue = 0;
+    EZ_TEST_BOOL(m.TryGetValue("a", iValue));
+    EZ_TEST_INT(iValue, 3);
+    EZ_TEST_BOOL(!m.TryGetValue("c", iValue));
+
+    ezInt32* pValue = nullptr;
+    EZ_TEST_BOOL(m.TryGetValue("b", pValue));
+    *pValue = 4;
+    EZ_TEST_INT(m["b"], 4);
+
+    const ezBTreeMap<ezString, ezInt32>& cm = m;
+    const ezInt32* pConstValue = nullptr;
+    EZ_TEST_BOOL(cm.TryGetValue("b", pConstValue));
+    EZ_TEST_INT(*pConstValue, 4);
+    EZ_TEST_INT(*cm.GetValue("a"), 3);
+
+    EZ_TEST_INT(cm.GetValueOrDefault("a", 42), 3);
+    EZ_TEST_INT(cm.GetValueOrDefault("c", 42), 42);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "FindOrAdd / operator[]")
+  {
+    ezBTreeMap<ezUInt32, ezUInt32> m;
+
+    for (ezInt32 i = 0; i < 1000; ++i)
+    {
+      bool bExisted = true;
+      m.FindOrAdd(i, &bExisted).Value() = i * 10;
+      EZ_TEST_BOOL(!bExisted);
+    }
+
+    for (ezInt32 i = 1000 - 1; i >= 0; --i)
+    {
+      bool bExisted = false;
+      EZ_TEST_INT(m.FindOrAdd(i, &bExisted).Value(), i * 10);
+      EZ_TEST_BOOL(bExisted);
+      EZ_TEST_INT(m[i], i * 10);
+    }
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Remove (non-existing)")
+  {
+    ezBTreeMap<ezUInt32, ezUInt32> m;
+
+    for (ezInt32 i = 0; i < 1000; ++i)
+    {
+      EZ_TEST_BOOL(!m.Remove(i));
+    }
+
+    for (ezInt32 i = 0; i < 1000; ++i)
+      m[i] = i * 10;
+
+    for (ezInt32 i = 0; i < 1000; ++i)
+    {
+      EZ_TEST_BOOL(m.Remove(i + 500) == (i < 500));
+    }
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Remove (Iterator)")
+  {
+    ezBTreeMap<ezUInt32, ezUInt32> m;
+
+    for (ezInt32 i = 0; i < 1000; ++i)
+      m[i] = i * 10;
+
+    for (ezInt32 i = 0; i < 1000 - 1; ++i)
+    {
+      ezBTreeMap<ezUInt32, ezUInt32>::Iterator itNext = m.Remove(m.Find(i));
+      EZ_TEST_BOOL(!m.Find(i).IsValid());
+      EZ_TEST_BOOL(itNext.Key() == i + 1);
+
+      EZ_TEST_INT(m.GetCount(), 1000 - 1 - i);
+    }
+
+    // remove every other element while iterating
+    m.Clear();
+    for (ezInt32 i = 0; i < 1000; ++i)
+      m[i] = i * 10;
+
+    for (auto it = m.GetIterator(); it.IsValid();)
+    {
+      if (it.Key() % 2 == 0)
+        it = m.Remove(it);
+      else
+        ++it;
+    }
+
+    EZ_TEST_INT(m.GetCount(), 500);
+    for (auto it : m)
+      EZ_TEST_INT(it.Key() % 2, 1);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Remove (Key)")
+  {
+    ezBTreeMap<ezUInt32, ezUInt32> m;
+
+    for (ezInt32 i = 0; i < 1000; ++i)
+      m[i] = i * 10;
+
+    for (ezInt32 i = 1000 - 1; i >= 0; --i)
+    {
+      EZ_TEST_BOOL(m.Remove(i));
+      EZ_TEST_BOOL(!m.Find(i).IsValid());
+
+      EZ_TEST_INT(m.GetCount(), i);
+    }
+
+    EZ_TEST_INT(m.GetHeapMemoryUsage(), 0);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "operator= / Copy Constructor")
+  {
+    ezBTreeMap<ezUInt32, ezUInt32> m, m2;
+
+    for (ezInt32 i = 0; i < 1000; ++i)
+      m[i] = i * 10;
+
+    m2 = m;
+    ezBTreeMap<ezUInt32, ezUInt32> m3(m);
+
+    EZ_TEST_INT(m2.GetCount(), 1000);
+    EZ_TEST_INT(m3.GetCount(), 1000);
+    EZ_TEST_INT(m2.GetHeapMemoryUsage(), m.GetHeapMemoryUsage());
+
+    for (ezInt32 i = 1000 - 1; i >= 0; --i)
+    {
+      EZ_TEST_INT(m2[i], i * 10);
+      EZ_TEST_INT(m3[i], i * 10);
+    }
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "GetIterator / GetReverseIterator")
+  {
+    ezBTreeMap<ezUInt32, ezUInt32> m;
+
+    for (ezInt32 i = 0; i < 1000; ++i)
+      m[i] = i * 10;
+
+    ezInt32 i = 0;
+    for (ezBTreeMap<ezUInt32, ezUInt32>::Iterator it = m.GetIterator(); it.IsValid(); ++it)
+    {
+      EZ_TEST_INT(it.Key(), i);
+      EZ_TEST_INT(it.Value(), i * 10);
+      ++i;
+    }
+
+    EZ_TEST_INT(i, 1000);
+
+    const ezBTreeMap<ezUInt32, ezUInt32>& cm = m;
+
+    for (ezBTreeMap<ezUInt32, ezUInt32>::ConstReverseIterator it = cm.GetReverseIterator(); it.IsValid(); ++it)
+    {
+      --i;
+      EZ_TEST_INT(it.Key(), i);
+      EZ_TEST_INT(it.Value(), i * 10);
+    }
+
+    EZ_TEST_INT(i, 0);
+
+    // Prev
+    auto it = m.Find(500);
+    --it;
+    EZ_TEST_INT(it.Key(), 499);
+    ++it;
+    ++it;
+    EZ_TEST_INT(it.Key(), 501);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "LowerBound / UpperBound")
+  {
+    ezBTreeMap<ezInt32, ezInt32> m;
+
+    m[0] = 0;
+    m[3] = 30;
+    m[7] = 70;
+    m[9] = 90;
+
+    EZ_TEST_INT(m.LowerBound(-1).Key(), 0);
+    EZ_TEST_INT(m.LowerBound(0).Key(), 0);
+    EZ_TEST_INT(m.LowerBound(1).Key(), 3);
+    EZ_TEST_INT(m.LowerBound(3).Key(), 3);
+    EZ_TEST_INT(m.LowerBound(4).Key(), 7);
+    EZ_TEST_INT(m.LowerBound(8).Key(), 9);
+    EZ_TEST_INT(m.LowerBound(9).Key(), 9);
+    EZ_TEST_BOOL(!m.LowerBound(10).IsValid());
+
+    EZ_TEST_INT(m.UpperBound(-1).Key(), 0);
+    EZ_TEST_INT(m.UpperBound(0).Key(), 3);
+    EZ_TEST_INT(m.UpperBound(3).Key(), 7);
+    EZ_TEST_INT(m.UpperBound(8).Key(), 9);
+    EZ_TEST_BOOL(!m.UpperBound(9).IsValid());
+    EZ_TEST_BOOL(!m.UpperBound(10).IsValid());
+
+    // bounds that have to be found in inner nodes
+    m.Clear();
+    for (ezInt32 i = 0; i < 1000; ++i)
+      m[i * 2] = i;
+
+    for (ezInt32 i = -1; i < 1998; ++i)
+    {
+      EZ_TEST_INT(m.LowerBound(i).Key(), (i + 1) / 2 * 2);
+      EZ_TEST_INT(m.UpperBound(i).Key(), (i + 2) / 2 * 2);
+    }
+
+    EZ_TEST_INT(m.LowerBound(1998).Key(), 1998);
+    EZ_TEST_BOOL(!m.UpperBound(1998).IsValid());
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "BuildFromSorted")
+  {
+    for (ezUInt32 uiCount : {0u, 1u, 5u, 64u, 65u, 1000u, 12345u})
+    {
+      ezDynamicArray<ezUInt32> keys;
+      ezDynamicArray<ezString> values;
+
+      ezStringBuilder sValue;
+      for (ezUInt32 i = 0; i < uiCount; ++i)
+      {
+        sValue.SetFormat("{}", i);
+        keys.PushBack(i * 3);
+        values.PushBack(sValue);
+      }
+
+      ezBTreeMap<ezUInt32, ezString> m;
+      m[7] = "old";
+      m.BuildFromSorted(keys, values);
+
+      EZ_TEST_INT(m.GetCount(), uiCount);
+
+      ezUInt32 i = 0;
+      for (auto it : m)
+      {
+        EZ_TEST_INT(it.Key(), i * 3);
+        EZ_TEST_BOOL(it.Value() == values[i]);
+        ++i;
+      }
+
+      EZ_TEST_INT(i, uiCount);
+
+      // the tree must stay valid when it is modified afterwards
+      for (ezUInt32 j = 0; j < uiCount; ++j)
+        m[j * 3 + 1] = "new";
+
+      for (ezUInt32 j = 0; j < uiCount; j += 2)
+        EZ_TEST_BOOL(m.Remove(j * 3));
+
+      EZ_TEST_INT(m.GetCount(), uiCount * 2 - (uiCount + 1) / 2);
+    }
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Random Insert / Remove (compared to ezMap)")
+  {
+    ezRandom rnd;
+    rnd.Initialize(42);
+
+    ezBTreeMap<ezInt32, ezInt32> m;
+    ezMap<ezInt32, ezInt32> ref;
+
+    for (ezUInt32 r = 0; r < 20000; ++r)
+    {
+      const ezInt32 iKey = static_cast<ezInt32>(rnd.UIntInRange(4000));
+
+      // more inserts than removes in the first half, the other way round afterwards
+      if (rnd.UIntInRange(100) < (r < 10000 ? 70u : 30u))
+      {
+        m[iKey] = static_cast<ezInt32>(r);
+        ref[iKey] = static_cast<ezInt32>(r);
+      }
+      else
+      {
+        EZ_TEST_BOOL(m.Remove(iKey) == ref.Remove(iKey));
+      }
+    }
+
+    EZ_TEST_INT(m.GetCount(), ref.GetCount());
+
+    auto itRef = ref.GetIterator();
+    for (auto it : m)
+    {
+      EZ_TEST_INT(it.Key(), itRef.Key());
+      EZ_TEST_INT(it.Value(), itRef.Value());
+      ++itRef;
+    }
+
+    EZ_TEST_BOOL(!itRef.IsValid());
+
+    while (!ref.IsEmpty())
+    {
+      const ezInt32 iKey = ref.GetIterator().Key();
+      EZ_TEST_BOOL(m.Remove(iKey));
+      ref.Remove(iKey);
+    }
+
+    EZ_TEST_BOOL(m.IsEmpty());
+    EZ_TEST_INT(m.GetHeapMemoryUsage(), 0);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "operator == / !=")
+  {
+    ezBTreeMap<ezUInt32, ezUInt32> m, m2;
+
+    EZ_TEST_BOOL(m == m2);
+
+    for (ezInt32 i = 0; i < 1000; ++i)
+      m[i] = i * 10;
+
+    EZ_TEST_BOOL(m != m2);
+
+    m2 = m;
+
+    EZ_TEST_BOOL(m == m2);
+
+    m2[5] = 1;
+
+    EZ_TEST_BOOL(m != m2);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "CompatibleKeyType")
+  {
+    ezBTreeMap<ezString, int> stringTable;
+    const char* szChar = "Char";
+    ezStringBuilder sBuilder("Builder");
+    ezString sString("String");
+    stringTable.Insert(szChar, 1);
+    stringTable.Insert(sBuilder, 2);
+    stringTable.Insert(sString, 3);
+
+    EZ_TEST_BOOL(stringTable.Contains(szChar));
+    EZ_TEST_BOOL(stringTable.Contains(sBuilder));
+    EZ_TEST_BOOL(stringTable.Contains(sString));
+    EZ_TEST_INT(stringTable.Find(sBuilder).Value(), 2);
+
+    EZ_TEST_BOOL(stringTable.Remove(szChar));
+    EZ_TEST_BOOL(!stringTable.Contains(szChar));
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Swap")
+  {
+    ezBTreeMap<ezUInt32, ezUInt32> m, m2;
+
+    for (ezUInt32 i = 0; i < 1000; ++i)
+      m[i] = i;
+
+    m2[7] = 7;
+
+    m.Swap(m2);
+
+    EZ_TEST_INT(m.GetCount(), 1);
+    EZ_TEST_INT(m2.GetCount(), 1000);
+    EZ_TEST_INT(m[7], 7);
+    EZ_TEST_INT(m2[999], 999);
+  }
+}
@@ -0,0 +1,249 @@
+#include <FoundationTest/FoundationTestPCH.h>
+
+#include <Foundation/Containers/BTreeSet.h>
+#include <Foundation/Containers/Set.h>
+#include <Foundation/Math/Random.h>
+#include <Foundation/Strings/String.h>
+
+EZ_CREATE_SIMPLE_TEST(Containers, BTreeSet)
+{
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Constructor")
+  {
+    ezBTreeSet<ezUInt32> s;
+    ezBTreeSet<ezConstructionCounter> s2;
+
+    EZ_TEST_BOOL(s.IsEmpty());
+    EZ_TEST_INT(s.GetHeapMemoryUsage(), 0);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Construction / Destruction")
+  {
+    EZ_TEST_BOOL(ezConstructionCounter::HasAllDestructed());
+
+    {
+      ezBTreeSet<ezConstructionCounter> s;
+
+      for (ezInt32 i = 0; i < 2000; ++i)
+        s.Insert(ezConstructionCounter(i));
+
+      for (ezInt32 i = 0; i < 2000; i += 2)
+        EZ_TEST_BOOL(s.Remove(ezConstructionCounter(i)));
+
+      EZ_TEST_INT(s.GetCount(), 1000);
+    }
+
+    EZ_TEST_BOOL(ezConstructionCounter::HasAllDestructed());
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Insert / Find / Contains")
+  {
+    ezBTreeSet<ezUInt32> s;
+
+    EZ_TEST_BOOL(s.Insert(1).IsValid());
+    EZ_TEST_BOOL(s.Insert(1).IsValid());
+    EZ_TEST_INT(s.GetCount(), 1);
+
+    for (ezUInt32 i = 0; i < 1000; ++i)
+      EZ_TEST_INT(s.Insert(i * 2).Key(), i * 2);
+
+    EZ_TEST_INT(s.GetCount(), 1001);
+    EZ_TEST_BOOL(s.GetHeapMemoryUsage() >= sizeof(ezUInt32) * 1001);
+
+    for (ezUInt32 i = 0; i < 1000; ++i)
+    {
+      EZ_TEST_INT(s.Find(i * 2).Key(), i * 2);
+      EZ_TEST_BOOL(s.Contains(i * 2));
+      EZ_TEST_BOOL(s.Contains(i * 2 + 1) == (i == 0));
+    }
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Remove")
+  {
+    ezBTreeSet<ezUInt32> s;
+
+    for (ezUInt32 i = 0; i < 1000; ++i)
+      s.Insert(i);
+
+    for (ezUInt32 i = 0; i < 1000; i += 2)
+    {
+      EZ_TEST_BOOL(s.Remove(i));
+      EZ_TEST_BOOL(!s.Remove(i));
+    }
+
+    EZ_TEST_INT(s.GetCount(), 500);
+
+    for (auto it = s.GetIterator(); it.IsValid();)
+    {
+      const ezUInt32 uiKey = it.Key();
+      it = s.Remove(it);
+
+      if (it.IsValid())
+        EZ_TEST_INT(it.Key(), uiKey + 2);
+    }
+
+    EZ_TEST_BOOL(s.IsEmpty());
+    EZ_TEST_INT(s.GetHeapMemoryUsage(), 0);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Iteration")
+  {
+    ezBTreeSet<ezUInt32> s;
+
+    for (ezUInt32 i = 1000; i > 0; --i)
+      s.Insert(i - 1);
+
+    ezUInt32 i = 0;
+    for (ezUInt32 uiKey : s)
+    {
+      EZ_TEST_INT(uiKey, i);
+      ++i;
+    }
+
+    EZ_TEST_INT(i, 1000);
+
+    for (auto it = s.GetReverseIterator(); it.IsValid(); ++it)
+    {
+      --i;
+      EZ_TEST_INT(it.Key(), i);
+    }
+
+    EZ_TEST_INT(i, 0);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "LowerBound / UpperBound")
+  {
+    ezBTreeSet<ezInt32> s;
+
+    for (ezInt32 i = 0; i < 1000; ++i)
+      s.Insert(i * 2);
+
+    for (ezInt32 i = -1; i < 1998; ++i)
+    {
+      EZ_TEST_INT(s.LowerBound(i).Key(), (i + 1) / 2 * 2);
+      EZ_TEST_INT(s.UpperBound(i).Key(), (i + 2) / 2 * 2);
+    }
+
+    EZ_TEST_BOOL(!s.LowerBound(1999).IsValid());
+    EZ_TEST_BOOL(!s.UpperBound(1998).IsValid());
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Union / Difference / Intersection / ContainsSet")
+  {
+    ezBTreeSet<ezUInt32> a, b;
+
+    for (ezUInt32 i = 0; i < 100; ++i)
+      a.Insert(i);
+
+    for (ezUInt32 i = 50; i < 150; ++i)
+      b.Insert(i);
+
+    ezBTreeSet<ezUInt32> u(a);
+    u.Union(b);
+    EZ_TEST_INT(u.GetCount(), 150);
+    EZ_TEST_BOOL(u.ContainsSet(a));
+    EZ_TEST_BOOL(u.ContainsSet(b));
+    EZ_TEST_BOOL(!a.ContainsSet(u));
+
+    ezBTreeSet<ezUInt32> d(a);
+    d.Difference(b);
+    EZ_TEST_INT(d.GetCount(), 50);
+    EZ_TEST_BOOL(d.Contains(49));
+    EZ_TEST_BOOL(!d.Contains(50));
+
+    ezBTreeSet<ezUInt32> n(a);
+    n.Intersection(b);
+    EZ_TEST_INT(n.GetCount(), 50);
+    EZ_TEST_BOOL(!n.Contains(49));
+    EZ_TEST_BOOL(n.Contains(50));
+    EZ_TEST_BOOL(n.Contains(99));
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "BuildFromSorted")
+  {
+    ezDynamicArray<ezString> keys;
+    ezStringBuilder sKey;
+
+    for (ezUInt32 i = 0; i < 5000; ++i)
+    {
+      sKey.SetFormat("{}", ezArgU(i, 5, true));
+      keys.PushBack(sKey);
+    }
+
+    ezBTreeSet<ezString> s;
+    s.BuildFromSorted(keys);
+
+    EZ_TEST_INT(s.GetCount(), 5000);
+
+    ezUInt32 i = 0;
+    for (const ezString& key : s)
+    {
+      EZ_TEST_BOOL(key == keys[i]);
+      ++i;
+    }
+
+    EZ_TEST_BOOL(s.Contains("01234"));
+    EZ_TEST_BOOL(!s.Contains("1234"));
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Random Insert / Remove (compared to ezSet)")
+  {
+    ezRandom rnd;
+    rnd.Initialize(7);
+
+    ezBTreeSet<ezUInt32> s;
+    ezSet<ezUInt32> ref;
+
+    for (ezUInt32 r = 0; r < 20000; ++r)
+    {
+      const ezUInt32 uiKey = rnd.UIntInRange(3000);
+
+      if (rnd.UIntInRange(100) < (r < 10000 ? 70u : 30u))
+      {
+        s.Insert(uiKey);
+        ref.Insert(uiKey);
+      }
+      else
+      {
+        EZ_TEST_BOOL(s.Remove(uiKey) == ref.Remove(uiKey));
+      }
+    }
+
+    EZ_TEST_INT(s.GetCount(), ref.GetCount());
+
+    auto itRef = ref.GetIterator();
+    for (ezUInt32 uiKey : s)
+    {
+      EZ_TEST_INT(uiKey, itRef.Key());
+      ++itRef;
+    }
+
+    EZ_TEST_BOOL(!itRef.IsValid());
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "operator == / != / Swap")
+  {
+    ezBTreeSet<ezUInt32> s, s2;
+
+    EZ_TEST_BOOL(s == s2);
+
+    for (ezUInt32 i = 0; i < 1000; ++i)
+      s.Insert(i);
+
+    EZ_TEST_BOOL(s != s2);
+
+    s2 = s;
+    EZ_TEST_BOOL(s == s2);
+
+    s2.Remove(5u);
+    s2.Insert(1001u);
+    EZ_TEST_BOOL(s != s2);
+
+    ezBTreeSet<ezUInt32> s3;
+    s3.Insert(7u);
+    s3.Swap(s);
+
+    EZ_TEST_INT(s.GetCount(), 1);
+    EZ_TEST_INT(s3.GetCount(), 1000);
+    EZ_TEST_BOOL(s.Contains(7u));
+  }
+}
@@ -0,0 +1,483 @@
+#include <FoundationTest/FoundationTestPCH.h>
+
+#include <Foundation/Containers/HashTable.h>
+#include <Foundation/Containers/SwissHashTable.h>
+#include <Foundation/Math/Random.h>
+#include <Foundation/Memory/CommonAllocators.h>
+#include <Foundation/Strings/String.h>
+
+namespace SwissHashTableTestDetail
+{
+  struct Collision
+  {
+    ezUInt32 hash;
+    int key;
+
+    inline Collision(ezUInt32 uiHash, int iKey)
+    {
+      this->hash = uiHash;
+      this->key = iKey;
+    }
+
+    inline bool operator==(const Collision& other) const { return key == other.key; }
+
+    EZ_DECLARE_POD_TYPE();
+  };
+} // namespace SwissHashTableTestDetail
+
+template <>
+struct ezHashHelper<SwissHashTableTestDetail::Collision>
+{
+  EZ_ALWAYS_INLINE static ezUInt32 Hash(const SwissHashTableTestDetail::Collision& value) { return value.hash; }
+
+  EZ_ALWAYS_INLINE static bool Equal(const SwissHashTableTestDetail::Collision& a, const SwissHashTableTestDetail::Collision& b) { return a == b; }
+};
+
+EZ_CREATE_SIMPLE_TEST(Containers, SwissHashTable)
+{
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Constructor")
+  {
+    ezSwissHashTable<ezInt32, ezConstructionCounter> table;
+
+    EZ_TEST_BOOL(table.IsEmpty());
+    EZ_TEST_INT(table.GetCount(), 0);
+    EZ_TEST_INT(table.GetHeapMemoryUsage(), 0);
+    EZ_TEST_BOOL(!table.GetIterator().IsValid());
+    EZ_TEST_BOOL(table.GetIterator() == table.GetEndIterator());
+    EZ_TEST_BOOL(!table.Contains(3));
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Copy Constructor/Assignment/Iterator")
+  {
+    EZ_TEST_BOOL(ezConstructionCounter::HasAllDestructed());
+
+    {
+      ezSwissHashTable<ezInt32, ezConstructionCounter> table1;
+
+      for (ezInt32 i = 0; i < 100; ++i)
+        table1.Insert(i * 7, ezConstructionCounter(i));
+
+      ezSwissHashTable<ezInt32, ezConstructionCounter> table2;
+      table2 = table1;
+      ezSwissHashTable<ezInt32, ezConstructionCounter> table3(table1);
+
+      EZ_TEST_INT(table2.GetCount(), 100);
+      EZ_TEST_INT(table3.GetCount(), 100);
+
+      ezUInt32 uiCounter = 0;
+      for (auto it = table1.GetIterator(); it.IsValid(); ++it)
+      {
+        ezConstructionCounter value;
+
+        EZ_TEST_BOOL(table2.TryGetValue(it.Key(), value));
+        EZ_TEST_INT(it.Value().m_iData, value.m_iData);
+        EZ_TEST_INT(it.Key(), value.m_iData * 7);
+
+        EZ_TEST_BOOL(table3.TryGetValue(it.Key(), value));
+        EZ_TEST_INT(it.Value().m_iData, value.m_iData);
+
+        ++uiCounter;
+      }
+      EZ_TEST_INT(uiCounter, 100);
+
+      // assigning to a table with elements and a different capacity
+      ezSwissHashTable<ezInt32, ezConstructionCounter> table4;
+      for (ezInt32 i = 0; i < 1000; ++i)
+        table4.Insert(-i, ezConstructionCounter(i));
+
+      table4 = table1;
+      EZ_TEST_BOOL(table4 == table1);
+    }
+
+    EZ_TEST_BOOL(ezConstructionCounter::HasAllDestructed());
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Move Copy Constructor/Assignment")
+  {
+    ezSwissHashTable<ezInt32, ezConstructionCounter> table1;
+    for (ezInt32 i = 0; i < 64; ++i)
+      table1.Insert(i, ezConstructionCounter(i));
+
+    const ezUInt64 uiMemoryUsage = table1.GetHeapMemoryUsage();
+
+    ezSwissHashTable<ezInt32, ezConstructionCounter> table2(std::move(table1));
+    EZ_TEST_INT(table1.GetCount(), 0);
+    EZ_TEST_INT(table1.GetHeapMemoryUsage(), 0);
+    EZ_TEST_INT(table2.GetCount(), 64);
+    EZ_TEST_INT(table2.GetHeapMemoryUsage(), uiMemoryUsage);
+
+    ezSwissHashTable<ezInt32, ezConstructionCounter> table3;
+    table3 = std::move(table2);
+    EZ_TEST_INT(table2.GetCount(), 0);
+    EZ_TEST_INT(table3.GetCount(), 64);
+
+    // moving between different allocators moves the individual elements
+    ezProxyAllocator proxyAllocator("SwissHashTableTest", ezFoundation::GetDefaultAllocator());
+    {
+      ezSwissHashTable<ezInt32, ezConstructionCounter> table4(&proxyAllocator);
+      table4 = std::move(table3);
+      EZ_TEST_INT(table3.GetCount(), 0);
+      EZ_TEST_INT(table4.GetCount(), 64);
+
+      for (ezInt32 i = 0; i < 64; ++i)
+        EZ_TEST_INT(table4[i].m_iData, i);
+    }
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Collision Tests")
+  {
+    ezSwissHashTable<SwissHashTableTestDetail::Collision, int> map;
+
+    // all keys end up with the same control byte and the same start group
+    for (int i = 0; i < 200; ++i)
+      map[SwissHashTableTestDetail::Collision(0, i)] = i;
+
+    // a second chain of collisions that is interleaved with the first one
+    for (int i = 0; i < 50; ++i)
+      map[SwissHashTableTestDetail::Collision(16, 1000 + i)] = 1000 + i;
+
+    EZ_TEST_INT(map.GetCount(), 250);
+
+    for (int i = 0; i < 200; ++i)
+      EZ_TEST_INT(map[SwissHashTableTestDetail::Collision(0, i)], i);
+
+    for (int i = 0; i < 200; i += 2)
+      EZ_TEST_BOOL(map.Remove(SwissHashTableTestDetail::Collision(0, i)));
+
+    // elements behind removed ones must still be found
+    for (int i = 0; i < 200; ++i)
+      EZ_TEST_BOOL(map.Contains(SwissHashTableTestDetail::Collision(0, i)) == ((i & 1) != 0));
+
+    for (int i = 0; i < 50; ++i)
+      EZ_TEST_BOOL(map.Contains(SwissHashTableTestDetail::Collision(16, 1000 + i)));
+
+    EZ_TEST_BOOL(!map.Contains(SwissHashTableTestDetail::Collision(0, 5000)));
+    EZ_TEST_INT(map.GetCount(), 150);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Clear")
+  {
+    EZ_TEST_BOOL(ezConstructionCounter::HasAllDestructed());
+
+    {
+      ezSwissHashTable<ezUInt32, ezConstructionCounter> m1;
+      m1[0] = ezConstructionCounter(1);
+      EZ_TEST_BOOL(ezConstructionCounter::HasDone(2, 1)); // for inserting new elements 1 temporary is created (and destroyed)
+
+      m1[1] = ezConstructionCounter(3);
+      EZ_TEST_BOOL(ezConstructionCounter::HasDone(2, 1)); // for inserting new elements 2 temporary is created (and destroyed)
+
+      m1[0] = ezConstructionCounter(2);
+      EZ_TEST_BOOL(ezConstructionCounter::HasDone(1, 1)); // nothing new to create, so only the one temporary is used
+
+      m1.Clear();
+      EZ_TEST_BOOL(ezConstructionCounter::HasDone(0, 2));
+      EZ_TEST_BOOL(ezConstructionCounter::HasAllDestructed());
+      EZ_TEST_BOOL(m1.IsEmpty());
+      EZ_TEST_BOOL(m1.GetHeapMemoryUsage() > 0);
+    }
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Insert/TryGetValue/GetValue")
+  {
+    ezSwissHashTable<ezInt32, ezConstructionCounter> a1;
+
+    for (ezInt32 i = 0; i < 10; ++i)
+      EZ_TEST_BOOL(!a1.Insert(i, i - 20));
+
+    for (ezInt32 i = 0; i < 10; ++i)
+    {
+      ezConstructionCounter oldValue;
+      EZ_TEST_BOOL(a1.Insert(i, i, &oldValue));
+      EZ_TEST_INT(oldValue.m_iData, i - 20);
+    }
+
+    ezConstructionCounter value;
+    EZ_TEST_BOOL(a1.TryGetValue(9, value));
+    EZ_TEST_INT(value.m_iData, 9);
+
+    EZ_TEST_BOOL(!a1.TryGetValue(11, value));
+    EZ_TEST_INT(value.m_iData, 9);
+
+    ezConstructionCounter* pValue;
+    EZ_TEST_BOOL(a1.TryGetValue(9, pValue));
+    EZ_TEST_INT(pValue->m_iData, 9);
+
+    pValue->m_iData = 20;
+    EZ_TEST_INT(a1[9].m_iData, 20);
+
+    const ezConstructionCounter* pConstValue = nullptr;
+    const ezSwissHashTable<ezInt32, ezConstructionCounter>& constA1 = a1;
+    EZ_TEST_BOOL(constA1.TryGetValue(3, pConstValue));
+    EZ_TEST_INT(pConstValue->m_iData, 3);
+
+    EZ_TEST_BOOL(a1.GetValue(11) == nullptr);
+    EZ_TEST_INT(a1.GetValue(2)->m_iData, 2);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Remove/Compact")
+  {
+    ezSwissHashTable<ezInt32, ezConstructionCounter> a;
+
+    EZ_TEST_BOOL(a.GetHeapMemoryUsage() == 0);
+
+    for (ezInt32 i = 0; i < 1000; ++i)
+    {
+      a.Insert(i, i);
+      EZ_TEST_INT(a.GetCount(), i + 1);
+    }
+
+    EZ_TEST_BOOL(a.GetHeapMemoryUsage() >= 1000 * (sizeof(ezInt32) + sizeof(ezConstructionCounter)));
+
+    a.Compact();
+
+    for (ezInt32 i = 0; i < 500; ++i)
+    {
+      ezConstructionCounter oldValue;
+      EZ_TEST_BOOL(a.Remove(i, &oldValue));
+      EZ_TEST_INT(oldValue.m_iData, i);
+      EZ_TEST_BOOL(!a.Remove(i));
+    }
+
+    const ezUInt64 uiMemoryBefore = a.GetHeapMemoryUsage();
+    a.Compact();
+    EZ_TEST_BOOL(a.GetHeapMemoryUsage() < uiMemoryBefore);
+
+    for (ezInt32 i = 500; i < 1000; ++i)
+    {
+      EZ_TEST_INT(a[i].m_iData, i);
+    }
+
+    a.Clear();
+    a.Compact();
+
+    EZ_TEST_BOOL(a.GetHeapMemoryUsage() == 0);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Remove/Iterator")
+  {
+    ezSwissHashTable<ezInt32, ezInt32> a;
+
+    for (ezInt32 i = 0; i < 1000; ++i)
+      a.Insert(i, i * 2);
+
+    // removing every other element while iterating
+    ezUInt32 uiVisited = 0;
+    for (auto it = a.GetIterator(); it.IsValid();)
+    {
+      ++uiVisited;
+
+      if ((it.Key() & 1) == 0)
+        it = a.Remove(it);
+      else
+        ++it;
+    }
+
+    EZ_TEST_INT(uiVisited, 1000);
+    EZ_TEST_INT(a.GetCount(), 500);
+
+    for (ezInt32 i = 0; i < 1000; ++i)
+      EZ_TEST_BOOL(a.Contains(i) == ((i & 1) != 0));
+
+    for (auto it = a.GetIterator(); it.IsValid();)
+      it = a.Remove(it);
+
+    EZ_TEST_BOOL(a.IsEmpty());
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Reserve")
+  {
+    ezSwissHashTable<ezInt32, ezInt32> a;
+    a.Reserve(1000);
+
+    const ezUInt64 uiMemory = a.GetHeapMemoryUsage();
+    EZ_TEST_BOOL(uiMemory >= 1000 * sizeof(ezInt32) * 2);
+
+    for (ezInt32 i = 0; i < 1000; ++i)
+      a.Insert(i, i);
+
+    EZ_TEST_INT(a.GetHeapMemoryUsage(), uiMemory);
+
+    // continuous removal and insertion must not grow the table
+    for (ezInt32 i = 1000; i < 100000; ++i)
+    {
+      a.Remove(i - 1000);
+      a.Insert(i, i);
+    }
+
+    EZ_TEST_INT(a.GetCount(), 1000);
+    EZ_TEST_INT(a.GetHeapMemoryUsage(), uiMemory);
+
+    for (ezInt32 i = 99000; i < 100000; ++i)
+      EZ_TEST_INT(*a.GetValue(i), i);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "operator[] / FindOrAdd")
+  {
+    ezSwissHashTable<ezInt32, ezInt32> a;
+
+    a.Insert(4, 20);
+    a[2] = 22;
+
+    EZ_TEST_INT(a[2], 22);
+    EZ_TEST_INT(a[4], 20);
+
+    bool bExisted = true;
+    a.FindOrAdd(5, &bExisted) = 7;
+    EZ_TEST_BOOL(!bExisted);
+    EZ_TEST_INT(a.FindOrAdd(5, &bExisted), 7);
+    EZ_TEST_BOOL(bExisted);
+    EZ_TEST_INT(a.GetCount(), 3);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "operator==/!=")
+  {
+    ezSwissHashTable<ezInt32, ezInt32> a, b;
+
+    EZ_TEST_BOOL(a == b);
+
+    for (ezInt32 i = 0; i < 100; ++i)
+      a[i] = i * 10;
+
+    // different insertion order
+    for (ezInt32 i = 99; i >= 0; --i)
+      b[i] = i * 10;
+
+    EZ_TEST_BOOL(a == b);
+
+    b[100] = 1000;
+    EZ_TEST_BOOL(a != b);
+
+    b.Remove(100);
+    b[5] = 0;
+    EZ_TEST_BOOL(a != b);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "CompatibleKeyType")
+  {
+    ezSwissHashTable<ezString, int> stringTable;
+    const char* szChar = "Char";
+    const char* szString = "ViewBla";
+    ezStringView sView(szString, szString + 4);
+    ezStringBuilder sBuilder("Builder");
+    ezString sString("String");
+
+    EZ_TEST_BOOL(!stringTable.Insert(szChar, 1));
+    EZ_TEST_BOOL(!stringTable.Insert(sView, 2));
+    EZ_TEST_BOOL(!stringTable.Insert(sBuilder, 3));
+    EZ_TEST_BOOL(!stringTable.Insert(sString, 4));
+    EZ_TEST_BOOL(!stringTable.Insert(szString, 5));
+    EZ_TEST_BOOL(stringTable.Insert(sView, 6));
+
+    EZ_TEST_BOOL(stringTable.Contains(szChar));
+    EZ_TEST_BOOL(stringTable.Contains(sView));
+    EZ_TEST_BOOL(stringTable.Contains(sBuilder));
+    EZ_TEST_BOOL(stringTable.Contains(sString));
+
+    EZ_TEST_INT(*stringTable.GetValue(szChar), 1);
+    EZ_TEST_INT(*stringTable.GetValue(sView), 6);
+    EZ_TEST_INT(*stringTable.GetValue(sBuilder), 3);
+    EZ_TEST_INT(*stringTable.GetValue(sString), 4);
+    EZ_TEST_INT(*stringTable.GetValue("ViewBla"), 5);
+
+    EZ_TEST_BOOL(stringTable.Remove(szChar));
+    EZ_TEST_BOOL(stringTable.Remove(sView));
+    EZ_TEST_BOOL(stringTable.Remove(sBuilder));
+    EZ_TEST_BOOL(stringTable.Remove(sString));
+    EZ_TEST_INT(stringTable.GetCount(), 1);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Swap")
+  {
+    ezSwissHashTable<ezInt32, ezInt32> a, b;
+
+    for (ezInt32 i = 0; i < 100; ++i)
+      a[i] = i;
+
+    b[1000] = 1;
+
+    a.Swap(b);
+
+    EZ_TEST_INT(a.GetCount(), 1);
+    EZ_TEST_INT(b.GetCount(), 100);
+    EZ_TEST_INT(a[1000], 1);
+    EZ_TEST_INT(b[50], 50);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "foreach / Find")
+  {
+    ezSwissHashTable<ezInt32, ezInt32> a;
+
+    for (ezInt32 i = 0; i < 100; ++i)
+      a[i] = i * 2;
+
+    ezInt32 iSum = 0;
+    for (auto it : a)
+    {
+      EZ_TEST_INT(it.Value(), it.Key() * 2);
+      it.Value() = it.Key();
+      iSum += it.Key();
+    }
+
+    EZ_TEST_INT(iSum, 99 * 50);
+
+    for (auto it : static_cast<const ezSwissHashTable<ezInt32, ezInt32>&>(a))
+    {
+      EZ_TEST_INT(it.Value(), it.Key());
+    }
+
+    auto it = a.Find(45);
+    EZ_TEST_BOOL(it.IsValid());
+    EZ_TEST_INT(it.Value(), 45);
+    it.Value() = 2;
+    EZ_TEST_INT(a[45], 2);
+
+    EZ_TEST_BOOL(!a.Find(100).IsValid());
+    EZ_TEST_BOOL(a.Find(100) == a.GetEndIterator());
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Random Insert / Remove (compared to ezHashTable)")
+  {
+    ezRandom rnd;
+    rnd.Initialize(11);
+
+    ezSwissHashTable<ezUInt64, ezUInt32> table;
+    ezHashTable<ezUInt64, ezUInt32> ref;
+
+    for (ezUInt32 r = 0; r < 50000; ++r)
+    {
+      const ezUInt64 uiKey = rnd.UIntInRange(5000);
+
+      switch (rnd.UIntInRange(4))
+      {
+        case 0:
+        case 1:
+          EZ_TEST_BOOL(table.Insert(uiKey, r) == ref.Insert(uiKey, r));
+          break;
+
+        case 2:
+          EZ_TEST_BOOL(table.Remove(uiKey) == ref.Remove(uiKey));
+          break;
+
+        case 3:
+          EZ_TEST_BOOL(table.Contains(uiKey) == ref.Contains(uiKey));
+          break;
+      }
+
+      if (r % 10000 == 0)
+        table.Compact();
+    }
+
+    EZ_TEST_INT(table.GetCount(), ref.GetCount());
+
+    ezUInt32 uiCount = 0;
+    for (auto it : table)
+    {
+      const ezUInt32* pValue = ref.GetValue(it.Key());
+      EZ_TEST_BOOL(pValue != nullptr && *pValue == it.Value());
+      ++uiCount;
+    }
+
+    EZ_TEST_INT(uiCount, ref.GetCount());
+  }
+}
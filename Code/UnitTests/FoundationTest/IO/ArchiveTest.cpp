@@ -6,6 +6,7 @@
 #include <Foundation/IO/FileSystem/FileReader.h>
 #include <Foundation/IO/FileSystem/FileSystem.h>
 #include <Foundation/IO/FileSystem/FileWriter.h>
+#include <Foundation/IO/MemoryStream.h>
 #include <Foundation/System/Process.h>
 #include <Foundation/Utilities/CommandLineUtils.h>
 
@@ -150,6 +151,30 @@ EZ_CREATE_SIMPLE_TEST(IO, Archive)
       EZ_TEST_FILES(sFileSrc, sFileDst, "Unpacked file should be identical");
     }
 
+    // uncompressed entries are read directly from the memory mapped archive
+    {
+      ezFileReader file;
+      EZ_TEST_BOOL(file.Open(":archive/FolderA/File2.jpg").Succeeded());
+
+      const ezArrayPtr<const ezUInt8> memoryView = file.GetMemoryView();
+      EZ_TEST_INT(memoryView.GetCount(), uiMinFileSize * sizeof(ezUInt64));
+
+      ezUInt64 uiValue = 0;
+      ezRawMemoryStreamReader viewReader(memoryView.GetPtr(), memoryView.GetCount());
+      viewReader.SkipBytes(memoryView.GetCount() - sizeof(ezUInt64));
+      viewReader >> uiValue;
+      EZ_TEST_INT(uiValue, uiMinFileSize - 1);
+    }
+
+    // files in regular folders are not kept in memory
+    {
+      sFileSrc.Set(":output/", szTestData, "/", szFileList[1]);
+
+      ezFileReader file;
+      EZ_TEST_BOOL(file.Open(sFileSrc).Succeeded());
+      EZ_TEST_BOOL(file.GetMemoryView().IsEmpty());
+    }
+
     // mount a second time
     if (!EZ_TEST_BOOL(ezFileSystem::AddDataDirectory(sArchiveFile, "Clear", "archive2", ezDataDirUsage::ReadOnly) == EZ_SUCCESS))
       return;
@@ -331,4 +331,97 @@ string{\"s\\2\",\"bla\"}\n\
     ezOpenDdlReader doc;
     EZ_TEST_BOOL(doc.ParseDocument(stream).Failed());
   }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Memory Input")
+  {
+    const char* szTestData = "\
+string{\"s1\",\"\\n\\t\\r\",\"a string that is longer than sixteen bytes\",\"\"}\n\
+float{0,1.1,-3,23.42}\n\
+int32{0,100002,300040,56000000,700008,1000009,100000207,-100000004,-506000000,-1020700000}\n\
+unsigned_int64{0,100002111,300040222,560000003333,70000844444,1000009555555,100000207666666,1000000047777777,50600000008888888,102070000099999}\n\
+";
+
+    ezOpenDdlReader doc;
+    EZ_TEST_BOOL(doc.ParseDocument(ezArrayPtr<const ezUInt8>((const ezUInt8*)szTestData, ezStringUtils::GetStringElementCount(szTestData))).Succeeded());
+
+    TestDoc(doc, szTestData);
+    EZ_TEST_BOOL(!doc.HadFatalParsingError());
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Memory Input Fatal Errors")
+  {
+    const char* szTestData = "\
+string{\"s1\",\"back\\slash\"\n\
+string{\"s\\2\",\"bla\"}\n\
+";
+
+    ezTestLogInterface log;
+    ezTestLogSystemScope logSystemScope(&log);
+
+    log.ExpectMessage("Unknown escape-sequence '\\s'", ezLogMsgType::WarningMsg);
+    log.ExpectMessage("Line 2 (2): Expected , or } or a \"", ezLogMsgType::ErrorMsg);
+
+    ezOpenDdlReader doc;
+    EZ_TEST_BOOL(doc.ParseDocument(ezArrayPtr<const ezUInt8>((const ezUInt8*)szTestData, ezStringUtils::GetStringElementCount(szTestData))).Failed());
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Large Document")
+  {
+    // large enough that strings and numbers cross the boundaries of the buffer that the stream is read into
+    ezContiguousMemoryStreamStorage storage;
+    {
+      ezMemoryStreamWriter writer(&storage);
+
+      ezOpenDdlWriter ddl;
+      ddl.SetOutputStream(&writer);
+      ddl.SetPrimitiveTypeStringMode(ezOpenDdlWriter::TypeStringMode::Compliant);
+      ddl.SetFloatPrecisionMode(ezOpenDdlWriter::FloatPrecisionMode::Readable);
+
+      ezStringBuilder sValue;
+      for (ezUInt32 i = 0; i < 500; ++i)
+      {
+        ddl.BeginObject("Object");
+
+        sValue.SetFormat("Value {} with some padding to make it longer", i);
+        for (ezUInt32 j = 0; j < i % 7; ++j)
+          sValue.Append("_x");
+
+        ddl.BeginPrimitiveList(ezOpenDdlPrimitiveType::String);
+        ddl.WriteString(sValue);
+        ddl.EndPrimitiveList();
+
+        const ezInt32 iValues[] = {static_cast<ezInt32>(i) * 7919, -static_cast<ezInt32>(i), 123456789};
+        ddl.BeginPrimitiveList(ezOpenDdlPrimitiveType::Int32);
+        ddl.WriteInt32(iValues, 3);
+        ddl.EndPrimitiveList();
+
+        const double fValues[] = {i * 0.25, -1.5};
+        ddl.BeginPrimitiveList(ezOpenDdlPrimitiveType::Double);
+        ddl.WriteDouble(fValues, 2);
+        ddl.EndPrimitiveList();
+
+        ddl.EndObject();
+      }
+
+      ezUInt8 term = 0;
+      writer.WriteBytes(&term, 1).IgnoreResult();
+    }
+
+    const char* szTestData = (const char*)storage.GetData();
+    EZ_TEST_BOOL(ezStringUtils::GetStringElementCount(szTestData) > 4096 * 4);
+
+    {
+      StringStream stream(szTestData);
+
+      ezOpenDdlReader doc;
+      EZ_TEST_BOOL(doc.ParseDocument(stream).Succeeded());
+      TestDoc(doc, szTestData);
+    }
+
+    {
+      ezOpenDdlReader doc;
+      EZ_TEST_BOOL(doc.ParseDocument(ezArrayPtr<const ezUInt8>((const ezUInt8*)szTestData, ezStringUtils::GetStringElementCount(szTestData))).Succeeded());
+      TestDoc(doc, szTestData);
+    }
+  }
 }
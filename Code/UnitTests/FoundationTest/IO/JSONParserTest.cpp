@@ -81,6 +81,12 @@ public:
     ParseAll();
   }
 
+  void ParseMemory(const char* szData)
+  {
+    SetInputMemory(ezArrayPtr<const ezUInt8>((const ezUInt8*)szData, ezStringUtils::GetStringElementCount(szData)));
+    ParseAll();
+  }
+
   void Add(ParseResult pr) { m_Results.PushBack(pr); }
 
   virtual bool OnVariable(ezStringView sVarName) override
@@ -683,4 +689,81 @@ EZ_CREATE_SIMPLE_TEST(IO, JSONParser)
 
     EZ_TEST_INT(reader.m_iExpectedParsingErrors, 0);
   }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Memory Input")
+  {
+    const char* szTestData = "{\n\
+\"a variable name longer than 16 bytes\" : \"a string value that is longer than 16 bytes\",\n\
+\"escaped\" : \"tab\\there \\\"quoted\\\"\",\n\
+\"numbers\" : [1, -2.5, 3e2, 0.125 ],\n\
+\"skip_var\" : { \"a\" : \"b\" },\n\
+\"bool\" : false\n\
+}";
+
+    TestReader reader;
+
+    reader.Add(ParseResult(BeginObject));
+    reader.Add(ParseResult(Variable, "a variable name longer than 16 bytes"));
+    reader.Add(ParseResult("a string value that is longer than 16 bytes"));
+    reader.Add(ParseResult(Variable, "escaped"));
+    reader.Add(ParseResult("tab\there \"quoted\""));
+    reader.Add(ParseResult(Variable, "numbers"));
+    reader.Add(ParseResult(BeginArray));
+    reader.Add(ParseResult(1.0));
+    reader.Add(ParseResult(-2.5));
+    reader.Add(ParseResult(300.0));
+    reader.Add(ParseResult(0.125));
+    reader.Add(ParseResult(EndArray));
+    reader.Add(ParseResult(Variable, "skip_var"));
+    reader.Add(ParseResult(Variable, "bool"));
+    reader.Add(ParseResult(false));
+    reader.Add(ParseResult(EndObject));
+
+    reader.ParseMemory(szTestData);
+
+    EZ_TEST_INT(reader.m_iExpectedParsingErrors, 0);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Large Document")
+  {
+    // large enough that strings and numbers cross the boundaries of the buffer that the stream is read into
+    ezStringBuilder sDocument = "[";
+    for (ezUInt32 i = 0; i < 1000; ++i)
+    {
+      sDocument.AppendFormat("\"value {} with some padding\", {}.5,\n", i, i * 7919);
+    }
+    sDocument.Append("true]");
+
+    for (ezUInt32 uiMode = 0; uiMode < 2; ++uiMode)
+    {
+      TestReader reader;
+
+      ezStringBuilder sValue;
+      ezDeque<ezString> values;
+
+      reader.Add(ParseResult(BeginArray));
+      for (ezUInt32 i = 0; i < 1000; ++i)
+      {
+        sValue.SetFormat("value {} with some padding", i);
+        values.PushBack(sValue);
+
+        reader.Add(ParseResult(values.PeekBack().GetData()));
+        reader.Add(ParseResult(i * 7919 + 0.5));
+      }
+      reader.Add(ParseResult(true));
+      reader.Add(ParseResult(EndArray));
+
+      if (uiMode == 0)
+      {
+        StringStream stream(sDocument.GetData());
+        reader.ParseStream(stream);
+      }
+      else
+      {
+        reader.ParseMemory(sDocument);
+      }
+
+      EZ_TEST_INT(reader.m_iExpectedParsingErrors, 0);
+    }
+  }
 }
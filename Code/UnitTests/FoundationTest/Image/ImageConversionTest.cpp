@@ -11,6 +11,7 @@
 #include <Texture/Image/Formats/ImageFileFormat.h>
 #include <Texture/Image/Image.h>
 #include <Texture/Image/ImageConversion.h>
+#include <Texture/TexConv/TexComparer.h>
 
 static const ezImageFormat::Enum defaultFormat = ezImageFormat::R32G32B32A32_FLOAT;
 
@@ -230,3 +231,83 @@ private:
 };
 
 static ezImageConversionTest s_ImageConversionTest;
+
+EZ_CREATE_SIMPLE_TEST(Image, ImageCompression)
+{
+  // large enough that the block compressors split the work into several stripes
+  ezImageHeader header;
+  header.SetImageFormat(ezImageFormat::R8G8B8A8_UNORM);
+  header.SetWidth(516);
+  header.SetHeight(260);
+
+  ezImage source;
+  source.ResetAndAlloc(header);
+
+  for (ezUInt32 y = 0; y < header.GetHeight(); ++y)
+  {
+    ezColorLinearUB* pRow = source.GetPixelPointer<ezColorLinearUB>(0, 0, 0, 0, y);
+
+    for (ezUInt32 x = 0; x < header.GetWidth(); ++x)
+    {
+      pRow[x] = ezColorLinearUB(static_cast<ezUInt8>(x / 2), static_cast<ezUInt8>(y), ((x / 16 + y / 16) % 2) ? 200 : 50, 255);
+    }
+  }
+
+  auto CompressAndCompare = [](const ezImage& image, ezImageFormat::Enum format, const ezImageCompressionSettings& settings) -> float
+  {
+    ezTexComparer comparer;
+    comparer.m_Descriptor.m_ExpectedImage.ResetAndCopy(image);
+
+    ezImage compressed;
+    EZ_TEST_BOOL(ezImageConversion::Convert(image, compressed, format, settings).Succeeded());
+    EZ_TEST_INT(compressed.GetImageFormat(), format);
+
+    EZ_TEST_BOOL(ezImageConversion::Convert(compressed, comparer.m_Descriptor.m_ActualImage, ezImageFormat::R8G8B8A8_UNORM).Succeeded());
+    EZ_TEST_BOOL(comparer.Compare().Succeeded());
+
+    return comparer.m_fOutputPSNR;
+  };
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "BC7 Quality")
+  {
+    if (!ezImageConversion::IsConvertible(ezImageFormat::R8G8B8A8_UNORM, ezImageFormat::BC7_UNORM))
+      return;
+
+    ezImageCompressionSettings settings;
+
+    settings.m_Quality = ezImageCompressionQuality::Fast;
+    const float fFast = CompressAndCompare(source, ezImageFormat::BC7_UNORM, settings);
+
+    settings.m_Quality = ezImageCompressionQuality::Final;
+    const float fFinal = CompressAndCompare(source, ezImageFormat::BC7_UNORM, settings);
+
+    EZ_TEST_BOOL(fFast > 35.0f);
+    EZ_TEST_BOOL(fFinal > 35.0f);
+    EZ_TEST_BOOL(fFinal >= fFast);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "BC7 RDO")
+  {
+    if (!ezImageConversion::IsConvertible(ezImageFormat::R8G8B8A8_UNORM, ezImageFormat::BC7_UNORM))
+      return;
+
+    ezImageCompressionSettings settings;
+    settings.m_fRdoLambda = 1.0f;
+
+    EZ_TEST_BOOL(CompressAndCompare(source, ezImageFormat::BC7_UNORM, settings) > 30.0f);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "BC5")
+  {
+    // BC5 only stores two channels, the decoded image has a black blue channel
+    ezImage twoChannels;
+    twoChannels.ResetAndCopy(source);
+
+    for (ezColorLinearUB& color : twoChannels.GetBlobPtr<ezColorLinearUB>())
+    {
+      color.b = 0;
+    }
+
+    EZ_TEST_BOOL(CompressAndCompare(twoChannels, ezImageFormat::BC5_UNORM, {}) > 35.0f);
+  }
+}
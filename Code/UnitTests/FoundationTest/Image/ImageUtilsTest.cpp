@@ -3,6 +3,7 @@
 #include <Foundation/IO/FileSystem/DataDirTypeFolder.h>
 #include <Foundation/IO/FileSystem/FileReader.h>
 #include <Foundation/IO/FileSystem/FileSystem.h>
+#include <Texture/Image/ImageFilter.h>
 #include <Texture/Image/ImageUtils.h>
 
 
@@ -128,5 +129,100 @@ EZ_CREATE_SIMPLE_TEST(Image, ImageUtils)
     EZ_TEST_INT(uiError, 1433);
   }
 
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Filter SamplePoints")
+  {
+    ezImageFilterBox filterBox;
+    ezImageFilterTriangle filterTriangle;
+    ezImageFilterSincWithKaiserWindow filterKaiser;
+
+    const ezImageFilter* filters[] = {&filterBox, &filterTriangle, &filterKaiser};
+
+    for (const ezImageFilter* pFilter : filters)
+    {
+      for (float x = -4.0f; x < 4.0f; x += 4 * 0.0137f)
+      {
+        const ezSimdVec4f vX(x, x + 0.0137f, x + 2 * 0.0137f, x + 3 * 0.0137f);
+        const ezSimdVec4f vResult = pFilter->SamplePoints(vX);
+
+        for (int i = 0; i < 4; ++i)
+        {
+          EZ_TEST_FLOAT(vResult.GetComponent(i), pFilter->SamplePoint(vX.GetComponent(i)), 0.0001f);
+        }
+      }
+    }
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Scale3D Depth")
+  {
+    ezImageHeader header;
+    header.SetImageFormat(ezImageFormat::R32G32B32A32_FLOAT);
+    header.SetWidth(4);
+    header.SetHeight(4);
+    header.SetDepth(8);
+
+    ezImage volume;
+    volume.ResetAndAlloc(header);
+
+    for (ezUInt32 z = 0; z < 8; ++z)
+    {
+      for (ezUInt32 y = 0; y < 4; ++y)
+      {
+        for (ezUInt32 x = 0; x < 4; ++x)
+        {
+          *volume.GetPixelPointer<ezColor>(0, 0, 0, x, y, z) = ezColor(static_cast<float>(z), 0.0f, 0.0f, 1.0f);
+        }
+      }
+    }
+
+    ezImage scaled;
+    EZ_TEST_BOOL(ezImageUtils::Scale3D(volume, scaled, 4, 4, 4).Succeeded());
+    EZ_TEST_INT(scaled.GetDepth(), 4);
+
+    // the triangle filter reproduces the linear ramp away from the clamped borders
+    EZ_TEST_FLOAT(scaled.GetPixelPointer<ezColor>(0, 0, 0, 1, 2, 1)->r, 2.5f, 0.001f);
+    EZ_TEST_FLOAT(scaled.GetPixelPointer<ezColor>(0, 0, 0, 2, 1, 2)->r, 4.5f, 0.001f);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "GenerateMipMaps Cubemap")
+  {
+    ezImageHeader header;
+    header.SetImageFormat(ezImageFormat::R32G32B32A32_FLOAT);
+    header.SetWidth(64);
+    header.SetHeight(64);
+    header.SetNumFaces(6);
+
+    ezImage cubemap;
+    cubemap.ResetAndAlloc(header);
+
+    for (ezUInt32 face = 0; face < 6; ++face)
+    {
+      for (ezColor& color : cubemap.GetSubImageView(0, face).GetBlobPtr<ezColor>())
+      {
+        color = ezColor(static_cast<float>(face), 1.0f, 0.5f, 1.0f);
+      }
+    }
+
+    ezImageFilterSincWithKaiserWindow filter;
+
+    ezImageUtils::MipMapOptions options;
+    options.m_filter = &filter;
+
+    ezImage mipmapped;
+    ezImageUtils::GenerateMipMaps(cubemap, mipmapped, options);
+
+    EZ_TEST_INT(mipmapped.GetNumMipLevels(), 7);
+
+    // every face is filtered on its own, so each one has to keep its constant color down to the last mip level
+    for (ezUInt32 mip = 0; mip < mipmapped.GetNumMipLevels(); ++mip)
+    {
+      for (ezUInt32 face = 0; face < 6; ++face)
+      {
+        const ezColor color = *mipmapped.GetPixelPointer<ezColor>(mip, face, 0, mipmapped.GetWidth(mip) / 2, mipmapped.GetHeight(mip) / 2);
+        EZ_TEST_FLOAT(color.r, static_cast<float>(face), 0.001f);
+        EZ_TEST_FLOAT(color.g, 1.0f, 0.001f);
+      }
+    }
+  }
+
   ezFileSystem::RemoveDataDirectoryGroup("ImageTest");
 }
@@ -254,3 +254,148 @@ EZ_CREATE_SIMPLE_TEST(Logging, GlobalTestLog)
     }
   }
 }
+
+namespace
+{
+  constexpr ezUInt32 s_uiNumAsyncLogThreads = 8;
+  constexpr ezUInt32 s_uiNumAsyncLogMessages = 200;
+
+  ezMutex s_AsyncLogMutex;
+  ezDynamicArray<ezString> s_AsyncLogMessages;
+  ezUInt32 s_uiAsyncLogWarnings = 0;
+
+  void AsyncLogTestWriter(const ezLoggingEventData& le)
+  {
+    if (!le.m_sText.StartsWith("AsyncLog "))
+    {
+      if (le.m_EventType == ezLogMsgType::WarningMsg && le.m_sText.FindSubString("discarded") != nullptr)
+      {
+        EZ_LOCK(s_AsyncLogMutex);
+        ++s_uiAsyncLogWarnings;
+      }
+
+      return;
+    }
+
+    EZ_LOCK(s_AsyncLogMutex);
+    s_AsyncLogMessages.PushBack(le.m_sText);
+  }
+
+  class AsyncLogTestThread : public ezThread
+  {
+  public:
+    ezUInt32 m_uiThreadIndex = 0;
+
+  private:
+    virtual ezUInt32 Run() override
+    {
+      for (ezUInt32 i = 0; i < s_uiNumAsyncLogMessages; ++i)
+      {
+        ezLog::Info("AsyncLog {} {}", m_uiThreadIndex, i);
+      }
+
+      return 0;
+    }
+  };
+
+  void RunAsyncLogThreads()
+  {
+    AsyncLogTestThread threads[s_uiNumAsyncLogThreads];
+
+    for (ezUInt32 i = 0; i < s_uiNumAsyncLogThreads; ++i)
+    {
+      threads[i].m_uiThreadIndex = i;
+      threads[i].Start();
+    }
+
+    for (ezUInt32 i = 0; i < s_uiNumAsyncLogThreads; ++i)
+    {
+      threads[i].Join();
+    }
+
+    ezGlobalLog::FlushAsyncMessages();
+  }
+
+  void TestAsyncLogOrder()
+  {
+    // the messages of each thread must arrive in the order in which they were logged
+    ezUInt32 uiNextMessage[s_uiNumAsyncLogThreads] = {};
+    ezHybridArray<ezStringView, 4> parts;
+    for (const ezString& sMessage : s_AsyncLogMessages)
+    {
+      sMessage.Split(false, parts, " ");
+      EZ_TEST_INT(parts.GetCount(), 3);
+
+      ezUInt32 uiThread = 0;
+      ezUInt32 uiMessage = 0;
+      EZ_TEST_BOOL(ezConversionUtils::StringToUInt(parts[1], uiThread).Succeeded());
+      EZ_TEST_BOOL(ezConversionUtils::StringToUInt(parts[2], uiMessage).Succeeded());
+      EZ_TEST_INT(uiMessage, uiNextMessage[uiThread]);
+      uiNextMessage[uiThread] = uiMessage + 1;
+    }
+  }
+} // namespace
+
+EZ_CREATE_SIMPLE_TEST(Logging, AsyncLog)
+{
+  ezGlobalLog::AddLogWriter(AsyncLogTestWriter);
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Block")
+  {
+    s_AsyncLogMessages.Clear();
+
+    ezAsyncLogSettings settings;
+    settings.m_uiQueueCapacity = 16;
+    settings.m_OverflowPolicy = ezAsyncLogSettings::OverflowPolicy::Block;
+    ezGlobalLog::EnableAsyncMode(settings);
+    EZ_TEST_BOOL(ezGlobalLog::IsAsyncModeEnabled());
+
+    RunAsyncLogThreads();
+
+    EZ_LOCK(s_AsyncLogMutex);
+    EZ_TEST_INT(s_AsyncLogMessages.GetCount(), s_uiNumAsyncLogThreads * s_uiNumAsyncLogMessages);
+    EZ_TEST_INT(ezGlobalLog::GetNumDiscardedAsyncMessages(), 0);
+    TestAsyncLogOrder();
+
+    ezGlobalLog::DisableAsyncMode();
+    EZ_TEST_BOOL(!ezGlobalLog::IsAsyncModeEnabled());
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Discard")
+  {
+    s_AsyncLogMessages.Clear();
+    s_uiAsyncLogWarnings = 0;
+
+    ezAsyncLogSettings settings;
+    settings.m_uiQueueCapacity = 4;
+    settings.m_OverflowPolicy = ezAsyncLogSettings::OverflowPolicy::Discard;
+    ezGlobalLog::EnableAsyncMode(settings);
+
+    RunAsyncLogThreads();
+
+    EZ_LOCK(s_AsyncLogMutex);
+    EZ_TEST_INT(s_AsyncLogMessages.GetCount() + ezGlobalLog::GetNumDiscardedAsyncMessages(), s_uiNumAsyncLogThreads * s_uiNumAsyncLogMessages);
+    EZ_TEST_BOOL((ezGlobalLog::GetNumDiscardedAsyncMessages() > 0) == (s_uiAsyncLogWarnings > 0));
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Synchronous")
+  {
+    ezGlobalLog::DisableAsyncMode();
+    s_AsyncLogMessages.Clear();
+
+    ezAsyncLogSettings settings;
+    settings.m_uiQueueCapacity = 4;
+    settings.m_OverflowPolicy = ezAsyncLogSettings::OverflowPolicy::Synchronous;
+    ezGlobalLog::EnableAsyncMode(settings);
+
+    RunAsyncLogThreads();
+
+    EZ_LOCK(s_AsyncLogMutex);
+    EZ_TEST_INT(s_AsyncLogMessages.GetCount(), s_uiNumAsyncLogThreads * s_uiNumAsyncLogMessages);
+    EZ_TEST_INT(ezGlobalLog::GetNumDiscardedAsyncMessages(), 0);
+    TestAsyncLogOrder();
+  }
+
+  ezGlobalLog::DisableAsyncMode();
+  ezGlobalLog::RemoveLogWriter(AsyncLogTestWriter);
+}
@@ -3,6 +3,8 @@
 #include <Foundation/Memory/CommonAllocators.h>
 #include <Foundation/Memory/LargeBlockAllocator.h>
 #include <Foundation/Memory/LinearAllocator.h>
+#include <Foundation/Memory/PerThreadLinearAllocator.h>
+#include <Foundation/Threading/TaskSystem.h>
 
 struct alignas(EZ_ALIGNMENT_MINIMUM) NonAlignedVector
 {
@@ -242,4 +244,75 @@ EZ_CREATE_SIMPLE_TEST(Memory, Allocator)
 
     EZ_TEST_BOOL(ezConstructionCounter::HasDestructed(50));
   }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "PerThreadLinearAllocator")
+  {
+    ezPerThreadLinearAllocator allocator("TestPerThreadLinearAllocator", ezFoundation::GetAlignedAllocator());
+
+    ezDynamicArray<ezConstructionCounter*> counters;
+    for (ezUInt32 i = 0; i < 100; ++i)
+    {
+      counters.PushBack(EZ_NEW(&allocator, ezConstructionCounter));
+      EZ_TEST_BOOL(ezMemoryUtils::IsAligned(counters.PeekBack(), 16));
+    }
+
+    EZ_TEST_INT(allocator.AllocatedSize(counters[0]), sizeof(ezConstructionCounter));
+    EZ_TEST_BOOL(ezConstructionCounter::HasConstructed(100));
+
+    for (ezUInt32 i = 0; i < 50; ++i)
+    {
+      EZ_DELETE(&allocator, counters[i * 2]);
+    }
+
+    EZ_TEST_BOOL(ezConstructionCounter::HasDestructed(50));
+
+    allocator.Reset();
+
+    EZ_TEST_BOOL(ezConstructionCounter::HasDestructed(50));
+    EZ_TEST_BOOL(allocator.GetUsedMemoryBeforeLastReset() >= 100 * sizeof(ezConstructionCounter));
+    EZ_TEST_INT(allocator.GetHighWaterMark(), allocator.GetUsedMemoryBeforeLastReset());
+
+    // allocate from many threads at once, every allocation must stay intact until the next reset
+    const ezUInt32 uiNumArrays = 256;
+    ezDynamicArray<ezArrayPtr<ezUInt32>> arrays;
+    arrays.SetCount(uiNumArrays);
+
+    ezTaskSystem::ParallelForIndexed(
+      0, uiNumArrays,
+      [&](ezUInt32 uiStartIndex, ezUInt32 uiEndIndex)
+      {
+        for (ezUInt32 i = uiStartIndex; i < uiEndIndex; ++i)
+        {
+          arrays[i] = EZ_NEW_ARRAY(&allocator, ezUInt32, 100 + i);
+          for (ezUInt32& value : arrays[i])
+          {
+            value = i;
+          }
+        }
+      },
+      "PerThreadLinearAllocator Test");
+
+    bool bAllValid = true;
+    for (ezUInt32 i = 0; i < uiNumArrays; ++i)
+    {
+      bAllValid &= arrays[i].GetCount() == 100 + i;
+      for (ezUInt32 value : arrays[i])
+      {
+        bAllValid &= value == i;
+      }
+    }
+
+    EZ_TEST_BOOL(bAllValid);
+
+    const ezUInt64 uiPreviousHighWaterMark = allocator.GetHighWaterMark();
+    allocator.Reset();
+
+    EZ_TEST_BOOL(allocator.GetHighWaterMark() > uiPreviousHighWaterMark);
+    EZ_TEST_INT(allocator.GetHighWaterMark(), allocator.GetUsedMemoryBeforeLastReset());
+
+    allocator.Reset();
+
+    EZ_TEST_INT(allocator.GetUsedMemoryBeforeLastReset(), 0);
+    EZ_TEST_BOOL(allocator.GetHighWaterMark() > uiPreviousHighWaterMark);
+  }
 }
@@ -1,7 +1,12 @@
 #include <FoundationTest/FoundationTestPCH.h>
 
+#include <Foundation/Containers/BTreeMap.h>
 #include <Foundation/Containers/DynamicArray.h>
+#include <Foundation/Containers/HashTable.h>
+#include <Foundation/Containers/Map.h>
+#include <Foundation/Containers/SwissHashTable.h>
 #include <Foundation/Logging/Log.h>
+#include <Foundation/Math/Random.h>
 #include <Foundation/Reflection/Reflection.h>
 #include <Foundation/Strings/String.h>
 #include <Foundation/Time/Time.h>
@@ -75,6 +80,109 @@ namespace
 
   ezUInt32 SomeBigObject::constructionCount = 0;
   ezUInt32 SomeBigObject::destructionCount = 0;
+
+  /// Measures insertion of shuffled keys, lookups and sorted iteration, which are the typical uses of an ordered map.
+  template <typename MapType>
+  void MeasureOrderedMap(const char* szName, ezArrayPtr<const ezUInt32> keys)
+  {
+    const ezUInt32 uiNumKeys = keys.GetCount();
+    ezUInt64 sum = 0;
+
+    MapType map;
+
+    ezTime t0 = ezTime::Now();
+    for (ezUInt32 i = 0; i < uiNumKeys; ++i)
+    {
+      map.Insert(keys[i], i);
+    }
+
+    ezTime t1 = ezTime::Now();
+    for (ezUInt32 n = 0; n < 8; ++n)
+    {
+      for (ezUInt32 i = 0; i < uiNumKeys; ++i)
+      {
+        sum += *map.GetValue(keys[i]);
+      }
+    }
+
+    ezTime t2 = ezTime::Now();
+    for (ezUInt32 n = 0; n < 8; ++n)
+    {
+      for (auto it = map.GetIterator(); it.IsValid(); ++it)
+      {
+        sum += it.Value();
+      }
+    }
+
+    ezTime t3 = ezTime::Now();
+    for (ezUInt32 i = 0; i < uiNumKeys; ++i)
+    {
+      map.Remove(keys[i]);
+    }
+
+    ezTime t4 = ezTime::Now();
+
+    ezLog::Info("[test]{0} size = {1}: insert {2}ms, find {3}ms, iterate {4}ms, remove {5}ms ({6})", szName, uiNumKeys, ezArgF((t1 - t0).GetMilliseconds(), 3),
+      ezArgF((t2 - t1).GetMilliseconds() / 8.0, 3), ezArgF((t3 - t2).GetMilliseconds() / 8.0, 3), ezArgF((t4 - t3).GetMilliseconds(), 3), sum);
+  }
+
+  /// Measures successful and failing lookups, as well as a workload in which elements are constantly removed and re-added.
+  template <typename TableType>
+  void MeasureHashTable(const char* szName, ezArrayPtr<const ezUInt32> keys)
+  {
+    const ezUInt32 uiNumKeys = keys.GetCount();
+    ezUInt64 sum = 0;
+
+    TableType table;
+
+    ezTime t0 = ezTime::Now();
+    for (ezUInt32 i = 0; i < uiNumKeys; ++i)
+    {
+      table.Insert(keys[i], i);
+    }
+
+    ezTime t1 = ezTime::Now();
+    for (ezUInt32 n = 0; n < 8; ++n)
+    {
+      for (ezUInt32 i = 0; i < uiNumKeys; ++i)
+      {
+        sum += *table.GetValue(keys[i]);
+      }
+    }
+
+    // all keys are multiples of 7, so these are never found
+    ezTime t2 = ezTime::Now();
+    for (ezUInt32 n = 0; n < 8; ++n)
+    {
+      for (ezUInt32 i = 0; i < uiNumKeys; ++i)
+      {
+        sum += table.Contains(keys[i] + 1) ? 1 : 0;
+      }
+    }
+
+    // remove one element and add another one, the number of elements stays the same
+    ezTime t3 = ezTime::Now();
+    for (ezUInt32 n = 0; n < 8; ++n)
+    {
+      for (ezUInt32 i = 0; i < uiNumKeys; ++i)
+      {
+        table.Remove(keys[i] + n * 2);
+        table.Insert(keys[i] + n * 2 + 2, i);
+      }
+    }
+
+    ezTime t4 = ezTime::Now();
+    for (auto it = table.GetIterator(); it.IsValid(); ++it)
+    {
+      sum += it.Value();
+    }
+
+    ezTime t5 = ezTime::Now();
+
+    ezLog::Info("[test]{0} size = {1}: insert {2}ms, hit {3}ms, miss {4}ms, erase/insert {5}ms, iterate {6}ms ({7})", szName, uiNumKeys,
+      ezArgF((t1 - t0).GetMilliseconds(), 3), ezArgF((t2 - t1).GetMilliseconds() / 8.0, 3), ezArgF((t3 - t2).GetMilliseconds() / 8.0, 3),
+      ezArgF((t4 - t3).GetMilliseconds() / 8.0, 3), ezArgF((t5 - t4).GetMilliseconds(), 3), sum);
+  }
 } // namespace
 
 // Enable when needed
@@ -419,4 +527,70 @@ EZ_CREATE_SIMPLE_TEST(Performance, Container)
         ezArgF((t1 - t0).GetMilliseconds() / static_cast<double>(NUM_SAMPLES), 4), sum);
     }
   }
+
+  EZ_TEST_BLOCK(EZ_PERFORMANCE_TESTS_STATE, "ezMap vs. ezBTreeMap")
+  {
+    ezRandom rnd;
+    rnd.Initialize(0);
+
+    for (ezUInt32 size = 1024; size <= 1024 * 1024; size *= 4)
+    {
+      ezDynamicArray<ezUInt32> keys;
+      keys.SetCountUninitialized(size);
+
+      for (ezUInt32 i = 0; i < size; ++i)
+        keys[i] = i * 7;
+
+      for (ezUInt32 i = size - 1; i > 0; --i)
+        ezMath::Swap(keys[i], keys[rnd.UIntInRange(i + 1)]);
+
+      MeasureOrderedMap<ezMap<ezUInt32, ezUInt32>>("ezMap<ezUInt32, ezUInt32>", keys);
+      MeasureOrderedMap<ezBTreeMap<ezUInt32, ezUInt32>>("ezBTreeMap<ezUInt32, ezUInt32>", keys);
+
+      // bulk construction from sorted data
+      keys.Sort();
+
+      ezDynamicArray<ezUInt32> values;
+      values.SetCount(size, 1);
+
+      ezTime t0 = ezTime::Now();
+      {
+        ezMap<ezUInt32, ezUInt32> map;
+        for (ezUInt32 i = 0; i < size; ++i)
+          map.Insert(keys[i], values[i]);
+      }
+
+      ezTime t1 = ezTime::Now();
+      {
+        ezBTreeMap<ezUInt32, ezUInt32> map;
+        map.BuildFromSorted(keys, values);
+      }
+
+      ezTime t2 = ezTime::Now();
+
+      ezLog::Info("[test]Build from sorted, size = {0}: ezMap {1}ms, ezBTreeMap {2}ms", size, ezArgF((t1 - t0).GetMilliseconds(), 3), ezArgF((t2 - t1).GetMilliseconds(), 3));
+    }
+  }
+
+  EZ_TEST_BLOCK(EZ_PERFORMANCE_TESTS_STATE, "ezHashTable vs. ezSwissHashTable")
+  {
+    ezRandom rnd;
+    rnd.Initialize(0);
+
+    // ezHashTable degrades badly in the erase/insert workload, larger sizes take minutes
+    for (ezUInt32 size = 1024; size <= 256 * 1024; size *= 4)
+    {
+      ezDynamicArray<ezUInt32> keys;
+      keys.SetCountUninitialized(size);
+
+      for (ezUInt32 i = 0; i < size; ++i)
+        keys[i] = i * 7;
+
+      for (ezUInt32 i = size - 1; i > 0; --i)
+        ezMath::Swap(keys[i], keys[rnd.UIntInRange(i + 1)]);
+
+      MeasureHashTable<ezHashTable<ezUInt32, ezUInt32>>("ezHashTable<ezUInt32, ezUInt32>", keys);
+      MeasureHashTable<ezSwissHashTable<ezUInt32, ezUInt32>>("ezSwissHashTable<ezUInt32, ezUInt32>", keys);
+    }
+  }
 }
@@ -0,0 +1,131 @@
+#include <FoundationTest/FoundationTestPCH.h>
+
+#include <Foundation/IO/CompressedStreamZstd.h>
+#include <Foundation/IO/MemoryStream.h>
+#include <Foundation/Logging/Log.h>
+#include <Foundation/Time/Time.h>
+#include <Texture/Image/ImageConversion.h>
+#include <Texture/TexConv/TexComparer.h>
+
+namespace
+{
+#if EZ_ENABLED(EZ_COMPILE_FOR_DEBUG)
+  constexpr ezUInt32 s_uiImageCompressionResolution = 256;
+#else
+  constexpr ezUInt32 s_uiImageCompressionResolution = 2048;
+#endif
+
+  /// Smooth gradients, hard edges and some noise, so that all encoder modes get some work.
+  void FillCompressionTestImage(ezImage& ref_image, ezImageFormat::Enum format, ezUInt32 uiResolution, bool bWithAlpha)
+  {
+    ezImageHeader header;
+    header.SetImageFormat(ezImageFormat::R32G32B32A32_FLOAT);
+    header.SetWidth(uiResolution);
+    header.SetHeight(uiResolution);
+
+    ref_image.ResetAndAlloc(header);
+
+    ezUInt32 uiNoise = 0x12345678u;
+
+    for (ezUInt32 y = 0; y < uiResolution; ++y)
+    {
+      ezColor* pRow = ref_image.GetPixelPointer<ezColor>(0, 0, 0, 0, y);
+
+      for (ezUInt32 x = 0; x < uiResolution; ++x)
+      {
+        uiNoise = uiNoise * 1664525u + 1013904223u;
+        const float fNoise = static_cast<float>(uiNoise >> 24) / 255.0f * 0.05f;
+
+        const float fx = static_cast<float>(x) / uiResolution;
+        const float fy = static_cast<float>(y) / uiResolution;
+        const float fEdge = ((x / 37 + y / 23) % 3) * 0.3f;
+        const float fWave = 0.5f + 0.5f * ezMath::Sin(ezAngle::MakeFromRadian((fx + fy) * 30.0f));
+
+        // stays below 1, so that the LDR comparison doesn't clamp the HDR values
+        pRow[x] = ezColor(fx * 0.9f + fNoise, fEdge + fNoise, fWave * 0.9f, bWithAlpha ? 1.0f - fy * 0.5f : 1.0f);
+      }
+    }
+
+    if (format != ezImageFormat::R32G32B32A32_FLOAT)
+    {
+      EZ_TEST_BOOL(ref_image.Convert(format).Succeeded());
+    }
+  }
+
+  ezUInt64 ComputeZstdSize(const ezImage& image)
+  {
+#ifdef BUILDSYSTEM_ENABLE_ZSTD_SUPPORT
+    ezDefaultMemoryStreamStorage storage;
+    ezMemoryStreamWriter writer(&storage);
+
+    ezCompressedStreamWriterZstd compressor(&writer, 0, ezCompressedStreamWriterZstd::Compression::Average);
+    EZ_TEST_BOOL(compressor.WriteBytes(image.GetByteBlobPtr().GetPtr(), image.GetByteBlobPtr().GetCount()).Succeeded());
+    EZ_TEST_BOOL(compressor.FinishCompressedStream().Succeeded());
+
+    return compressor.GetCompressedSize();
+#else
+    return image.GetByteBlobPtr().GetCount();
+#endif
+  }
+
+  void BenchmarkCompression(const char* szName, const ezImage& source, ezImageFormat::Enum targetFormat, const ezImageCompressionSettings& settings)
+  {
+    if (!ezImageConversion::IsConvertible(source.GetImageFormat(), targetFormat))
+    {
+      ezLog::Info("[test]{0}: no encoder available", szName);
+      return;
+    }
+
+    ezImage compressed;
+
+    const ezTime t0 = ezTime::Now();
+    EZ_TEST_BOOL(ezImageConversion::Convert(source, compressed, targetFormat, settings).Succeeded());
+    const ezTime tEncode = ezTime::Now() - t0;
+
+    ezTexComparer comparer;
+    EZ_TEST_BOOL(ezImageConversion::Convert(source, comparer.m_Descriptor.m_ExpectedImage, ezImageFormat::R8G8B8A8_UNORM).Succeeded());
+    EZ_TEST_BOOL(ezImageConversion::Convert(compressed, comparer.m_Descriptor.m_ActualImage, ezImageFormat::R8G8B8A8_UNORM).Succeeded());
+    EZ_TEST_BOOL(comparer.Compare().Succeeded());
+
+    const double fMegaPixels = static_cast<double>(source.GetWidth()) * source.GetHeight() / (1024.0 * 1024.0);
+
+    ezLog::Info("[test]{0} {1}x{1}: {2}ms ({3} MPix/s), PSNR {4} dB, zstd {5} KB", szName, source.GetWidth(), ezArgF(tEncode.GetMilliseconds(), 1),
+      ezArgF(fMegaPixels / tEncode.GetSeconds(), 2), ezArgF(comparer.m_fOutputPSNR, 2), ComputeZstdSize(compressed) / 1024);
+  }
+} // namespace
+
+#ifndef EZ_PERFORMANCE_TESTS_STATE
+#  define EZ_PERFORMANCE_TESTS_STATE ezTestBlock::DisabledNoWarning
+#endif
+
+EZ_CREATE_SIMPLE_TEST(Performance, ImageCompression)
+{
+  EZ_TEST_BLOCK(EZ_PERFORMANCE_TESTS_STATE, "BC7")
+  {
+    ezImage image;
+    FillCompressionTestImage(image, ezImageFormat::R8G8B8A8_UNORM, s_uiImageCompressionResolution, true);
+
+    ezImageCompressionSettings settings;
+
+    settings.m_Quality = ezImageCompressionQuality::Fast;
+    BenchmarkCompression("BC7 Fast", image, ezImageFormat::BC7_UNORM, settings);
+
+    settings.m_Quality = ezImageCompressionQuality::Final;
+    BenchmarkCompression("BC7 Final", image, ezImageFormat::BC7_UNORM, settings);
+
+    settings.m_fRdoLambda = 1.0f;
+    BenchmarkCompression("BC7 Final RDO 1", image, ezImageFormat::BC7_UNORM, settings);
+
+    settings.m_fRdoLambda = 4.0f;
+    BenchmarkCompression("BC7 Final RDO 4", image, ezImageFormat::BC7_UNORM, settings);
+  }
+
+  EZ_TEST_BLOCK(EZ_PERFORMANCE_TESTS_STATE, "BC6H")
+  {
+    // the BC6H encoder is a lot slower and doesn't store alpha
+    ezImage image;
+    FillCompressionTestImage(image, ezImageFormat::R32G32B32A32_FLOAT, s_uiImageCompressionResolution / 4, false);
+
+    BenchmarkCompression("BC6H", image, ezImageFormat::BC6H_UF16, {});
+  }
+}
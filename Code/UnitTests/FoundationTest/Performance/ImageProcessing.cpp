@@ -0,0 +1,125 @@
+#include <FoundationTest/FoundationTestPCH.h>
+
+#include <Foundation/Logging/Log.h>
+#include <Foundation/Time/Time.h>
+#include <Texture/Image/ImageConversion.h>
+#include <Texture/Image/ImageFilter.h>
+#include <Texture/Image/ImageUtils.h>
+
+namespace
+{
+#if EZ_ENABLED(EZ_COMPILE_FOR_DEBUG)
+  constexpr ezUInt32 s_uiImageProcessingResolution = 256;
+  constexpr ezUInt32 s_uiImageProcessingSamples = 2;
+#else
+  constexpr ezUInt32 s_uiImageProcessingResolution = 2048;
+  constexpr ezUInt32 s_uiImageProcessingSamples = 4;
+#endif
+
+  /// Fills the image with a pattern that has some detail on every mip level, so that the filters can't take any shortcuts.
+  void FillTestImage(ezImage& ref_image, ezImageFormat::Enum format, ezUInt32 uiNumFaces, float fScale)
+  {
+    ezImageHeader header;
+    header.SetImageFormat(ezImageFormat::R32G32B32A32_FLOAT);
+    header.SetWidth(s_uiImageProcessingResolution);
+    header.SetHeight(s_uiImageProcessingResolution);
+    header.SetNumFaces(uiNumFaces);
+
+    ref_image.ResetAndAlloc(header);
+
+    for (ezUInt32 face = 0; face < uiNumFaces; ++face)
+    {
+      for (ezUInt32 y = 0; y < s_uiImageProcessingResolution; ++y)
+      {
+        ezColor* pRow = ref_image.GetPixelPointer<ezColor>(0, face, 0, 0, y);
+
+        for (ezUInt32 x = 0; x < s_uiImageProcessingResolution; ++x)
+        {
+          const float fx = static_cast<float>(x) / s_uiImageProcessingResolution;
+          const float fy = static_cast<float>(y) / s_uiImageProcessingResolution;
+          const float fChecker = ((x / 8 + y / 8 + face) % 2) ? 1.0f : 0.25f;
+
+          const float fWave = 0.5f + 0.5f * ezMath::Sin(ezAngle::MakeFromRadian(fx * 40.0f));
+
+          pRow[x] = ezColor(fx * fChecker * fScale, fy * fScale, fWave * fScale, fChecker);
+        }
+      }
+    }
+
+    if (format != ezImageFormat::R32G32B32A32_FLOAT)
+    {
+      EZ_TEST_BOOL(ref_image.Convert(format).Succeeded());
+    }
+  }
+
+  void BenchmarkImage(const char* szName, const ezImage& image, bool bRenormalizeNormals)
+  {
+    ezImageFilterSincWithKaiserWindow filterKaiser;
+
+    ezImageUtils::MipMapOptions options;
+    options.m_filter = &filterKaiser;
+    options.m_renormalizeNormals = bRenormalizeNormals;
+
+    ezTime tScale;
+    ezTime tMipMaps;
+
+    for (ezUInt32 i = 0; i < s_uiImageProcessingSamples; ++i)
+    {
+      {
+        ezImage scaled;
+
+        const ezTime t0 = ezTime::Now();
+        EZ_TEST_BOOL(ezImageUtils::Scale(image, scaled, image.GetWidth() * 3 / 4, image.GetHeight() * 3 / 4, &filterKaiser).Succeeded());
+        tScale += ezTime::Now() - t0;
+      }
+
+      {
+        ezImage source;
+        source.ResetAndCopy(image);
+
+        const ezTime t0 = ezTime::Now();
+        EZ_TEST_BOOL(source.Convert(ezImageFormat::R32G32B32A32_FLOAT).Succeeded());
+
+        ezImage mipmapped;
+        ezImageUtils::GenerateMipMaps(source, mipmapped, options);
+        tMipMaps += ezTime::Now() - t0;
+
+        EZ_TEST_BOOL(mipmapped.GetNumMipLevels() > 1);
+      }
+    }
+
+    ezLog::Info("[test]{0} {1}x{1}x{2}: scale {3}ms, mipmaps {4}ms", szName, image.GetWidth(), image.GetNumFaces(),
+      ezArgF(tScale.GetMilliseconds() / s_uiImageProcessingSamples, 3), ezArgF(tMipMaps.GetMilliseconds() / s_uiImageProcessingSamples, 3));
+  }
+} // namespace
+
+#ifndef EZ_PERFORMANCE_TESTS_STATE
+#  define EZ_PERFORMANCE_TESTS_STATE ezTestBlock::DisabledNoWarning
+#endif
+
+EZ_CREATE_SIMPLE_TEST(Performance, ImageProcessing)
+{
+  EZ_TEST_BLOCK(EZ_PERFORMANCE_TESTS_STATE, "Albedo")
+  {
+    ezImage image;
+    FillTestImage(image, ezImageFormat::R8G8B8A8_UNORM_SRGB, 1, 1.0f);
+
+    BenchmarkImage("Albedo", image, false);
+  }
+
+  EZ_TEST_BLOCK(EZ_PERFORMANCE_TESTS_STATE, "NormalMap")
+  {
+    ezImage image;
+    FillTestImage(image, ezImageFormat::R8G8B8A8_UNORM, 1, 1.0f);
+
+    BenchmarkImage("NormalMap", image, true);
+  }
+
+  EZ_TEST_BLOCK(EZ_PERFORMANCE_TESTS_STATE, "HDR Cubemap")
+  {
+    ezImage image;
+    FillTestImage(image, ezImageFormat::R16G16B16A16_FLOAT, 6, 16.0f);
+
+    BenchmarkImage("HDR Cubemap", image, false);
+  }
+}
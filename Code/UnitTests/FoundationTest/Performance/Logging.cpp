@@ -0,0 +1,92 @@
+#include <FoundationTest/FoundationTestPCH.h>
+
+#include <Foundation/Logging/Log.h>
+#include <Foundation/Threading/Thread.h>
+#include <Foundation/Time/Time.h>
+
+namespace
+{
+  constexpr ezUInt32 s_uiNumLogPerfThreads = 8;
+  constexpr ezUInt32 s_uiNumLogPerfMessages = 10000;
+
+  ezMutex s_LogPerfMutex;
+  ezStringBuilder s_sLogPerfOutput;
+
+  /// Simulates a log writer that formats each message into a file buffer.
+  void LogPerfWriter(const ezLoggingEventData& le)
+  {
+    if (!le.m_sText.StartsWith("LogPerf "))
+      return;
+
+    EZ_LOCK(s_LogPerfMutex);
+    s_sLogPerfOutput.AppendFormat("[{}] {}\n", static_cast<ezInt32>(le.m_EventType), le.m_sText);
+
+    if (s_sLogPerfOutput.GetElementCount() > 1024 * 1024)
+      s_sLogPerfOutput.Clear();
+  }
+
+  class LogPerfThread : public ezThread
+  {
+  public:
+    ezTime m_Duration;
+
+  private:
+    virtual ezUInt32 Run() override
+    {
+      const ezTime t0 = ezTime::Now();
+
+      for (ezUInt32 i = 0; i < s_uiNumLogPerfMessages; ++i)
+      {
+        ezLog::Info("LogPerf message number {} with a value of {}", i, i * 0.5f);
+      }
+
+      m_Duration = ezTime::Now() - t0;
+      return 0;
+    }
+  };
+
+  ezTime RunLogPerfThreads()
+  {
+    LogPerfThread threads[s_uiNumLogPerfThreads];
+
+    for (ezUInt32 i = 0; i < s_uiNumLogPerfThreads; ++i)
+    {
+      threads[i].Start();
+    }
+
+    ezTime tMax;
+    for (ezUInt32 i = 0; i < s_uiNumLogPerfThreads; ++i)
+    {
+      threads[i].Join();
+      tMax = ezMath::Max(tMax, threads[i].m_Duration);
+    }
+
+    return tMax;
+  }
+} // namespace
+
+#ifndef EZ_PERFORMANCE_TESTS_STATE
+#  define EZ_PERFORMANCE_TESTS_STATE ezTestBlock::DisabledNoWarning
+#endif
+
+EZ_CREATE_SIMPLE_TEST(Performance, Logging)
+{
+  EZ_TEST_BLOCK(EZ_PERFORMANCE_TESTS_STATE, "Sync vs. Async")
+  {
+    ezGlobalLog::AddLogWriter(LogPerfWriter);
+
+    const ezTime tSync = RunLogPerfThreads();
+
+    ezGlobalLog::EnableAsyncMode();
+    const ezTime tAsync = RunLogPerfThreads();
+    const ezTime t0 = ezTime::Now();
+    ezGlobalLog::FlushAsyncMessages();
+    const ezTime tFlush = ezTime::Now() - t0;
+    ezGlobalLog::DisableAsyncMode();
+
+    ezGlobalLog::RemoveLogWriter(LogPerfWriter);
+
+    ezLog::Info("[test]Logging {0} messages on {1} threads: sync {2}ms, async {3}ms (+{4}ms flush)", s_uiNumLogPerfMessages, s_uiNumLogPerfThreads,
+      ezArgF(tSync.GetMilliseconds(), 2), ezArgF(tAsync.GetMilliseconds(), 2), ezArgF(tFlush.GetMilliseconds(), 2));
+  }
+}
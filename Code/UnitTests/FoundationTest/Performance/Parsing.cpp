@@ -0,0 +1,136 @@
+#include <FoundationTest/FoundationTestPCH.h>
+
+#include <Foundation/IO/JSONReader.h>
+#include <Foundation/IO/MemoryStream.h>
+#include <Foundation/IO/OpenDdlReader.h>
+#include <Foundation/IO/OpenDdlWriter.h>
+#include <Foundation/Logging/Log.h>
+#include <Foundation/Time/Time.h>
+
+namespace
+{
+#if EZ_ENABLED(EZ_COMPILE_FOR_DEBUG)
+  constexpr ezUInt32 s_uiNumParseObjects = 1000;
+  constexpr ezUInt32 s_uiNumParseSamples = 4;
+#else
+  constexpr ezUInt32 s_uiNumParseObjects = 20000;
+  constexpr ezUInt32 s_uiNumParseSamples = 16;
+#endif
+
+  void CreateDdlDocument(ezContiguousMemoryStreamStorage& ref_storage)
+  {
+    ezMemoryStreamWriter writer(&ref_storage);
+
+    ezOpenDdlWriter ddl;
+    ddl.SetOutputStream(&writer);
+    ddl.SetFloatPrecisionMode(ezOpenDdlWriter::FloatPrecisionMode::Readable);
+
+    ezStringBuilder sValue;
+    for (ezUInt32 i = 0; i < s_uiNumParseObjects; ++i)
+    {
+      ddl.BeginObject("Object");
+
+      sValue.SetFormat("Objects/Category{}/Name{}", i % 17, i);
+      ddl.BeginPrimitiveList(ezOpenDdlPrimitiveType::String, "Name");
+      ddl.WriteString(sValue);
+      ddl.EndPrimitiveList();
+
+      const ezInt32 iValues[] = {static_cast<ezInt32>(i), static_cast<ezInt32>(i) * 7919, -static_cast<ezInt32>(i)};
+      ddl.BeginPrimitiveList(ezOpenDdlPrimitiveType::Int32);
+      ddl.WriteInt32(iValues, 3);
+      ddl.EndPrimitiveList();
+
+      const float fValues[] = {i * 0.25f, -1.5f, 3.14159f, 1000.125f};
+      ddl.BeginPrimitiveList(ezOpenDdlPrimitiveType::Float);
+      ddl.WriteFloat(fValues, 4);
+      ddl.EndPrimitiveList();
+
+      ddl.EndObject();
+    }
+  }
+
+  void CreateJsonDocument(ezStringBuilder& ref_sDocument)
+  {
+    ref_sDocument = "[\n";
+
+    for (ezUInt32 i = 0; i < s_uiNumParseObjects; ++i)
+    {
+      ref_sDocument.AppendFormat("  {\n    \"Name\" : \"Objects/Category{}/Name{}\",\n    \"Values\" : [{}, {}, -1.5, 3.14159, 1000.125],\n    \"Enabled\" : true\n  },\n", i % 17, i, i, i * 7919);
+    }
+
+    ref_sDocument.Append("  null\n]");
+  }
+} // namespace
+
+#ifndef EZ_PERFORMANCE_TESTS_STATE
+#  define EZ_PERFORMANCE_TESTS_STATE ezTestBlock::DisabledNoWarning
+#endif
+
+EZ_CREATE_SIMPLE_TEST(Performance, Parsing)
+{
+  EZ_TEST_BLOCK(EZ_PERFORMANCE_TESTS_STATE, "OpenDDL")
+  {
+    ezContiguousMemoryStreamStorage storage;
+    CreateDdlDocument(storage);
+
+    const ezArrayPtr<const ezUInt8> document(storage.GetData(), storage.GetStorageSize32());
+
+    ezTime tStream;
+    ezTime tMemory;
+
+    for (ezUInt32 i = 0; i < s_uiNumParseSamples; ++i)
+    {
+      {
+        ezMemoryStreamReader reader(&storage);
+
+        const ezTime t0 = ezTime::Now();
+        ezOpenDdlReader ddl;
+        EZ_TEST_BOOL(ddl.ParseDocument(reader).Succeeded());
+        tStream += ezTime::Now() - t0;
+      }
+
+      {
+        const ezTime t0 = ezTime::Now();
+        ezOpenDdlReader ddl;
+        EZ_TEST_BOOL(ddl.ParseDocument(document).Succeeded());
+        tMemory += ezTime::Now() - t0;
+      }
+    }
+
+    ezLog::Info("[test]OpenDDL {0} KB: stream {1}ms, memory {2}ms", document.GetCount() / 1024, ezArgF(tStream.GetMilliseconds() / s_uiNumParseSamples, 3),
+      ezArgF(tMemory.GetMilliseconds() / s_uiNumParseSamples, 3));
+  }
+
+  EZ_TEST_BLOCK(EZ_PERFORMANCE_TESTS_STATE, "JSON")
+  {
+    ezStringBuilder sDocument;
+    CreateJsonDocument(sDocument);
+
+    const ezArrayPtr<const ezUInt8> document(reinterpret_cast<const ezUInt8*>(sDocument.GetData()), sDocument.GetElementCount());
+
+    ezTime tStream;
+    ezTime tMemory;
+
+    for (ezUInt32 i = 0; i < s_uiNumParseSamples; ++i)
+    {
+      {
+        ezRawMemoryStreamReader reader(sDocument.GetData(), sDocument.GetElementCount());
+
+        const ezTime t0 = ezTime::Now();
+        ezJSONReader json;
+        EZ_TEST_BOOL(json.Parse(reader).Succeeded());
+        tStream += ezTime::Now() - t0;
+      }
+
+      {
+        const ezTime t0 = ezTime::Now();
+        ezJSONReader json;
+        EZ_TEST_BOOL(json.Parse(document).Succeeded());
+        tMemory += ezTime::Now() - t0;
+      }
+    }
+
+    ezLog::Info("[test]JSON {0} KB: stream {1}ms, memory {2}ms", document.GetCount() / 1024, ezArgF(tStream.GetMilliseconds() / s_uiNumParseSamples, 3),
+      ezArgF(tMemory.GetMilliseconds() / s_uiNumParseSamples, 3));
+  }
+}
@@ -0,0 +1,260 @@
+#include <GameEngineTest/GameEngineTestPCH.h>
+
+#ifdef BUILDSYSTEM_ENABLE_MINIAUDIO_SUPPORT
+
+#  include <Foundation/Configuration/CVar.h>
+#  include <Foundation/Threading/ThreadUtils.h>
+#  include <MiniAudioPlugin/Resources/MiniAudioSoundData.h>
+
+EZ_CREATE_SIMPLE_TEST_GROUP(MiniAudio);
+
+namespace
+{
+  constexpr ezUInt32 s_uiSampleRate = 8000;
+  constexpr ezUInt32 s_uiNumChannels = 2;
+
+  /// Builds a 16 bit PCM WAV file in memory, MiniAudio is built without encoders.
+  ezDataBuffer CreateWavFile(ezUInt32 uiNumFrames)
+  {
+    const ezUInt32 uiDataSize = uiNumFrames * s_uiNumChannels * sizeof(ezInt16);
+
+    ezDataBuffer wav;
+    wav.SetCountUninitialized(44 + uiDataSize);
+    ezUInt8* pData = wav.GetData();
+
+    auto write32 = [&](ezUInt32 uiOffset, ezUInt32 uiValue)
+    {
+      for (ezUInt32 i = 0; i < 4; ++i)
+        pData[uiOffset + i] = static_cast<ezUInt8>(uiValue >> (i * 8));
+    };
+
+    auto write16 = [&](ezUInt32 uiOffset, ezUInt32 uiValue)
+    {
+      pData[uiOffset + 0] = static_cast<ezUInt8>(uiValue);
+      pData[uiOffset + 1] = static_cast<ezUInt8>(uiValue >> 8);
+    };
+
+    ezMemoryUtils::Copy(pData + 0, reinterpret_cast<const ezUInt8*>("RIFF"), 4);
+    write32(4, 36 + uiDataSize);
+    ezMemoryUtils::Copy(pData + 8, reinterpret_cast<const ezUInt8*>("WAVEfmt "), 8);
+    write32(16, 16);
+    write16(20, 1); // PCM
+    write16(22, s_uiNumChannels);
+    write32(24, s_uiSampleRate);
+    write32(28, s_uiSampleRate * s_uiNumChannels * sizeof(ezInt16));
+    write16(32, s_uiNumChannels * sizeof(ezInt16));
+    write16(34, 16);
+    ezMemoryUtils::Copy(pData + 36, reinterpret_cast<const ezUInt8*>("data"), 4);
+    write32(40, uiDataSize);
+
+    // a pattern that never repeats within the sound, so that misplaced frames are detected
+    for (ezUInt32 i = 0; i < uiNumFrames * s_uiNumChannels; ++i)
+    {
+      write16(44 + i * 2, static_cast<ezUInt16>(i * 7919 + (i / 3) * 13));
+    }
+
+    return wav;
+  }
+
+  ezSharedPtr<ezMiniAudioSoundData> CreateStreamedSound(ezUInt32 uiNumFrames)
+  {
+    ezCVarFloat* pThreshold = static_cast<ezCVarFloat*>(ezCVar::FindCVarByName("MiniAudio.StreamingThreshold"));
+    const float fPrevThreshold = *pThreshold;
+    *pThreshold = 0.0f;
+
+    ezSharedPtr<ezMiniAudioSoundData> pSoundData = EZ_DEFAULT_NEW(ezMiniAudioSoundData);
+    const bool bSuccess = pSoundData->Initialize(CreateWavFile(uiNumFrames)).Succeeded();
+
+    *pThreshold = fPrevThreshold;
+
+    if (!bSuccess)
+      return nullptr;
+
+    return pSoundData;
+  }
+
+  ezDynamicArray<float> DecodeWholeSound(ezUInt32 uiNumFrames)
+  {
+    const ezDataBuffer wav = CreateWavFile(uiNumFrames);
+
+    ma_decoder_config cfg = ma_decoder_config_init(ma_format_f32, 0, 0);
+    ma_uint64 uiDecodedFrames = 0;
+    void* pFrames = nullptr;
+
+    ezDynamicArray<float> result;
+    if (ma_decode_memory(wav.GetData(), wav.GetCount(), &cfg, &uiDecodedFrames, &pFrames) == MA_SUCCESS)
+    {
+      result.SetCountUninitialized(static_cast<ezUInt32>(uiDecodedFrames * s_uiNumChannels));
+      ezMemoryUtils::Copy(result.GetData(), static_cast<const float*>(pFrames), result.GetCount());
+      ma_free(pFrames, nullptr);
+    }
+
+    return result;
+  }
+
+  /// Returns the index of the first sample that differs, or ezInvalidIndex if all match.
+  ezUInt32 FindMismatch(const float* pActual, const float* pExpected, ezUInt32 uiNumSamples)
+  {
+    for (ezUInt32 i = 0; i < uiNumSamples; ++i)
+    {
+      if (!ezMath::IsEqual(pActual[i], pExpected[i], 0.00001f))
+        return i;
+    }
+
+    return ezInvalidIndex;
+  }
+} // namespace
+
+EZ_CREATE_SIMPLE_TEST(MiniAudio, StreamingDataSource)
+{
+  // several times the size of the streaming buffer
+  const ezUInt32 uiNumFrames = s_uiSampleRate * 3 + 123;
+  const ezUInt32 uiChunkFrames = 256;
+
+  const ezDynamicArray<float> expected = DecodeWholeSound(uiNumFrames);
+  EZ_TEST_INT(expected.GetCount(), uiNumFrames * s_uiNumChannels);
+
+  ezSharedPtr<ezMiniAudioSoundData> pSoundData = CreateStreamedSound(uiNumFrames);
+  EZ_TEST_BOOL(pSoundData != nullptr && pSoundData->IsStreamed());
+
+  if (pSoundData == nullptr || expected.GetCount() != uiNumFrames * s_uiNumChannels)
+    return;
+
+  ezDynamicArray<float> output;
+  output.SetCount(uiChunkFrames * s_uiNumChannels);
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Streamed Output")
+  {
+    // an engine without a device mixes on the calling thread, which keeps the timing deterministic
+    ma_engine_config engineConfig = ma_engine_config_init();
+    engineConfig.noDevice = MA_TRUE;
+    engineConfig.channels = s_uiNumChannels;
+    engineConfig.sampleRate = s_uiSampleRate;
+
+    ma_engine engine;
+    EZ_TEST_INT(ma_engine_init(&engineConfig, &engine), MA_SUCCESS);
+
+    ezMiniAudioStreamingDataSource source;
+    EZ_TEST_BOOL(source.Initialize(pSoundData).Succeeded());
+
+    ma_sound sound;
+    EZ_TEST_INT(ma_sound_init_from_data_source(&engine, source.GetDataSource(), MA_SOUND_FLAG_NO_SPATIALIZATION | MA_SOUND_FLAG_NO_PITCH, nullptr, &sound), MA_SUCCESS);
+    EZ_TEST_INT(ma_sound_start(&sound), MA_SUCCESS);
+
+    ezUInt32 uiFirstMismatch = ezInvalidIndex;
+
+    for (ezUInt32 uiFrame = 0; uiFrame < uiNumFrames; uiFrame += uiChunkFrames)
+    {
+      // what ezMiniAudioSingleton::UpdateSound() does every frame
+      source.ScheduleDecoding();
+      source.WaitForDecoding();
+
+      const ezUInt32 uiNum = ezMath::Min(uiChunkFrames, uiNumFrames - uiFrame);
+
+      ma_uint64 uiRead = 0;
+      ma_engine_read_pcm_frames(&engine, output.GetData(), uiNum, &uiRead);
+      EZ_TEST_INT(uiRead, uiNum);
+
+      const ezUInt32 uiMismatch = FindMismatch(output.GetData(), expected.GetData() + uiFrame * s_uiNumChannels, uiNum * s_uiNumChannels);
+      if (uiMismatch != ezInvalidIndex && uiFirstMismatch == ezInvalidIndex)
+      {
+        uiFirstMismatch = uiFrame * s_uiNumChannels + uiMismatch;
+      }
+    }
+
+    EZ_TEST_INT(uiFirstMismatch, ezInvalidIndex);
+    EZ_TEST_INT(source.GetNumUnderruns(), 0);
+
+    ma_sound_uninit(&sound);
+    source.Deinitialize();
+    ma_engine_uninit(&engine);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Seek and Loop")
+  {
+    ezMiniAudioStreamingDataSource source;
+    EZ_TEST_BOOL(source.Initialize(pSoundData).Succeeded());
+
+    ma_data_source* pDataSource = source.GetDataSource();
+
+    const ezUInt32 uiSeekTarget = uiNumFrames - s_uiSampleRate / 2;
+    EZ_TEST_INT(ma_data_source_seek_to_pcm_frame(pDataSource, uiSeekTarget), MA_SUCCESS);
+    EZ_TEST_INT(ma_data_source_set_looping(pDataSource, MA_TRUE), MA_SUCCESS);
+
+    ezUInt32 uiFirstMismatch = ezInvalidIndex;
+
+    // read across the loop point twice
+    for (ezUInt32 uiFrame = 0; uiFrame < uiNumFrames + s_uiSampleRate; uiFrame += uiChunkFrames)
+    {
+      source.ScheduleDecoding();
+      source.WaitForDecoding();
+
+      ma_uint64 uiRead = 0;
+      EZ_TEST_INT(ma_data_source_read_pcm_frames(pDataSource, output.GetData(), uiChunkFrames, &uiRead), MA_SUCCESS);
+      EZ_TEST_INT(uiRead, uiChunkFrames);
+
+      for (ezUInt32 i = 0; i < uiChunkFrames && uiFirstMismatch == ezInvalidIndex; ++i)
+      {
+        const ezUInt32 uiExpectedFrame = (uiSeekTarget + uiFrame + i) % uiNumFrames;
+
+        if (FindMismatch(output.GetData() + i * s_uiNumChannels, expected.GetData() + uiExpectedFrame * s_uiNumChannels, s_uiNumChannels) != ezInvalidIndex)
+        {
+          uiFirstMismatch = uiFrame + i;
+        }
+      }
+    }
+
+    EZ_TEST_INT(uiFirstMismatch, ezInvalidIndex);
+    EZ_TEST_INT(source.GetNumUnderruns(), 0);
+
+    ma_uint64 uiCursor = 0;
+    EZ_TEST_INT(ma_data_source_get_cursor_in_pcm_frames(pDataSource, &uiCursor), MA_SUCCESS);
+    EZ_TEST_INT(uiCursor, (uiSeekTarget + (uiNumFrames + s_uiSampleRate + uiChunkFrames - 1) / uiChunkFrames * uiChunkFrames) % uiNumFrames);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Underruns")
+  {
+    // the null backend pulls the frames on its own thread in real time, like a regular device does
+    ma_backend backends[] = {ma_backend_null};
+
+    ma_context context;
+    EZ_TEST_INT(ma_context_init(backends, EZ_ARRAY_SIZE(backends), nullptr, &context), MA_SUCCESS);
+
+    ma_engine_config engineConfig = ma_engine_config_init();
+    engineConfig.pContext = &context;
+    engineConfig.channels = s_uiNumChannels;
+    engineConfig.sampleRate = s_uiSampleRate;
+
+    ma_engine engine;
+    EZ_TEST_INT(ma_engine_init(&engineConfig, &engine), MA_SUCCESS);
+
+    ezMiniAudioStreamingDataSource source;
+    EZ_TEST_BOOL(source.Initialize(pSoundData).Succeeded());
+
+    const ezUInt32 uiPrevTotalUnderruns = ezMiniAudioStreamingDataSource::GetTotalUnderruns();
+
+    ma_sound sound;
+    EZ_TEST_INT(ma_sound_init_from_data_source(&engine, source.GetDataSource(), MA_SOUND_FLAG_NO_SPATIALIZATION | MA_SOUND_FLAG_NO_PITCH, nullptr, &sound), MA_SUCCESS);
+    EZ_TEST_INT(ma_sound_start(&sound), MA_SUCCESS);
+
+    // nothing refills the buffer, so the device runs out of decoded frames after the first chunk
+    const ezTime tTimeout = ezTime::Now() + ezTime::MakeFromSeconds(10);
+    while (source.GetNumUnderruns() == 0 && ezTime::Now() < tTimeout)
+    {
+      ezThreadUtils::Sleep(ezTime::MakeFromMilliseconds(10));
+    }
+
+    EZ_TEST_BOOL(source.GetNumUnderruns() > 0);
+    EZ_TEST_BOOL(ezMiniAudioStreamingDataSource::GetTotalUnderruns() > uiPrevTotalUnderruns);
+
+    // the sound keeps playing silence instead of ending
+    EZ_TEST_BOOL(ma_sound_is_playing(&sound));
+
+    ma_sound_uninit(&sound);
+    ma_engine_uninit(&engine);
+    source.Deinitialize();
+    ma_context_uninit(&context);
+  }
+}
+
+#endif
@@ -0,0 +1,348 @@
+#include <GameEngineTest/GameEngineTestPCH.h>
+
+#include <Foundation/Math/Random.h>
+#include <Foundation/Time/Stopwatch.h>
+#include <Utilities/PathFinding/GraphSearch.h>
+#include <Utilities/PathFinding/GridJumpPointSearch.h>
+
+EZ_CREATE_SIMPLE_TEST_GROUP(PathFinding);
+
+namespace PathFindingTestDetail
+{
+  /// 8-connected grid with the same movement rules as ezGridJumpPointSearch, as a reference for the A* search.
+  class GridStateGenerator : public ezPathStateGenerator<ezPathState>
+  {
+  public:
+    GridStateGenerator(const ezGridJumpPointSearch& grid, ezUInt32 uiSizeX)
+      : m_Grid(grid)
+      , m_uiSizeX(uiSizeX)
+    {
+    }
+
+    virtual void StartSearch(ezInt64 iStartNodeIndex, const ezPathState* pStartState, ezInt64 iTargetNodeIndex) override
+    {
+      EZ_IGNORE_UNUSED(iStartNodeIndex);
+      EZ_IGNORE_UNUSED(pStartState);
+
+      m_vTarget = ToCoord(iTargetNodeIndex);
+    }
+
+    virtual void GenerateAdjacentStates(ezInt64 iNodeIndex, const ezPathState& startState, ezPathSearch<ezPathState>* pPathSearch) override
+    {
+      const ezVec2I32 vCoord = ToCoord(iNodeIndex);
+
+      for (ezInt32 dy = -1; dy <= 1; ++dy)
+      {
+        for (ezInt32 dx = -1; dx <= 1; ++dx)
+        {
+          if (dx == 0 && dy == 0)
+            continue;
+
+          const ezVec2I32 vNext(vCoord.x + dx, vCoord.y + dy);
+          if (m_Grid.IsCellBlocked(vNext))
+            continue;
+
+          const bool bDiagonal = dx != 0 && dy != 0;
+          if (bDiagonal && (m_Grid.IsCellBlocked(ezVec2I32(vCoord.x + dx, vCoord.y)) || m_Grid.IsCellBlocked(ezVec2I32(vCoord.x, vCoord.y + dy))))
+            continue;
+
+          ezPathState state = startState;
+          state.m_fCostToNode += bDiagonal ? ezMath::Sqrt(2.0f) : 1.0f;
+          state.m_fEstimatedCostToTarget = state.m_fCostToNode + OctileDistance(vNext, m_vTarget);
+
+          pPathSearch->AddPathNode(vNext.y * m_uiSizeX + vNext.x, state);
+        }
+      }
+    }
+
+    ezVec2I32 ToCoord(ezInt64 iNodeIndex) const { return ezVec2I32(static_cast<ezInt32>(iNodeIndex % m_uiSizeX), static_cast<ezInt32>(iNodeIndex / m_uiSizeX)); }
+
+    static float OctileDistance(const ezVec2I32& a, const ezVec2I32& b)
+    {
+      const ezInt32 dx = ezMath::Abs(a.x - b.x);
+      const ezInt32 dy = ezMath::Abs(a.y - b.y);
+
+      return (float)ezMath::Max(dx, dy) + (ezMath::Sqrt(2.0f) - 1.0f) * (float)ezMath::Min(dx, dy);
+    }
+
+  private:
+    const ezGridJumpPointSearch& m_Grid;
+    ezUInt32 m_uiSizeX;
+    ezVec2I32 m_vTarget;
+  };
+
+  void FillRandomObstacles(ezGridJumpPointSearch& ref_grid, ezUInt32 uiSize, ezUInt32 uiObstaclePercentage, ezRandom& ref_rng)
+  {
+    ref_grid.CreateGrid(uiSize, uiSize);
+
+    for (ezUInt32 y = 0; y < uiSize; ++y)
+    {
+      for (ezUInt32 x = 0; x < uiSize; ++x)
+      {
+        if (ref_rng.UIntInRange(100) < uiObstaclePercentage)
+        {
+          ref_grid.SetCellBlocked(ezVec2I32(x, y), true);
+        }
+      }
+    }
+  }
+
+  ezVec2I32 RandomFreeCell(const ezGridJumpPointSearch& grid, ezUInt32 uiSize, ezRandom& ref_rng)
+  {
+    while (true)
+    {
+      const ezVec2I32 vCell(ref_rng.UIntInRange(uiSize), ref_rng.UIntInRange(uiSize));
+
+      if (!grid.IsCellBlocked(vCell))
+        return vCell;
+    }
+  }
+
+  /// Checks that consecutive points are connected through straight or diagonal lines of free cells, without cutting corners.
+  bool IsValidJumpPointPath(const ezGridJumpPointSearch& grid, const ezDynamicArray<ezVec2I32>& path, float& out_fLength)
+  {
+    out_fLength = 0.0f;
+
+    for (ezUInt32 i = 1; i < path.GetCount(); ++i)
+    {
+      const ezVec2I32 vDelta = path[i] - path[i - 1];
+      const ezInt32 dx = ezMath::Sign(vDelta.x);
+      const ezInt32 dy = ezMath::Sign(vDelta.y);
+      const ezInt32 iSteps = ezMath::Max(ezMath::Abs(vDelta.x), ezMath::Abs(vDelta.y));
+
+      if (iSteps == 0 || (dx != 0 && dy != 0 && ezMath::Abs(vDelta.x) != ezMath::Abs(vDelta.y)))
+        return false;
+
+      ezVec2I32 vCell = path[i - 1];
+      for (ezInt32 s = 0; s < iSteps; ++s)
+      {
+        if (dx != 0 && dy != 0 && (grid.IsCellBlocked(ezVec2I32(vCell.x + dx, vCell.y)) || grid.IsCellBlocked(ezVec2I32(vCell.x, vCell.y + dy))))
+          return false;
+
+        vCell += ezVec2I32(dx, dy);
+
+        if (grid.IsCellBlocked(vCell))
+          return false;
+      }
+
+      out_fLength += (dx != 0 && dy != 0) ? iSteps * ezMath::Sqrt(2.0f) : (float)iSteps;
+    }
+
+    return true;
+  }
+
+  ezResult FindPathAStar(ezPathSearch<ezPathState>& ref_search, ezUInt32 uiSizeX, const ezVec2I32& vStart, const ezVec2I32& vTarget, float& out_fCost)
+  {
+    ezDeque<ezPathSearch<ezPathState>::PathResultData> path;
+
+    ezPathState startState;
+    startState.m_fEstimatedCostToTarget = GridStateGenerator::OctileDistance(vStart, vTarget);
+
+    if (ref_search.FindPath(vStart.y * uiSizeX + vStart.x, startState, vTarget.y * uiSizeX + vTarget.x, path).Failed())
+      return EZ_FAILURE;
+
+    out_fCost = path.PeekBack().m_pPathState->m_fCostToNode;
+    return EZ_SUCCESS;
+  }
+} // namespace PathFindingTestDetail
+
+EZ_CREATE_SIMPLE_TEST(PathFinding, GridJumpPointSearch)
+{
+  using namespace PathFindingTestDetail;
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Start equals target")
+  {
+    ezGridJumpPointSearch jps;
+    jps.CreateGrid(16, 16);
+
+    ezDynamicArray<ezVec2I32> path;
+    float fCost = -1.0f;
+    EZ_TEST_BOOL(jps.FindPath(ezVec2I32(3, 4), ezVec2I32(3, 4), path, &fCost).Succeeded());
+    EZ_TEST_INT(path.GetCount(), 1);
+    EZ_TEST_BOOL(path[0] == ezVec2I32(3, 4));
+    EZ_TEST_FLOAT(fCost, 0.0f, 0.0f);
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Blocked start / target")
+  {
+    ezGridJumpPointSearch jps;
+    jps.CreateGrid(16, 16);
+    jps.SetCellBlocked(ezVec2I32(5, 5), true);
+
+    ezDynamicArray<ezVec2I32> path;
+    EZ_TEST_BOOL(jps.FindPath(ezVec2I32(5, 5), ezVec2I32(0, 0), path).Failed());
+    EZ_TEST_BOOL(jps.FindPath(ezVec2I32(0, 0), ezVec2I32(5, 5), path).Failed());
+    EZ_TEST_BOOL(jps.FindPath(ezVec2I32(0, 0), ezVec2I32(16, 0), path).Failed());
+    EZ_TEST_BOOL(path.IsEmpty());
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Target unreachable")
+  {
+    // a closed wall around the target, the diagonal gaps at the corners are not passable either
+    ezGridJumpPointSearch jps;
+    jps.CreateGrid(32, 32);
+
+    for (ezInt32 i = 10; i <= 20; ++i)
+    {
+      jps.SetCellBlocked(ezVec2I32(i, 10), true);
+      jps.SetCellBlocked(ezVec2I32(i, 20), true);
+      jps.SetCellBlocked(ezVec2I32(10, i), true);
+      jps.SetCellBlocked(ezVec2I32(20, i), true);
+    }
+
+    ezDynamicArray<ezVec2I32> path;
+    EZ_TEST_BOOL(jps.FindPath(ezVec2I32(0, 0), ezVec2I32(15, 15), path).Failed());
+    EZ_TEST_BOOL(jps.FindPath(ezVec2I32(15, 15), ezVec2I32(31, 31), path).Failed());
+    EZ_TEST_BOOL(jps.FindPath(ezVec2I32(12, 12), ezVec2I32(18, 17), path).Succeeded());
+
+    ezPathSearch<ezPathState> search;
+    GridStateGenerator generator(jps, 32);
+    search.SetPathStateGenerator(&generator);
+
+    float fCost = 0.0f;
+    EZ_TEST_BOOL(FindPathAStar(search, 32, ezVec2I32(0, 0), ezVec2I32(15, 15), fCost).Failed());
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "No corner cutting")
+  {
+    // the only diagonal connection between (4,4) and (5,5) squeezes between two blocked cells
+    ezGridJumpPointSearch jps;
+    jps.CreateGrid(10, 10);
+    jps.SetCellBlocked(ezVec2I32(5, 4), true);
+    jps.SetCellBlocked(ezVec2I32(4, 5), true);
+
+    ezDynamicArray<ezVec2I32> path;
+    float fCost = 0.0f;
+    EZ_TEST_BOOL(jps.FindPath(ezVec2I32(4, 4), ezVec2I32(5, 5), path, &fCost).Succeeded());
+    EZ_TEST_BOOL(fCost > ezMath::Sqrt(2.0f) + 0.01f);
+
+    float fLength = 0.0f;
+    EZ_TEST_BOOL(IsValidJumpPointPath(jps, path, fLength));
+    EZ_TEST_FLOAT(fLength, fCost, 0.001f);
+
+    // with the diagonal closed entirely, there is no way through
+    ezGridJumpPointSearch wall;
+    wall.CreateGrid(10, 10);
+    for (ezInt32 i = 0; i < 10; ++i)
+    {
+      wall.SetCellBlocked(ezVec2I32(i, 9 - i), true);
+    }
+
+    EZ_TEST_BOOL(wall.FindPath(ezVec2I32(0, 0), ezVec2I32(9, 9), path).Failed());
+  }
+
+  EZ_TEST_BLOCK(ezTestBlock::Enabled, "Random grids: JPS vs. A*")
+  {
+    ezRandom rng;
+    rng.Initialize(42);
+
+    const ezUInt32 obstaclePercentages[] = {0, 10, 25, 40};
+
+    for (ezUInt32 uiObstacles : obstaclePercentages)
+    {
+      const ezUInt32 uiSize = 64;
+
+      ezGridJumpPointSearch jps;
+      FillRandomObstacles(jps, uiSize, uiObstacles, rng);
+
+      GridStateGenerator generator(jps, uiSize);
+
+      ezPathSearch<ezPathState> searchHashed;
+      searchHashed.SetPathStateGenerator(&generator);
+
+      ezPathSearch<ezPathState> searchDense;
+      searchDense.SetPathStateGenerator(&generator);
+      searchDense.SetDenseNodeCount(uiSize * uiSize);
+
+      for (ezUInt32 i = 0; i < 50; ++i)
+      {
+        const ezVec2I32 vStart = RandomFreeCell(jps, uiSize, rng);
+        const ezVec2I32 vTarget = RandomFreeCell(jps, uiSize, rng);
+
+        ezDynamicArray<ezVec2I32> path;
+        float fCostJPS = 0.0f;
+        float fCostHashed = 0.0f;
+        float fCostDense = 0.0f;
+
+        const ezResult resJPS = jps.FindPath(vStart, vTarget, path, &fCostJPS);
+        const ezResult resHashed = FindPathAStar(searchHashed, uiSize, vStart, vTarget, fCostHashed);
+        const ezResult resDense = FindPathAStar(searchDense, uiSize, vStart, vTarget, fCostDense);
+
+        EZ_TEST_BOOL(resJPS.Succeeded() == resHashed.Succeeded());
+        EZ_TEST_BOOL(resDense.Succeeded() == resHashed.Succeeded());
+
+        if (resJPS.Succeeded() && resHashed.Succeeded())
+        {
+          EZ_TEST_FLOAT(fCostJPS, fCostHashed, 0.01f);
+          EZ_TEST_FLOAT(fCostDense, fCostHashed, 0.01f);
+
+          EZ_TEST_BOOL(path[0] == vStart);
+          EZ_TEST_BOOL(path.PeekBack() == vTarget);
+
+          float fLength = 0.0f;
+          EZ_TEST_BOOL(IsValidJumpPointPath(jps, path, fLength));
+          EZ_TEST_FLOAT(fLength, fCostJPS, 0.01f);
+        }
+      }
+    }
+  }
+}
+
+#ifndef EZ_PERFORMANCE_TESTS_STATE
+#  define EZ_PERFORMANCE_TESTS_STATE ezTestBlock::DisabledNoWarning
+#endif
+
+EZ_CREATE_SIMPLE_TEST(PathFinding, Performance)
+{
+  using namespace PathFindingTestDetail;
+
+  EZ_TEST_BLOCK(EZ_PERFORMANCE_TESTS_STATE, "JPS vs. A*")
+  {
+    const ezUInt32 gridSizes[] = {256, 1024, 4096};
+    const ezUInt32 uiNumQueries = 20;
+
+    for (ezUInt32 uiSize : gridSizes)
+    {
+      ezRandom rng;
+      rng.Initialize(uiSize);
+
+      ezGridJumpPointSearch jps;
+      FillRandomObstacles(jps, uiSize, 3, rng);
+
+      GridStateGenerator generator(jps, uiSize);
+
+      ezPathSearch<ezPathState> search;
+      search.SetPathStateGenerator(&generator);
+      search.SetDenseNodeCount(uiSize * uiSize);
+
+      ezHybridArray<ezVec2I32, 32> starts;
+      ezHybridArray<ezVec2I32, 32> targets;
+      for (ezUInt32 i = 0; i < uiNumQueries; ++i)
+      {
+        starts.PushBack(RandomFreeCell(jps, uiSize, rng));
+        targets.PushBack(RandomFreeCell(jps, uiSize, rng));
+      }
+
+      ezDynamicArray<ezVec2I32> path;
+      float fCost = 0.0f;
+      ezUInt32 uiFound = 0;
+
+      ezStopwatch sw;
+      for (ezUInt32 i = 0; i < uiNumQueries; ++i)
+      {
+        uiFound += jps.FindPath(starts[i], targets[i], path, &fCost).Succeeded() ? 1 : 0;
+      }
+      const ezTime tJPS = sw.GetRunningTotal();
+
+      sw.StopAndReset();
+      sw.Resume();
+      for (ezUInt32 i = 0; i < uiNumQueries; ++i)
+      {
+        FindPathAStar(search, uiSize, starts[i], targets[i], fCost).IgnoreResult();
+      }
+      const ezTime tAStar = sw.GetRunningTotal();
+
+      ezLog::Info("[test]{0}x{0}, {1} of {2} paths found: JPS {3}ms, A* {4}ms", uiSize, uiFound, uiNumQueries, ezArgF(tJPS.GetMilliseconds(), 2), ezArgF(tAStar.GetMilliseconds(), 2));
+    }
+  }
+}